@@ -0,0 +1,2 @@
+#define HAVE_READLINE 1
+#define GC_TIMING 1
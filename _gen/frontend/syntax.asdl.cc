@@ -0,0 +1,12079 @@
+// _gen/frontend/syntax.asdl.cc is generated by asdl_main.py
+
+#include "_gen/frontend/syntax.asdl.h"
+#include <assert.h>
+#include "prebuilt/asdl/runtime.mycpp.h"  // generated code uses wrappers here
+#include "cpp/asdl_serialize.h"
+
+// Generated code uses these types
+using hnode_asdl::hnode__Record;
+using hnode_asdl::hnode__Array;
+using hnode_asdl::hnode__External;
+using hnode_asdl::hnode__Leaf;
+using hnode_asdl::field;
+using hnode_asdl::color_e;
+
+using id_kind_asdl::Id_str;
+
+namespace syntax_asdl {
+
+GLOBAL_STR(SERIALIZE_FINGERPRINT, "73f2ab321d8d973a");
+
+hnode_t* BoolOutParam::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("BoolOutParam"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = Alloc<hnode__Leaf>(this->b ? runtime::TRUE_STR :
+                                   runtime::FALSE_STR, color_e::OtherConst);
+  L->append(Alloc<field>(StrFromC("b"), x0));
+
+  return out_node;
+}
+
+void BoolOutParam::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, 64)) {
+    return;
+  }
+  enc->Bool(this->b);
+  enc->End(this);
+}
+
+BoolOutParam* BoolOutParam::DecodeFields(serialize::Decoder* dec) {
+  bool x0 = dec->Bool();
+  BoolOutParam* obj = Alloc<BoolOutParam>(x0);
+  return obj;
+}
+
+BoolOutParam* BoolOutParam::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<BoolOutParam*>(dec->Ref());
+  }
+  if (tag != 64) {
+    throw Alloc<ValueError>();
+  }
+  BoolOutParam* obj = DecodeFields(dec);
+  dec->End(obj);
+  return obj;
+}
+const char* parse_result_str(int tag) {
+  switch (tag) {
+  case parse_result_e::EmptyLine:
+    return "parse_result.EmptyLine";
+  case parse_result_e::Eof:
+    return "parse_result.Eof";
+  case parse_result_e::Node:
+    return "parse_result.Node";
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* parse_result__EmptyLine::PrettyTree() {
+  hnode__Record* out_node =
+runtime::NewRecord(StrFromC("parse_result.EmptyLine"));
+  return out_node;
+}
+
+void parse_result__EmptyLine::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, parse_result_e::EmptyLine)) {
+    return;
+  }
+  enc->End(this);
+}
+
+parse_result__EmptyLine*
+parse_result__EmptyLine::DecodeFields(serialize::Decoder* dec) {
+  parse_result__EmptyLine* obj = Alloc<parse_result__EmptyLine>();
+  return obj;
+}
+
+hnode_t* parse_result__Eof::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("parse_result.Eof"));
+  return out_node;
+}
+
+void parse_result__Eof::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, parse_result_e::Eof)) {
+    return;
+  }
+  enc->End(this);
+}
+
+parse_result__Eof* parse_result__Eof::DecodeFields(serialize::Decoder* dec) {
+  parse_result__Eof* obj = Alloc<parse_result__Eof>();
+  return obj;
+}
+
+hnode_t* parse_result__Node::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("parse_result.Node"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->cmd->PrettyTree();
+  L->append(Alloc<field>(StrFromC("cmd"), x0));
+
+  return out_node;
+}
+
+void parse_result__Node::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, parse_result_e::Node)) {
+    return;
+  }
+  enc->Obj(this->cmd);
+  enc->End(this);
+}
+
+parse_result__Node* parse_result__Node::DecodeFields(serialize::Decoder* dec) {
+  command_t* x0 = command_t::Decode(dec);
+  parse_result__Node* obj = Alloc<parse_result__Node>(x0);
+  return obj;
+}
+
+void parse_result_t::Encode(serialize::Encoder* enc) {
+  switch (this->tag_()) {
+  case parse_result_e::EmptyLine:
+    static_cast<parse_result__EmptyLine*>(this)->Encode(enc);
+    break;
+  case parse_result_e::Eof:
+    static_cast<parse_result__Eof*>(this)->Encode(enc);
+    break;
+  case parse_result_e::Node:
+    static_cast<parse_result__Node*>(this)->Encode(enc);
+    break;
+  default:
+    assert(0);
+  }
+}
+
+parse_result_t* parse_result_t::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<parse_result_t*>(dec->Ref());
+  }
+  parse_result_t* obj = nullptr;
+  switch (tag) {
+  case parse_result_e::EmptyLine:
+    obj = parse_result__EmptyLine::DecodeFields(dec);
+    break;
+  case parse_result_e::Eof:
+    obj = parse_result__Eof::DecodeFields(dec);
+    break;
+  case parse_result_e::Node:
+    obj = parse_result__Node::DecodeFields(dec);
+    break;
+  default:
+    throw Alloc<ValueError>();
+  }
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* parse_result_t::PrettyTree() {
+  switch (this->tag_()) {
+  case parse_result_e::EmptyLine: {
+    parse_result__EmptyLine* obj = static_cast<parse_result__EmptyLine*>(this);
+    return obj->PrettyTree();
+  }
+  case parse_result_e::Eof: {
+    parse_result__Eof* obj = static_cast<parse_result__Eof*>(this);
+    return obj->PrettyTree();
+  }
+  case parse_result_e::Node: {
+    parse_result__Node* obj = static_cast<parse_result__Node*>(this);
+    return obj->PrettyTree();
+  }
+  default:
+    assert(0);
+  }
+}
+const char* source_str(int tag) {
+  switch (tag) {
+  case source_e::Interactive:
+    return "source.Interactive";
+  case source_e::Headless:
+    return "source.Headless";
+  case source_e::Unused:
+    return "source.Unused";
+  case source_e::CFlag:
+    return "source.CFlag";
+  case source_e::Stdin:
+    return "source.Stdin";
+  case source_e::MainFile:
+    return "source.MainFile";
+  case source_e::SourcedFile:
+    return "source.SourcedFile";
+  case source_e::ArgvWord:
+    return "source.ArgvWord";
+  case source_e::Variable:
+    return "source.Variable";
+  case source_e::VarRef:
+    return "source.VarRef";
+  case source_e::Alias:
+    return "source.Alias";
+  case source_e::Reparsed:
+    return "source.Reparsed";
+  case source_e::Synthetic:
+    return "source.Synthetic";
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* source__Interactive::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("source.Interactive"));
+  return out_node;
+}
+
+void source__Interactive::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, source_e::Interactive)) {
+    return;
+  }
+  enc->End(this);
+}
+
+source__Interactive* source__Interactive::DecodeFields(serialize::Decoder* dec)
+                                                       {
+  source__Interactive* obj = Alloc<source__Interactive>();
+  return obj;
+}
+
+hnode_t* source__Headless::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("source.Headless"));
+  return out_node;
+}
+
+void source__Headless::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, source_e::Headless)) {
+    return;
+  }
+  enc->End(this);
+}
+
+source__Headless* source__Headless::DecodeFields(serialize::Decoder* dec) {
+  source__Headless* obj = Alloc<source__Headless>();
+  return obj;
+}
+
+hnode_t* source__Unused::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("source.Unused"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = runtime::NewLeaf(this->comment, color_e::StringConst);
+  L->append(Alloc<field>(StrFromC("comment"), x0));
+
+  return out_node;
+}
+
+void source__Unused::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, source_e::Unused)) {
+    return;
+  }
+  enc->Str(this->comment);
+  enc->End(this);
+}
+
+source__Unused* source__Unused::DecodeFields(serialize::Decoder* dec) {
+  Str* x0 = dec->Str();
+  source__Unused* obj = Alloc<source__Unused>(x0);
+  return obj;
+}
+
+hnode_t* source__CFlag::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("source.CFlag"));
+  return out_node;
+}
+
+void source__CFlag::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, source_e::CFlag)) {
+    return;
+  }
+  enc->End(this);
+}
+
+source__CFlag* source__CFlag::DecodeFields(serialize::Decoder* dec) {
+  source__CFlag* obj = Alloc<source__CFlag>();
+  return obj;
+}
+
+hnode_t* source__Stdin::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("source.Stdin"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = runtime::NewLeaf(this->comment, color_e::StringConst);
+  L->append(Alloc<field>(StrFromC("comment"), x0));
+
+  return out_node;
+}
+
+void source__Stdin::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, source_e::Stdin)) {
+    return;
+  }
+  enc->Str(this->comment);
+  enc->End(this);
+}
+
+source__Stdin* source__Stdin::DecodeFields(serialize::Decoder* dec) {
+  Str* x0 = dec->Str();
+  source__Stdin* obj = Alloc<source__Stdin>(x0);
+  return obj;
+}
+
+hnode_t* source__MainFile::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("source.MainFile"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = runtime::NewLeaf(this->path, color_e::StringConst);
+  L->append(Alloc<field>(StrFromC("path"), x0));
+
+  return out_node;
+}
+
+void source__MainFile::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, source_e::MainFile)) {
+    return;
+  }
+  enc->Str(this->path);
+  enc->End(this);
+}
+
+source__MainFile* source__MainFile::DecodeFields(serialize::Decoder* dec) {
+  Str* x0 = dec->Str();
+  source__MainFile* obj = Alloc<source__MainFile>(x0);
+  return obj;
+}
+
+hnode_t* source__SourcedFile::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("source.SourcedFile"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = runtime::NewLeaf(this->path, color_e::StringConst);
+  L->append(Alloc<field>(StrFromC("path"), x0));
+
+  hnode_t* x1 = Alloc<hnode__Leaf>(str(this->spid), color_e::OtherConst);
+  L->append(Alloc<field>(StrFromC("spid"), x1));
+
+  return out_node;
+}
+
+void source__SourcedFile::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, source_e::SourcedFile)) {
+    return;
+  }
+  enc->Str(this->path);
+  enc->SpanId(this->spid);
+  enc->End(this);
+}
+
+source__SourcedFile* source__SourcedFile::DecodeFields(serialize::Decoder* dec)
+                                                       {
+  Str* x0 = dec->Str();
+  int x1 = dec->SpanId();
+  source__SourcedFile* obj = Alloc<source__SourcedFile>(x0, x1);
+  return obj;
+}
+
+hnode_t* source__ArgvWord::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("source.ArgvWord"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = runtime::NewLeaf(this->what, color_e::StringConst);
+  L->append(Alloc<field>(StrFromC("what"), x0));
+
+  hnode_t* x1 = Alloc<hnode__Leaf>(str(this->span_id), color_e::OtherConst);
+  L->append(Alloc<field>(StrFromC("span_id"), x1));
+
+  return out_node;
+}
+
+void source__ArgvWord::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, source_e::ArgvWord)) {
+    return;
+  }
+  enc->Str(this->what);
+  enc->SpanId(this->span_id);
+  enc->End(this);
+}
+
+source__ArgvWord* source__ArgvWord::DecodeFields(serialize::Decoder* dec) {
+  Str* x0 = dec->Str();
+  int x1 = dec->SpanId();
+  source__ArgvWord* obj = Alloc<source__ArgvWord>(x0, x1);
+  return obj;
+}
+
+hnode_t* source__Variable::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("source.Variable"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = runtime::NewLeaf(this->var_name, color_e::StringConst);
+  L->append(Alloc<field>(StrFromC("var_name"), x0));
+
+  hnode_t* x1 = Alloc<hnode__Leaf>(str(this->span_id), color_e::OtherConst);
+  L->append(Alloc<field>(StrFromC("span_id"), x1));
+
+  return out_node;
+}
+
+void source__Variable::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, source_e::Variable)) {
+    return;
+  }
+  enc->Str(this->var_name);
+  enc->SpanId(this->span_id);
+  enc->End(this);
+}
+
+source__Variable* source__Variable::DecodeFields(serialize::Decoder* dec) {
+  Str* x0 = dec->Str();
+  int x1 = dec->SpanId();
+  source__Variable* obj = Alloc<source__Variable>(x0, x1);
+  return obj;
+}
+
+hnode_t* source__VarRef::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("source.VarRef"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->orig_tok->PrettyTree();
+  L->append(Alloc<field>(StrFromC("orig_tok"), x0));
+
+  return out_node;
+}
+
+void source__VarRef::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, source_e::VarRef)) {
+    return;
+  }
+  enc->Obj(this->orig_tok);
+  enc->End(this);
+}
+
+source__VarRef* source__VarRef::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  source__VarRef* obj = Alloc<source__VarRef>(x0);
+  return obj;
+}
+
+hnode_t* source__Alias::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("source.Alias"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = runtime::NewLeaf(this->argv0, color_e::StringConst);
+  L->append(Alloc<field>(StrFromC("argv0"), x0));
+
+  hnode_t* x1 = Alloc<hnode__Leaf>(str(this->argv0_spid), color_e::OtherConst);
+  L->append(Alloc<field>(StrFromC("argv0_spid"), x1));
+
+  return out_node;
+}
+
+void source__Alias::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, source_e::Alias)) {
+    return;
+  }
+  enc->Str(this->argv0);
+  enc->SpanId(this->argv0_spid);
+  enc->End(this);
+}
+
+source__Alias* source__Alias::DecodeFields(serialize::Decoder* dec) {
+  Str* x0 = dec->Str();
+  int x1 = dec->SpanId();
+  source__Alias* obj = Alloc<source__Alias>(x0, x1);
+  return obj;
+}
+
+hnode_t* source__Reparsed::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("source.Reparsed"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = runtime::NewLeaf(this->what, color_e::StringConst);
+  L->append(Alloc<field>(StrFromC("what"), x0));
+
+  hnode_t* x1 = this->left_token->PrettyTree();
+  L->append(Alloc<field>(StrFromC("left_token"), x1));
+
+  hnode_t* x2 = this->right_token->PrettyTree();
+  L->append(Alloc<field>(StrFromC("right_token"), x2));
+
+  return out_node;
+}
+
+void source__Reparsed::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, source_e::Reparsed)) {
+    return;
+  }
+  enc->Str(this->what);
+  enc->Obj(this->left_token);
+  enc->Obj(this->right_token);
+  enc->End(this);
+}
+
+source__Reparsed* source__Reparsed::DecodeFields(serialize::Decoder* dec) {
+  Str* x0 = dec->Str();
+  Token* x1 = Token::Decode(dec);
+  Token* x2 = Token::Decode(dec);
+  source__Reparsed* obj = Alloc<source__Reparsed>(x0, x1, x2);
+  return obj;
+}
+
+hnode_t* source__Synthetic::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("source.Synthetic"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = runtime::NewLeaf(this->s, color_e::StringConst);
+  L->append(Alloc<field>(StrFromC("s"), x0));
+
+  return out_node;
+}
+
+void source__Synthetic::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, source_e::Synthetic)) {
+    return;
+  }
+  enc->Str(this->s);
+  enc->End(this);
+}
+
+source__Synthetic* source__Synthetic::DecodeFields(serialize::Decoder* dec) {
+  Str* x0 = dec->Str();
+  source__Synthetic* obj = Alloc<source__Synthetic>(x0);
+  return obj;
+}
+
+void source_t::Encode(serialize::Encoder* enc) {
+  switch (this->tag_()) {
+  case source_e::Interactive:
+    static_cast<source__Interactive*>(this)->Encode(enc);
+    break;
+  case source_e::Headless:
+    static_cast<source__Headless*>(this)->Encode(enc);
+    break;
+  case source_e::Unused:
+    static_cast<source__Unused*>(this)->Encode(enc);
+    break;
+  case source_e::CFlag:
+    static_cast<source__CFlag*>(this)->Encode(enc);
+    break;
+  case source_e::Stdin:
+    static_cast<source__Stdin*>(this)->Encode(enc);
+    break;
+  case source_e::MainFile:
+    static_cast<source__MainFile*>(this)->Encode(enc);
+    break;
+  case source_e::SourcedFile:
+    static_cast<source__SourcedFile*>(this)->Encode(enc);
+    break;
+  case source_e::ArgvWord:
+    static_cast<source__ArgvWord*>(this)->Encode(enc);
+    break;
+  case source_e::Variable:
+    static_cast<source__Variable*>(this)->Encode(enc);
+    break;
+  case source_e::VarRef:
+    static_cast<source__VarRef*>(this)->Encode(enc);
+    break;
+  case source_e::Alias:
+    static_cast<source__Alias*>(this)->Encode(enc);
+    break;
+  case source_e::Reparsed:
+    static_cast<source__Reparsed*>(this)->Encode(enc);
+    break;
+  case source_e::Synthetic:
+    static_cast<source__Synthetic*>(this)->Encode(enc);
+    break;
+  default:
+    assert(0);
+  }
+}
+
+source_t* source_t::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<source_t*>(dec->Ref());
+  }
+  source_t* obj = nullptr;
+  switch (tag) {
+  case source_e::Interactive:
+    obj = source__Interactive::DecodeFields(dec);
+    break;
+  case source_e::Headless:
+    obj = source__Headless::DecodeFields(dec);
+    break;
+  case source_e::Unused:
+    obj = source__Unused::DecodeFields(dec);
+    break;
+  case source_e::CFlag:
+    obj = source__CFlag::DecodeFields(dec);
+    break;
+  case source_e::Stdin:
+    obj = source__Stdin::DecodeFields(dec);
+    break;
+  case source_e::MainFile:
+    obj = source__MainFile::DecodeFields(dec);
+    break;
+  case source_e::SourcedFile:
+    obj = source__SourcedFile::DecodeFields(dec);
+    break;
+  case source_e::ArgvWord:
+    obj = source__ArgvWord::DecodeFields(dec);
+    break;
+  case source_e::Variable:
+    obj = source__Variable::DecodeFields(dec);
+    break;
+  case source_e::VarRef:
+    obj = source__VarRef::DecodeFields(dec);
+    break;
+  case source_e::Alias:
+    obj = source__Alias::DecodeFields(dec);
+    break;
+  case source_e::Reparsed:
+    obj = source__Reparsed::DecodeFields(dec);
+    break;
+  case source_e::Synthetic:
+    obj = source__Synthetic::DecodeFields(dec);
+    break;
+  default:
+    throw Alloc<ValueError>();
+  }
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* source_t::PrettyTree() {
+  switch (this->tag_()) {
+  case source_e::Interactive: {
+    source__Interactive* obj = static_cast<source__Interactive*>(this);
+    return obj->PrettyTree();
+  }
+  case source_e::Headless: {
+    source__Headless* obj = static_cast<source__Headless*>(this);
+    return obj->PrettyTree();
+  }
+  case source_e::Unused: {
+    source__Unused* obj = static_cast<source__Unused*>(this);
+    return obj->PrettyTree();
+  }
+  case source_e::CFlag: {
+    source__CFlag* obj = static_cast<source__CFlag*>(this);
+    return obj->PrettyTree();
+  }
+  case source_e::Stdin: {
+    source__Stdin* obj = static_cast<source__Stdin*>(this);
+    return obj->PrettyTree();
+  }
+  case source_e::MainFile: {
+    source__MainFile* obj = static_cast<source__MainFile*>(this);
+    return obj->PrettyTree();
+  }
+  case source_e::SourcedFile: {
+    source__SourcedFile* obj = static_cast<source__SourcedFile*>(this);
+    return obj->PrettyTree();
+  }
+  case source_e::ArgvWord: {
+    source__ArgvWord* obj = static_cast<source__ArgvWord*>(this);
+    return obj->PrettyTree();
+  }
+  case source_e::Variable: {
+    source__Variable* obj = static_cast<source__Variable*>(this);
+    return obj->PrettyTree();
+  }
+  case source_e::VarRef: {
+    source__VarRef* obj = static_cast<source__VarRef*>(this);
+    return obj->PrettyTree();
+  }
+  case source_e::Alias: {
+    source__Alias* obj = static_cast<source__Alias*>(this);
+    return obj->PrettyTree();
+  }
+  case source_e::Reparsed: {
+    source__Reparsed* obj = static_cast<source__Reparsed*>(this);
+    return obj->PrettyTree();
+  }
+  case source_e::Synthetic: {
+    source__Synthetic* obj = static_cast<source__Synthetic*>(this);
+    return obj->PrettyTree();
+  }
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* SourceLine::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("SourceLine"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = Alloc<hnode__Leaf>(str(this->line_num), color_e::OtherConst);
+  L->append(Alloc<field>(StrFromC("line_num"), x0));
+
+  hnode_t* x1 = runtime::NewLeaf(this->content, color_e::StringConst);
+  L->append(Alloc<field>(StrFromC("content"), x1));
+
+  hnode_t* x2 = this->src->PrettyTree();
+  L->append(Alloc<field>(StrFromC("src"), x2));
+
+  return out_node;
+}
+
+void SourceLine::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, 65)) {
+    return;
+  }
+  enc->Int(this->line_num);
+  enc->Str(this->content);
+  enc->Obj(this->src);
+  enc->End(this);
+}
+
+SourceLine* SourceLine::DecodeFields(serialize::Decoder* dec) {
+  int x0 = dec->Int();
+  Str* x1 = dec->Str();
+  source_t* x2 = source_t::Decode(dec);
+  SourceLine* obj = Alloc<SourceLine>(x0, x1, x2);
+  return obj;
+}
+
+SourceLine* SourceLine::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<SourceLine*>(dec->Ref());
+  }
+  if (tag != 65) {
+    throw Alloc<ValueError>();
+  }
+  SourceLine* obj = DecodeFields(dec);
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* Token::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("Token"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = Alloc<hnode__Leaf>(StrFromC(Id_str(this->id)),
+                                   color_e::UserType);
+  L->append(Alloc<field>(StrFromC("id"), x0));
+
+  hnode_t* x1 = Alloc<hnode__Leaf>(str(this->col), color_e::OtherConst);
+  L->append(Alloc<field>(StrFromC("col"), x1));
+
+  hnode_t* x2 = Alloc<hnode__Leaf>(str(this->length), color_e::OtherConst);
+  L->append(Alloc<field>(StrFromC("length"), x2));
+
+  hnode_t* x3 = Alloc<hnode__Leaf>(str(this->span_id), color_e::OtherConst);
+  L->append(Alloc<field>(StrFromC("span_id"), x3));
+
+  if (this->line) {  // maybe
+    hnode_t* x4 = this->line->PrettyTree();
+    L->append(Alloc<field>(StrFromC("line"), x4));
+  }
+
+  hnode_t* x5 = runtime::NewLeaf(this->tval, color_e::StringConst);
+  L->append(Alloc<field>(StrFromC("tval"), x5));
+
+  return out_node;
+}
+
+void Token::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, 66)) {
+    return;
+  }
+  enc->Int(this->id);
+  enc->Int(this->col);
+  enc->Int(this->length);
+  enc->SpanId(this->span_id);
+  enc->Obj(this->line);
+  enc->Str(this->tval);
+  enc->End(this);
+}
+
+Token* Token::DecodeFields(serialize::Decoder* dec) {
+  Id_t x0 = dec->Int();
+  int x1 = dec->Int();
+  int x2 = dec->Int();
+  int x3 = dec->SpanId();
+  SourceLine* x4 = SourceLine::Decode(dec);
+  Str* x5 = dec->Str();
+  Token* obj = Alloc<Token>(x0, x1, x2, x3, x4, x5);
+  return obj;
+}
+
+Token* Token::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<Token*>(dec->Ref());
+  }
+  if (tag != 66) {
+    throw Alloc<ValueError>();
+  }
+  Token* obj = DecodeFields(dec);
+  dec->End(obj);
+  return obj;
+}
+const char* loc_str(int tag) {
+  switch (tag) {
+  case loc_e::Missing:
+    return "loc.Missing";
+  case loc_e::Span:
+    return "loc.Span";
+  case loc_e::Token:
+    return "loc.Token";
+  case loc_e::WordPart:
+    return "loc.WordPart";
+  case loc_e::Word:
+    return "loc.Word";
+  case loc_e::Arith:
+    return "loc.Arith";
+  case loc_e::Command:
+    return "loc.Command";
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* loc__Missing::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("loc.Missing"));
+  return out_node;
+}
+
+void loc__Missing::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, loc_e::Missing)) {
+    return;
+  }
+  enc->End(this);
+}
+
+loc__Missing* loc__Missing::DecodeFields(serialize::Decoder* dec) {
+  loc__Missing* obj = Alloc<loc__Missing>();
+  return obj;
+}
+
+hnode_t* loc__Span::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("loc.Span"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = Alloc<hnode__Leaf>(str(this->span_id), color_e::OtherConst);
+  L->append(Alloc<field>(StrFromC("span_id"), x0));
+
+  return out_node;
+}
+
+void loc__Span::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, loc_e::Span)) {
+    return;
+  }
+  enc->SpanId(this->span_id);
+  enc->End(this);
+}
+
+loc__Span* loc__Span::DecodeFields(serialize::Decoder* dec) {
+  int x0 = dec->SpanId();
+  loc__Span* obj = Alloc<loc__Span>(x0);
+  return obj;
+}
+
+hnode_t* loc__WordPart::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("loc.WordPart"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->p->PrettyTree();
+  L->append(Alloc<field>(StrFromC("p"), x0));
+
+  return out_node;
+}
+
+void loc__WordPart::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, loc_e::WordPart)) {
+    return;
+  }
+  enc->Obj(this->p);
+  enc->End(this);
+}
+
+loc__WordPart* loc__WordPart::DecodeFields(serialize::Decoder* dec) {
+  word_part_t* x0 = word_part_t::Decode(dec);
+  loc__WordPart* obj = Alloc<loc__WordPart>(x0);
+  return obj;
+}
+
+hnode_t* loc__Word::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("loc.Word"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->w->PrettyTree();
+  L->append(Alloc<field>(StrFromC("w"), x0));
+
+  return out_node;
+}
+
+void loc__Word::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, loc_e::Word)) {
+    return;
+  }
+  enc->Obj(this->w);
+  enc->End(this);
+}
+
+loc__Word* loc__Word::DecodeFields(serialize::Decoder* dec) {
+  word_t* x0 = word_t::Decode(dec);
+  loc__Word* obj = Alloc<loc__Word>(x0);
+  return obj;
+}
+
+hnode_t* loc__Arith::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("loc.Arith"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->a->PrettyTree();
+  L->append(Alloc<field>(StrFromC("a"), x0));
+
+  return out_node;
+}
+
+void loc__Arith::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, loc_e::Arith)) {
+    return;
+  }
+  enc->Obj(this->a);
+  enc->End(this);
+}
+
+loc__Arith* loc__Arith::DecodeFields(serialize::Decoder* dec) {
+  arith_expr_t* x0 = arith_expr_t::Decode(dec);
+  loc__Arith* obj = Alloc<loc__Arith>(x0);
+  return obj;
+}
+
+hnode_t* loc__Command::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("loc.Command"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->c->PrettyTree();
+  L->append(Alloc<field>(StrFromC("c"), x0));
+
+  return out_node;
+}
+
+void loc__Command::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, loc_e::Command)) {
+    return;
+  }
+  enc->Obj(this->c);
+  enc->End(this);
+}
+
+loc__Command* loc__Command::DecodeFields(serialize::Decoder* dec) {
+  command_t* x0 = command_t::Decode(dec);
+  loc__Command* obj = Alloc<loc__Command>(x0);
+  return obj;
+}
+
+void loc_t::Encode(serialize::Encoder* enc) {
+  switch (this->tag_()) {
+  case loc_e::Missing:
+    static_cast<loc__Missing*>(this)->Encode(enc);
+    break;
+  case loc_e::Span:
+    static_cast<loc__Span*>(this)->Encode(enc);
+    break;
+  case loc_e::Token:
+    static_cast<Token*>(this)->Encode(enc);
+    break;
+  case loc_e::WordPart:
+    static_cast<loc__WordPart*>(this)->Encode(enc);
+    break;
+  case loc_e::Word:
+    static_cast<loc__Word*>(this)->Encode(enc);
+    break;
+  case loc_e::Arith:
+    static_cast<loc__Arith*>(this)->Encode(enc);
+    break;
+  case loc_e::Command:
+    static_cast<loc__Command*>(this)->Encode(enc);
+    break;
+  default:
+    assert(0);
+  }
+}
+
+loc_t* loc_t::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<loc_t*>(dec->Ref());
+  }
+  loc_t* obj = nullptr;
+  switch (tag) {
+  case loc_e::Missing:
+    obj = loc__Missing::DecodeFields(dec);
+    break;
+  case loc_e::Span:
+    obj = loc__Span::DecodeFields(dec);
+    break;
+  case loc_e::Token:
+    obj = Token::DecodeFields(dec);
+    break;
+  case loc_e::WordPart:
+    obj = loc__WordPart::DecodeFields(dec);
+    break;
+  case loc_e::Word:
+    obj = loc__Word::DecodeFields(dec);
+    break;
+  case loc_e::Arith:
+    obj = loc__Arith::DecodeFields(dec);
+    break;
+  case loc_e::Command:
+    obj = loc__Command::DecodeFields(dec);
+    break;
+  default:
+    throw Alloc<ValueError>();
+  }
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* loc_t::PrettyTree() {
+  switch (this->tag_()) {
+  case loc_e::Missing: {
+    loc__Missing* obj = static_cast<loc__Missing*>(this);
+    return obj->PrettyTree();
+  }
+  case loc_e::Span: {
+    loc__Span* obj = static_cast<loc__Span*>(this);
+    return obj->PrettyTree();
+  }
+  case loc_e::Token: {
+    Token* obj = static_cast<Token*>(this);
+    return obj->PrettyTree();
+  }
+  case loc_e::WordPart: {
+    loc__WordPart* obj = static_cast<loc__WordPart*>(this);
+    return obj->PrettyTree();
+  }
+  case loc_e::Word: {
+    loc__Word* obj = static_cast<loc__Word*>(this);
+    return obj->PrettyTree();
+  }
+  case loc_e::Arith: {
+    loc__Arith* obj = static_cast<loc__Arith*>(this);
+    return obj->PrettyTree();
+  }
+  case loc_e::Command: {
+    loc__Command* obj = static_cast<loc__Command*>(this);
+    return obj->PrettyTree();
+  }
+  default:
+    assert(0);
+  }
+}
+const char* bracket_op_str(int tag) {
+  switch (tag) {
+  case bracket_op_e::WholeArray:
+    return "bracket_op.WholeArray";
+  case bracket_op_e::ArrayIndex:
+    return "bracket_op.ArrayIndex";
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* bracket_op__WholeArray::PrettyTree() {
+  hnode__Record* out_node =
+runtime::NewRecord(StrFromC("bracket_op.WholeArray"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = Alloc<hnode__Leaf>(StrFromC(Id_str(this->op_id)),
+                                   color_e::UserType);
+  L->append(Alloc<field>(StrFromC("op_id"), x0));
+
+  return out_node;
+}
+
+void bracket_op__WholeArray::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, bracket_op_e::WholeArray)) {
+    return;
+  }
+  enc->Int(this->op_id);
+  enc->End(this);
+}
+
+bracket_op__WholeArray*
+bracket_op__WholeArray::DecodeFields(serialize::Decoder* dec) {
+  Id_t x0 = dec->Int();
+  bracket_op__WholeArray* obj = Alloc<bracket_op__WholeArray>(x0);
+  return obj;
+}
+
+hnode_t* bracket_op__ArrayIndex::PrettyTree() {
+  hnode__Record* out_node =
+runtime::NewRecord(StrFromC("bracket_op.ArrayIndex"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->expr->PrettyTree();
+  L->append(Alloc<field>(StrFromC("expr"), x0));
+
+  return out_node;
+}
+
+void bracket_op__ArrayIndex::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, bracket_op_e::ArrayIndex)) {
+    return;
+  }
+  enc->Obj(this->expr);
+  enc->End(this);
+}
+
+bracket_op__ArrayIndex*
+bracket_op__ArrayIndex::DecodeFields(serialize::Decoder* dec) {
+  arith_expr_t* x0 = arith_expr_t::Decode(dec);
+  bracket_op__ArrayIndex* obj = Alloc<bracket_op__ArrayIndex>(x0);
+  return obj;
+}
+
+void bracket_op_t::Encode(serialize::Encoder* enc) {
+  switch (this->tag_()) {
+  case bracket_op_e::WholeArray:
+    static_cast<bracket_op__WholeArray*>(this)->Encode(enc);
+    break;
+  case bracket_op_e::ArrayIndex:
+    static_cast<bracket_op__ArrayIndex*>(this)->Encode(enc);
+    break;
+  default:
+    assert(0);
+  }
+}
+
+bracket_op_t* bracket_op_t::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<bracket_op_t*>(dec->Ref());
+  }
+  bracket_op_t* obj = nullptr;
+  switch (tag) {
+  case bracket_op_e::WholeArray:
+    obj = bracket_op__WholeArray::DecodeFields(dec);
+    break;
+  case bracket_op_e::ArrayIndex:
+    obj = bracket_op__ArrayIndex::DecodeFields(dec);
+    break;
+  default:
+    throw Alloc<ValueError>();
+  }
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* bracket_op_t::PrettyTree() {
+  switch (this->tag_()) {
+  case bracket_op_e::WholeArray: {
+    bracket_op__WholeArray* obj = static_cast<bracket_op__WholeArray*>(this);
+    return obj->PrettyTree();
+  }
+  case bracket_op_e::ArrayIndex: {
+    bracket_op__ArrayIndex* obj = static_cast<bracket_op__ArrayIndex*>(this);
+    return obj->PrettyTree();
+  }
+  default:
+    assert(0);
+  }
+}
+const char* suffix_op_str(int tag) {
+  switch (tag) {
+  case suffix_op_e::Nullary:
+    return "suffix_op.Nullary";
+  case suffix_op_e::Unary:
+    return "suffix_op.Unary";
+  case suffix_op_e::Static:
+    return "suffix_op.Static";
+  case suffix_op_e::PatSub:
+    return "suffix_op.PatSub";
+  case suffix_op_e::Slice:
+    return "suffix_op.Slice";
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* suffix_op__Unary::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("suffix_op.Unary"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->op->PrettyTree();
+  L->append(Alloc<field>(StrFromC("op"), x0));
+
+  hnode_t* x1 = this->arg_word->PrettyTree();
+  L->append(Alloc<field>(StrFromC("arg_word"), x1));
+
+  return out_node;
+}
+
+void suffix_op__Unary::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, suffix_op_e::Unary)) {
+    return;
+  }
+  enc->Obj(this->op);
+  enc->Obj(this->arg_word);
+  enc->End(this);
+}
+
+suffix_op__Unary* suffix_op__Unary::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  rhs_word_t* x1 = rhs_word_t::Decode(dec);
+  suffix_op__Unary* obj = Alloc<suffix_op__Unary>(x0, x1);
+  return obj;
+}
+
+hnode_t* suffix_op__Static::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("suffix_op.Static"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->tok->PrettyTree();
+  L->append(Alloc<field>(StrFromC("tok"), x0));
+
+  hnode_t* x1 = runtime::NewLeaf(this->arg, color_e::StringConst);
+  L->append(Alloc<field>(StrFromC("arg"), x1));
+
+  return out_node;
+}
+
+void suffix_op__Static::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, suffix_op_e::Static)) {
+    return;
+  }
+  enc->Obj(this->tok);
+  enc->Str(this->arg);
+  enc->End(this);
+}
+
+suffix_op__Static* suffix_op__Static::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  Str* x1 = dec->Str();
+  suffix_op__Static* obj = Alloc<suffix_op__Static>(x0, x1);
+  return obj;
+}
+
+hnode_t* suffix_op__PatSub::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("suffix_op.PatSub"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->pat->PrettyTree();
+  L->append(Alloc<field>(StrFromC("pat"), x0));
+
+  hnode_t* x1 = this->replace->PrettyTree();
+  L->append(Alloc<field>(StrFromC("replace"), x1));
+
+  hnode_t* x2 = Alloc<hnode__Leaf>(StrFromC(Id_str(this->replace_mode)),
+                                   color_e::UserType);
+  L->append(Alloc<field>(StrFromC("replace_mode"), x2));
+
+  hnode_t* x3 = this->slash_tok->PrettyTree();
+  L->append(Alloc<field>(StrFromC("slash_tok"), x3));
+
+  return out_node;
+}
+
+void suffix_op__PatSub::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, suffix_op_e::PatSub)) {
+    return;
+  }
+  enc->Obj(this->pat);
+  enc->Obj(this->replace);
+  enc->Int(this->replace_mode);
+  enc->Obj(this->slash_tok);
+  enc->End(this);
+}
+
+suffix_op__PatSub* suffix_op__PatSub::DecodeFields(serialize::Decoder* dec) {
+  compound_word* x0 = compound_word::Decode(dec);
+  rhs_word_t* x1 = rhs_word_t::Decode(dec);
+  Id_t x2 = dec->Int();
+  Token* x3 = Token::Decode(dec);
+  suffix_op__PatSub* obj = Alloc<suffix_op__PatSub>(x0, x1, x2, x3);
+  return obj;
+}
+
+hnode_t* suffix_op__Slice::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("suffix_op.Slice"));
+  List<field*>* L = out_node->fields;
+
+  if (this->begin) {  // maybe
+    hnode_t* x0 = this->begin->PrettyTree();
+    L->append(Alloc<field>(StrFromC("begin"), x0));
+  }
+
+  if (this->length) {  // maybe
+    hnode_t* x1 = this->length->PrettyTree();
+    L->append(Alloc<field>(StrFromC("length"), x1));
+  }
+
+  return out_node;
+}
+
+void suffix_op__Slice::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, suffix_op_e::Slice)) {
+    return;
+  }
+  enc->Obj(this->begin);
+  enc->Obj(this->length);
+  enc->End(this);
+}
+
+suffix_op__Slice* suffix_op__Slice::DecodeFields(serialize::Decoder* dec) {
+  arith_expr_t* x0 = arith_expr_t::Decode(dec);
+  arith_expr_t* x1 = arith_expr_t::Decode(dec);
+  suffix_op__Slice* obj = Alloc<suffix_op__Slice>(x0, x1);
+  return obj;
+}
+
+void suffix_op_t::Encode(serialize::Encoder* enc) {
+  switch (this->tag_()) {
+  case suffix_op_e::Nullary:
+    static_cast<Token*>(this)->Encode(enc);
+    break;
+  case suffix_op_e::Unary:
+    static_cast<suffix_op__Unary*>(this)->Encode(enc);
+    break;
+  case suffix_op_e::Static:
+    static_cast<suffix_op__Static*>(this)->Encode(enc);
+    break;
+  case suffix_op_e::PatSub:
+    static_cast<suffix_op__PatSub*>(this)->Encode(enc);
+    break;
+  case suffix_op_e::Slice:
+    static_cast<suffix_op__Slice*>(this)->Encode(enc);
+    break;
+  default:
+    assert(0);
+  }
+}
+
+suffix_op_t* suffix_op_t::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<suffix_op_t*>(dec->Ref());
+  }
+  suffix_op_t* obj = nullptr;
+  switch (tag) {
+  case suffix_op_e::Nullary:
+    obj = Token::DecodeFields(dec);
+    break;
+  case suffix_op_e::Unary:
+    obj = suffix_op__Unary::DecodeFields(dec);
+    break;
+  case suffix_op_e::Static:
+    obj = suffix_op__Static::DecodeFields(dec);
+    break;
+  case suffix_op_e::PatSub:
+    obj = suffix_op__PatSub::DecodeFields(dec);
+    break;
+  case suffix_op_e::Slice:
+    obj = suffix_op__Slice::DecodeFields(dec);
+    break;
+  default:
+    throw Alloc<ValueError>();
+  }
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* suffix_op_t::PrettyTree() {
+  switch (this->tag_()) {
+  case suffix_op_e::Nullary: {
+    Token* obj = static_cast<Token*>(this);
+    return obj->PrettyTree();
+  }
+  case suffix_op_e::Unary: {
+    suffix_op__Unary* obj = static_cast<suffix_op__Unary*>(this);
+    return obj->PrettyTree();
+  }
+  case suffix_op_e::Static: {
+    suffix_op__Static* obj = static_cast<suffix_op__Static*>(this);
+    return obj->PrettyTree();
+  }
+  case suffix_op_e::PatSub: {
+    suffix_op__PatSub* obj = static_cast<suffix_op__PatSub*>(this);
+    return obj->PrettyTree();
+  }
+  case suffix_op_e::Slice: {
+    suffix_op__Slice* obj = static_cast<suffix_op__Slice*>(this);
+    return obj->PrettyTree();
+  }
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* braced_var_sub::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("braced_var_sub"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->left->PrettyTree();
+  L->append(Alloc<field>(StrFromC("left"), x0));
+
+  hnode_t* x1 = this->token->PrettyTree();
+  L->append(Alloc<field>(StrFromC("token"), x1));
+
+  hnode_t* x2 = runtime::NewLeaf(this->var_name, color_e::StringConst);
+  L->append(Alloc<field>(StrFromC("var_name"), x2));
+
+  if (this->prefix_op) {  // maybe
+    hnode_t* x3 = this->prefix_op->PrettyTree();
+    L->append(Alloc<field>(StrFromC("prefix_op"), x3));
+  }
+
+  if (this->bracket_op) {  // maybe
+    hnode_t* x4 = this->bracket_op->PrettyTree();
+    L->append(Alloc<field>(StrFromC("bracket_op"), x4));
+  }
+
+  if (this->suffix_op) {  // maybe
+    hnode_t* x5 = this->suffix_op->PrettyTree();
+    L->append(Alloc<field>(StrFromC("suffix_op"), x5));
+  }
+
+  hnode_t* x6 = this->right->PrettyTree();
+  L->append(Alloc<field>(StrFromC("right"), x6));
+
+  return out_node;
+}
+
+void braced_var_sub::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, 67)) {
+    return;
+  }
+  enc->Obj(this->left);
+  enc->Obj(this->token);
+  enc->Str(this->var_name);
+  enc->Obj(this->prefix_op);
+  enc->Obj(this->bracket_op);
+  enc->Obj(this->suffix_op);
+  enc->Obj(this->right);
+  enc->End(this);
+}
+
+braced_var_sub* braced_var_sub::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  Token* x1 = Token::Decode(dec);
+  Str* x2 = dec->Str();
+  Token* x3 = Token::Decode(dec);
+  bracket_op_t* x4 = bracket_op_t::Decode(dec);
+  suffix_op_t* x5 = suffix_op_t::Decode(dec);
+  Token* x6 = Token::Decode(dec);
+  braced_var_sub* obj = Alloc<braced_var_sub>(x0, x1, x2, x3, x4, x5, x6);
+  return obj;
+}
+
+braced_var_sub* braced_var_sub::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<braced_var_sub*>(dec->Ref());
+  }
+  if (tag != 67) {
+    throw Alloc<ValueError>();
+  }
+  braced_var_sub* obj = DecodeFields(dec);
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* double_quoted::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("double_quoted"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->left->PrettyTree();
+  L->append(Alloc<field>(StrFromC("left"), x0));
+
+  if (this->parts != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<word_part_t*> it(this->parts); !it.Done(); it.Next()) {
+      word_part_t* i1 = it.Value();
+      x1->children->append(i1->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("parts"), x1));
+  }
+
+  hnode_t* x2 = this->right->PrettyTree();
+  L->append(Alloc<field>(StrFromC("right"), x2));
+
+  return out_node;
+}
+
+void double_quoted::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, 68)) {
+    return;
+  }
+  enc->Obj(this->left);
+  if (this->parts == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->parts));
+    for (ListIter<word_part_t*> it(this->parts); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->Obj(this->right);
+  enc->End(this);
+}
+
+double_quoted* double_quoted::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  List<word_part_t*>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<word_part_t*>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(word_part_t::Decode(dec));
+    }
+  }
+  Token* x2 = Token::Decode(dec);
+  double_quoted* obj = Alloc<double_quoted>(x0, x1, x2);
+  return obj;
+}
+
+double_quoted* double_quoted::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<double_quoted*>(dec->Ref());
+  }
+  if (tag != 68) {
+    throw Alloc<ValueError>();
+  }
+  double_quoted* obj = DecodeFields(dec);
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* single_quoted::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("single_quoted"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->left->PrettyTree();
+  L->append(Alloc<field>(StrFromC("left"), x0));
+
+  if (this->tokens != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<Token*> it(this->tokens); !it.Done(); it.Next()) {
+      Token* i1 = it.Value();
+      x1->children->append(i1->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("tokens"), x1));
+  }
+
+  hnode_t* x2 = this->right->PrettyTree();
+  L->append(Alloc<field>(StrFromC("right"), x2));
+
+  return out_node;
+}
+
+void single_quoted::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, 69)) {
+    return;
+  }
+  enc->Obj(this->left);
+  if (this->tokens == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->tokens));
+    for (ListIter<Token*> it(this->tokens); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->Obj(this->right);
+  enc->End(this);
+}
+
+single_quoted* single_quoted::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  List<Token*>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<Token*>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(Token::Decode(dec));
+    }
+  }
+  Token* x2 = Token::Decode(dec);
+  single_quoted* obj = Alloc<single_quoted>(x0, x1, x2);
+  return obj;
+}
+
+single_quoted* single_quoted::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<single_quoted*>(dec->Ref());
+  }
+  if (tag != 69) {
+    throw Alloc<ValueError>();
+  }
+  single_quoted* obj = DecodeFields(dec);
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* simple_var_sub::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("simple_var_sub"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->left->PrettyTree();
+  L->append(Alloc<field>(StrFromC("left"), x0));
+
+  hnode_t* x1 = runtime::NewLeaf(this->var_name, color_e::StringConst);
+  L->append(Alloc<field>(StrFromC("var_name"), x1));
+
+  return out_node;
+}
+
+void simple_var_sub::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, 70)) {
+    return;
+  }
+  enc->Obj(this->left);
+  enc->Str(this->var_name);
+  enc->End(this);
+}
+
+simple_var_sub* simple_var_sub::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  Str* x1 = dec->Str();
+  simple_var_sub* obj = Alloc<simple_var_sub>(x0, x1);
+  return obj;
+}
+
+simple_var_sub* simple_var_sub::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<simple_var_sub*>(dec->Ref());
+  }
+  if (tag != 70) {
+    throw Alloc<ValueError>();
+  }
+  simple_var_sub* obj = DecodeFields(dec);
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* command_sub::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("command_sub"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->left_token->PrettyTree();
+  L->append(Alloc<field>(StrFromC("left_token"), x0));
+
+  hnode_t* x1 = this->child->PrettyTree();
+  L->append(Alloc<field>(StrFromC("child"), x1));
+
+  hnode_t* x2 = this->right->PrettyTree();
+  L->append(Alloc<field>(StrFromC("right"), x2));
+
+  return out_node;
+}
+
+void command_sub::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, 71)) {
+    return;
+  }
+  enc->Obj(this->left_token);
+  enc->Obj(this->child);
+  enc->Obj(this->right);
+  enc->End(this);
+}
+
+command_sub* command_sub::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  command_t* x1 = command_t::Decode(dec);
+  Token* x2 = Token::Decode(dec);
+  command_sub* obj = Alloc<command_sub>(x0, x1, x2);
+  return obj;
+}
+
+command_sub* command_sub::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<command_sub*>(dec->Ref());
+  }
+  if (tag != 71) {
+    throw Alloc<ValueError>();
+  }
+  command_sub* obj = DecodeFields(dec);
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* sh_array_literal::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("sh_array_literal"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->left->PrettyTree();
+  L->append(Alloc<field>(StrFromC("left"), x0));
+
+  if (this->words != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<word_t*> it(this->words); !it.Done(); it.Next()) {
+      word_t* i1 = it.Value();
+      x1->children->append(i1->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("words"), x1));
+  }
+
+  return out_node;
+}
+
+void sh_array_literal::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, 72)) {
+    return;
+  }
+  enc->Obj(this->left);
+  if (this->words == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->words));
+    for (ListIter<word_t*> it(this->words); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+sh_array_literal* sh_array_literal::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  List<word_t*>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<word_t*>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(word_t::Decode(dec));
+    }
+  }
+  sh_array_literal* obj = Alloc<sh_array_literal>(x0, x1);
+  return obj;
+}
+
+sh_array_literal* sh_array_literal::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<sh_array_literal*>(dec->Ref());
+  }
+  if (tag != 72) {
+    throw Alloc<ValueError>();
+  }
+  sh_array_literal* obj = DecodeFields(dec);
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* ArgList::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("ArgList"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->left->PrettyTree();
+  L->append(Alloc<field>(StrFromC("left"), x0));
+
+  if (this->positional != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<expr_t*> it(this->positional); !it.Done(); it.Next()) {
+      expr_t* i1 = it.Value();
+      x1->children->append(i1->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("positional"), x1));
+  }
+
+  if (this->named != nullptr) {  // array
+    hnode__Array* x2 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<named_arg*> it(this->named); !it.Done(); it.Next()) {
+      named_arg* i2 = it.Value();
+      x2->children->append(i2->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("named"), x2));
+  }
+
+  hnode_t* x3 = this->right->PrettyTree();
+  L->append(Alloc<field>(StrFromC("right"), x3));
+
+  return out_node;
+}
+
+void ArgList::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, 73)) {
+    return;
+  }
+  enc->Obj(this->left);
+  if (this->positional == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->positional));
+    for (ListIter<expr_t*> it(this->positional); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  if (this->named == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->named));
+    for (ListIter<named_arg*> it(this->named); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->Obj(this->right);
+  enc->End(this);
+}
+
+ArgList* ArgList::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  List<expr_t*>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<expr_t*>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(expr_t::Decode(dec));
+    }
+  }
+  List<named_arg*>* x2 = nullptr;
+  int n2 = dec->Int();
+  if (n2 >= 0) {
+    x2 = Alloc<List<named_arg*>>();
+    for (int i = 0; i < n2; ++i) {
+      x2->append(named_arg::Decode(dec));
+    }
+  }
+  Token* x3 = Token::Decode(dec);
+  ArgList* obj = Alloc<ArgList>(x0, x1, x2, x3);
+  return obj;
+}
+
+ArgList* ArgList::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<ArgList*>(dec->Ref());
+  }
+  if (tag != 73) {
+    throw Alloc<ValueError>();
+  }
+  ArgList* obj = DecodeFields(dec);
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* assoc_pair::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("assoc_pair"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->key->PrettyTree();
+  L->append(Alloc<field>(StrFromC("key"), x0));
+
+  hnode_t* x1 = this->value->PrettyTree();
+  L->append(Alloc<field>(StrFromC("value"), x1));
+
+  return out_node;
+}
+
+void assoc_pair::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, 74)) {
+    return;
+  }
+  enc->Obj(this->key);
+  enc->Obj(this->value);
+  enc->End(this);
+}
+
+assoc_pair* assoc_pair::DecodeFields(serialize::Decoder* dec) {
+  compound_word* x0 = compound_word::Decode(dec);
+  compound_word* x1 = compound_word::Decode(dec);
+  assoc_pair* obj = Alloc<assoc_pair>(x0, x1);
+  return obj;
+}
+
+assoc_pair* assoc_pair::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<assoc_pair*>(dec->Ref());
+  }
+  if (tag != 74) {
+    throw Alloc<ValueError>();
+  }
+  assoc_pair* obj = DecodeFields(dec);
+  dec->End(obj);
+  return obj;
+}
+const char* word_part_str(int tag) {
+  switch (tag) {
+  case word_part_e::ShArrayLiteral:
+    return "word_part.ShArrayLiteral";
+  case word_part_e::AssocArrayLiteral:
+    return "word_part.AssocArrayLiteral";
+  case word_part_e::Literal:
+    return "word_part.Literal";
+  case word_part_e::EscapedLiteral:
+    return "word_part.EscapedLiteral";
+  case word_part_e::SingleQuoted:
+    return "word_part.SingleQuoted";
+  case word_part_e::DoubleQuoted:
+    return "word_part.DoubleQuoted";
+  case word_part_e::SimpleVarSub:
+    return "word_part.SimpleVarSub";
+  case word_part_e::BracedVarSub:
+    return "word_part.BracedVarSub";
+  case word_part_e::CommandSub:
+    return "word_part.CommandSub";
+  case word_part_e::TildeSub:
+    return "word_part.TildeSub";
+  case word_part_e::ArithSub:
+    return "word_part.ArithSub";
+  case word_part_e::BracedTuple:
+    return "word_part.BracedTuple";
+  case word_part_e::BracedRange:
+    return "word_part.BracedRange";
+  case word_part_e::ExtGlob:
+    return "word_part.ExtGlob";
+  case word_part_e::Splice:
+    return "word_part.Splice";
+  case word_part_e::FuncCall:
+    return "word_part.FuncCall";
+  case word_part_e::ExprSub:
+    return "word_part.ExprSub";
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* word_part__AssocArrayLiteral::PrettyTree() {
+  hnode__Record* out_node =
+runtime::NewRecord(StrFromC("word_part.AssocArrayLiteral"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->left->PrettyTree();
+  L->append(Alloc<field>(StrFromC("left"), x0));
+
+  if (this->pairs != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<assoc_pair*> it(this->pairs); !it.Done(); it.Next()) {
+      assoc_pair* i1 = it.Value();
+      x1->children->append(i1->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("pairs"), x1));
+  }
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x2 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i2 = it.Value();
+      x2->children->append(Alloc<hnode__Leaf>(str(i2), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x2));
+  }
+
+  return out_node;
+}
+
+void word_part__AssocArrayLiteral::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, word_part_e::AssocArrayLiteral)) {
+    return;
+  }
+  enc->Obj(this->left);
+  if (this->pairs == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->pairs));
+    for (ListIter<assoc_pair*> it(this->pairs); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+word_part__AssocArrayLiteral*
+word_part__AssocArrayLiteral::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  List<assoc_pair*>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<assoc_pair*>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(assoc_pair::Decode(dec));
+    }
+  }
+  List<int>* x2 = nullptr;
+  int n2 = dec->Int();
+  if (n2 >= 0) {
+    x2 = Alloc<List<int>>();
+    for (int i = 0; i < n2; ++i) {
+      x2->append(dec->SpanId());
+    }
+  }
+  word_part__AssocArrayLiteral* obj = Alloc<word_part__AssocArrayLiteral>(x0,
+                                                                          x1);
+  obj->spids = x2;
+  return obj;
+}
+
+hnode_t* word_part__EscapedLiteral::PrettyTree() {
+  hnode__Record* out_node =
+runtime::NewRecord(StrFromC("word_part.EscapedLiteral"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->token->PrettyTree();
+  L->append(Alloc<field>(StrFromC("token"), x0));
+
+  hnode_t* x1 = runtime::NewLeaf(this->ch, color_e::StringConst);
+  L->append(Alloc<field>(StrFromC("ch"), x1));
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x2 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i2 = it.Value();
+      x2->children->append(Alloc<hnode__Leaf>(str(i2), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x2));
+  }
+
+  return out_node;
+}
+
+void word_part__EscapedLiteral::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, word_part_e::EscapedLiteral)) {
+    return;
+  }
+  enc->Obj(this->token);
+  enc->Str(this->ch);
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+word_part__EscapedLiteral*
+word_part__EscapedLiteral::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  Str* x1 = dec->Str();
+  List<int>* x2 = nullptr;
+  int n2 = dec->Int();
+  if (n2 >= 0) {
+    x2 = Alloc<List<int>>();
+    for (int i = 0; i < n2; ++i) {
+      x2->append(dec->SpanId());
+    }
+  }
+  word_part__EscapedLiteral* obj = Alloc<word_part__EscapedLiteral>(x0, x1);
+  obj->spids = x2;
+  return obj;
+}
+
+hnode_t* word_part__TildeSub::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("word_part.TildeSub"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->token->PrettyTree();
+  L->append(Alloc<field>(StrFromC("token"), x0));
+
+  if (this->user_name) {  // maybe
+    hnode_t* x1 = runtime::NewLeaf(this->user_name, color_e::StringConst);
+    L->append(Alloc<field>(StrFromC("user_name"), x1));
+  }
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x2 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i2 = it.Value();
+      x2->children->append(Alloc<hnode__Leaf>(str(i2), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x2));
+  }
+
+  return out_node;
+}
+
+void word_part__TildeSub::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, word_part_e::TildeSub)) {
+    return;
+  }
+  enc->Obj(this->token);
+  enc->Str(this->user_name);
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+word_part__TildeSub* word_part__TildeSub::DecodeFields(serialize::Decoder* dec)
+                                                       {
+  Token* x0 = Token::Decode(dec);
+  Str* x1 = dec->Str();
+  List<int>* x2 = nullptr;
+  int n2 = dec->Int();
+  if (n2 >= 0) {
+    x2 = Alloc<List<int>>();
+    for (int i = 0; i < n2; ++i) {
+      x2->append(dec->SpanId());
+    }
+  }
+  word_part__TildeSub* obj = Alloc<word_part__TildeSub>(x0, x1);
+  obj->spids = x2;
+  return obj;
+}
+
+hnode_t* word_part__ArithSub::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("word_part.ArithSub"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->anode->PrettyTree();
+  L->append(Alloc<field>(StrFromC("anode"), x0));
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i1 = it.Value();
+      x1->children->append(Alloc<hnode__Leaf>(str(i1), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x1));
+  }
+
+  return out_node;
+}
+
+void word_part__ArithSub::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, word_part_e::ArithSub)) {
+    return;
+  }
+  enc->Obj(this->anode);
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+word_part__ArithSub* word_part__ArithSub::DecodeFields(serialize::Decoder* dec)
+                                                       {
+  arith_expr_t* x0 = arith_expr_t::Decode(dec);
+  List<int>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<int>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(dec->SpanId());
+    }
+  }
+  word_part__ArithSub* obj = Alloc<word_part__ArithSub>(x0);
+  obj->spids = x1;
+  return obj;
+}
+
+hnode_t* word_part__BracedTuple::PrettyTree() {
+  hnode__Record* out_node =
+runtime::NewRecord(StrFromC("word_part.BracedTuple"));
+  List<field*>* L = out_node->fields;
+
+  if (this->words != nullptr) {  // array
+    hnode__Array* x0 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<compound_word*> it(this->words); !it.Done(); it.Next()) {
+      compound_word* i0 = it.Value();
+      x0->children->append(i0->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("words"), x0));
+  }
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i1 = it.Value();
+      x1->children->append(Alloc<hnode__Leaf>(str(i1), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x1));
+  }
+
+  return out_node;
+}
+
+void word_part__BracedTuple::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, word_part_e::BracedTuple)) {
+    return;
+  }
+  if (this->words == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->words));
+    for (ListIter<compound_word*> it(this->words); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+word_part__BracedTuple*
+word_part__BracedTuple::DecodeFields(serialize::Decoder* dec) {
+  List<compound_word*>* x0 = nullptr;
+  int n0 = dec->Int();
+  if (n0 >= 0) {
+    x0 = Alloc<List<compound_word*>>();
+    for (int i = 0; i < n0; ++i) {
+      x0->append(compound_word::Decode(dec));
+    }
+  }
+  List<int>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<int>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(dec->SpanId());
+    }
+  }
+  word_part__BracedTuple* obj = Alloc<word_part__BracedTuple>(x0);
+  obj->spids = x1;
+  return obj;
+}
+
+hnode_t* word_part__BracedRange::PrettyTree() {
+  hnode__Record* out_node =
+runtime::NewRecord(StrFromC("word_part.BracedRange"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = Alloc<hnode__Leaf>(StrFromC(Id_str(this->kind)),
+                                   color_e::UserType);
+  L->append(Alloc<field>(StrFromC("kind"), x0));
+
+  hnode_t* x1 = runtime::NewLeaf(this->start, color_e::StringConst);
+  L->append(Alloc<field>(StrFromC("start"), x1));
+
+  hnode_t* x2 = runtime::NewLeaf(this->end, color_e::StringConst);
+  L->append(Alloc<field>(StrFromC("end"), x2));
+
+  hnode_t* x3 = Alloc<hnode__Leaf>(str(this->step), color_e::OtherConst);
+  L->append(Alloc<field>(StrFromC("step"), x3));
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x4 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i4 = it.Value();
+      x4->children->append(Alloc<hnode__Leaf>(str(i4), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x4));
+  }
+
+  return out_node;
+}
+
+void word_part__BracedRange::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, word_part_e::BracedRange)) {
+    return;
+  }
+  enc->Int(this->kind);
+  enc->Str(this->start);
+  enc->Str(this->end);
+  enc->Int(this->step);
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+word_part__BracedRange*
+word_part__BracedRange::DecodeFields(serialize::Decoder* dec) {
+  Id_t x0 = dec->Int();
+  Str* x1 = dec->Str();
+  Str* x2 = dec->Str();
+  int x3 = dec->Int();
+  List<int>* x4 = nullptr;
+  int n4 = dec->Int();
+  if (n4 >= 0) {
+    x4 = Alloc<List<int>>();
+    for (int i = 0; i < n4; ++i) {
+      x4->append(dec->SpanId());
+    }
+  }
+  word_part__BracedRange* obj = Alloc<word_part__BracedRange>(x0, x1, x2, x3);
+  obj->spids = x4;
+  return obj;
+}
+
+hnode_t* word_part__ExtGlob::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("word_part.ExtGlob"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->op->PrettyTree();
+  L->append(Alloc<field>(StrFromC("op"), x0));
+
+  if (this->arms != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<compound_word*> it(this->arms); !it.Done(); it.Next()) {
+      compound_word* i1 = it.Value();
+      x1->children->append(i1->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("arms"), x1));
+  }
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x2 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i2 = it.Value();
+      x2->children->append(Alloc<hnode__Leaf>(str(i2), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x2));
+  }
+
+  return out_node;
+}
+
+void word_part__ExtGlob::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, word_part_e::ExtGlob)) {
+    return;
+  }
+  enc->Obj(this->op);
+  if (this->arms == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->arms));
+    for (ListIter<compound_word*> it(this->arms); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+word_part__ExtGlob* word_part__ExtGlob::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  List<compound_word*>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<compound_word*>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(compound_word::Decode(dec));
+    }
+  }
+  List<int>* x2 = nullptr;
+  int n2 = dec->Int();
+  if (n2 >= 0) {
+    x2 = Alloc<List<int>>();
+    for (int i = 0; i < n2; ++i) {
+      x2->append(dec->SpanId());
+    }
+  }
+  word_part__ExtGlob* obj = Alloc<word_part__ExtGlob>(x0, x1);
+  obj->spids = x2;
+  return obj;
+}
+
+hnode_t* word_part__Splice::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("word_part.Splice"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->name->PrettyTree();
+  L->append(Alloc<field>(StrFromC("name"), x0));
+
+  hnode_t* x1 = runtime::NewLeaf(this->var_name, color_e::StringConst);
+  L->append(Alloc<field>(StrFromC("var_name"), x1));
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x2 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i2 = it.Value();
+      x2->children->append(Alloc<hnode__Leaf>(str(i2), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x2));
+  }
+
+  return out_node;
+}
+
+void word_part__Splice::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, word_part_e::Splice)) {
+    return;
+  }
+  enc->Obj(this->name);
+  enc->Str(this->var_name);
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+word_part__Splice* word_part__Splice::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  Str* x1 = dec->Str();
+  List<int>* x2 = nullptr;
+  int n2 = dec->Int();
+  if (n2 >= 0) {
+    x2 = Alloc<List<int>>();
+    for (int i = 0; i < n2; ++i) {
+      x2->append(dec->SpanId());
+    }
+  }
+  word_part__Splice* obj = Alloc<word_part__Splice>(x0, x1);
+  obj->spids = x2;
+  return obj;
+}
+
+hnode_t* word_part__FuncCall::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("word_part.FuncCall"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->name->PrettyTree();
+  L->append(Alloc<field>(StrFromC("name"), x0));
+
+  hnode_t* x1 = this->args->PrettyTree();
+  L->append(Alloc<field>(StrFromC("args"), x1));
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x2 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i2 = it.Value();
+      x2->children->append(Alloc<hnode__Leaf>(str(i2), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x2));
+  }
+
+  return out_node;
+}
+
+void word_part__FuncCall::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, word_part_e::FuncCall)) {
+    return;
+  }
+  enc->Obj(this->name);
+  enc->Obj(this->args);
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+word_part__FuncCall* word_part__FuncCall::DecodeFields(serialize::Decoder* dec)
+                                                       {
+  Token* x0 = Token::Decode(dec);
+  ArgList* x1 = ArgList::Decode(dec);
+  List<int>* x2 = nullptr;
+  int n2 = dec->Int();
+  if (n2 >= 0) {
+    x2 = Alloc<List<int>>();
+    for (int i = 0; i < n2; ++i) {
+      x2->append(dec->SpanId());
+    }
+  }
+  word_part__FuncCall* obj = Alloc<word_part__FuncCall>(x0, x1);
+  obj->spids = x2;
+  return obj;
+}
+
+hnode_t* word_part__ExprSub::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("word_part.ExprSub"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->left->PrettyTree();
+  L->append(Alloc<field>(StrFromC("left"), x0));
+
+  hnode_t* x1 = this->child->PrettyTree();
+  L->append(Alloc<field>(StrFromC("child"), x1));
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x2 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i2 = it.Value();
+      x2->children->append(Alloc<hnode__Leaf>(str(i2), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x2));
+  }
+
+  return out_node;
+}
+
+void word_part__ExprSub::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, word_part_e::ExprSub)) {
+    return;
+  }
+  enc->Obj(this->left);
+  enc->Obj(this->child);
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+word_part__ExprSub* word_part__ExprSub::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  expr_t* x1 = expr_t::Decode(dec);
+  List<int>* x2 = nullptr;
+  int n2 = dec->Int();
+  if (n2 >= 0) {
+    x2 = Alloc<List<int>>();
+    for (int i = 0; i < n2; ++i) {
+      x2->append(dec->SpanId());
+    }
+  }
+  word_part__ExprSub* obj = Alloc<word_part__ExprSub>(x0, x1);
+  obj->spids = x2;
+  return obj;
+}
+
+void word_part_t::Encode(serialize::Encoder* enc) {
+  switch (this->tag_()) {
+  case word_part_e::ShArrayLiteral:
+    static_cast<sh_array_literal*>(this)->Encode(enc);
+    break;
+  case word_part_e::AssocArrayLiteral:
+    static_cast<word_part__AssocArrayLiteral*>(this)->Encode(enc);
+    break;
+  case word_part_e::Literal:
+    static_cast<Token*>(this)->Encode(enc);
+    break;
+  case word_part_e::EscapedLiteral:
+    static_cast<word_part__EscapedLiteral*>(this)->Encode(enc);
+    break;
+  case word_part_e::SingleQuoted:
+    static_cast<single_quoted*>(this)->Encode(enc);
+    break;
+  case word_part_e::DoubleQuoted:
+    static_cast<double_quoted*>(this)->Encode(enc);
+    break;
+  case word_part_e::SimpleVarSub:
+    static_cast<simple_var_sub*>(this)->Encode(enc);
+    break;
+  case word_part_e::BracedVarSub:
+    static_cast<braced_var_sub*>(this)->Encode(enc);
+    break;
+  case word_part_e::CommandSub:
+    static_cast<command_sub*>(this)->Encode(enc);
+    break;
+  case word_part_e::TildeSub:
+    static_cast<word_part__TildeSub*>(this)->Encode(enc);
+    break;
+  case word_part_e::ArithSub:
+    static_cast<word_part__ArithSub*>(this)->Encode(enc);
+    break;
+  case word_part_e::BracedTuple:
+    static_cast<word_part__BracedTuple*>(this)->Encode(enc);
+    break;
+  case word_part_e::BracedRange:
+    static_cast<word_part__BracedRange*>(this)->Encode(enc);
+    break;
+  case word_part_e::ExtGlob:
+    static_cast<word_part__ExtGlob*>(this)->Encode(enc);
+    break;
+  case word_part_e::Splice:
+    static_cast<word_part__Splice*>(this)->Encode(enc);
+    break;
+  case word_part_e::FuncCall:
+    static_cast<word_part__FuncCall*>(this)->Encode(enc);
+    break;
+  case word_part_e::ExprSub:
+    static_cast<word_part__ExprSub*>(this)->Encode(enc);
+    break;
+  default:
+    assert(0);
+  }
+}
+
+word_part_t* word_part_t::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<word_part_t*>(dec->Ref());
+  }
+  word_part_t* obj = nullptr;
+  switch (tag) {
+  case word_part_e::ShArrayLiteral:
+    obj = sh_array_literal::DecodeFields(dec);
+    break;
+  case word_part_e::AssocArrayLiteral:
+    obj = word_part__AssocArrayLiteral::DecodeFields(dec);
+    break;
+  case word_part_e::Literal:
+    obj = Token::DecodeFields(dec);
+    break;
+  case word_part_e::EscapedLiteral:
+    obj = word_part__EscapedLiteral::DecodeFields(dec);
+    break;
+  case word_part_e::SingleQuoted:
+    obj = single_quoted::DecodeFields(dec);
+    break;
+  case word_part_e::DoubleQuoted:
+    obj = double_quoted::DecodeFields(dec);
+    break;
+  case word_part_e::SimpleVarSub:
+    obj = simple_var_sub::DecodeFields(dec);
+    break;
+  case word_part_e::BracedVarSub:
+    obj = braced_var_sub::DecodeFields(dec);
+    break;
+  case word_part_e::CommandSub:
+    obj = command_sub::DecodeFields(dec);
+    break;
+  case word_part_e::TildeSub:
+    obj = word_part__TildeSub::DecodeFields(dec);
+    break;
+  case word_part_e::ArithSub:
+    obj = word_part__ArithSub::DecodeFields(dec);
+    break;
+  case word_part_e::BracedTuple:
+    obj = word_part__BracedTuple::DecodeFields(dec);
+    break;
+  case word_part_e::BracedRange:
+    obj = word_part__BracedRange::DecodeFields(dec);
+    break;
+  case word_part_e::ExtGlob:
+    obj = word_part__ExtGlob::DecodeFields(dec);
+    break;
+  case word_part_e::Splice:
+    obj = word_part__Splice::DecodeFields(dec);
+    break;
+  case word_part_e::FuncCall:
+    obj = word_part__FuncCall::DecodeFields(dec);
+    break;
+  case word_part_e::ExprSub:
+    obj = word_part__ExprSub::DecodeFields(dec);
+    break;
+  default:
+    throw Alloc<ValueError>();
+  }
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* word_part_t::PrettyTree() {
+  switch (this->tag_()) {
+  case word_part_e::ShArrayLiteral: {
+    sh_array_literal* obj = static_cast<sh_array_literal*>(this);
+    return obj->PrettyTree();
+  }
+  case word_part_e::AssocArrayLiteral: {
+    word_part__AssocArrayLiteral* obj =
+static_cast<word_part__AssocArrayLiteral*>(this);
+    return obj->PrettyTree();
+  }
+  case word_part_e::Literal: {
+    Token* obj = static_cast<Token*>(this);
+    return obj->PrettyTree();
+  }
+  case word_part_e::EscapedLiteral: {
+    word_part__EscapedLiteral* obj =
+static_cast<word_part__EscapedLiteral*>(this);
+    return obj->PrettyTree();
+  }
+  case word_part_e::SingleQuoted: {
+    single_quoted* obj = static_cast<single_quoted*>(this);
+    return obj->PrettyTree();
+  }
+  case word_part_e::DoubleQuoted: {
+    double_quoted* obj = static_cast<double_quoted*>(this);
+    return obj->PrettyTree();
+  }
+  case word_part_e::SimpleVarSub: {
+    simple_var_sub* obj = static_cast<simple_var_sub*>(this);
+    return obj->PrettyTree();
+  }
+  case word_part_e::BracedVarSub: {
+    braced_var_sub* obj = static_cast<braced_var_sub*>(this);
+    return obj->PrettyTree();
+  }
+  case word_part_e::CommandSub: {
+    command_sub* obj = static_cast<command_sub*>(this);
+    return obj->PrettyTree();
+  }
+  case word_part_e::TildeSub: {
+    word_part__TildeSub* obj = static_cast<word_part__TildeSub*>(this);
+    return obj->PrettyTree();
+  }
+  case word_part_e::ArithSub: {
+    word_part__ArithSub* obj = static_cast<word_part__ArithSub*>(this);
+    return obj->PrettyTree();
+  }
+  case word_part_e::BracedTuple: {
+    word_part__BracedTuple* obj = static_cast<word_part__BracedTuple*>(this);
+    return obj->PrettyTree();
+  }
+  case word_part_e::BracedRange: {
+    word_part__BracedRange* obj = static_cast<word_part__BracedRange*>(this);
+    return obj->PrettyTree();
+  }
+  case word_part_e::ExtGlob: {
+    word_part__ExtGlob* obj = static_cast<word_part__ExtGlob*>(this);
+    return obj->PrettyTree();
+  }
+  case word_part_e::Splice: {
+    word_part__Splice* obj = static_cast<word_part__Splice*>(this);
+    return obj->PrettyTree();
+  }
+  case word_part_e::FuncCall: {
+    word_part__FuncCall* obj = static_cast<word_part__FuncCall*>(this);
+    return obj->PrettyTree();
+  }
+  case word_part_e::ExprSub: {
+    word_part__ExprSub* obj = static_cast<word_part__ExprSub*>(this);
+    return obj->PrettyTree();
+  }
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* compound_word::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("compound_word"));
+  List<field*>* L = out_node->fields;
+
+  if (this->parts != nullptr) {  // array
+    hnode__Array* x0 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<word_part_t*> it(this->parts); !it.Done(); it.Next()) {
+      word_part_t* i0 = it.Value();
+      x0->children->append(i0->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("parts"), x0));
+  }
+
+  return out_node;
+}
+
+void compound_word::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, 75)) {
+    return;
+  }
+  if (this->parts == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->parts));
+    for (ListIter<word_part_t*> it(this->parts); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+compound_word* compound_word::DecodeFields(serialize::Decoder* dec) {
+  List<word_part_t*>* x0 = nullptr;
+  int n0 = dec->Int();
+  if (n0 >= 0) {
+    x0 = Alloc<List<word_part_t*>>();
+    for (int i = 0; i < n0; ++i) {
+      x0->append(word_part_t::Decode(dec));
+    }
+  }
+  compound_word* obj = Alloc<compound_word>(x0);
+  return obj;
+}
+
+compound_word* compound_word::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<compound_word*>(dec->Ref());
+  }
+  if (tag != 75) {
+    throw Alloc<ValueError>();
+  }
+  compound_word* obj = DecodeFields(dec);
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* string_line::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("string_line"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = Alloc<hnode__Leaf>(str(this->dedent), color_e::OtherConst);
+  L->append(Alloc<field>(StrFromC("dedent"), x0));
+
+  if (this->part != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<word_part_t*> it(this->part); !it.Done(); it.Next()) {
+      word_part_t* i1 = it.Value();
+      x1->children->append(i1->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("part"), x1));
+  }
+
+  return out_node;
+}
+
+void string_line::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, 76)) {
+    return;
+  }
+  enc->Int(this->dedent);
+  if (this->part == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->part));
+    for (ListIter<word_part_t*> it(this->part); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+string_line* string_line::DecodeFields(serialize::Decoder* dec) {
+  int x0 = dec->Int();
+  List<word_part_t*>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<word_part_t*>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(word_part_t::Decode(dec));
+    }
+  }
+  string_line* obj = Alloc<string_line>(x0, x1);
+  return obj;
+}
+
+string_line* string_line::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<string_line*>(dec->Ref());
+  }
+  if (tag != 76) {
+    throw Alloc<ValueError>();
+  }
+  string_line* obj = DecodeFields(dec);
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* triple_quoted::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("triple_quoted"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = Alloc<hnode__Leaf>(str(this->min_dedent), color_e::OtherConst);
+  L->append(Alloc<field>(StrFromC("min_dedent"), x0));
+
+  if (this->lines != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<string_line*> it(this->lines); !it.Done(); it.Next()) {
+      string_line* i1 = it.Value();
+      x1->children->append(i1->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("lines"), x1));
+  }
+
+  return out_node;
+}
+
+void triple_quoted::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, 77)) {
+    return;
+  }
+  enc->Int(this->min_dedent);
+  if (this->lines == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->lines));
+    for (ListIter<string_line*> it(this->lines); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+triple_quoted* triple_quoted::DecodeFields(serialize::Decoder* dec) {
+  int x0 = dec->Int();
+  List<string_line*>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<string_line*>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(string_line::Decode(dec));
+    }
+  }
+  triple_quoted* obj = Alloc<triple_quoted>(x0, x1);
+  return obj;
+}
+
+triple_quoted* triple_quoted::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<triple_quoted*>(dec->Ref());
+  }
+  if (tag != 77) {
+    throw Alloc<ValueError>();
+  }
+  triple_quoted* obj = DecodeFields(dec);
+  dec->End(obj);
+  return obj;
+}
+const char* rhs_word_str(int tag) {
+  switch (tag) {
+  case rhs_word_e::Empty:
+    return "rhs_word.Empty";
+  case rhs_word_e::Compound:
+    return "rhs_word.Compound";
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* rhs_word__Empty::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("rhs_word.Empty"));
+  return out_node;
+}
+
+void rhs_word__Empty::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, rhs_word_e::Empty)) {
+    return;
+  }
+  enc->End(this);
+}
+
+rhs_word__Empty* rhs_word__Empty::DecodeFields(serialize::Decoder* dec) {
+  rhs_word__Empty* obj = Alloc<rhs_word__Empty>();
+  return obj;
+}
+
+void rhs_word_t::Encode(serialize::Encoder* enc) {
+  switch (this->tag_()) {
+  case rhs_word_e::Empty:
+    static_cast<rhs_word__Empty*>(this)->Encode(enc);
+    break;
+  case rhs_word_e::Compound:
+    static_cast<compound_word*>(this)->Encode(enc);
+    break;
+  default:
+    assert(0);
+  }
+}
+
+rhs_word_t* rhs_word_t::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<rhs_word_t*>(dec->Ref());
+  }
+  rhs_word_t* obj = nullptr;
+  switch (tag) {
+  case rhs_word_e::Empty:
+    obj = rhs_word__Empty::DecodeFields(dec);
+    break;
+  case rhs_word_e::Compound:
+    obj = compound_word::DecodeFields(dec);
+    break;
+  default:
+    throw Alloc<ValueError>();
+  }
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* rhs_word_t::PrettyTree() {
+  switch (this->tag_()) {
+  case rhs_word_e::Empty: {
+    rhs_word__Empty* obj = static_cast<rhs_word__Empty*>(this);
+    return obj->PrettyTree();
+  }
+  case rhs_word_e::Compound: {
+    compound_word* obj = static_cast<compound_word*>(this);
+    return obj->PrettyTree();
+  }
+  default:
+    assert(0);
+  }
+}
+const char* word_str(int tag) {
+  switch (tag) {
+  case word_e::Token:
+    return "word.Token";
+  case word_e::Compound:
+    return "word.Compound";
+  case word_e::BracedTree:
+    return "word.BracedTree";
+  case word_e::String:
+    return "word.String";
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* word__BracedTree::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("word.BracedTree"));
+  List<field*>* L = out_node->fields;
+
+  if (this->parts != nullptr) {  // array
+    hnode__Array* x0 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<word_part_t*> it(this->parts); !it.Done(); it.Next()) {
+      word_part_t* i0 = it.Value();
+      x0->children->append(i0->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("parts"), x0));
+  }
+
+  return out_node;
+}
+
+void word__BracedTree::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, word_e::BracedTree)) {
+    return;
+  }
+  if (this->parts == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->parts));
+    for (ListIter<word_part_t*> it(this->parts); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+word__BracedTree* word__BracedTree::DecodeFields(serialize::Decoder* dec) {
+  List<word_part_t*>* x0 = nullptr;
+  int n0 = dec->Int();
+  if (n0 >= 0) {
+    x0 = Alloc<List<word_part_t*>>();
+    for (int i = 0; i < n0; ++i) {
+      x0->append(word_part_t::Decode(dec));
+    }
+  }
+  word__BracedTree* obj = Alloc<word__BracedTree>(x0);
+  return obj;
+}
+
+hnode_t* word__String::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("word.String"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = Alloc<hnode__Leaf>(StrFromC(Id_str(this->id)),
+                                   color_e::UserType);
+  L->append(Alloc<field>(StrFromC("id"), x0));
+
+  hnode_t* x1 = runtime::NewLeaf(this->s, color_e::StringConst);
+  L->append(Alloc<field>(StrFromC("s"), x1));
+
+  hnode_t* x2 = Alloc<hnode__Leaf>(str(this->span_id), color_e::OtherConst);
+  L->append(Alloc<field>(StrFromC("span_id"), x2));
+
+  return out_node;
+}
+
+void word__String::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, word_e::String)) {
+    return;
+  }
+  enc->Int(this->id);
+  enc->Str(this->s);
+  enc->SpanId(this->span_id);
+  enc->End(this);
+}
+
+word__String* word__String::DecodeFields(serialize::Decoder* dec) {
+  Id_t x0 = dec->Int();
+  Str* x1 = dec->Str();
+  int x2 = dec->SpanId();
+  word__String* obj = Alloc<word__String>(x0, x1, x2);
+  return obj;
+}
+
+void word_t::Encode(serialize::Encoder* enc) {
+  switch (this->tag_()) {
+  case word_e::Token:
+    static_cast<Token*>(this)->Encode(enc);
+    break;
+  case word_e::Compound:
+    static_cast<compound_word*>(this)->Encode(enc);
+    break;
+  case word_e::BracedTree:
+    static_cast<word__BracedTree*>(this)->Encode(enc);
+    break;
+  case word_e::String:
+    static_cast<word__String*>(this)->Encode(enc);
+    break;
+  default:
+    assert(0);
+  }
+}
+
+word_t* word_t::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<word_t*>(dec->Ref());
+  }
+  word_t* obj = nullptr;
+  switch (tag) {
+  case word_e::Token:
+    obj = Token::DecodeFields(dec);
+    break;
+  case word_e::Compound:
+    obj = compound_word::DecodeFields(dec);
+    break;
+  case word_e::BracedTree:
+    obj = word__BracedTree::DecodeFields(dec);
+    break;
+  case word_e::String:
+    obj = word__String::DecodeFields(dec);
+    break;
+  default:
+    throw Alloc<ValueError>();
+  }
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* word_t::PrettyTree() {
+  switch (this->tag_()) {
+  case word_e::Token: {
+    Token* obj = static_cast<Token*>(this);
+    return obj->PrettyTree();
+  }
+  case word_e::Compound: {
+    compound_word* obj = static_cast<compound_word*>(this);
+    return obj->PrettyTree();
+  }
+  case word_e::BracedTree: {
+    word__BracedTree* obj = static_cast<word__BracedTree*>(this);
+    return obj->PrettyTree();
+  }
+  case word_e::String: {
+    word__String* obj = static_cast<word__String*>(this);
+    return obj->PrettyTree();
+  }
+  default:
+    assert(0);
+  }
+}
+const char* sh_lhs_expr_str(int tag) {
+  switch (tag) {
+  case sh_lhs_expr_e::Name:
+    return "sh_lhs_expr.Name";
+  case sh_lhs_expr_e::IndexedName:
+    return "sh_lhs_expr.IndexedName";
+  case sh_lhs_expr_e::UnparsedIndex:
+    return "sh_lhs_expr.UnparsedIndex";
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* sh_lhs_expr__Name::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("sh_lhs_expr.Name"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->left->PrettyTree();
+  L->append(Alloc<field>(StrFromC("left"), x0));
+
+  hnode_t* x1 = runtime::NewLeaf(this->name, color_e::StringConst);
+  L->append(Alloc<field>(StrFromC("name"), x1));
+
+  return out_node;
+}
+
+void sh_lhs_expr__Name::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, sh_lhs_expr_e::Name)) {
+    return;
+  }
+  enc->Obj(this->left);
+  enc->Str(this->name);
+  enc->End(this);
+}
+
+sh_lhs_expr__Name* sh_lhs_expr__Name::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  Str* x1 = dec->Str();
+  sh_lhs_expr__Name* obj = Alloc<sh_lhs_expr__Name>(x0, x1);
+  return obj;
+}
+
+hnode_t* sh_lhs_expr__IndexedName::PrettyTree() {
+  hnode__Record* out_node =
+runtime::NewRecord(StrFromC("sh_lhs_expr.IndexedName"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->left->PrettyTree();
+  L->append(Alloc<field>(StrFromC("left"), x0));
+
+  hnode_t* x1 = runtime::NewLeaf(this->name, color_e::StringConst);
+  L->append(Alloc<field>(StrFromC("name"), x1));
+
+  hnode_t* x2 = this->index->PrettyTree();
+  L->append(Alloc<field>(StrFromC("index"), x2));
+
+  return out_node;
+}
+
+void sh_lhs_expr__IndexedName::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, sh_lhs_expr_e::IndexedName)) {
+    return;
+  }
+  enc->Obj(this->left);
+  enc->Str(this->name);
+  enc->Obj(this->index);
+  enc->End(this);
+}
+
+sh_lhs_expr__IndexedName*
+sh_lhs_expr__IndexedName::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  Str* x1 = dec->Str();
+  arith_expr_t* x2 = arith_expr_t::Decode(dec);
+  sh_lhs_expr__IndexedName* obj = Alloc<sh_lhs_expr__IndexedName>(x0, x1, x2);
+  return obj;
+}
+
+hnode_t* sh_lhs_expr__UnparsedIndex::PrettyTree() {
+  hnode__Record* out_node =
+runtime::NewRecord(StrFromC("sh_lhs_expr.UnparsedIndex"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->left->PrettyTree();
+  L->append(Alloc<field>(StrFromC("left"), x0));
+
+  hnode_t* x1 = runtime::NewLeaf(this->name, color_e::StringConst);
+  L->append(Alloc<field>(StrFromC("name"), x1));
+
+  hnode_t* x2 = runtime::NewLeaf(this->index, color_e::StringConst);
+  L->append(Alloc<field>(StrFromC("index"), x2));
+
+  return out_node;
+}
+
+void sh_lhs_expr__UnparsedIndex::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, sh_lhs_expr_e::UnparsedIndex)) {
+    return;
+  }
+  enc->Obj(this->left);
+  enc->Str(this->name);
+  enc->Str(this->index);
+  enc->End(this);
+}
+
+sh_lhs_expr__UnparsedIndex*
+sh_lhs_expr__UnparsedIndex::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  Str* x1 = dec->Str();
+  Str* x2 = dec->Str();
+  sh_lhs_expr__UnparsedIndex* obj = Alloc<sh_lhs_expr__UnparsedIndex>(x0, x1,
+                                                                      x2);
+  return obj;
+}
+
+void sh_lhs_expr_t::Encode(serialize::Encoder* enc) {
+  switch (this->tag_()) {
+  case sh_lhs_expr_e::Name:
+    static_cast<sh_lhs_expr__Name*>(this)->Encode(enc);
+    break;
+  case sh_lhs_expr_e::IndexedName:
+    static_cast<sh_lhs_expr__IndexedName*>(this)->Encode(enc);
+    break;
+  case sh_lhs_expr_e::UnparsedIndex:
+    static_cast<sh_lhs_expr__UnparsedIndex*>(this)->Encode(enc);
+    break;
+  default:
+    assert(0);
+  }
+}
+
+sh_lhs_expr_t* sh_lhs_expr_t::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<sh_lhs_expr_t*>(dec->Ref());
+  }
+  sh_lhs_expr_t* obj = nullptr;
+  switch (tag) {
+  case sh_lhs_expr_e::Name:
+    obj = sh_lhs_expr__Name::DecodeFields(dec);
+    break;
+  case sh_lhs_expr_e::IndexedName:
+    obj = sh_lhs_expr__IndexedName::DecodeFields(dec);
+    break;
+  case sh_lhs_expr_e::UnparsedIndex:
+    obj = sh_lhs_expr__UnparsedIndex::DecodeFields(dec);
+    break;
+  default:
+    throw Alloc<ValueError>();
+  }
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* sh_lhs_expr_t::PrettyTree() {
+  switch (this->tag_()) {
+  case sh_lhs_expr_e::Name: {
+    sh_lhs_expr__Name* obj = static_cast<sh_lhs_expr__Name*>(this);
+    return obj->PrettyTree();
+  }
+  case sh_lhs_expr_e::IndexedName: {
+    sh_lhs_expr__IndexedName* obj =
+static_cast<sh_lhs_expr__IndexedName*>(this);
+    return obj->PrettyTree();
+  }
+  case sh_lhs_expr_e::UnparsedIndex: {
+    sh_lhs_expr__UnparsedIndex* obj =
+static_cast<sh_lhs_expr__UnparsedIndex*>(this);
+    return obj->PrettyTree();
+  }
+  default:
+    assert(0);
+  }
+}
+const char* arith_expr_str(int tag) {
+  switch (tag) {
+  case arith_expr_e::VarSub:
+    return "arith_expr.VarSub";
+  case arith_expr_e::Word:
+    return "arith_expr.Word";
+  case arith_expr_e::UnaryAssign:
+    return "arith_expr.UnaryAssign";
+  case arith_expr_e::BinaryAssign:
+    return "arith_expr.BinaryAssign";
+  case arith_expr_e::Unary:
+    return "arith_expr.Unary";
+  case arith_expr_e::Binary:
+    return "arith_expr.Binary";
+  case arith_expr_e::TernaryOp:
+    return "arith_expr.TernaryOp";
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* arith_expr__UnaryAssign::PrettyTree() {
+  hnode__Record* out_node =
+runtime::NewRecord(StrFromC("arith_expr.UnaryAssign"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = Alloc<hnode__Leaf>(StrFromC(Id_str(this->op_id)),
+                                   color_e::UserType);
+  L->append(Alloc<field>(StrFromC("op_id"), x0));
+
+  hnode_t* x1 = this->child->PrettyTree();
+  L->append(Alloc<field>(StrFromC("child"), x1));
+
+  return out_node;
+}
+
+void arith_expr__UnaryAssign::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, arith_expr_e::UnaryAssign)) {
+    return;
+  }
+  enc->Int(this->op_id);
+  enc->Obj(this->child);
+  enc->End(this);
+}
+
+arith_expr__UnaryAssign*
+arith_expr__UnaryAssign::DecodeFields(serialize::Decoder* dec) {
+  Id_t x0 = dec->Int();
+  arith_expr_t* x1 = arith_expr_t::Decode(dec);
+  arith_expr__UnaryAssign* obj = Alloc<arith_expr__UnaryAssign>(x0, x1);
+  return obj;
+}
+
+hnode_t* arith_expr__BinaryAssign::PrettyTree() {
+  hnode__Record* out_node =
+runtime::NewRecord(StrFromC("arith_expr.BinaryAssign"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = Alloc<hnode__Leaf>(StrFromC(Id_str(this->op_id)),
+                                   color_e::UserType);
+  L->append(Alloc<field>(StrFromC("op_id"), x0));
+
+  hnode_t* x1 = this->left->PrettyTree();
+  L->append(Alloc<field>(StrFromC("left"), x1));
+
+  hnode_t* x2 = this->right->PrettyTree();
+  L->append(Alloc<field>(StrFromC("right"), x2));
+
+  return out_node;
+}
+
+void arith_expr__BinaryAssign::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, arith_expr_e::BinaryAssign)) {
+    return;
+  }
+  enc->Int(this->op_id);
+  enc->Obj(this->left);
+  enc->Obj(this->right);
+  enc->End(this);
+}
+
+arith_expr__BinaryAssign*
+arith_expr__BinaryAssign::DecodeFields(serialize::Decoder* dec) {
+  Id_t x0 = dec->Int();
+  arith_expr_t* x1 = arith_expr_t::Decode(dec);
+  arith_expr_t* x2 = arith_expr_t::Decode(dec);
+  arith_expr__BinaryAssign* obj = Alloc<arith_expr__BinaryAssign>(x0, x1, x2);
+  return obj;
+}
+
+hnode_t* arith_expr__Unary::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("arith_expr.Unary"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = Alloc<hnode__Leaf>(StrFromC(Id_str(this->op_id)),
+                                   color_e::UserType);
+  L->append(Alloc<field>(StrFromC("op_id"), x0));
+
+  hnode_t* x1 = this->child->PrettyTree();
+  L->append(Alloc<field>(StrFromC("child"), x1));
+
+  return out_node;
+}
+
+void arith_expr__Unary::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, arith_expr_e::Unary)) {
+    return;
+  }
+  enc->Int(this->op_id);
+  enc->Obj(this->child);
+  enc->End(this);
+}
+
+arith_expr__Unary* arith_expr__Unary::DecodeFields(serialize::Decoder* dec) {
+  Id_t x0 = dec->Int();
+  arith_expr_t* x1 = arith_expr_t::Decode(dec);
+  arith_expr__Unary* obj = Alloc<arith_expr__Unary>(x0, x1);
+  return obj;
+}
+
+hnode_t* arith_expr__Binary::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("arith_expr.Binary"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = Alloc<hnode__Leaf>(StrFromC(Id_str(this->op_id)),
+                                   color_e::UserType);
+  L->append(Alloc<field>(StrFromC("op_id"), x0));
+
+  hnode_t* x1 = this->left->PrettyTree();
+  L->append(Alloc<field>(StrFromC("left"), x1));
+
+  hnode_t* x2 = this->right->PrettyTree();
+  L->append(Alloc<field>(StrFromC("right"), x2));
+
+  return out_node;
+}
+
+void arith_expr__Binary::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, arith_expr_e::Binary)) {
+    return;
+  }
+  enc->Int(this->op_id);
+  enc->Obj(this->left);
+  enc->Obj(this->right);
+  enc->End(this);
+}
+
+arith_expr__Binary* arith_expr__Binary::DecodeFields(serialize::Decoder* dec) {
+  Id_t x0 = dec->Int();
+  arith_expr_t* x1 = arith_expr_t::Decode(dec);
+  arith_expr_t* x2 = arith_expr_t::Decode(dec);
+  arith_expr__Binary* obj = Alloc<arith_expr__Binary>(x0, x1, x2);
+  return obj;
+}
+
+hnode_t* arith_expr__TernaryOp::PrettyTree() {
+  hnode__Record* out_node =
+runtime::NewRecord(StrFromC("arith_expr.TernaryOp"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->cond->PrettyTree();
+  L->append(Alloc<field>(StrFromC("cond"), x0));
+
+  hnode_t* x1 = this->true_expr->PrettyTree();
+  L->append(Alloc<field>(StrFromC("true_expr"), x1));
+
+  hnode_t* x2 = this->false_expr->PrettyTree();
+  L->append(Alloc<field>(StrFromC("false_expr"), x2));
+
+  return out_node;
+}
+
+void arith_expr__TernaryOp::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, arith_expr_e::TernaryOp)) {
+    return;
+  }
+  enc->Obj(this->cond);
+  enc->Obj(this->true_expr);
+  enc->Obj(this->false_expr);
+  enc->End(this);
+}
+
+arith_expr__TernaryOp* arith_expr__TernaryOp::DecodeFields(serialize::Decoder*
+                                                           dec) {
+  arith_expr_t* x0 = arith_expr_t::Decode(dec);
+  arith_expr_t* x1 = arith_expr_t::Decode(dec);
+  arith_expr_t* x2 = arith_expr_t::Decode(dec);
+  arith_expr__TernaryOp* obj = Alloc<arith_expr__TernaryOp>(x0, x1, x2);
+  return obj;
+}
+
+void arith_expr_t::Encode(serialize::Encoder* enc) {
+  switch (this->tag_()) {
+  case arith_expr_e::VarSub:
+    static_cast<simple_var_sub*>(this)->Encode(enc);
+    break;
+  case arith_expr_e::Word:
+    static_cast<compound_word*>(this)->Encode(enc);
+    break;
+  case arith_expr_e::UnaryAssign:
+    static_cast<arith_expr__UnaryAssign*>(this)->Encode(enc);
+    break;
+  case arith_expr_e::BinaryAssign:
+    static_cast<arith_expr__BinaryAssign*>(this)->Encode(enc);
+    break;
+  case arith_expr_e::Unary:
+    static_cast<arith_expr__Unary*>(this)->Encode(enc);
+    break;
+  case arith_expr_e::Binary:
+    static_cast<arith_expr__Binary*>(this)->Encode(enc);
+    break;
+  case arith_expr_e::TernaryOp:
+    static_cast<arith_expr__TernaryOp*>(this)->Encode(enc);
+    break;
+  default:
+    assert(0);
+  }
+}
+
+arith_expr_t* arith_expr_t::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<arith_expr_t*>(dec->Ref());
+  }
+  arith_expr_t* obj = nullptr;
+  switch (tag) {
+  case arith_expr_e::VarSub:
+    obj = simple_var_sub::DecodeFields(dec);
+    break;
+  case arith_expr_e::Word:
+    obj = compound_word::DecodeFields(dec);
+    break;
+  case arith_expr_e::UnaryAssign:
+    obj = arith_expr__UnaryAssign::DecodeFields(dec);
+    break;
+  case arith_expr_e::BinaryAssign:
+    obj = arith_expr__BinaryAssign::DecodeFields(dec);
+    break;
+  case arith_expr_e::Unary:
+    obj = arith_expr__Unary::DecodeFields(dec);
+    break;
+  case arith_expr_e::Binary:
+    obj = arith_expr__Binary::DecodeFields(dec);
+    break;
+  case arith_expr_e::TernaryOp:
+    obj = arith_expr__TernaryOp::DecodeFields(dec);
+    break;
+  default:
+    throw Alloc<ValueError>();
+  }
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* arith_expr_t::PrettyTree() {
+  switch (this->tag_()) {
+  case arith_expr_e::VarSub: {
+    simple_var_sub* obj = static_cast<simple_var_sub*>(this);
+    return obj->PrettyTree();
+  }
+  case arith_expr_e::Word: {
+    compound_word* obj = static_cast<compound_word*>(this);
+    return obj->PrettyTree();
+  }
+  case arith_expr_e::UnaryAssign: {
+    arith_expr__UnaryAssign* obj = static_cast<arith_expr__UnaryAssign*>(this);
+    return obj->PrettyTree();
+  }
+  case arith_expr_e::BinaryAssign: {
+    arith_expr__BinaryAssign* obj =
+static_cast<arith_expr__BinaryAssign*>(this);
+    return obj->PrettyTree();
+  }
+  case arith_expr_e::Unary: {
+    arith_expr__Unary* obj = static_cast<arith_expr__Unary*>(this);
+    return obj->PrettyTree();
+  }
+  case arith_expr_e::Binary: {
+    arith_expr__Binary* obj = static_cast<arith_expr__Binary*>(this);
+    return obj->PrettyTree();
+  }
+  case arith_expr_e::TernaryOp: {
+    arith_expr__TernaryOp* obj = static_cast<arith_expr__TernaryOp*>(this);
+    return obj->PrettyTree();
+  }
+  default:
+    assert(0);
+  }
+}
+const char* bool_expr_str(int tag) {
+  switch (tag) {
+  case bool_expr_e::WordTest:
+    return "bool_expr.WordTest";
+  case bool_expr_e::Binary:
+    return "bool_expr.Binary";
+  case bool_expr_e::Unary:
+    return "bool_expr.Unary";
+  case bool_expr_e::LogicalNot:
+    return "bool_expr.LogicalNot";
+  case bool_expr_e::LogicalAnd:
+    return "bool_expr.LogicalAnd";
+  case bool_expr_e::LogicalOr:
+    return "bool_expr.LogicalOr";
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* bool_expr__WordTest::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("bool_expr.WordTest"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->w->PrettyTree();
+  L->append(Alloc<field>(StrFromC("w"), x0));
+
+  return out_node;
+}
+
+void bool_expr__WordTest::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, bool_expr_e::WordTest)) {
+    return;
+  }
+  enc->Obj(this->w);
+  enc->End(this);
+}
+
+bool_expr__WordTest* bool_expr__WordTest::DecodeFields(serialize::Decoder* dec)
+                                                       {
+  word_t* x0 = word_t::Decode(dec);
+  bool_expr__WordTest* obj = Alloc<bool_expr__WordTest>(x0);
+  return obj;
+}
+
+hnode_t* bool_expr__Binary::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("bool_expr.Binary"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = Alloc<hnode__Leaf>(StrFromC(Id_str(this->op_id)),
+                                   color_e::UserType);
+  L->append(Alloc<field>(StrFromC("op_id"), x0));
+
+  hnode_t* x1 = this->left->PrettyTree();
+  L->append(Alloc<field>(StrFromC("left"), x1));
+
+  hnode_t* x2 = this->right->PrettyTree();
+  L->append(Alloc<field>(StrFromC("right"), x2));
+
+  return out_node;
+}
+
+void bool_expr__Binary::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, bool_expr_e::Binary)) {
+    return;
+  }
+  enc->Int(this->op_id);
+  enc->Obj(this->left);
+  enc->Obj(this->right);
+  enc->End(this);
+}
+
+bool_expr__Binary* bool_expr__Binary::DecodeFields(serialize::Decoder* dec) {
+  Id_t x0 = dec->Int();
+  word_t* x1 = word_t::Decode(dec);
+  word_t* x2 = word_t::Decode(dec);
+  bool_expr__Binary* obj = Alloc<bool_expr__Binary>(x0, x1, x2);
+  return obj;
+}
+
+hnode_t* bool_expr__Unary::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("bool_expr.Unary"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = Alloc<hnode__Leaf>(StrFromC(Id_str(this->op_id)),
+                                   color_e::UserType);
+  L->append(Alloc<field>(StrFromC("op_id"), x0));
+
+  hnode_t* x1 = this->child->PrettyTree();
+  L->append(Alloc<field>(StrFromC("child"), x1));
+
+  return out_node;
+}
+
+void bool_expr__Unary::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, bool_expr_e::Unary)) {
+    return;
+  }
+  enc->Int(this->op_id);
+  enc->Obj(this->child);
+  enc->End(this);
+}
+
+bool_expr__Unary* bool_expr__Unary::DecodeFields(serialize::Decoder* dec) {
+  Id_t x0 = dec->Int();
+  word_t* x1 = word_t::Decode(dec);
+  bool_expr__Unary* obj = Alloc<bool_expr__Unary>(x0, x1);
+  return obj;
+}
+
+hnode_t* bool_expr__LogicalNot::PrettyTree() {
+  hnode__Record* out_node =
+runtime::NewRecord(StrFromC("bool_expr.LogicalNot"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->child->PrettyTree();
+  L->append(Alloc<field>(StrFromC("child"), x0));
+
+  return out_node;
+}
+
+void bool_expr__LogicalNot::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, bool_expr_e::LogicalNot)) {
+    return;
+  }
+  enc->Obj(this->child);
+  enc->End(this);
+}
+
+bool_expr__LogicalNot* bool_expr__LogicalNot::DecodeFields(serialize::Decoder*
+                                                           dec) {
+  bool_expr_t* x0 = bool_expr_t::Decode(dec);
+  bool_expr__LogicalNot* obj = Alloc<bool_expr__LogicalNot>(x0);
+  return obj;
+}
+
+hnode_t* bool_expr__LogicalAnd::PrettyTree() {
+  hnode__Record* out_node =
+runtime::NewRecord(StrFromC("bool_expr.LogicalAnd"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->left->PrettyTree();
+  L->append(Alloc<field>(StrFromC("left"), x0));
+
+  hnode_t* x1 = this->right->PrettyTree();
+  L->append(Alloc<field>(StrFromC("right"), x1));
+
+  return out_node;
+}
+
+void bool_expr__LogicalAnd::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, bool_expr_e::LogicalAnd)) {
+    return;
+  }
+  enc->Obj(this->left);
+  enc->Obj(this->right);
+  enc->End(this);
+}
+
+bool_expr__LogicalAnd* bool_expr__LogicalAnd::DecodeFields(serialize::Decoder*
+                                                           dec) {
+  bool_expr_t* x0 = bool_expr_t::Decode(dec);
+  bool_expr_t* x1 = bool_expr_t::Decode(dec);
+  bool_expr__LogicalAnd* obj = Alloc<bool_expr__LogicalAnd>(x0, x1);
+  return obj;
+}
+
+hnode_t* bool_expr__LogicalOr::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("bool_expr.LogicalOr"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->left->PrettyTree();
+  L->append(Alloc<field>(StrFromC("left"), x0));
+
+  hnode_t* x1 = this->right->PrettyTree();
+  L->append(Alloc<field>(StrFromC("right"), x1));
+
+  return out_node;
+}
+
+void bool_expr__LogicalOr::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, bool_expr_e::LogicalOr)) {
+    return;
+  }
+  enc->Obj(this->left);
+  enc->Obj(this->right);
+  enc->End(this);
+}
+
+bool_expr__LogicalOr* bool_expr__LogicalOr::DecodeFields(serialize::Decoder*
+                                                         dec) {
+  bool_expr_t* x0 = bool_expr_t::Decode(dec);
+  bool_expr_t* x1 = bool_expr_t::Decode(dec);
+  bool_expr__LogicalOr* obj = Alloc<bool_expr__LogicalOr>(x0, x1);
+  return obj;
+}
+
+void bool_expr_t::Encode(serialize::Encoder* enc) {
+  switch (this->tag_()) {
+  case bool_expr_e::WordTest:
+    static_cast<bool_expr__WordTest*>(this)->Encode(enc);
+    break;
+  case bool_expr_e::Binary:
+    static_cast<bool_expr__Binary*>(this)->Encode(enc);
+    break;
+  case bool_expr_e::Unary:
+    static_cast<bool_expr__Unary*>(this)->Encode(enc);
+    break;
+  case bool_expr_e::LogicalNot:
+    static_cast<bool_expr__LogicalNot*>(this)->Encode(enc);
+    break;
+  case bool_expr_e::LogicalAnd:
+    static_cast<bool_expr__LogicalAnd*>(this)->Encode(enc);
+    break;
+  case bool_expr_e::LogicalOr:
+    static_cast<bool_expr__LogicalOr*>(this)->Encode(enc);
+    break;
+  default:
+    assert(0);
+  }
+}
+
+bool_expr_t* bool_expr_t::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<bool_expr_t*>(dec->Ref());
+  }
+  bool_expr_t* obj = nullptr;
+  switch (tag) {
+  case bool_expr_e::WordTest:
+    obj = bool_expr__WordTest::DecodeFields(dec);
+    break;
+  case bool_expr_e::Binary:
+    obj = bool_expr__Binary::DecodeFields(dec);
+    break;
+  case bool_expr_e::Unary:
+    obj = bool_expr__Unary::DecodeFields(dec);
+    break;
+  case bool_expr_e::LogicalNot:
+    obj = bool_expr__LogicalNot::DecodeFields(dec);
+    break;
+  case bool_expr_e::LogicalAnd:
+    obj = bool_expr__LogicalAnd::DecodeFields(dec);
+    break;
+  case bool_expr_e::LogicalOr:
+    obj = bool_expr__LogicalOr::DecodeFields(dec);
+    break;
+  default:
+    throw Alloc<ValueError>();
+  }
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* bool_expr_t::PrettyTree() {
+  switch (this->tag_()) {
+  case bool_expr_e::WordTest: {
+    bool_expr__WordTest* obj = static_cast<bool_expr__WordTest*>(this);
+    return obj->PrettyTree();
+  }
+  case bool_expr_e::Binary: {
+    bool_expr__Binary* obj = static_cast<bool_expr__Binary*>(this);
+    return obj->PrettyTree();
+  }
+  case bool_expr_e::Unary: {
+    bool_expr__Unary* obj = static_cast<bool_expr__Unary*>(this);
+    return obj->PrettyTree();
+  }
+  case bool_expr_e::LogicalNot: {
+    bool_expr__LogicalNot* obj = static_cast<bool_expr__LogicalNot*>(this);
+    return obj->PrettyTree();
+  }
+  case bool_expr_e::LogicalAnd: {
+    bool_expr__LogicalAnd* obj = static_cast<bool_expr__LogicalAnd*>(this);
+    return obj->PrettyTree();
+  }
+  case bool_expr_e::LogicalOr: {
+    bool_expr__LogicalOr* obj = static_cast<bool_expr__LogicalOr*>(this);
+    return obj->PrettyTree();
+  }
+  default:
+    assert(0);
+  }
+}
+const char* redir_loc_str(int tag) {
+  switch (tag) {
+  case redir_loc_e::Fd:
+    return "redir_loc.Fd";
+  case redir_loc_e::VarName:
+    return "redir_loc.VarName";
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* redir_loc__Fd::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("redir_loc.Fd"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = Alloc<hnode__Leaf>(str(this->fd), color_e::OtherConst);
+  L->append(Alloc<field>(StrFromC("fd"), x0));
+
+  return out_node;
+}
+
+void redir_loc__Fd::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, redir_loc_e::Fd)) {
+    return;
+  }
+  enc->Int(this->fd);
+  enc->End(this);
+}
+
+redir_loc__Fd* redir_loc__Fd::DecodeFields(serialize::Decoder* dec) {
+  int x0 = dec->Int();
+  redir_loc__Fd* obj = Alloc<redir_loc__Fd>(x0);
+  return obj;
+}
+
+hnode_t* redir_loc__VarName::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("redir_loc.VarName"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = runtime::NewLeaf(this->name, color_e::StringConst);
+  L->append(Alloc<field>(StrFromC("name"), x0));
+
+  return out_node;
+}
+
+void redir_loc__VarName::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, redir_loc_e::VarName)) {
+    return;
+  }
+  enc->Str(this->name);
+  enc->End(this);
+}
+
+redir_loc__VarName* redir_loc__VarName::DecodeFields(serialize::Decoder* dec) {
+  Str* x0 = dec->Str();
+  redir_loc__VarName* obj = Alloc<redir_loc__VarName>(x0);
+  return obj;
+}
+
+void redir_loc_t::Encode(serialize::Encoder* enc) {
+  switch (this->tag_()) {
+  case redir_loc_e::Fd:
+    static_cast<redir_loc__Fd*>(this)->Encode(enc);
+    break;
+  case redir_loc_e::VarName:
+    static_cast<redir_loc__VarName*>(this)->Encode(enc);
+    break;
+  default:
+    assert(0);
+  }
+}
+
+redir_loc_t* redir_loc_t::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<redir_loc_t*>(dec->Ref());
+  }
+  redir_loc_t* obj = nullptr;
+  switch (tag) {
+  case redir_loc_e::Fd:
+    obj = redir_loc__Fd::DecodeFields(dec);
+    break;
+  case redir_loc_e::VarName:
+    obj = redir_loc__VarName::DecodeFields(dec);
+    break;
+  default:
+    throw Alloc<ValueError>();
+  }
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* redir_loc_t::PrettyTree() {
+  switch (this->tag_()) {
+  case redir_loc_e::Fd: {
+    redir_loc__Fd* obj = static_cast<redir_loc__Fd*>(this);
+    return obj->PrettyTree();
+  }
+  case redir_loc_e::VarName: {
+    redir_loc__VarName* obj = static_cast<redir_loc__VarName*>(this);
+    return obj->PrettyTree();
+  }
+  default:
+    assert(0);
+  }
+}
+const char* redir_param_str(int tag) {
+  switch (tag) {
+  case redir_param_e::Word:
+    return "redir_param.Word";
+  case redir_param_e::HereDoc:
+    return "redir_param.HereDoc";
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* redir_param__HereDoc::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("redir_param.HereDoc"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->here_begin->PrettyTree();
+  L->append(Alloc<field>(StrFromC("here_begin"), x0));
+
+  hnode_t* x1 = Alloc<hnode__Leaf>(str(this->here_end_span_id),
+                                   color_e::OtherConst);
+  L->append(Alloc<field>(StrFromC("here_end_span_id"), x1));
+
+  if (this->stdin_parts != nullptr) {  // array
+    hnode__Array* x2 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<word_part_t*> it(this->stdin_parts); !it.Done(); it.Next()) {
+      word_part_t* i2 = it.Value();
+      x2->children->append(i2->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("stdin_parts"), x2));
+  }
+
+  return out_node;
+}
+
+void redir_param__HereDoc::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, redir_param_e::HereDoc)) {
+    return;
+  }
+  enc->Obj(this->here_begin);
+  enc->SpanId(this->here_end_span_id);
+  if (this->stdin_parts == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->stdin_parts));
+    for (ListIter<word_part_t*> it(this->stdin_parts); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+redir_param__HereDoc* redir_param__HereDoc::DecodeFields(serialize::Decoder*
+                                                         dec) {
+  word_t* x0 = word_t::Decode(dec);
+  int x1 = dec->SpanId();
+  List<word_part_t*>* x2 = nullptr;
+  int n2 = dec->Int();
+  if (n2 >= 0) {
+    x2 = Alloc<List<word_part_t*>>();
+    for (int i = 0; i < n2; ++i) {
+      x2->append(word_part_t::Decode(dec));
+    }
+  }
+  redir_param__HereDoc* obj = Alloc<redir_param__HereDoc>(x0, x1, x2);
+  return obj;
+}
+
+void redir_param_t::Encode(serialize::Encoder* enc) {
+  switch (this->tag_()) {
+  case redir_param_e::Word:
+    static_cast<compound_word*>(this)->Encode(enc);
+    break;
+  case redir_param_e::HereDoc:
+    static_cast<redir_param__HereDoc*>(this)->Encode(enc);
+    break;
+  default:
+    assert(0);
+  }
+}
+
+redir_param_t* redir_param_t::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<redir_param_t*>(dec->Ref());
+  }
+  redir_param_t* obj = nullptr;
+  switch (tag) {
+  case redir_param_e::Word:
+    obj = compound_word::DecodeFields(dec);
+    break;
+  case redir_param_e::HereDoc:
+    obj = redir_param__HereDoc::DecodeFields(dec);
+    break;
+  default:
+    throw Alloc<ValueError>();
+  }
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* redir_param_t::PrettyTree() {
+  switch (this->tag_()) {
+  case redir_param_e::Word: {
+    compound_word* obj = static_cast<compound_word*>(this);
+    return obj->PrettyTree();
+  }
+  case redir_param_e::HereDoc: {
+    redir_param__HereDoc* obj = static_cast<redir_param__HereDoc*>(this);
+    return obj->PrettyTree();
+  }
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* redir::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("redir"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->op->PrettyTree();
+  L->append(Alloc<field>(StrFromC("op"), x0));
+
+  hnode_t* x1 = this->loc->PrettyTree();
+  L->append(Alloc<field>(StrFromC("loc"), x1));
+
+  hnode_t* x2 = this->arg->PrettyTree();
+  L->append(Alloc<field>(StrFromC("arg"), x2));
+
+  return out_node;
+}
+
+void redir::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, 78)) {
+    return;
+  }
+  enc->Obj(this->op);
+  enc->Obj(this->loc);
+  enc->Obj(this->arg);
+  enc->End(this);
+}
+
+redir* redir::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  redir_loc_t* x1 = redir_loc_t::Decode(dec);
+  redir_param_t* x2 = redir_param_t::Decode(dec);
+  redir* obj = Alloc<redir>(x0, x1, x2);
+  return obj;
+}
+
+redir* redir::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<redir*>(dec->Ref());
+  }
+  if (tag != 78) {
+    throw Alloc<ValueError>();
+  }
+  redir* obj = DecodeFields(dec);
+  dec->End(obj);
+  return obj;
+}
+const char* assign_op_str(assign_op_e tag) {
+  switch (tag) {
+  case assign_op_e::Equal:
+    return "assign_op.Equal";
+  case assign_op_e::PlusEqual:
+    return "assign_op.PlusEqual";
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* assign_pair::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("assign_pair"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->lhs->PrettyTree();
+  L->append(Alloc<field>(StrFromC("lhs"), x0));
+
+  hnode_t* x1 = Alloc<hnode__Leaf>(StrFromC(assign_op_str(this->op)),
+                                   color_e::TypeName);
+  L->append(Alloc<field>(StrFromC("op"), x1));
+
+  hnode_t* x2 = this->rhs->PrettyTree();
+  L->append(Alloc<field>(StrFromC("rhs"), x2));
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x3 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i3 = it.Value();
+      x3->children->append(Alloc<hnode__Leaf>(str(i3), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x3));
+  }
+
+  return out_node;
+}
+
+void assign_pair::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, 79)) {
+    return;
+  }
+  enc->Obj(this->lhs);
+  enc->Int(static_cast<int>(this->op));
+  enc->Obj(this->rhs);
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+assign_pair* assign_pair::DecodeFields(serialize::Decoder* dec) {
+  sh_lhs_expr_t* x0 = sh_lhs_expr_t::Decode(dec);
+  assign_op_t x1 = static_cast<assign_op_t>(dec->Int());
+  rhs_word_t* x2 = rhs_word_t::Decode(dec);
+  List<int>* x3 = nullptr;
+  int n3 = dec->Int();
+  if (n3 >= 0) {
+    x3 = Alloc<List<int>>();
+    for (int i = 0; i < n3; ++i) {
+      x3->append(dec->SpanId());
+    }
+  }
+  assign_pair* obj = Alloc<assign_pair>(x0, x1, x2, x3);
+  return obj;
+}
+
+assign_pair* assign_pair::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<assign_pair*>(dec->Ref());
+  }
+  if (tag != 79) {
+    throw Alloc<ValueError>();
+  }
+  assign_pair* obj = DecodeFields(dec);
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* env_pair::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("env_pair"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = runtime::NewLeaf(this->name, color_e::StringConst);
+  L->append(Alloc<field>(StrFromC("name"), x0));
+
+  hnode_t* x1 = this->val->PrettyTree();
+  L->append(Alloc<field>(StrFromC("val"), x1));
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x2 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i2 = it.Value();
+      x2->children->append(Alloc<hnode__Leaf>(str(i2), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x2));
+  }
+
+  return out_node;
+}
+
+void env_pair::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, 80)) {
+    return;
+  }
+  enc->Str(this->name);
+  enc->Obj(this->val);
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+env_pair* env_pair::DecodeFields(serialize::Decoder* dec) {
+  Str* x0 = dec->Str();
+  rhs_word_t* x1 = rhs_word_t::Decode(dec);
+  List<int>* x2 = nullptr;
+  int n2 = dec->Int();
+  if (n2 >= 0) {
+    x2 = Alloc<List<int>>();
+    for (int i = 0; i < n2; ++i) {
+      x2->append(dec->SpanId());
+    }
+  }
+  env_pair* obj = Alloc<env_pair>(x0, x1, x2);
+  return obj;
+}
+
+env_pair* env_pair::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<env_pair*>(dec->Ref());
+  }
+  if (tag != 80) {
+    throw Alloc<ValueError>();
+  }
+  env_pair* obj = DecodeFields(dec);
+  dec->End(obj);
+  return obj;
+}
+const char* condition_str(int tag) {
+  switch (tag) {
+  case condition_e::Shell:
+    return "condition.Shell";
+  case condition_e::Oil:
+    return "condition.Oil";
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* condition__Shell::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("condition.Shell"));
+  List<field*>* L = out_node->fields;
+
+  if (this->commands != nullptr) {  // array
+    hnode__Array* x0 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<command_t*> it(this->commands); !it.Done(); it.Next()) {
+      command_t* i0 = it.Value();
+      x0->children->append(i0->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("commands"), x0));
+  }
+
+  return out_node;
+}
+
+void condition__Shell::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, condition_e::Shell)) {
+    return;
+  }
+  if (this->commands == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->commands));
+    for (ListIter<command_t*> it(this->commands); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+condition__Shell* condition__Shell::DecodeFields(serialize::Decoder* dec) {
+  List<command_t*>* x0 = nullptr;
+  int n0 = dec->Int();
+  if (n0 >= 0) {
+    x0 = Alloc<List<command_t*>>();
+    for (int i = 0; i < n0; ++i) {
+      x0->append(command_t::Decode(dec));
+    }
+  }
+  condition__Shell* obj = Alloc<condition__Shell>(x0);
+  return obj;
+}
+
+hnode_t* condition__Oil::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("condition.Oil"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->e->PrettyTree();
+  L->append(Alloc<field>(StrFromC("e"), x0));
+
+  return out_node;
+}
+
+void condition__Oil::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, condition_e::Oil)) {
+    return;
+  }
+  enc->Obj(this->e);
+  enc->End(this);
+}
+
+condition__Oil* condition__Oil::DecodeFields(serialize::Decoder* dec) {
+  expr_t* x0 = expr_t::Decode(dec);
+  condition__Oil* obj = Alloc<condition__Oil>(x0);
+  return obj;
+}
+
+void condition_t::Encode(serialize::Encoder* enc) {
+  switch (this->tag_()) {
+  case condition_e::Shell:
+    static_cast<condition__Shell*>(this)->Encode(enc);
+    break;
+  case condition_e::Oil:
+    static_cast<condition__Oil*>(this)->Encode(enc);
+    break;
+  default:
+    assert(0);
+  }
+}
+
+condition_t* condition_t::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<condition_t*>(dec->Ref());
+  }
+  condition_t* obj = nullptr;
+  switch (tag) {
+  case condition_e::Shell:
+    obj = condition__Shell::DecodeFields(dec);
+    break;
+  case condition_e::Oil:
+    obj = condition__Oil::DecodeFields(dec);
+    break;
+  default:
+    throw Alloc<ValueError>();
+  }
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* condition_t::PrettyTree() {
+  switch (this->tag_()) {
+  case condition_e::Shell: {
+    condition__Shell* obj = static_cast<condition__Shell*>(this);
+    return obj->PrettyTree();
+  }
+  case condition_e::Oil: {
+    condition__Oil* obj = static_cast<condition__Oil*>(this);
+    return obj->PrettyTree();
+  }
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* case_arm::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("case_arm"));
+  List<field*>* L = out_node->fields;
+
+  if (this->pat_list != nullptr) {  // array
+    hnode__Array* x0 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<word_t*> it(this->pat_list); !it.Done(); it.Next()) {
+      word_t* i0 = it.Value();
+      x0->children->append(i0->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("pat_list"), x0));
+  }
+
+  if (this->action != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<command_t*> it(this->action); !it.Done(); it.Next()) {
+      command_t* i1 = it.Value();
+      x1->children->append(i1->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("action"), x1));
+  }
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x2 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i2 = it.Value();
+      x2->children->append(Alloc<hnode__Leaf>(str(i2), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x2));
+  }
+
+  return out_node;
+}
+
+void case_arm::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, 81)) {
+    return;
+  }
+  if (this->pat_list == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->pat_list));
+    for (ListIter<word_t*> it(this->pat_list); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  if (this->action == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->action));
+    for (ListIter<command_t*> it(this->action); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+case_arm* case_arm::DecodeFields(serialize::Decoder* dec) {
+  List<word_t*>* x0 = nullptr;
+  int n0 = dec->Int();
+  if (n0 >= 0) {
+    x0 = Alloc<List<word_t*>>();
+    for (int i = 0; i < n0; ++i) {
+      x0->append(word_t::Decode(dec));
+    }
+  }
+  List<command_t*>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<command_t*>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(command_t::Decode(dec));
+    }
+  }
+  List<int>* x2 = nullptr;
+  int n2 = dec->Int();
+  if (n2 >= 0) {
+    x2 = Alloc<List<int>>();
+    for (int i = 0; i < n2; ++i) {
+      x2->append(dec->SpanId());
+    }
+  }
+  case_arm* obj = Alloc<case_arm>(x0, x1, x2);
+  return obj;
+}
+
+case_arm* case_arm::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<case_arm*>(dec->Ref());
+  }
+  if (tag != 81) {
+    throw Alloc<ValueError>();
+  }
+  case_arm* obj = DecodeFields(dec);
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* if_arm::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("if_arm"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->cond->PrettyTree();
+  L->append(Alloc<field>(StrFromC("cond"), x0));
+
+  if (this->action != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<command_t*> it(this->action); !it.Done(); it.Next()) {
+      command_t* i1 = it.Value();
+      x1->children->append(i1->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("action"), x1));
+  }
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x2 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i2 = it.Value();
+      x2->children->append(Alloc<hnode__Leaf>(str(i2), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x2));
+  }
+
+  return out_node;
+}
+
+void if_arm::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, 82)) {
+    return;
+  }
+  enc->Obj(this->cond);
+  if (this->action == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->action));
+    for (ListIter<command_t*> it(this->action); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+if_arm* if_arm::DecodeFields(serialize::Decoder* dec) {
+  condition_t* x0 = condition_t::Decode(dec);
+  List<command_t*>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<command_t*>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(command_t::Decode(dec));
+    }
+  }
+  List<int>* x2 = nullptr;
+  int n2 = dec->Int();
+  if (n2 >= 0) {
+    x2 = Alloc<List<int>>();
+    for (int i = 0; i < n2; ++i) {
+      x2->append(dec->SpanId());
+    }
+  }
+  if_arm* obj = Alloc<if_arm>(x0, x1, x2);
+  return obj;
+}
+
+if_arm* if_arm::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<if_arm*>(dec->Ref());
+  }
+  if (tag != 82) {
+    throw Alloc<ValueError>();
+  }
+  if_arm* obj = DecodeFields(dec);
+  dec->End(obj);
+  return obj;
+}
+const char* for_iter_str(int tag) {
+  switch (tag) {
+  case for_iter_e::Args:
+    return "for_iter.Args";
+  case for_iter_e::Words:
+    return "for_iter.Words";
+  case for_iter_e::Oil:
+    return "for_iter.Oil";
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* for_iter__Args::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("for_iter.Args"));
+  return out_node;
+}
+
+void for_iter__Args::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, for_iter_e::Args)) {
+    return;
+  }
+  enc->End(this);
+}
+
+for_iter__Args* for_iter__Args::DecodeFields(serialize::Decoder* dec) {
+  for_iter__Args* obj = Alloc<for_iter__Args>();
+  return obj;
+}
+
+hnode_t* for_iter__Words::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("for_iter.Words"));
+  List<field*>* L = out_node->fields;
+
+  if (this->words != nullptr) {  // array
+    hnode__Array* x0 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<word_t*> it(this->words); !it.Done(); it.Next()) {
+      word_t* i0 = it.Value();
+      x0->children->append(i0->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("words"), x0));
+  }
+
+  return out_node;
+}
+
+void for_iter__Words::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, for_iter_e::Words)) {
+    return;
+  }
+  if (this->words == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->words));
+    for (ListIter<word_t*> it(this->words); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+for_iter__Words* for_iter__Words::DecodeFields(serialize::Decoder* dec) {
+  List<word_t*>* x0 = nullptr;
+  int n0 = dec->Int();
+  if (n0 >= 0) {
+    x0 = Alloc<List<word_t*>>();
+    for (int i = 0; i < n0; ++i) {
+      x0->append(word_t::Decode(dec));
+    }
+  }
+  for_iter__Words* obj = Alloc<for_iter__Words>(x0);
+  return obj;
+}
+
+hnode_t* for_iter__Oil::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("for_iter.Oil"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->e->PrettyTree();
+  L->append(Alloc<field>(StrFromC("e"), x0));
+
+  hnode_t* x1 = this->blame->PrettyTree();
+  L->append(Alloc<field>(StrFromC("blame"), x1));
+
+  return out_node;
+}
+
+void for_iter__Oil::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, for_iter_e::Oil)) {
+    return;
+  }
+  enc->Obj(this->e);
+  enc->Obj(this->blame);
+  enc->End(this);
+}
+
+for_iter__Oil* for_iter__Oil::DecodeFields(serialize::Decoder* dec) {
+  expr_t* x0 = expr_t::Decode(dec);
+  Token* x1 = Token::Decode(dec);
+  for_iter__Oil* obj = Alloc<for_iter__Oil>(x0, x1);
+  return obj;
+}
+
+void for_iter_t::Encode(serialize::Encoder* enc) {
+  switch (this->tag_()) {
+  case for_iter_e::Args:
+    static_cast<for_iter__Args*>(this)->Encode(enc);
+    break;
+  case for_iter_e::Words:
+    static_cast<for_iter__Words*>(this)->Encode(enc);
+    break;
+  case for_iter_e::Oil:
+    static_cast<for_iter__Oil*>(this)->Encode(enc);
+    break;
+  default:
+    assert(0);
+  }
+}
+
+for_iter_t* for_iter_t::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<for_iter_t*>(dec->Ref());
+  }
+  for_iter_t* obj = nullptr;
+  switch (tag) {
+  case for_iter_e::Args:
+    obj = for_iter__Args::DecodeFields(dec);
+    break;
+  case for_iter_e::Words:
+    obj = for_iter__Words::DecodeFields(dec);
+    break;
+  case for_iter_e::Oil:
+    obj = for_iter__Oil::DecodeFields(dec);
+    break;
+  default:
+    throw Alloc<ValueError>();
+  }
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* for_iter_t::PrettyTree() {
+  switch (this->tag_()) {
+  case for_iter_e::Args: {
+    for_iter__Args* obj = static_cast<for_iter__Args*>(this);
+    return obj->PrettyTree();
+  }
+  case for_iter_e::Words: {
+    for_iter__Words* obj = static_cast<for_iter__Words*>(this);
+    return obj->PrettyTree();
+  }
+  case for_iter_e::Oil: {
+    for_iter__Oil* obj = static_cast<for_iter__Oil*>(this);
+    return obj->PrettyTree();
+  }
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* BraceGroup::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("BraceGroup"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->left->PrettyTree();
+  L->append(Alloc<field>(StrFromC("left"), x0));
+
+  if (this->doc_token) {  // maybe
+    hnode_t* x1 = this->doc_token->PrettyTree();
+    L->append(Alloc<field>(StrFromC("doc_token"), x1));
+  }
+
+  if (this->children != nullptr) {  // array
+    hnode__Array* x2 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<command_t*> it(this->children); !it.Done(); it.Next()) {
+      command_t* i2 = it.Value();
+      x2->children->append(i2->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("children"), x2));
+  }
+
+  if (this->redirects != nullptr) {  // array
+    hnode__Array* x3 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<redir*> it(this->redirects); !it.Done(); it.Next()) {
+      redir* i3 = it.Value();
+      x3->children->append(i3->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("redirects"), x3));
+  }
+
+  hnode_t* x4 = this->right->PrettyTree();
+  L->append(Alloc<field>(StrFromC("right"), x4));
+
+  return out_node;
+}
+
+void BraceGroup::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, 83)) {
+    return;
+  }
+  enc->Obj(this->left);
+  enc->Obj(this->doc_token);
+  if (this->children == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->children));
+    for (ListIter<command_t*> it(this->children); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  if (this->redirects == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->redirects));
+    for (ListIter<redir*> it(this->redirects); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->Obj(this->right);
+  enc->End(this);
+}
+
+BraceGroup* BraceGroup::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  Token* x1 = Token::Decode(dec);
+  List<command_t*>* x2 = nullptr;
+  int n2 = dec->Int();
+  if (n2 >= 0) {
+    x2 = Alloc<List<command_t*>>();
+    for (int i = 0; i < n2; ++i) {
+      x2->append(command_t::Decode(dec));
+    }
+  }
+  List<redir*>* x3 = nullptr;
+  int n3 = dec->Int();
+  if (n3 >= 0) {
+    x3 = Alloc<List<redir*>>();
+    for (int i = 0; i < n3; ++i) {
+      x3->append(redir::Decode(dec));
+    }
+  }
+  Token* x4 = Token::Decode(dec);
+  BraceGroup* obj = Alloc<BraceGroup>(x0, x1, x2, x3, x4);
+  return obj;
+}
+
+BraceGroup* BraceGroup::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<BraceGroup*>(dec->Ref());
+  }
+  if (tag != 83) {
+    throw Alloc<ValueError>();
+  }
+  BraceGroup* obj = DecodeFields(dec);
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* BlockArg::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("BlockArg"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->brace_group->PrettyTree();
+  L->append(Alloc<field>(StrFromC("brace_group"), x0));
+
+  if (this->lines != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<SourceLine*> it(this->lines); !it.Done(); it.Next()) {
+      SourceLine* i1 = it.Value();
+      x1->children->append(i1->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("lines"), x1));
+  }
+
+  return out_node;
+}
+
+void BlockArg::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, 84)) {
+    return;
+  }
+  enc->Obj(this->brace_group);
+  if (this->lines == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->lines));
+    for (ListIter<SourceLine*> it(this->lines); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+BlockArg* BlockArg::DecodeFields(serialize::Decoder* dec) {
+  BraceGroup* x0 = BraceGroup::Decode(dec);
+  List<SourceLine*>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<SourceLine*>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(SourceLine::Decode(dec));
+    }
+  }
+  BlockArg* obj = Alloc<BlockArg>(x0, x1);
+  return obj;
+}
+
+BlockArg* BlockArg::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<BlockArg*>(dec->Ref());
+  }
+  if (tag != 84) {
+    throw Alloc<ValueError>();
+  }
+  BlockArg* obj = DecodeFields(dec);
+  dec->End(obj);
+  return obj;
+}
+const char* command_str(int tag) {
+  switch (tag) {
+  case command_e::NoOp:
+    return "command.NoOp";
+  case command_e::Simple:
+    return "command.Simple";
+  case command_e::ExpandedAlias:
+    return "command.ExpandedAlias";
+  case command_e::Sentence:
+    return "command.Sentence";
+  case command_e::ShAssignment:
+    return "command.ShAssignment";
+  case command_e::ControlFlow:
+    return "command.ControlFlow";
+  case command_e::Pipeline:
+    return "command.Pipeline";
+  case command_e::AndOr:
+    return "command.AndOr";
+  case command_e::DoGroup:
+    return "command.DoGroup";
+  case command_e::BraceGroup:
+    return "command.BraceGroup";
+  case command_e::Subshell:
+    return "command.Subshell";
+  case command_e::DParen:
+    return "command.DParen";
+  case command_e::DBracket:
+    return "command.DBracket";
+  case command_e::ForEach:
+    return "command.ForEach";
+  case command_e::ForExpr:
+    return "command.ForExpr";
+  case command_e::WhileUntil:
+    return "command.WhileUntil";
+  case command_e::If:
+    return "command.If";
+  case command_e::Case:
+    return "command.Case";
+  case command_e::ShFunction:
+    return "command.ShFunction";
+  case command_e::TimeBlock:
+    return "command.TimeBlock";
+  case command_e::CommandList:
+    return "command.CommandList";
+  case command_e::BareDecl:
+    return "command.BareDecl";
+  case command_e::VarDecl:
+    return "command.VarDecl";
+  case command_e::PlaceMutation:
+    return "command.PlaceMutation";
+  case command_e::Expr:
+    return "command.Expr";
+  case command_e::Proc:
+    return "command.Proc";
+  case command_e::Func:
+    return "command.Func";
+  case command_e::Data:
+    return "command.Data";
+  case command_e::Enum:
+    return "command.Enum";
+  case command_e::Class:
+    return "command.Class";
+  case command_e::Import:
+    return "command.Import";
+  case command_e::For:
+    return "command.For";
+  case command_e::While:
+    return "command.While";
+  case command_e::Break:
+    return "command.Break";
+  case command_e::Continue:
+    return "command.Continue";
+  case command_e::Return:
+    return "command.Return";
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* command__NoOp::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("command.NoOp"));
+  List<field*>* L = out_node->fields;
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x0 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i0 = it.Value();
+      x0->children->append(Alloc<hnode__Leaf>(str(i0), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x0));
+  }
+
+  return out_node;
+}
+
+void command__NoOp::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, command_e::NoOp)) {
+    return;
+  }
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+command__NoOp* command__NoOp::DecodeFields(serialize::Decoder* dec) {
+  List<int>* x0 = nullptr;
+  int n0 = dec->Int();
+  if (n0 >= 0) {
+    x0 = Alloc<List<int>>();
+    for (int i = 0; i < n0; ++i) {
+      x0->append(dec->SpanId());
+    }
+  }
+  command__NoOp* obj = Alloc<command__NoOp>();
+  obj->spids = x0;
+  return obj;
+}
+
+hnode_t* command__Simple::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("command.Simple"));
+  List<field*>* L = out_node->fields;
+
+  if (this->words != nullptr) {  // array
+    hnode__Array* x0 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<word_t*> it(this->words); !it.Done(); it.Next()) {
+      word_t* i0 = it.Value();
+      x0->children->append(i0->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("words"), x0));
+  }
+
+  if (this->redirects != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<redir*> it(this->redirects); !it.Done(); it.Next()) {
+      redir* i1 = it.Value();
+      x1->children->append(i1->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("redirects"), x1));
+  }
+
+  if (this->more_env != nullptr) {  // array
+    hnode__Array* x2 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<env_pair*> it(this->more_env); !it.Done(); it.Next()) {
+      env_pair* i2 = it.Value();
+      x2->children->append(i2->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("more_env"), x2));
+  }
+
+  if (this->typed_args) {  // maybe
+    hnode_t* x3 = this->typed_args->PrettyTree();
+    L->append(Alloc<field>(StrFromC("typed_args"), x3));
+  }
+
+  if (this->block) {  // maybe
+    hnode_t* x4 = this->block->PrettyTree();
+    L->append(Alloc<field>(StrFromC("block"), x4));
+  }
+
+  hnode_t* x5 = Alloc<hnode__Leaf>(this->do_fork ? runtime::TRUE_STR :
+                                   runtime::FALSE_STR, color_e::OtherConst);
+  L->append(Alloc<field>(StrFromC("do_fork"), x5));
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x6 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i6 = it.Value();
+      x6->children->append(Alloc<hnode__Leaf>(str(i6), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x6));
+  }
+
+  return out_node;
+}
+
+void command__Simple::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, command_e::Simple)) {
+    return;
+  }
+  if (this->words == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->words));
+    for (ListIter<word_t*> it(this->words); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  if (this->redirects == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->redirects));
+    for (ListIter<redir*> it(this->redirects); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  if (this->more_env == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->more_env));
+    for (ListIter<env_pair*> it(this->more_env); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->Obj(this->typed_args);
+  enc->Obj(this->block);
+  enc->Bool(this->do_fork);
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+command__Simple* command__Simple::DecodeFields(serialize::Decoder* dec) {
+  List<word_t*>* x0 = nullptr;
+  int n0 = dec->Int();
+  if (n0 >= 0) {
+    x0 = Alloc<List<word_t*>>();
+    for (int i = 0; i < n0; ++i) {
+      x0->append(word_t::Decode(dec));
+    }
+  }
+  List<redir*>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<redir*>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(redir::Decode(dec));
+    }
+  }
+  List<env_pair*>* x2 = nullptr;
+  int n2 = dec->Int();
+  if (n2 >= 0) {
+    x2 = Alloc<List<env_pair*>>();
+    for (int i = 0; i < n2; ++i) {
+      x2->append(env_pair::Decode(dec));
+    }
+  }
+  ArgList* x3 = ArgList::Decode(dec);
+  BlockArg* x4 = BlockArg::Decode(dec);
+  bool x5 = dec->Bool();
+  List<int>* x6 = nullptr;
+  int n6 = dec->Int();
+  if (n6 >= 0) {
+    x6 = Alloc<List<int>>();
+    for (int i = 0; i < n6; ++i) {
+      x6->append(dec->SpanId());
+    }
+  }
+  command__Simple* obj = Alloc<command__Simple>(x0, x1, x2, x3, x4, x5);
+  obj->spids = x6;
+  return obj;
+}
+
+hnode_t* command__ExpandedAlias::PrettyTree() {
+  hnode__Record* out_node =
+runtime::NewRecord(StrFromC("command.ExpandedAlias"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->child->PrettyTree();
+  L->append(Alloc<field>(StrFromC("child"), x0));
+
+  if (this->redirects != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<redir*> it(this->redirects); !it.Done(); it.Next()) {
+      redir* i1 = it.Value();
+      x1->children->append(i1->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("redirects"), x1));
+  }
+
+  if (this->more_env != nullptr) {  // array
+    hnode__Array* x2 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<env_pair*> it(this->more_env); !it.Done(); it.Next()) {
+      env_pair* i2 = it.Value();
+      x2->children->append(i2->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("more_env"), x2));
+  }
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x3 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i3 = it.Value();
+      x3->children->append(Alloc<hnode__Leaf>(str(i3), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x3));
+  }
+
+  return out_node;
+}
+
+void command__ExpandedAlias::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, command_e::ExpandedAlias)) {
+    return;
+  }
+  enc->Obj(this->child);
+  if (this->redirects == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->redirects));
+    for (ListIter<redir*> it(this->redirects); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  if (this->more_env == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->more_env));
+    for (ListIter<env_pair*> it(this->more_env); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+command__ExpandedAlias*
+command__ExpandedAlias::DecodeFields(serialize::Decoder* dec) {
+  command_t* x0 = command_t::Decode(dec);
+  List<redir*>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<redir*>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(redir::Decode(dec));
+    }
+  }
+  List<env_pair*>* x2 = nullptr;
+  int n2 = dec->Int();
+  if (n2 >= 0) {
+    x2 = Alloc<List<env_pair*>>();
+    for (int i = 0; i < n2; ++i) {
+      x2->append(env_pair::Decode(dec));
+    }
+  }
+  List<int>* x3 = nullptr;
+  int n3 = dec->Int();
+  if (n3 >= 0) {
+    x3 = Alloc<List<int>>();
+    for (int i = 0; i < n3; ++i) {
+      x3->append(dec->SpanId());
+    }
+  }
+  command__ExpandedAlias* obj = Alloc<command__ExpandedAlias>(x0, x1, x2);
+  obj->spids = x3;
+  return obj;
+}
+
+hnode_t* command__Sentence::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("command.Sentence"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->child->PrettyTree();
+  L->append(Alloc<field>(StrFromC("child"), x0));
+
+  hnode_t* x1 = this->terminator->PrettyTree();
+  L->append(Alloc<field>(StrFromC("terminator"), x1));
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x2 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i2 = it.Value();
+      x2->children->append(Alloc<hnode__Leaf>(str(i2), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x2));
+  }
+
+  return out_node;
+}
+
+void command__Sentence::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, command_e::Sentence)) {
+    return;
+  }
+  enc->Obj(this->child);
+  enc->Obj(this->terminator);
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+command__Sentence* command__Sentence::DecodeFields(serialize::Decoder* dec) {
+  command_t* x0 = command_t::Decode(dec);
+  Token* x1 = Token::Decode(dec);
+  List<int>* x2 = nullptr;
+  int n2 = dec->Int();
+  if (n2 >= 0) {
+    x2 = Alloc<List<int>>();
+    for (int i = 0; i < n2; ++i) {
+      x2->append(dec->SpanId());
+    }
+  }
+  command__Sentence* obj = Alloc<command__Sentence>(x0, x1);
+  obj->spids = x2;
+  return obj;
+}
+
+hnode_t* command__ShAssignment::PrettyTree() {
+  hnode__Record* out_node =
+runtime::NewRecord(StrFromC("command.ShAssignment"));
+  List<field*>* L = out_node->fields;
+
+  if (this->pairs != nullptr) {  // array
+    hnode__Array* x0 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<assign_pair*> it(this->pairs); !it.Done(); it.Next()) {
+      assign_pair* i0 = it.Value();
+      x0->children->append(i0->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("pairs"), x0));
+  }
+
+  if (this->redirects != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<redir*> it(this->redirects); !it.Done(); it.Next()) {
+      redir* i1 = it.Value();
+      x1->children->append(i1->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("redirects"), x1));
+  }
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x2 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i2 = it.Value();
+      x2->children->append(Alloc<hnode__Leaf>(str(i2), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x2));
+  }
+
+  return out_node;
+}
+
+void command__ShAssignment::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, command_e::ShAssignment)) {
+    return;
+  }
+  if (this->pairs == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->pairs));
+    for (ListIter<assign_pair*> it(this->pairs); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  if (this->redirects == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->redirects));
+    for (ListIter<redir*> it(this->redirects); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+command__ShAssignment* command__ShAssignment::DecodeFields(serialize::Decoder*
+                                                           dec) {
+  List<assign_pair*>* x0 = nullptr;
+  int n0 = dec->Int();
+  if (n0 >= 0) {
+    x0 = Alloc<List<assign_pair*>>();
+    for (int i = 0; i < n0; ++i) {
+      x0->append(assign_pair::Decode(dec));
+    }
+  }
+  List<redir*>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<redir*>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(redir::Decode(dec));
+    }
+  }
+  List<int>* x2 = nullptr;
+  int n2 = dec->Int();
+  if (n2 >= 0) {
+    x2 = Alloc<List<int>>();
+    for (int i = 0; i < n2; ++i) {
+      x2->append(dec->SpanId());
+    }
+  }
+  command__ShAssignment* obj = Alloc<command__ShAssignment>(x0, x1);
+  obj->spids = x2;
+  return obj;
+}
+
+hnode_t* command__ControlFlow::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("command.ControlFlow"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->token->PrettyTree();
+  L->append(Alloc<field>(StrFromC("token"), x0));
+
+  if (this->arg_word) {  // maybe
+    hnode_t* x1 = this->arg_word->PrettyTree();
+    L->append(Alloc<field>(StrFromC("arg_word"), x1));
+  }
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x2 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i2 = it.Value();
+      x2->children->append(Alloc<hnode__Leaf>(str(i2), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x2));
+  }
+
+  return out_node;
+}
+
+void command__ControlFlow::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, command_e::ControlFlow)) {
+    return;
+  }
+  enc->Obj(this->token);
+  enc->Obj(this->arg_word);
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+command__ControlFlow* command__ControlFlow::DecodeFields(serialize::Decoder*
+                                                         dec) {
+  Token* x0 = Token::Decode(dec);
+  word_t* x1 = word_t::Decode(dec);
+  List<int>* x2 = nullptr;
+  int n2 = dec->Int();
+  if (n2 >= 0) {
+    x2 = Alloc<List<int>>();
+    for (int i = 0; i < n2; ++i) {
+      x2->append(dec->SpanId());
+    }
+  }
+  command__ControlFlow* obj = Alloc<command__ControlFlow>(x0, x1);
+  obj->spids = x2;
+  return obj;
+}
+
+hnode_t* command__Pipeline::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("command.Pipeline"));
+  List<field*>* L = out_node->fields;
+
+  if (this->children != nullptr) {  // array
+    hnode__Array* x0 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<command_t*> it(this->children); !it.Done(); it.Next()) {
+      command_t* i0 = it.Value();
+      x0->children->append(i0->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("children"), x0));
+  }
+
+  hnode_t* x1 = Alloc<hnode__Leaf>(this->negated ? runtime::TRUE_STR :
+                                   runtime::FALSE_STR, color_e::OtherConst);
+  L->append(Alloc<field>(StrFromC("negated"), x1));
+
+  if (this->stderr_indices != nullptr) {  // array
+    hnode__Array* x2 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->stderr_indices); !it.Done(); it.Next()) {
+      int i2 = it.Value();
+      x2->children->append(Alloc<hnode__Leaf>(str(i2), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("stderr_indices"), x2));
+  }
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x3 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i3 = it.Value();
+      x3->children->append(Alloc<hnode__Leaf>(str(i3), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x3));
+  }
+
+  return out_node;
+}
+
+void command__Pipeline::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, command_e::Pipeline)) {
+    return;
+  }
+  if (this->children == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->children));
+    for (ListIter<command_t*> it(this->children); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->Bool(this->negated);
+  if (this->stderr_indices == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->stderr_indices));
+    for (ListIter<int> it(this->stderr_indices); !it.Done(); it.Next()) {
+      enc->Int(it.Value());
+    }
+  }
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+command__Pipeline* command__Pipeline::DecodeFields(serialize::Decoder* dec) {
+  List<command_t*>* x0 = nullptr;
+  int n0 = dec->Int();
+  if (n0 >= 0) {
+    x0 = Alloc<List<command_t*>>();
+    for (int i = 0; i < n0; ++i) {
+      x0->append(command_t::Decode(dec));
+    }
+  }
+  bool x1 = dec->Bool();
+  List<int>* x2 = nullptr;
+  int n2 = dec->Int();
+  if (n2 >= 0) {
+    x2 = Alloc<List<int>>();
+    for (int i = 0; i < n2; ++i) {
+      x2->append(dec->Int());
+    }
+  }
+  List<int>* x3 = nullptr;
+  int n3 = dec->Int();
+  if (n3 >= 0) {
+    x3 = Alloc<List<int>>();
+    for (int i = 0; i < n3; ++i) {
+      x3->append(dec->SpanId());
+    }
+  }
+  command__Pipeline* obj = Alloc<command__Pipeline>(x0, x1, x2);
+  obj->spids = x3;
+  return obj;
+}
+
+hnode_t* command__AndOr::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("command.AndOr"));
+  List<field*>* L = out_node->fields;
+
+  if (this->ops != nullptr) {  // array
+    hnode__Array* x0 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<Id_t> it(this->ops); !it.Done(); it.Next()) {
+      Id_t i0 = it.Value();
+      x0->children->append(Alloc<hnode__Leaf>(StrFromC(Id_str(i0)),
+                           color_e::UserType));
+    }
+    L->append(Alloc<field>(StrFromC("ops"), x0));
+  }
+
+  if (this->children != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<command_t*> it(this->children); !it.Done(); it.Next()) {
+      command_t* i1 = it.Value();
+      x1->children->append(i1->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("children"), x1));
+  }
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x2 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i2 = it.Value();
+      x2->children->append(Alloc<hnode__Leaf>(str(i2), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x2));
+  }
+
+  return out_node;
+}
+
+void command__AndOr::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, command_e::AndOr)) {
+    return;
+  }
+  if (this->ops == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->ops));
+    for (ListIter<Id_t> it(this->ops); !it.Done(); it.Next()) {
+      enc->Int(it.Value());
+    }
+  }
+  if (this->children == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->children));
+    for (ListIter<command_t*> it(this->children); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+command__AndOr* command__AndOr::DecodeFields(serialize::Decoder* dec) {
+  List<Id_t>* x0 = nullptr;
+  int n0 = dec->Int();
+  if (n0 >= 0) {
+    x0 = Alloc<List<Id_t>>();
+    for (int i = 0; i < n0; ++i) {
+      x0->append(dec->Int());
+    }
+  }
+  List<command_t*>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<command_t*>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(command_t::Decode(dec));
+    }
+  }
+  List<int>* x2 = nullptr;
+  int n2 = dec->Int();
+  if (n2 >= 0) {
+    x2 = Alloc<List<int>>();
+    for (int i = 0; i < n2; ++i) {
+      x2->append(dec->SpanId());
+    }
+  }
+  command__AndOr* obj = Alloc<command__AndOr>(x0, x1);
+  obj->spids = x2;
+  return obj;
+}
+
+hnode_t* command__DoGroup::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("command.DoGroup"));
+  List<field*>* L = out_node->fields;
+
+  if (this->children != nullptr) {  // array
+    hnode__Array* x0 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<command_t*> it(this->children); !it.Done(); it.Next()) {
+      command_t* i0 = it.Value();
+      x0->children->append(i0->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("children"), x0));
+  }
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i1 = it.Value();
+      x1->children->append(Alloc<hnode__Leaf>(str(i1), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x1));
+  }
+
+  return out_node;
+}
+
+void command__DoGroup::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, command_e::DoGroup)) {
+    return;
+  }
+  if (this->children == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->children));
+    for (ListIter<command_t*> it(this->children); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+command__DoGroup* command__DoGroup::DecodeFields(serialize::Decoder* dec) {
+  List<command_t*>* x0 = nullptr;
+  int n0 = dec->Int();
+  if (n0 >= 0) {
+    x0 = Alloc<List<command_t*>>();
+    for (int i = 0; i < n0; ++i) {
+      x0->append(command_t::Decode(dec));
+    }
+  }
+  List<int>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<int>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(dec->SpanId());
+    }
+  }
+  command__DoGroup* obj = Alloc<command__DoGroup>(x0);
+  obj->spids = x1;
+  return obj;
+}
+
+hnode_t* command__Subshell::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("command.Subshell"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->child->PrettyTree();
+  L->append(Alloc<field>(StrFromC("child"), x0));
+
+  if (this->redirects != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<redir*> it(this->redirects); !it.Done(); it.Next()) {
+      redir* i1 = it.Value();
+      x1->children->append(i1->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("redirects"), x1));
+  }
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x2 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i2 = it.Value();
+      x2->children->append(Alloc<hnode__Leaf>(str(i2), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x2));
+  }
+
+  return out_node;
+}
+
+void command__Subshell::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, command_e::Subshell)) {
+    return;
+  }
+  enc->Obj(this->child);
+  if (this->redirects == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->redirects));
+    for (ListIter<redir*> it(this->redirects); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+command__Subshell* command__Subshell::DecodeFields(serialize::Decoder* dec) {
+  command_t* x0 = command_t::Decode(dec);
+  List<redir*>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<redir*>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(redir::Decode(dec));
+    }
+  }
+  List<int>* x2 = nullptr;
+  int n2 = dec->Int();
+  if (n2 >= 0) {
+    x2 = Alloc<List<int>>();
+    for (int i = 0; i < n2; ++i) {
+      x2->append(dec->SpanId());
+    }
+  }
+  command__Subshell* obj = Alloc<command__Subshell>(x0, x1);
+  obj->spids = x2;
+  return obj;
+}
+
+hnode_t* command__DParen::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("command.DParen"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->child->PrettyTree();
+  L->append(Alloc<field>(StrFromC("child"), x0));
+
+  if (this->redirects != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<redir*> it(this->redirects); !it.Done(); it.Next()) {
+      redir* i1 = it.Value();
+      x1->children->append(i1->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("redirects"), x1));
+  }
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x2 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i2 = it.Value();
+      x2->children->append(Alloc<hnode__Leaf>(str(i2), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x2));
+  }
+
+  return out_node;
+}
+
+void command__DParen::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, command_e::DParen)) {
+    return;
+  }
+  enc->Obj(this->child);
+  if (this->redirects == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->redirects));
+    for (ListIter<redir*> it(this->redirects); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+command__DParen* command__DParen::DecodeFields(serialize::Decoder* dec) {
+  arith_expr_t* x0 = arith_expr_t::Decode(dec);
+  List<redir*>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<redir*>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(redir::Decode(dec));
+    }
+  }
+  List<int>* x2 = nullptr;
+  int n2 = dec->Int();
+  if (n2 >= 0) {
+    x2 = Alloc<List<int>>();
+    for (int i = 0; i < n2; ++i) {
+      x2->append(dec->SpanId());
+    }
+  }
+  command__DParen* obj = Alloc<command__DParen>(x0, x1);
+  obj->spids = x2;
+  return obj;
+}
+
+hnode_t* command__DBracket::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("command.DBracket"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->expr->PrettyTree();
+  L->append(Alloc<field>(StrFromC("expr"), x0));
+
+  if (this->redirects != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<redir*> it(this->redirects); !it.Done(); it.Next()) {
+      redir* i1 = it.Value();
+      x1->children->append(i1->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("redirects"), x1));
+  }
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x2 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i2 = it.Value();
+      x2->children->append(Alloc<hnode__Leaf>(str(i2), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x2));
+  }
+
+  return out_node;
+}
+
+void command__DBracket::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, command_e::DBracket)) {
+    return;
+  }
+  enc->Obj(this->expr);
+  if (this->redirects == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->redirects));
+    for (ListIter<redir*> it(this->redirects); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+command__DBracket* command__DBracket::DecodeFields(serialize::Decoder* dec) {
+  bool_expr_t* x0 = bool_expr_t::Decode(dec);
+  List<redir*>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<redir*>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(redir::Decode(dec));
+    }
+  }
+  List<int>* x2 = nullptr;
+  int n2 = dec->Int();
+  if (n2 >= 0) {
+    x2 = Alloc<List<int>>();
+    for (int i = 0; i < n2; ++i) {
+      x2->append(dec->SpanId());
+    }
+  }
+  command__DBracket* obj = Alloc<command__DBracket>(x0, x1);
+  obj->spids = x2;
+  return obj;
+}
+
+hnode_t* command__ForEach::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("command.ForEach"));
+  List<field*>* L = out_node->fields;
+
+  if (this->iter_names != nullptr) {  // array
+    hnode__Array* x0 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<Str*> it(this->iter_names); !it.Done(); it.Next()) {
+      Str* i0 = it.Value();
+      x0->children->append(runtime::NewLeaf(i0, color_e::StringConst));
+    }
+    L->append(Alloc<field>(StrFromC("iter_names"), x0));
+  }
+
+  hnode_t* x1 = this->iterable->PrettyTree();
+  L->append(Alloc<field>(StrFromC("iterable"), x1));
+
+  hnode_t* x2 = this->body->PrettyTree();
+  L->append(Alloc<field>(StrFromC("body"), x2));
+
+  if (this->redirects != nullptr) {  // array
+    hnode__Array* x3 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<redir*> it(this->redirects); !it.Done(); it.Next()) {
+      redir* i3 = it.Value();
+      x3->children->append(i3->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("redirects"), x3));
+  }
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x4 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i4 = it.Value();
+      x4->children->append(Alloc<hnode__Leaf>(str(i4), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x4));
+  }
+
+  return out_node;
+}
+
+void command__ForEach::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, command_e::ForEach)) {
+    return;
+  }
+  if (this->iter_names == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->iter_names));
+    for (ListIter<Str*> it(this->iter_names); !it.Done(); it.Next()) {
+      enc->Str(it.Value());
+    }
+  }
+  enc->Obj(this->iterable);
+  enc->Obj(this->body);
+  if (this->redirects == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->redirects));
+    for (ListIter<redir*> it(this->redirects); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+command__ForEach* command__ForEach::DecodeFields(serialize::Decoder* dec) {
+  List<Str*>* x0 = nullptr;
+  int n0 = dec->Int();
+  if (n0 >= 0) {
+    x0 = Alloc<List<Str*>>();
+    for (int i = 0; i < n0; ++i) {
+      x0->append(dec->Str());
+    }
+  }
+  for_iter_t* x1 = for_iter_t::Decode(dec);
+  command_t* x2 = command_t::Decode(dec);
+  List<redir*>* x3 = nullptr;
+  int n3 = dec->Int();
+  if (n3 >= 0) {
+    x3 = Alloc<List<redir*>>();
+    for (int i = 0; i < n3; ++i) {
+      x3->append(redir::Decode(dec));
+    }
+  }
+  List<int>* x4 = nullptr;
+  int n4 = dec->Int();
+  if (n4 >= 0) {
+    x4 = Alloc<List<int>>();
+    for (int i = 0; i < n4; ++i) {
+      x4->append(dec->SpanId());
+    }
+  }
+  command__ForEach* obj = Alloc<command__ForEach>(x0, x1, x2, x3);
+  obj->spids = x4;
+  return obj;
+}
+
+hnode_t* command__ForExpr::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("command.ForExpr"));
+  List<field*>* L = out_node->fields;
+
+  if (this->init) {  // maybe
+    hnode_t* x0 = this->init->PrettyTree();
+    L->append(Alloc<field>(StrFromC("init"), x0));
+  }
+
+  if (this->cond) {  // maybe
+    hnode_t* x1 = this->cond->PrettyTree();
+    L->append(Alloc<field>(StrFromC("cond"), x1));
+  }
+
+  if (this->update) {  // maybe
+    hnode_t* x2 = this->update->PrettyTree();
+    L->append(Alloc<field>(StrFromC("update"), x2));
+  }
+
+  if (this->body) {  // maybe
+    hnode_t* x3 = this->body->PrettyTree();
+    L->append(Alloc<field>(StrFromC("body"), x3));
+  }
+
+  if (this->redirects != nullptr) {  // array
+    hnode__Array* x4 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<redir*> it(this->redirects); !it.Done(); it.Next()) {
+      redir* i4 = it.Value();
+      x4->children->append(i4->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("redirects"), x4));
+  }
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x5 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i5 = it.Value();
+      x5->children->append(Alloc<hnode__Leaf>(str(i5), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x5));
+  }
+
+  return out_node;
+}
+
+void command__ForExpr::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, command_e::ForExpr)) {
+    return;
+  }
+  enc->Obj(this->init);
+  enc->Obj(this->cond);
+  enc->Obj(this->update);
+  enc->Obj(this->body);
+  if (this->redirects == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->redirects));
+    for (ListIter<redir*> it(this->redirects); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+command__ForExpr* command__ForExpr::DecodeFields(serialize::Decoder* dec) {
+  arith_expr_t* x0 = arith_expr_t::Decode(dec);
+  arith_expr_t* x1 = arith_expr_t::Decode(dec);
+  arith_expr_t* x2 = arith_expr_t::Decode(dec);
+  command_t* x3 = command_t::Decode(dec);
+  List<redir*>* x4 = nullptr;
+  int n4 = dec->Int();
+  if (n4 >= 0) {
+    x4 = Alloc<List<redir*>>();
+    for (int i = 0; i < n4; ++i) {
+      x4->append(redir::Decode(dec));
+    }
+  }
+  List<int>* x5 = nullptr;
+  int n5 = dec->Int();
+  if (n5 >= 0) {
+    x5 = Alloc<List<int>>();
+    for (int i = 0; i < n5; ++i) {
+      x5->append(dec->SpanId());
+    }
+  }
+  command__ForExpr* obj = Alloc<command__ForExpr>(x0, x1, x2, x3, x4);
+  obj->spids = x5;
+  return obj;
+}
+
+hnode_t* command__WhileUntil::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("command.WhileUntil"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->keyword->PrettyTree();
+  L->append(Alloc<field>(StrFromC("keyword"), x0));
+
+  hnode_t* x1 = this->cond->PrettyTree();
+  L->append(Alloc<field>(StrFromC("cond"), x1));
+
+  hnode_t* x2 = this->body->PrettyTree();
+  L->append(Alloc<field>(StrFromC("body"), x2));
+
+  if (this->redirects != nullptr) {  // array
+    hnode__Array* x3 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<redir*> it(this->redirects); !it.Done(); it.Next()) {
+      redir* i3 = it.Value();
+      x3->children->append(i3->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("redirects"), x3));
+  }
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x4 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i4 = it.Value();
+      x4->children->append(Alloc<hnode__Leaf>(str(i4), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x4));
+  }
+
+  return out_node;
+}
+
+void command__WhileUntil::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, command_e::WhileUntil)) {
+    return;
+  }
+  enc->Obj(this->keyword);
+  enc->Obj(this->cond);
+  enc->Obj(this->body);
+  if (this->redirects == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->redirects));
+    for (ListIter<redir*> it(this->redirects); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+command__WhileUntil* command__WhileUntil::DecodeFields(serialize::Decoder* dec)
+                                                       {
+  Token* x0 = Token::Decode(dec);
+  condition_t* x1 = condition_t::Decode(dec);
+  command_t* x2 = command_t::Decode(dec);
+  List<redir*>* x3 = nullptr;
+  int n3 = dec->Int();
+  if (n3 >= 0) {
+    x3 = Alloc<List<redir*>>();
+    for (int i = 0; i < n3; ++i) {
+      x3->append(redir::Decode(dec));
+    }
+  }
+  List<int>* x4 = nullptr;
+  int n4 = dec->Int();
+  if (n4 >= 0) {
+    x4 = Alloc<List<int>>();
+    for (int i = 0; i < n4; ++i) {
+      x4->append(dec->SpanId());
+    }
+  }
+  command__WhileUntil* obj = Alloc<command__WhileUntil>(x0, x1, x2, x3);
+  obj->spids = x4;
+  return obj;
+}
+
+hnode_t* command__If::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("command.If"));
+  List<field*>* L = out_node->fields;
+
+  if (this->arms != nullptr) {  // array
+    hnode__Array* x0 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<if_arm*> it(this->arms); !it.Done(); it.Next()) {
+      if_arm* i0 = it.Value();
+      x0->children->append(i0->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("arms"), x0));
+  }
+
+  if (this->else_action != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<command_t*> it(this->else_action); !it.Done(); it.Next()) {
+      command_t* i1 = it.Value();
+      x1->children->append(i1->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("else_action"), x1));
+  }
+
+  if (this->redirects != nullptr) {  // array
+    hnode__Array* x2 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<redir*> it(this->redirects); !it.Done(); it.Next()) {
+      redir* i2 = it.Value();
+      x2->children->append(i2->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("redirects"), x2));
+  }
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x3 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i3 = it.Value();
+      x3->children->append(Alloc<hnode__Leaf>(str(i3), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x3));
+  }
+
+  return out_node;
+}
+
+void command__If::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, command_e::If)) {
+    return;
+  }
+  if (this->arms == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->arms));
+    for (ListIter<if_arm*> it(this->arms); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  if (this->else_action == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->else_action));
+    for (ListIter<command_t*> it(this->else_action); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  if (this->redirects == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->redirects));
+    for (ListIter<redir*> it(this->redirects); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+command__If* command__If::DecodeFields(serialize::Decoder* dec) {
+  List<if_arm*>* x0 = nullptr;
+  int n0 = dec->Int();
+  if (n0 >= 0) {
+    x0 = Alloc<List<if_arm*>>();
+    for (int i = 0; i < n0; ++i) {
+      x0->append(if_arm::Decode(dec));
+    }
+  }
+  List<command_t*>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<command_t*>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(command_t::Decode(dec));
+    }
+  }
+  List<redir*>* x2 = nullptr;
+  int n2 = dec->Int();
+  if (n2 >= 0) {
+    x2 = Alloc<List<redir*>>();
+    for (int i = 0; i < n2; ++i) {
+      x2->append(redir::Decode(dec));
+    }
+  }
+  List<int>* x3 = nullptr;
+  int n3 = dec->Int();
+  if (n3 >= 0) {
+    x3 = Alloc<List<int>>();
+    for (int i = 0; i < n3; ++i) {
+      x3->append(dec->SpanId());
+    }
+  }
+  command__If* obj = Alloc<command__If>(x0, x1, x2);
+  obj->spids = x3;
+  return obj;
+}
+
+hnode_t* command__Case::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("command.Case"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->to_match->PrettyTree();
+  L->append(Alloc<field>(StrFromC("to_match"), x0));
+
+  if (this->arms != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<case_arm*> it(this->arms); !it.Done(); it.Next()) {
+      case_arm* i1 = it.Value();
+      x1->children->append(i1->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("arms"), x1));
+  }
+
+  if (this->redirects != nullptr) {  // array
+    hnode__Array* x2 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<redir*> it(this->redirects); !it.Done(); it.Next()) {
+      redir* i2 = it.Value();
+      x2->children->append(i2->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("redirects"), x2));
+  }
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x3 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i3 = it.Value();
+      x3->children->append(Alloc<hnode__Leaf>(str(i3), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x3));
+  }
+
+  return out_node;
+}
+
+void command__Case::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, command_e::Case)) {
+    return;
+  }
+  enc->Obj(this->to_match);
+  if (this->arms == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->arms));
+    for (ListIter<case_arm*> it(this->arms); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  if (this->redirects == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->redirects));
+    for (ListIter<redir*> it(this->redirects); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+command__Case* command__Case::DecodeFields(serialize::Decoder* dec) {
+  word_t* x0 = word_t::Decode(dec);
+  List<case_arm*>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<case_arm*>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(case_arm::Decode(dec));
+    }
+  }
+  List<redir*>* x2 = nullptr;
+  int n2 = dec->Int();
+  if (n2 >= 0) {
+    x2 = Alloc<List<redir*>>();
+    for (int i = 0; i < n2; ++i) {
+      x2->append(redir::Decode(dec));
+    }
+  }
+  List<int>* x3 = nullptr;
+  int n3 = dec->Int();
+  if (n3 >= 0) {
+    x3 = Alloc<List<int>>();
+    for (int i = 0; i < n3; ++i) {
+      x3->append(dec->SpanId());
+    }
+  }
+  command__Case* obj = Alloc<command__Case>(x0, x1, x2);
+  obj->spids = x3;
+  return obj;
+}
+
+hnode_t* command__ShFunction::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("command.ShFunction"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = runtime::NewLeaf(this->name, color_e::StringConst);
+  L->append(Alloc<field>(StrFromC("name"), x0));
+
+  hnode_t* x1 = this->body->PrettyTree();
+  L->append(Alloc<field>(StrFromC("body"), x1));
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x2 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i2 = it.Value();
+      x2->children->append(Alloc<hnode__Leaf>(str(i2), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x2));
+  }
+
+  return out_node;
+}
+
+void command__ShFunction::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, command_e::ShFunction)) {
+    return;
+  }
+  enc->Str(this->name);
+  enc->Obj(this->body);
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+command__ShFunction* command__ShFunction::DecodeFields(serialize::Decoder* dec)
+                                                       {
+  Str* x0 = dec->Str();
+  command_t* x1 = command_t::Decode(dec);
+  List<int>* x2 = nullptr;
+  int n2 = dec->Int();
+  if (n2 >= 0) {
+    x2 = Alloc<List<int>>();
+    for (int i = 0; i < n2; ++i) {
+      x2->append(dec->SpanId());
+    }
+  }
+  command__ShFunction* obj = Alloc<command__ShFunction>(x0, x1);
+  obj->spids = x2;
+  return obj;
+}
+
+hnode_t* command__TimeBlock::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("command.TimeBlock"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->pipeline->PrettyTree();
+  L->append(Alloc<field>(StrFromC("pipeline"), x0));
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i1 = it.Value();
+      x1->children->append(Alloc<hnode__Leaf>(str(i1), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x1));
+  }
+
+  return out_node;
+}
+
+void command__TimeBlock::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, command_e::TimeBlock)) {
+    return;
+  }
+  enc->Obj(this->pipeline);
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+command__TimeBlock* command__TimeBlock::DecodeFields(serialize::Decoder* dec) {
+  command_t* x0 = command_t::Decode(dec);
+  List<int>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<int>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(dec->SpanId());
+    }
+  }
+  command__TimeBlock* obj = Alloc<command__TimeBlock>(x0);
+  obj->spids = x1;
+  return obj;
+}
+
+hnode_t* command__CommandList::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("command.CommandList"));
+  List<field*>* L = out_node->fields;
+
+  if (this->children != nullptr) {  // array
+    hnode__Array* x0 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<command_t*> it(this->children); !it.Done(); it.Next()) {
+      command_t* i0 = it.Value();
+      x0->children->append(i0->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("children"), x0));
+  }
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i1 = it.Value();
+      x1->children->append(Alloc<hnode__Leaf>(str(i1), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x1));
+  }
+
+  return out_node;
+}
+
+void command__CommandList::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, command_e::CommandList)) {
+    return;
+  }
+  if (this->children == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->children));
+    for (ListIter<command_t*> it(this->children); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+command__CommandList* command__CommandList::DecodeFields(serialize::Decoder*
+                                                         dec) {
+  List<command_t*>* x0 = nullptr;
+  int n0 = dec->Int();
+  if (n0 >= 0) {
+    x0 = Alloc<List<command_t*>>();
+    for (int i = 0; i < n0; ++i) {
+      x0->append(command_t::Decode(dec));
+    }
+  }
+  List<int>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<int>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(dec->SpanId());
+    }
+  }
+  command__CommandList* obj = Alloc<command__CommandList>(x0);
+  obj->spids = x1;
+  return obj;
+}
+
+hnode_t* command__BareDecl::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("command.BareDecl"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->lhs->PrettyTree();
+  L->append(Alloc<field>(StrFromC("lhs"), x0));
+
+  hnode_t* x1 = this->rhs->PrettyTree();
+  L->append(Alloc<field>(StrFromC("rhs"), x1));
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x2 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i2 = it.Value();
+      x2->children->append(Alloc<hnode__Leaf>(str(i2), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x2));
+  }
+
+  return out_node;
+}
+
+void command__BareDecl::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, command_e::BareDecl)) {
+    return;
+  }
+  enc->Obj(this->lhs);
+  enc->Obj(this->rhs);
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+command__BareDecl* command__BareDecl::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  expr_t* x1 = expr_t::Decode(dec);
+  List<int>* x2 = nullptr;
+  int n2 = dec->Int();
+  if (n2 >= 0) {
+    x2 = Alloc<List<int>>();
+    for (int i = 0; i < n2; ++i) {
+      x2->append(dec->SpanId());
+    }
+  }
+  command__BareDecl* obj = Alloc<command__BareDecl>(x0, x1);
+  obj->spids = x2;
+  return obj;
+}
+
+hnode_t* command__VarDecl::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("command.VarDecl"));
+  List<field*>* L = out_node->fields;
+
+  if (this->keyword) {  // maybe
+    hnode_t* x0 = this->keyword->PrettyTree();
+    L->append(Alloc<field>(StrFromC("keyword"), x0));
+  }
+
+  if (this->lhs != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<name_type*> it(this->lhs); !it.Done(); it.Next()) {
+      name_type* i1 = it.Value();
+      x1->children->append(i1->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("lhs"), x1));
+  }
+
+  hnode_t* x2 = this->rhs->PrettyTree();
+  L->append(Alloc<field>(StrFromC("rhs"), x2));
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x3 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i3 = it.Value();
+      x3->children->append(Alloc<hnode__Leaf>(str(i3), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x3));
+  }
+
+  return out_node;
+}
+
+void command__VarDecl::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, command_e::VarDecl)) {
+    return;
+  }
+  enc->Obj(this->keyword);
+  if (this->lhs == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->lhs));
+    for (ListIter<name_type*> it(this->lhs); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->Obj(this->rhs);
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+command__VarDecl* command__VarDecl::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  List<name_type*>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<name_type*>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(name_type::Decode(dec));
+    }
+  }
+  expr_t* x2 = expr_t::Decode(dec);
+  List<int>* x3 = nullptr;
+  int n3 = dec->Int();
+  if (n3 >= 0) {
+    x3 = Alloc<List<int>>();
+    for (int i = 0; i < n3; ++i) {
+      x3->append(dec->SpanId());
+    }
+  }
+  command__VarDecl* obj = Alloc<command__VarDecl>(x0, x1, x2);
+  obj->spids = x3;
+  return obj;
+}
+
+hnode_t* command__PlaceMutation::PrettyTree() {
+  hnode__Record* out_node =
+runtime::NewRecord(StrFromC("command.PlaceMutation"));
+  List<field*>* L = out_node->fields;
+
+  if (this->keyword) {  // maybe
+    hnode_t* x0 = this->keyword->PrettyTree();
+    L->append(Alloc<field>(StrFromC("keyword"), x0));
+  }
+
+  if (this->lhs != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<place_expr_t*> it(this->lhs); !it.Done(); it.Next()) {
+      place_expr_t* i1 = it.Value();
+      x1->children->append(i1->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("lhs"), x1));
+  }
+
+  hnode_t* x2 = this->op->PrettyTree();
+  L->append(Alloc<field>(StrFromC("op"), x2));
+
+  hnode_t* x3 = this->rhs->PrettyTree();
+  L->append(Alloc<field>(StrFromC("rhs"), x3));
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x4 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i4 = it.Value();
+      x4->children->append(Alloc<hnode__Leaf>(str(i4), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x4));
+  }
+
+  return out_node;
+}
+
+void command__PlaceMutation::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, command_e::PlaceMutation)) {
+    return;
+  }
+  enc->Obj(this->keyword);
+  if (this->lhs == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->lhs));
+    for (ListIter<place_expr_t*> it(this->lhs); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->Obj(this->op);
+  enc->Obj(this->rhs);
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+command__PlaceMutation*
+command__PlaceMutation::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  List<place_expr_t*>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<place_expr_t*>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(place_expr_t::Decode(dec));
+    }
+  }
+  Token* x2 = Token::Decode(dec);
+  expr_t* x3 = expr_t::Decode(dec);
+  List<int>* x4 = nullptr;
+  int n4 = dec->Int();
+  if (n4 >= 0) {
+    x4 = Alloc<List<int>>();
+    for (int i = 0; i < n4; ++i) {
+      x4->append(dec->SpanId());
+    }
+  }
+  command__PlaceMutation* obj = Alloc<command__PlaceMutation>(x0, x1, x2, x3);
+  obj->spids = x4;
+  return obj;
+}
+
+hnode_t* command__Expr::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("command.Expr"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->keyword->PrettyTree();
+  L->append(Alloc<field>(StrFromC("keyword"), x0));
+
+  hnode_t* x1 = this->e->PrettyTree();
+  L->append(Alloc<field>(StrFromC("e"), x1));
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x2 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i2 = it.Value();
+      x2->children->append(Alloc<hnode__Leaf>(str(i2), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x2));
+  }
+
+  return out_node;
+}
+
+void command__Expr::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, command_e::Expr)) {
+    return;
+  }
+  enc->Obj(this->keyword);
+  enc->Obj(this->e);
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+command__Expr* command__Expr::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  expr_t* x1 = expr_t::Decode(dec);
+  List<int>* x2 = nullptr;
+  int n2 = dec->Int();
+  if (n2 >= 0) {
+    x2 = Alloc<List<int>>();
+    for (int i = 0; i < n2; ++i) {
+      x2->append(dec->SpanId());
+    }
+  }
+  command__Expr* obj = Alloc<command__Expr>(x0, x1);
+  obj->spids = x2;
+  return obj;
+}
+
+hnode_t* command__Proc::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("command.Proc"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->name->PrettyTree();
+  L->append(Alloc<field>(StrFromC("name"), x0));
+
+  hnode_t* x1 = this->sig->PrettyTree();
+  L->append(Alloc<field>(StrFromC("sig"), x1));
+
+  hnode_t* x2 = this->body->PrettyTree();
+  L->append(Alloc<field>(StrFromC("body"), x2));
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x3 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i3 = it.Value();
+      x3->children->append(Alloc<hnode__Leaf>(str(i3), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x3));
+  }
+
+  return out_node;
+}
+
+void command__Proc::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, command_e::Proc)) {
+    return;
+  }
+  enc->Obj(this->name);
+  enc->Obj(this->sig);
+  enc->Obj(this->body);
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+command__Proc* command__Proc::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  proc_sig_t* x1 = proc_sig_t::Decode(dec);
+  command_t* x2 = command_t::Decode(dec);
+  List<int>* x3 = nullptr;
+  int n3 = dec->Int();
+  if (n3 >= 0) {
+    x3 = Alloc<List<int>>();
+    for (int i = 0; i < n3; ++i) {
+      x3->append(dec->SpanId());
+    }
+  }
+  command__Proc* obj = Alloc<command__Proc>(x0, x1, x2);
+  obj->spids = x3;
+  return obj;
+}
+
+hnode_t* command__Func::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("command.Func"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->name->PrettyTree();
+  L->append(Alloc<field>(StrFromC("name"), x0));
+
+  if (this->pos_params != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<param*> it(this->pos_params); !it.Done(); it.Next()) {
+      param* i1 = it.Value();
+      x1->children->append(i1->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("pos_params"), x1));
+  }
+
+  if (this->pos_splat) {  // maybe
+    hnode_t* x2 = this->pos_splat->PrettyTree();
+    L->append(Alloc<field>(StrFromC("pos_splat"), x2));
+  }
+
+  if (this->named_params != nullptr) {  // array
+    hnode__Array* x3 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<param*> it(this->named_params); !it.Done(); it.Next()) {
+      param* i3 = it.Value();
+      x3->children->append(i3->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("named_params"), x3));
+  }
+
+  if (this->named_splat) {  // maybe
+    hnode_t* x4 = this->named_splat->PrettyTree();
+    L->append(Alloc<field>(StrFromC("named_splat"), x4));
+  }
+
+  if (this->return_types != nullptr) {  // array
+    hnode__Array* x5 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<type_expr_t*> it(this->return_types); !it.Done(); it.Next()) {
+      type_expr_t* i5 = it.Value();
+      x5->children->append(i5->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("return_types"), x5));
+  }
+
+  hnode_t* x6 = this->body->PrettyTree();
+  L->append(Alloc<field>(StrFromC("body"), x6));
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x7 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i7 = it.Value();
+      x7->children->append(Alloc<hnode__Leaf>(str(i7), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x7));
+  }
+
+  return out_node;
+}
+
+void command__Func::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, command_e::Func)) {
+    return;
+  }
+  enc->Obj(this->name);
+  if (this->pos_params == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->pos_params));
+    for (ListIter<param*> it(this->pos_params); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->Obj(this->pos_splat);
+  if (this->named_params == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->named_params));
+    for (ListIter<param*> it(this->named_params); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->Obj(this->named_splat);
+  if (this->return_types == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->return_types));
+    for (ListIter<type_expr_t*> it(this->return_types); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->Obj(this->body);
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+command__Func* command__Func::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  List<param*>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<param*>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(param::Decode(dec));
+    }
+  }
+  Token* x2 = Token::Decode(dec);
+  List<param*>* x3 = nullptr;
+  int n3 = dec->Int();
+  if (n3 >= 0) {
+    x3 = Alloc<List<param*>>();
+    for (int i = 0; i < n3; ++i) {
+      x3->append(param::Decode(dec));
+    }
+  }
+  Token* x4 = Token::Decode(dec);
+  List<type_expr_t*>* x5 = nullptr;
+  int n5 = dec->Int();
+  if (n5 >= 0) {
+    x5 = Alloc<List<type_expr_t*>>();
+    for (int i = 0; i < n5; ++i) {
+      x5->append(type_expr_t::Decode(dec));
+    }
+  }
+  command_t* x6 = command_t::Decode(dec);
+  List<int>* x7 = nullptr;
+  int n7 = dec->Int();
+  if (n7 >= 0) {
+    x7 = Alloc<List<int>>();
+    for (int i = 0; i < n7; ++i) {
+      x7->append(dec->SpanId());
+    }
+  }
+  command__Func* obj = Alloc<command__Func>(x0, x1, x2, x3, x4, x5, x6);
+  obj->spids = x7;
+  return obj;
+}
+
+hnode_t* command__Data::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("command.Data"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->name->PrettyTree();
+  L->append(Alloc<field>(StrFromC("name"), x0));
+
+  if (this->params != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<param*> it(this->params); !it.Done(); it.Next()) {
+      param* i1 = it.Value();
+      x1->children->append(i1->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("params"), x1));
+  }
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x2 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i2 = it.Value();
+      x2->children->append(Alloc<hnode__Leaf>(str(i2), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x2));
+  }
+
+  return out_node;
+}
+
+void command__Data::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, command_e::Data)) {
+    return;
+  }
+  enc->Obj(this->name);
+  if (this->params == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->params));
+    for (ListIter<param*> it(this->params); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+command__Data* command__Data::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  List<param*>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<param*>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(param::Decode(dec));
+    }
+  }
+  List<int>* x2 = nullptr;
+  int n2 = dec->Int();
+  if (n2 >= 0) {
+    x2 = Alloc<List<int>>();
+    for (int i = 0; i < n2; ++i) {
+      x2->append(dec->SpanId());
+    }
+  }
+  command__Data* obj = Alloc<command__Data>(x0, x1);
+  obj->spids = x2;
+  return obj;
+}
+
+hnode_t* command__Enum::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("command.Enum"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->name->PrettyTree();
+  L->append(Alloc<field>(StrFromC("name"), x0));
+
+  if (this->variants != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<variant*> it(this->variants); !it.Done(); it.Next()) {
+      variant* i1 = it.Value();
+      x1->children->append(i1->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("variants"), x1));
+  }
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x2 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i2 = it.Value();
+      x2->children->append(Alloc<hnode__Leaf>(str(i2), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x2));
+  }
+
+  return out_node;
+}
+
+void command__Enum::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, command_e::Enum)) {
+    return;
+  }
+  enc->Obj(this->name);
+  if (this->variants == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->variants));
+    for (ListIter<variant*> it(this->variants); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+command__Enum* command__Enum::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  List<variant*>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<variant*>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(variant::Decode(dec));
+    }
+  }
+  List<int>* x2 = nullptr;
+  int n2 = dec->Int();
+  if (n2 >= 0) {
+    x2 = Alloc<List<int>>();
+    for (int i = 0; i < n2; ++i) {
+      x2->append(dec->SpanId());
+    }
+  }
+  command__Enum* obj = Alloc<command__Enum>(x0, x1);
+  obj->spids = x2;
+  return obj;
+}
+
+hnode_t* command__Class::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("command.Class"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->name->PrettyTree();
+  L->append(Alloc<field>(StrFromC("name"), x0));
+
+  if (this->extends) {  // maybe
+    hnode_t* x1 = this->extends->PrettyTree();
+    L->append(Alloc<field>(StrFromC("extends"), x1));
+  }
+
+  if (this->items != nullptr) {  // array
+    hnode__Array* x2 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<class_item_t*> it(this->items); !it.Done(); it.Next()) {
+      class_item_t* i2 = it.Value();
+      x2->children->append(i2->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("items"), x2));
+  }
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x3 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i3 = it.Value();
+      x3->children->append(Alloc<hnode__Leaf>(str(i3), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x3));
+  }
+
+  return out_node;
+}
+
+void command__Class::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, command_e::Class)) {
+    return;
+  }
+  enc->Obj(this->name);
+  enc->Obj(this->extends);
+  if (this->items == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->items));
+    for (ListIter<class_item_t*> it(this->items); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+command__Class* command__Class::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  Token* x1 = Token::Decode(dec);
+  List<class_item_t*>* x2 = nullptr;
+  int n2 = dec->Int();
+  if (n2 >= 0) {
+    x2 = Alloc<List<class_item_t*>>();
+    for (int i = 0; i < n2; ++i) {
+      x2->append(class_item_t::Decode(dec));
+    }
+  }
+  List<int>* x3 = nullptr;
+  int n3 = dec->Int();
+  if (n3 >= 0) {
+    x3 = Alloc<List<int>>();
+    for (int i = 0; i < n3; ++i) {
+      x3->append(dec->SpanId());
+    }
+  }
+  command__Class* obj = Alloc<command__Class>(x0, x1, x2);
+  obj->spids = x3;
+  return obj;
+}
+
+hnode_t* command__Import::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("command.Import"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->path->PrettyTree();
+  L->append(Alloc<field>(StrFromC("path"), x0));
+
+  if (this->alias) {  // maybe
+    hnode_t* x1 = this->alias->PrettyTree();
+    L->append(Alloc<field>(StrFromC("alias"), x1));
+  }
+
+  if (this->names != nullptr) {  // array
+    hnode__Array* x2 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<import_name*> it(this->names); !it.Done(); it.Next()) {
+      import_name* i2 = it.Value();
+      x2->children->append(i2->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("names"), x2));
+  }
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x3 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i3 = it.Value();
+      x3->children->append(Alloc<hnode__Leaf>(str(i3), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x3));
+  }
+
+  return out_node;
+}
+
+void command__Import::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, command_e::Import)) {
+    return;
+  }
+  enc->Obj(this->path);
+  enc->Obj(this->alias);
+  if (this->names == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->names));
+    for (ListIter<import_name*> it(this->names); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+command__Import* command__Import::DecodeFields(serialize::Decoder* dec) {
+  single_quoted* x0 = single_quoted::Decode(dec);
+  Token* x1 = Token::Decode(dec);
+  List<import_name*>* x2 = nullptr;
+  int n2 = dec->Int();
+  if (n2 >= 0) {
+    x2 = Alloc<List<import_name*>>();
+    for (int i = 0; i < n2; ++i) {
+      x2->append(import_name::Decode(dec));
+    }
+  }
+  List<int>* x3 = nullptr;
+  int n3 = dec->Int();
+  if (n3 >= 0) {
+    x3 = Alloc<List<int>>();
+    for (int i = 0; i < n3; ++i) {
+      x3->append(dec->SpanId());
+    }
+  }
+  command__Import* obj = Alloc<command__Import>(x0, x1, x2);
+  obj->spids = x3;
+  return obj;
+}
+
+hnode_t* command__For::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("command.For"));
+  List<field*>* L = out_node->fields;
+
+  if (this->targets != nullptr) {  // array
+    hnode__Array* x0 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<name_type*> it(this->targets); !it.Done(); it.Next()) {
+      name_type* i0 = it.Value();
+      x0->children->append(i0->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("targets"), x0));
+  }
+
+  hnode_t* x1 = this->iterable->PrettyTree();
+  L->append(Alloc<field>(StrFromC("iterable"), x1));
+
+  hnode_t* x2 = this->body->PrettyTree();
+  L->append(Alloc<field>(StrFromC("body"), x2));
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x3 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i3 = it.Value();
+      x3->children->append(Alloc<hnode__Leaf>(str(i3), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x3));
+  }
+
+  return out_node;
+}
+
+void command__For::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, command_e::For)) {
+    return;
+  }
+  if (this->targets == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->targets));
+    for (ListIter<name_type*> it(this->targets); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->Obj(this->iterable);
+  enc->Obj(this->body);
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+command__For* command__For::DecodeFields(serialize::Decoder* dec) {
+  List<name_type*>* x0 = nullptr;
+  int n0 = dec->Int();
+  if (n0 >= 0) {
+    x0 = Alloc<List<name_type*>>();
+    for (int i = 0; i < n0; ++i) {
+      x0->append(name_type::Decode(dec));
+    }
+  }
+  expr_t* x1 = expr_t::Decode(dec);
+  command_t* x2 = command_t::Decode(dec);
+  List<int>* x3 = nullptr;
+  int n3 = dec->Int();
+  if (n3 >= 0) {
+    x3 = Alloc<List<int>>();
+    for (int i = 0; i < n3; ++i) {
+      x3->append(dec->SpanId());
+    }
+  }
+  command__For* obj = Alloc<command__For>(x0, x1, x2);
+  obj->spids = x3;
+  return obj;
+}
+
+hnode_t* command__While::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("command.While"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->test->PrettyTree();
+  L->append(Alloc<field>(StrFromC("test"), x0));
+
+  hnode_t* x1 = this->body->PrettyTree();
+  L->append(Alloc<field>(StrFromC("body"), x1));
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x2 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i2 = it.Value();
+      x2->children->append(Alloc<hnode__Leaf>(str(i2), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x2));
+  }
+
+  return out_node;
+}
+
+void command__While::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, command_e::While)) {
+    return;
+  }
+  enc->Obj(this->test);
+  enc->Obj(this->body);
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+command__While* command__While::DecodeFields(serialize::Decoder* dec) {
+  expr_t* x0 = expr_t::Decode(dec);
+  command_t* x1 = command_t::Decode(dec);
+  List<int>* x2 = nullptr;
+  int n2 = dec->Int();
+  if (n2 >= 0) {
+    x2 = Alloc<List<int>>();
+    for (int i = 0; i < n2; ++i) {
+      x2->append(dec->SpanId());
+    }
+  }
+  command__While* obj = Alloc<command__While>(x0, x1);
+  obj->spids = x2;
+  return obj;
+}
+
+hnode_t* command__Break::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("command.Break"));
+  List<field*>* L = out_node->fields;
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x0 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i0 = it.Value();
+      x0->children->append(Alloc<hnode__Leaf>(str(i0), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x0));
+  }
+
+  return out_node;
+}
+
+void command__Break::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, command_e::Break)) {
+    return;
+  }
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+command__Break* command__Break::DecodeFields(serialize::Decoder* dec) {
+  List<int>* x0 = nullptr;
+  int n0 = dec->Int();
+  if (n0 >= 0) {
+    x0 = Alloc<List<int>>();
+    for (int i = 0; i < n0; ++i) {
+      x0->append(dec->SpanId());
+    }
+  }
+  command__Break* obj = Alloc<command__Break>();
+  obj->spids = x0;
+  return obj;
+}
+
+hnode_t* command__Continue::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("command.Continue"));
+  List<field*>* L = out_node->fields;
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x0 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i0 = it.Value();
+      x0->children->append(Alloc<hnode__Leaf>(str(i0), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x0));
+  }
+
+  return out_node;
+}
+
+void command__Continue::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, command_e::Continue)) {
+    return;
+  }
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+command__Continue* command__Continue::DecodeFields(serialize::Decoder* dec) {
+  List<int>* x0 = nullptr;
+  int n0 = dec->Int();
+  if (n0 >= 0) {
+    x0 = Alloc<List<int>>();
+    for (int i = 0; i < n0; ++i) {
+      x0->append(dec->SpanId());
+    }
+  }
+  command__Continue* obj = Alloc<command__Continue>();
+  obj->spids = x0;
+  return obj;
+}
+
+hnode_t* command__Return::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("command.Return"));
+  List<field*>* L = out_node->fields;
+
+  if (this->value) {  // maybe
+    hnode_t* x0 = this->value->PrettyTree();
+    L->append(Alloc<field>(StrFromC("value"), x0));
+  }
+
+  if (this->spids != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      int i1 = it.Value();
+      x1->children->append(Alloc<hnode__Leaf>(str(i1), color_e::OtherConst));
+    }
+    L->append(Alloc<field>(StrFromC("spids"), x1));
+  }
+
+  return out_node;
+}
+
+void command__Return::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, command_e::Return)) {
+    return;
+  }
+  enc->Obj(this->value);
+  if (this->spids == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->spids));
+    for (ListIter<int> it(this->spids); !it.Done(); it.Next()) {
+      enc->SpanId(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+command__Return* command__Return::DecodeFields(serialize::Decoder* dec) {
+  expr_t* x0 = expr_t::Decode(dec);
+  List<int>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<int>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(dec->SpanId());
+    }
+  }
+  command__Return* obj = Alloc<command__Return>(x0);
+  obj->spids = x1;
+  return obj;
+}
+
+void command_t::Encode(serialize::Encoder* enc) {
+  switch (this->tag_()) {
+  case command_e::NoOp:
+    static_cast<command__NoOp*>(this)->Encode(enc);
+    break;
+  case command_e::Simple:
+    static_cast<command__Simple*>(this)->Encode(enc);
+    break;
+  case command_e::ExpandedAlias:
+    static_cast<command__ExpandedAlias*>(this)->Encode(enc);
+    break;
+  case command_e::Sentence:
+    static_cast<command__Sentence*>(this)->Encode(enc);
+    break;
+  case command_e::ShAssignment:
+    static_cast<command__ShAssignment*>(this)->Encode(enc);
+    break;
+  case command_e::ControlFlow:
+    static_cast<command__ControlFlow*>(this)->Encode(enc);
+    break;
+  case command_e::Pipeline:
+    static_cast<command__Pipeline*>(this)->Encode(enc);
+    break;
+  case command_e::AndOr:
+    static_cast<command__AndOr*>(this)->Encode(enc);
+    break;
+  case command_e::DoGroup:
+    static_cast<command__DoGroup*>(this)->Encode(enc);
+    break;
+  case command_e::BraceGroup:
+    static_cast<BraceGroup*>(this)->Encode(enc);
+    break;
+  case command_e::Subshell:
+    static_cast<command__Subshell*>(this)->Encode(enc);
+    break;
+  case command_e::DParen:
+    static_cast<command__DParen*>(this)->Encode(enc);
+    break;
+  case command_e::DBracket:
+    static_cast<command__DBracket*>(this)->Encode(enc);
+    break;
+  case command_e::ForEach:
+    static_cast<command__ForEach*>(this)->Encode(enc);
+    break;
+  case command_e::ForExpr:
+    static_cast<command__ForExpr*>(this)->Encode(enc);
+    break;
+  case command_e::WhileUntil:
+    static_cast<command__WhileUntil*>(this)->Encode(enc);
+    break;
+  case command_e::If:
+    static_cast<command__If*>(this)->Encode(enc);
+    break;
+  case command_e::Case:
+    static_cast<command__Case*>(this)->Encode(enc);
+    break;
+  case command_e::ShFunction:
+    static_cast<command__ShFunction*>(this)->Encode(enc);
+    break;
+  case command_e::TimeBlock:
+    static_cast<command__TimeBlock*>(this)->Encode(enc);
+    break;
+  case command_e::CommandList:
+    static_cast<command__CommandList*>(this)->Encode(enc);
+    break;
+  case command_e::BareDecl:
+    static_cast<command__BareDecl*>(this)->Encode(enc);
+    break;
+  case command_e::VarDecl:
+    static_cast<command__VarDecl*>(this)->Encode(enc);
+    break;
+  case command_e::PlaceMutation:
+    static_cast<command__PlaceMutation*>(this)->Encode(enc);
+    break;
+  case command_e::Expr:
+    static_cast<command__Expr*>(this)->Encode(enc);
+    break;
+  case command_e::Proc:
+    static_cast<command__Proc*>(this)->Encode(enc);
+    break;
+  case command_e::Func:
+    static_cast<command__Func*>(this)->Encode(enc);
+    break;
+  case command_e::Data:
+    static_cast<command__Data*>(this)->Encode(enc);
+    break;
+  case command_e::Enum:
+    static_cast<command__Enum*>(this)->Encode(enc);
+    break;
+  case command_e::Class:
+    static_cast<command__Class*>(this)->Encode(enc);
+    break;
+  case command_e::Import:
+    static_cast<command__Import*>(this)->Encode(enc);
+    break;
+  case command_e::For:
+    static_cast<command__For*>(this)->Encode(enc);
+    break;
+  case command_e::While:
+    static_cast<command__While*>(this)->Encode(enc);
+    break;
+  case command_e::Break:
+    static_cast<command__Break*>(this)->Encode(enc);
+    break;
+  case command_e::Continue:
+    static_cast<command__Continue*>(this)->Encode(enc);
+    break;
+  case command_e::Return:
+    static_cast<command__Return*>(this)->Encode(enc);
+    break;
+  default:
+    assert(0);
+  }
+}
+
+command_t* command_t::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<command_t*>(dec->Ref());
+  }
+  command_t* obj = nullptr;
+  switch (tag) {
+  case command_e::NoOp:
+    obj = command__NoOp::DecodeFields(dec);
+    break;
+  case command_e::Simple:
+    obj = command__Simple::DecodeFields(dec);
+    break;
+  case command_e::ExpandedAlias:
+    obj = command__ExpandedAlias::DecodeFields(dec);
+    break;
+  case command_e::Sentence:
+    obj = command__Sentence::DecodeFields(dec);
+    break;
+  case command_e::ShAssignment:
+    obj = command__ShAssignment::DecodeFields(dec);
+    break;
+  case command_e::ControlFlow:
+    obj = command__ControlFlow::DecodeFields(dec);
+    break;
+  case command_e::Pipeline:
+    obj = command__Pipeline::DecodeFields(dec);
+    break;
+  case command_e::AndOr:
+    obj = command__AndOr::DecodeFields(dec);
+    break;
+  case command_e::DoGroup:
+    obj = command__DoGroup::DecodeFields(dec);
+    break;
+  case command_e::BraceGroup:
+    obj = BraceGroup::DecodeFields(dec);
+    break;
+  case command_e::Subshell:
+    obj = command__Subshell::DecodeFields(dec);
+    break;
+  case command_e::DParen:
+    obj = command__DParen::DecodeFields(dec);
+    break;
+  case command_e::DBracket:
+    obj = command__DBracket::DecodeFields(dec);
+    break;
+  case command_e::ForEach:
+    obj = command__ForEach::DecodeFields(dec);
+    break;
+  case command_e::ForExpr:
+    obj = command__ForExpr::DecodeFields(dec);
+    break;
+  case command_e::WhileUntil:
+    obj = command__WhileUntil::DecodeFields(dec);
+    break;
+  case command_e::If:
+    obj = command__If::DecodeFields(dec);
+    break;
+  case command_e::Case:
+    obj = command__Case::DecodeFields(dec);
+    break;
+  case command_e::ShFunction:
+    obj = command__ShFunction::DecodeFields(dec);
+    break;
+  case command_e::TimeBlock:
+    obj = command__TimeBlock::DecodeFields(dec);
+    break;
+  case command_e::CommandList:
+    obj = command__CommandList::DecodeFields(dec);
+    break;
+  case command_e::BareDecl:
+    obj = command__BareDecl::DecodeFields(dec);
+    break;
+  case command_e::VarDecl:
+    obj = command__VarDecl::DecodeFields(dec);
+    break;
+  case command_e::PlaceMutation:
+    obj = command__PlaceMutation::DecodeFields(dec);
+    break;
+  case command_e::Expr:
+    obj = command__Expr::DecodeFields(dec);
+    break;
+  case command_e::Proc:
+    obj = command__Proc::DecodeFields(dec);
+    break;
+  case command_e::Func:
+    obj = command__Func::DecodeFields(dec);
+    break;
+  case command_e::Data:
+    obj = command__Data::DecodeFields(dec);
+    break;
+  case command_e::Enum:
+    obj = command__Enum::DecodeFields(dec);
+    break;
+  case command_e::Class:
+    obj = command__Class::DecodeFields(dec);
+    break;
+  case command_e::Import:
+    obj = command__Import::DecodeFields(dec);
+    break;
+  case command_e::For:
+    obj = command__For::DecodeFields(dec);
+    break;
+  case command_e::While:
+    obj = command__While::DecodeFields(dec);
+    break;
+  case command_e::Break:
+    obj = command__Break::DecodeFields(dec);
+    break;
+  case command_e::Continue:
+    obj = command__Continue::DecodeFields(dec);
+    break;
+  case command_e::Return:
+    obj = command__Return::DecodeFields(dec);
+    break;
+  default:
+    throw Alloc<ValueError>();
+  }
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* command_t::PrettyTree() {
+  switch (this->tag_()) {
+  case command_e::NoOp: {
+    command__NoOp* obj = static_cast<command__NoOp*>(this);
+    return obj->PrettyTree();
+  }
+  case command_e::Simple: {
+    command__Simple* obj = static_cast<command__Simple*>(this);
+    return obj->PrettyTree();
+  }
+  case command_e::ExpandedAlias: {
+    command__ExpandedAlias* obj = static_cast<command__ExpandedAlias*>(this);
+    return obj->PrettyTree();
+  }
+  case command_e::Sentence: {
+    command__Sentence* obj = static_cast<command__Sentence*>(this);
+    return obj->PrettyTree();
+  }
+  case command_e::ShAssignment: {
+    command__ShAssignment* obj = static_cast<command__ShAssignment*>(this);
+    return obj->PrettyTree();
+  }
+  case command_e::ControlFlow: {
+    command__ControlFlow* obj = static_cast<command__ControlFlow*>(this);
+    return obj->PrettyTree();
+  }
+  case command_e::Pipeline: {
+    command__Pipeline* obj = static_cast<command__Pipeline*>(this);
+    return obj->PrettyTree();
+  }
+  case command_e::AndOr: {
+    command__AndOr* obj = static_cast<command__AndOr*>(this);
+    return obj->PrettyTree();
+  }
+  case command_e::DoGroup: {
+    command__DoGroup* obj = static_cast<command__DoGroup*>(this);
+    return obj->PrettyTree();
+  }
+  case command_e::BraceGroup: {
+    BraceGroup* obj = static_cast<BraceGroup*>(this);
+    return obj->PrettyTree();
+  }
+  case command_e::Subshell: {
+    command__Subshell* obj = static_cast<command__Subshell*>(this);
+    return obj->PrettyTree();
+  }
+  case command_e::DParen: {
+    command__DParen* obj = static_cast<command__DParen*>(this);
+    return obj->PrettyTree();
+  }
+  case command_e::DBracket: {
+    command__DBracket* obj = static_cast<command__DBracket*>(this);
+    return obj->PrettyTree();
+  }
+  case command_e::ForEach: {
+    command__ForEach* obj = static_cast<command__ForEach*>(this);
+    return obj->PrettyTree();
+  }
+  case command_e::ForExpr: {
+    command__ForExpr* obj = static_cast<command__ForExpr*>(this);
+    return obj->PrettyTree();
+  }
+  case command_e::WhileUntil: {
+    command__WhileUntil* obj = static_cast<command__WhileUntil*>(this);
+    return obj->PrettyTree();
+  }
+  case command_e::If: {
+    command__If* obj = static_cast<command__If*>(this);
+    return obj->PrettyTree();
+  }
+  case command_e::Case: {
+    command__Case* obj = static_cast<command__Case*>(this);
+    return obj->PrettyTree();
+  }
+  case command_e::ShFunction: {
+    command__ShFunction* obj = static_cast<command__ShFunction*>(this);
+    return obj->PrettyTree();
+  }
+  case command_e::TimeBlock: {
+    command__TimeBlock* obj = static_cast<command__TimeBlock*>(this);
+    return obj->PrettyTree();
+  }
+  case command_e::CommandList: {
+    command__CommandList* obj = static_cast<command__CommandList*>(this);
+    return obj->PrettyTree();
+  }
+  case command_e::BareDecl: {
+    command__BareDecl* obj = static_cast<command__BareDecl*>(this);
+    return obj->PrettyTree();
+  }
+  case command_e::VarDecl: {
+    command__VarDecl* obj = static_cast<command__VarDecl*>(this);
+    return obj->PrettyTree();
+  }
+  case command_e::PlaceMutation: {
+    command__PlaceMutation* obj = static_cast<command__PlaceMutation*>(this);
+    return obj->PrettyTree();
+  }
+  case command_e::Expr: {
+    command__Expr* obj = static_cast<command__Expr*>(this);
+    return obj->PrettyTree();
+  }
+  case command_e::Proc: {
+    command__Proc* obj = static_cast<command__Proc*>(this);
+    return obj->PrettyTree();
+  }
+  case command_e::Func: {
+    command__Func* obj = static_cast<command__Func*>(this);
+    return obj->PrettyTree();
+  }
+  case command_e::Data: {
+    command__Data* obj = static_cast<command__Data*>(this);
+    return obj->PrettyTree();
+  }
+  case command_e::Enum: {
+    command__Enum* obj = static_cast<command__Enum*>(this);
+    return obj->PrettyTree();
+  }
+  case command_e::Class: {
+    command__Class* obj = static_cast<command__Class*>(this);
+    return obj->PrettyTree();
+  }
+  case command_e::Import: {
+    command__Import* obj = static_cast<command__Import*>(this);
+    return obj->PrettyTree();
+  }
+  case command_e::For: {
+    command__For* obj = static_cast<command__For*>(this);
+    return obj->PrettyTree();
+  }
+  case command_e::While: {
+    command__While* obj = static_cast<command__While*>(this);
+    return obj->PrettyTree();
+  }
+  case command_e::Break: {
+    command__Break* obj = static_cast<command__Break*>(this);
+    return obj->PrettyTree();
+  }
+  case command_e::Continue: {
+    command__Continue* obj = static_cast<command__Continue*>(this);
+    return obj->PrettyTree();
+  }
+  case command_e::Return: {
+    command__Return* obj = static_cast<command__Return*>(this);
+    return obj->PrettyTree();
+  }
+  default:
+    assert(0);
+  }
+}
+const char* variant_type_str(int tag) {
+  switch (tag) {
+  case variant_type_e::Anon:
+    return "variant_type.Anon";
+  case variant_type_e::Ref:
+    return "variant_type.Ref";
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* variant_type__Anon::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("variant_type.Anon"));
+  List<field*>* L = out_node->fields;
+
+  if (this->params != nullptr) {  // array
+    hnode__Array* x0 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<param*> it(this->params); !it.Done(); it.Next()) {
+      param* i0 = it.Value();
+      x0->children->append(i0->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("params"), x0));
+  }
+
+  return out_node;
+}
+
+void variant_type__Anon::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, variant_type_e::Anon)) {
+    return;
+  }
+  if (this->params == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->params));
+    for (ListIter<param*> it(this->params); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+variant_type__Anon* variant_type__Anon::DecodeFields(serialize::Decoder* dec) {
+  List<param*>* x0 = nullptr;
+  int n0 = dec->Int();
+  if (n0 >= 0) {
+    x0 = Alloc<List<param*>>();
+    for (int i = 0; i < n0; ++i) {
+      x0->append(param::Decode(dec));
+    }
+  }
+  variant_type__Anon* obj = Alloc<variant_type__Anon>(x0);
+  return obj;
+}
+
+hnode_t* variant_type__Ref::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("variant_type.Ref"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->type_name->PrettyTree();
+  L->append(Alloc<field>(StrFromC("type_name"), x0));
+
+  return out_node;
+}
+
+void variant_type__Ref::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, variant_type_e::Ref)) {
+    return;
+  }
+  enc->Obj(this->type_name);
+  enc->End(this);
+}
+
+variant_type__Ref* variant_type__Ref::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  variant_type__Ref* obj = Alloc<variant_type__Ref>(x0);
+  return obj;
+}
+
+void variant_type_t::Encode(serialize::Encoder* enc) {
+  switch (this->tag_()) {
+  case variant_type_e::Anon:
+    static_cast<variant_type__Anon*>(this)->Encode(enc);
+    break;
+  case variant_type_e::Ref:
+    static_cast<variant_type__Ref*>(this)->Encode(enc);
+    break;
+  default:
+    assert(0);
+  }
+}
+
+variant_type_t* variant_type_t::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<variant_type_t*>(dec->Ref());
+  }
+  variant_type_t* obj = nullptr;
+  switch (tag) {
+  case variant_type_e::Anon:
+    obj = variant_type__Anon::DecodeFields(dec);
+    break;
+  case variant_type_e::Ref:
+    obj = variant_type__Ref::DecodeFields(dec);
+    break;
+  default:
+    throw Alloc<ValueError>();
+  }
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* variant_type_t::PrettyTree() {
+  switch (this->tag_()) {
+  case variant_type_e::Anon: {
+    variant_type__Anon* obj = static_cast<variant_type__Anon*>(this);
+    return obj->PrettyTree();
+  }
+  case variant_type_e::Ref: {
+    variant_type__Ref* obj = static_cast<variant_type__Ref*>(this);
+    return obj->PrettyTree();
+  }
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* variant::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("variant"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->tag_name->PrettyTree();
+  L->append(Alloc<field>(StrFromC("tag_name"), x0));
+
+  if (this->typ) {  // maybe
+    hnode_t* x1 = this->typ->PrettyTree();
+    L->append(Alloc<field>(StrFromC("typ"), x1));
+  }
+
+  return out_node;
+}
+
+void variant::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, 85)) {
+    return;
+  }
+  enc->Obj(this->tag_name);
+  enc->Obj(this->typ);
+  enc->End(this);
+}
+
+variant* variant::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  variant_type_t* x1 = variant_type_t::Decode(dec);
+  variant* obj = Alloc<variant>(x0, x1);
+  return obj;
+}
+
+variant* variant::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<variant*>(dec->Ref());
+  }
+  if (tag != 85) {
+    throw Alloc<ValueError>();
+  }
+  variant* obj = DecodeFields(dec);
+  dec->End(obj);
+  return obj;
+}
+const char* class_item_str(int tag) {
+  switch (tag) {
+  case class_item_e::Data:
+    return "class_item.Data";
+  case class_item_e::Method:
+    return "class_item.Method";
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* class_item__Data::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("class_item.Data"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->keyword->PrettyTree();
+  L->append(Alloc<field>(StrFromC("keyword"), x0));
+
+  if (this->fields != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<name_type*> it(this->fields); !it.Done(); it.Next()) {
+      name_type* i1 = it.Value();
+      x1->children->append(i1->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("fields"), x1));
+  }
+
+  return out_node;
+}
+
+void class_item__Data::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, class_item_e::Data)) {
+    return;
+  }
+  enc->Obj(this->keyword);
+  if (this->fields == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->fields));
+    for (ListIter<name_type*> it(this->fields); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+class_item__Data* class_item__Data::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  List<name_type*>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<name_type*>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(name_type::Decode(dec));
+    }
+  }
+  class_item__Data* obj = Alloc<class_item__Data>(x0, x1);
+  return obj;
+}
+
+hnode_t* class_item__Method::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("class_item.Method"));
+  return out_node;
+}
+
+void class_item__Method::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, class_item_e::Method)) {
+    return;
+  }
+  enc->End(this);
+}
+
+class_item__Method* class_item__Method::DecodeFields(serialize::Decoder* dec) {
+  class_item__Method* obj = Alloc<class_item__Method>();
+  return obj;
+}
+
+void class_item_t::Encode(serialize::Encoder* enc) {
+  switch (this->tag_()) {
+  case class_item_e::Data:
+    static_cast<class_item__Data*>(this)->Encode(enc);
+    break;
+  case class_item_e::Method:
+    static_cast<class_item__Method*>(this)->Encode(enc);
+    break;
+  default:
+    assert(0);
+  }
+}
+
+class_item_t* class_item_t::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<class_item_t*>(dec->Ref());
+  }
+  class_item_t* obj = nullptr;
+  switch (tag) {
+  case class_item_e::Data:
+    obj = class_item__Data::DecodeFields(dec);
+    break;
+  case class_item_e::Method:
+    obj = class_item__Method::DecodeFields(dec);
+    break;
+  default:
+    throw Alloc<ValueError>();
+  }
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* class_item_t::PrettyTree() {
+  switch (this->tag_()) {
+  case class_item_e::Data: {
+    class_item__Data* obj = static_cast<class_item__Data*>(this);
+    return obj->PrettyTree();
+  }
+  case class_item_e::Method: {
+    class_item__Method* obj = static_cast<class_item__Method*>(this);
+    return obj->PrettyTree();
+  }
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* import_name::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("import_name"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->name->PrettyTree();
+  L->append(Alloc<field>(StrFromC("name"), x0));
+
+  if (this->alias) {  // maybe
+    hnode_t* x1 = this->alias->PrettyTree();
+    L->append(Alloc<field>(StrFromC("alias"), x1));
+  }
+
+  return out_node;
+}
+
+void import_name::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, 86)) {
+    return;
+  }
+  enc->Obj(this->name);
+  enc->Obj(this->alias);
+  enc->End(this);
+}
+
+import_name* import_name::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  Token* x1 = Token::Decode(dec);
+  import_name* obj = Alloc<import_name>(x0, x1);
+  return obj;
+}
+
+import_name* import_name::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<import_name*>(dec->Ref());
+  }
+  if (tag != 86) {
+    throw Alloc<ValueError>();
+  }
+  import_name* obj = DecodeFields(dec);
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* UntypedParam::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("UntypedParam"));
+  List<field*>* L = out_node->fields;
+
+  if (this->ref) {  // maybe
+    hnode_t* x0 = this->ref->PrettyTree();
+    L->append(Alloc<field>(StrFromC("ref"), x0));
+  }
+
+  hnode_t* x1 = this->name->PrettyTree();
+  L->append(Alloc<field>(StrFromC("name"), x1));
+
+  if (this->default_val) {  // maybe
+    hnode_t* x2 = this->default_val->PrettyTree();
+    L->append(Alloc<field>(StrFromC("default_val"), x2));
+  }
+
+  return out_node;
+}
+
+void UntypedParam::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, 87)) {
+    return;
+  }
+  enc->Obj(this->ref);
+  enc->Obj(this->name);
+  enc->Obj(this->default_val);
+  enc->End(this);
+}
+
+UntypedParam* UntypedParam::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  Token* x1 = Token::Decode(dec);
+  expr_t* x2 = expr_t::Decode(dec);
+  UntypedParam* obj = Alloc<UntypedParam>(x0, x1, x2);
+  return obj;
+}
+
+UntypedParam* UntypedParam::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<UntypedParam*>(dec->Ref());
+  }
+  if (tag != 87) {
+    throw Alloc<ValueError>();
+  }
+  UntypedParam* obj = DecodeFields(dec);
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* TypedParam::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("TypedParam"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->name->PrettyTree();
+  L->append(Alloc<field>(StrFromC("name"), x0));
+
+  hnode_t* x1 = this->type->PrettyTree();
+  L->append(Alloc<field>(StrFromC("type"), x1));
+
+  if (this->default_val) {  // maybe
+    hnode_t* x2 = this->default_val->PrettyTree();
+    L->append(Alloc<field>(StrFromC("default_val"), x2));
+  }
+
+  return out_node;
+}
+
+void TypedParam::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, 88)) {
+    return;
+  }
+  enc->Obj(this->name);
+  enc->Obj(this->type);
+  enc->Obj(this->default_val);
+  enc->End(this);
+}
+
+TypedParam* TypedParam::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  Token* x1 = Token::Decode(dec);
+  expr_t* x2 = expr_t::Decode(dec);
+  TypedParam* obj = Alloc<TypedParam>(x0, x1, x2);
+  return obj;
+}
+
+TypedParam* TypedParam::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<TypedParam*>(dec->Ref());
+  }
+  if (tag != 88) {
+    throw Alloc<ValueError>();
+  }
+  TypedParam* obj = DecodeFields(dec);
+  dec->End(obj);
+  return obj;
+}
+const char* proc_sig_str(int tag) {
+  switch (tag) {
+  case proc_sig_e::Open:
+    return "proc_sig.Open";
+  case proc_sig_e::Closed:
+    return "proc_sig.Closed";
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* proc_sig__Open::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("proc_sig.Open"));
+  return out_node;
+}
+
+void proc_sig__Open::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, proc_sig_e::Open)) {
+    return;
+  }
+  enc->End(this);
+}
+
+proc_sig__Open* proc_sig__Open::DecodeFields(serialize::Decoder* dec) {
+  proc_sig__Open* obj = Alloc<proc_sig__Open>();
+  return obj;
+}
+
+hnode_t* proc_sig__Closed::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("proc_sig.Closed"));
+  List<field*>* L = out_node->fields;
+
+  if (this->untyped != nullptr) {  // array
+    hnode__Array* x0 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<UntypedParam*> it(this->untyped); !it.Done(); it.Next()) {
+      UntypedParam* i0 = it.Value();
+      x0->children->append(i0->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("untyped"), x0));
+  }
+
+  if (this->rest) {  // maybe
+    hnode_t* x1 = this->rest->PrettyTree();
+    L->append(Alloc<field>(StrFromC("rest"), x1));
+  }
+
+  if (this->typed != nullptr) {  // array
+    hnode__Array* x2 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<TypedParam*> it(this->typed); !it.Done(); it.Next()) {
+      TypedParam* i2 = it.Value();
+      x2->children->append(i2->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("typed"), x2));
+  }
+
+  return out_node;
+}
+
+void proc_sig__Closed::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, proc_sig_e::Closed)) {
+    return;
+  }
+  if (this->untyped == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->untyped));
+    for (ListIter<UntypedParam*> it(this->untyped); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->Obj(this->rest);
+  if (this->typed == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->typed));
+    for (ListIter<TypedParam*> it(this->typed); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+proc_sig__Closed* proc_sig__Closed::DecodeFields(serialize::Decoder* dec) {
+  List<UntypedParam*>* x0 = nullptr;
+  int n0 = dec->Int();
+  if (n0 >= 0) {
+    x0 = Alloc<List<UntypedParam*>>();
+    for (int i = 0; i < n0; ++i) {
+      x0->append(UntypedParam::Decode(dec));
+    }
+  }
+  Token* x1 = Token::Decode(dec);
+  List<TypedParam*>* x2 = nullptr;
+  int n2 = dec->Int();
+  if (n2 >= 0) {
+    x2 = Alloc<List<TypedParam*>>();
+    for (int i = 0; i < n2; ++i) {
+      x2->append(TypedParam::Decode(dec));
+    }
+  }
+  proc_sig__Closed* obj = Alloc<proc_sig__Closed>(x0, x1, x2);
+  return obj;
+}
+
+void proc_sig_t::Encode(serialize::Encoder* enc) {
+  switch (this->tag_()) {
+  case proc_sig_e::Open:
+    static_cast<proc_sig__Open*>(this)->Encode(enc);
+    break;
+  case proc_sig_e::Closed:
+    static_cast<proc_sig__Closed*>(this)->Encode(enc);
+    break;
+  default:
+    assert(0);
+  }
+}
+
+proc_sig_t* proc_sig_t::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<proc_sig_t*>(dec->Ref());
+  }
+  proc_sig_t* obj = nullptr;
+  switch (tag) {
+  case proc_sig_e::Open:
+    obj = proc_sig__Open::DecodeFields(dec);
+    break;
+  case proc_sig_e::Closed:
+    obj = proc_sig__Closed::DecodeFields(dec);
+    break;
+  default:
+    throw Alloc<ValueError>();
+  }
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* proc_sig_t::PrettyTree() {
+  switch (this->tag_()) {
+  case proc_sig_e::Open: {
+    proc_sig__Open* obj = static_cast<proc_sig__Open*>(this);
+    return obj->PrettyTree();
+  }
+  case proc_sig_e::Closed: {
+    proc_sig__Closed* obj = static_cast<proc_sig__Closed*>(this);
+    return obj->PrettyTree();
+  }
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* param::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("param"));
+  List<field*>* L = out_node->fields;
+
+  if (this->prefix) {  // maybe
+    hnode_t* x0 = this->prefix->PrettyTree();
+    L->append(Alloc<field>(StrFromC("prefix"), x0));
+  }
+
+  hnode_t* x1 = this->name->PrettyTree();
+  L->append(Alloc<field>(StrFromC("name"), x1));
+
+  if (this->type) {  // maybe
+    hnode_t* x2 = this->type->PrettyTree();
+    L->append(Alloc<field>(StrFromC("type"), x2));
+  }
+
+  if (this->default_val) {  // maybe
+    hnode_t* x3 = this->default_val->PrettyTree();
+    L->append(Alloc<field>(StrFromC("default_val"), x3));
+  }
+
+  return out_node;
+}
+
+void param::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, 89)) {
+    return;
+  }
+  enc->Obj(this->prefix);
+  enc->Obj(this->name);
+  enc->Obj(this->type);
+  enc->Obj(this->default_val);
+  enc->End(this);
+}
+
+param* param::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  Token* x1 = Token::Decode(dec);
+  type_expr_t* x2 = type_expr_t::Decode(dec);
+  expr_t* x3 = expr_t::Decode(dec);
+  param* obj = Alloc<param>(x0, x1, x2, x3);
+  return obj;
+}
+
+param* param::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<param*>(dec->Ref());
+  }
+  if (tag != 89) {
+    throw Alloc<ValueError>();
+  }
+  param* obj = DecodeFields(dec);
+  dec->End(obj);
+  return obj;
+}
+const char* glob_part_str(int tag) {
+  switch (tag) {
+  case glob_part_e::Literal:
+    return "glob_part.Literal";
+  case glob_part_e::Operator:
+    return "glob_part.Operator";
+  case glob_part_e::CharClass:
+    return "glob_part.CharClass";
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* glob_part__Literal::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("glob_part.Literal"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = Alloc<hnode__Leaf>(StrFromC(Id_str(this->id)),
+                                   color_e::UserType);
+  L->append(Alloc<field>(StrFromC("id"), x0));
+
+  hnode_t* x1 = runtime::NewLeaf(this->s, color_e::StringConst);
+  L->append(Alloc<field>(StrFromC("s"), x1));
+
+  return out_node;
+}
+
+void glob_part__Literal::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, glob_part_e::Literal)) {
+    return;
+  }
+  enc->Int(this->id);
+  enc->Str(this->s);
+  enc->End(this);
+}
+
+glob_part__Literal* glob_part__Literal::DecodeFields(serialize::Decoder* dec) {
+  Id_t x0 = dec->Int();
+  Str* x1 = dec->Str();
+  glob_part__Literal* obj = Alloc<glob_part__Literal>(x0, x1);
+  return obj;
+}
+
+hnode_t* glob_part__Operator::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("glob_part.Operator"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = Alloc<hnode__Leaf>(StrFromC(Id_str(this->op_id)),
+                                   color_e::UserType);
+  L->append(Alloc<field>(StrFromC("op_id"), x0));
+
+  return out_node;
+}
+
+void glob_part__Operator::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, glob_part_e::Operator)) {
+    return;
+  }
+  enc->Int(this->op_id);
+  enc->End(this);
+}
+
+glob_part__Operator* glob_part__Operator::DecodeFields(serialize::Decoder* dec)
+                                                       {
+  Id_t x0 = dec->Int();
+  glob_part__Operator* obj = Alloc<glob_part__Operator>(x0);
+  return obj;
+}
+
+hnode_t* glob_part__CharClass::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("glob_part.CharClass"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = Alloc<hnode__Leaf>(this->negated ? runtime::TRUE_STR :
+                                   runtime::FALSE_STR, color_e::OtherConst);
+  L->append(Alloc<field>(StrFromC("negated"), x0));
+
+  if (this->strs != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<Str*> it(this->strs); !it.Done(); it.Next()) {
+      Str* i1 = it.Value();
+      x1->children->append(runtime::NewLeaf(i1, color_e::StringConst));
+    }
+    L->append(Alloc<field>(StrFromC("strs"), x1));
+  }
+
+  return out_node;
+}
+
+void glob_part__CharClass::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, glob_part_e::CharClass)) {
+    return;
+  }
+  enc->Bool(this->negated);
+  if (this->strs == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->strs));
+    for (ListIter<Str*> it(this->strs); !it.Done(); it.Next()) {
+      enc->Str(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+glob_part__CharClass* glob_part__CharClass::DecodeFields(serialize::Decoder*
+                                                         dec) {
+  bool x0 = dec->Bool();
+  List<Str*>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<Str*>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(dec->Str());
+    }
+  }
+  glob_part__CharClass* obj = Alloc<glob_part__CharClass>(x0, x1);
+  return obj;
+}
+
+void glob_part_t::Encode(serialize::Encoder* enc) {
+  switch (this->tag_()) {
+  case glob_part_e::Literal:
+    static_cast<glob_part__Literal*>(this)->Encode(enc);
+    break;
+  case glob_part_e::Operator:
+    static_cast<glob_part__Operator*>(this)->Encode(enc);
+    break;
+  case glob_part_e::CharClass:
+    static_cast<glob_part__CharClass*>(this)->Encode(enc);
+    break;
+  default:
+    assert(0);
+  }
+}
+
+glob_part_t* glob_part_t::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<glob_part_t*>(dec->Ref());
+  }
+  glob_part_t* obj = nullptr;
+  switch (tag) {
+  case glob_part_e::Literal:
+    obj = glob_part__Literal::DecodeFields(dec);
+    break;
+  case glob_part_e::Operator:
+    obj = glob_part__Operator::DecodeFields(dec);
+    break;
+  case glob_part_e::CharClass:
+    obj = glob_part__CharClass::DecodeFields(dec);
+    break;
+  default:
+    throw Alloc<ValueError>();
+  }
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* glob_part_t::PrettyTree() {
+  switch (this->tag_()) {
+  case glob_part_e::Literal: {
+    glob_part__Literal* obj = static_cast<glob_part__Literal*>(this);
+    return obj->PrettyTree();
+  }
+  case glob_part_e::Operator: {
+    glob_part__Operator* obj = static_cast<glob_part__Operator*>(this);
+    return obj->PrettyTree();
+  }
+  case glob_part_e::CharClass: {
+    glob_part__CharClass* obj = static_cast<glob_part__CharClass*>(this);
+    return obj->PrettyTree();
+  }
+  default:
+    assert(0);
+  }
+}
+const char* printf_part_str(int tag) {
+  switch (tag) {
+  case printf_part_e::Literal:
+    return "printf_part.Literal";
+  case printf_part_e::Percent:
+    return "printf_part.Percent";
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* printf_part__Literal::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("printf_part.Literal"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->token->PrettyTree();
+  L->append(Alloc<field>(StrFromC("token"), x0));
+
+  return out_node;
+}
+
+void printf_part__Literal::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, printf_part_e::Literal)) {
+    return;
+  }
+  enc->Obj(this->token);
+  enc->End(this);
+}
+
+printf_part__Literal* printf_part__Literal::DecodeFields(serialize::Decoder*
+                                                         dec) {
+  Token* x0 = Token::Decode(dec);
+  printf_part__Literal* obj = Alloc<printf_part__Literal>(x0);
+  return obj;
+}
+
+hnode_t* printf_part__Percent::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("printf_part.Percent"));
+  List<field*>* L = out_node->fields;
+
+  if (this->flags != nullptr) {  // array
+    hnode__Array* x0 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<Token*> it(this->flags); !it.Done(); it.Next()) {
+      Token* i0 = it.Value();
+      x0->children->append(i0->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("flags"), x0));
+  }
+
+  if (this->width) {  // maybe
+    hnode_t* x1 = this->width->PrettyTree();
+    L->append(Alloc<field>(StrFromC("width"), x1));
+  }
+
+  if (this->precision) {  // maybe
+    hnode_t* x2 = this->precision->PrettyTree();
+    L->append(Alloc<field>(StrFromC("precision"), x2));
+  }
+
+  hnode_t* x3 = this->type->PrettyTree();
+  L->append(Alloc<field>(StrFromC("type"), x3));
+
+  return out_node;
+}
+
+void printf_part__Percent::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, printf_part_e::Percent)) {
+    return;
+  }
+  if (this->flags == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->flags));
+    for (ListIter<Token*> it(this->flags); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->Obj(this->width);
+  enc->Obj(this->precision);
+  enc->Obj(this->type);
+  enc->End(this);
+}
+
+printf_part__Percent* printf_part__Percent::DecodeFields(serialize::Decoder*
+                                                         dec) {
+  List<Token*>* x0 = nullptr;
+  int n0 = dec->Int();
+  if (n0 >= 0) {
+    x0 = Alloc<List<Token*>>();
+    for (int i = 0; i < n0; ++i) {
+      x0->append(Token::Decode(dec));
+    }
+  }
+  Token* x1 = Token::Decode(dec);
+  Token* x2 = Token::Decode(dec);
+  Token* x3 = Token::Decode(dec);
+  printf_part__Percent* obj = Alloc<printf_part__Percent>(x0, x1, x2, x3);
+  return obj;
+}
+
+void printf_part_t::Encode(serialize::Encoder* enc) {
+  switch (this->tag_()) {
+  case printf_part_e::Literal:
+    static_cast<printf_part__Literal*>(this)->Encode(enc);
+    break;
+  case printf_part_e::Percent:
+    static_cast<printf_part__Percent*>(this)->Encode(enc);
+    break;
+  default:
+    assert(0);
+  }
+}
+
+printf_part_t* printf_part_t::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<printf_part_t*>(dec->Ref());
+  }
+  printf_part_t* obj = nullptr;
+  switch (tag) {
+  case printf_part_e::Literal:
+    obj = printf_part__Literal::DecodeFields(dec);
+    break;
+  case printf_part_e::Percent:
+    obj = printf_part__Percent::DecodeFields(dec);
+    break;
+  default:
+    throw Alloc<ValueError>();
+  }
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* printf_part_t::PrettyTree() {
+  switch (this->tag_()) {
+  case printf_part_e::Literal: {
+    printf_part__Literal* obj = static_cast<printf_part__Literal*>(this);
+    return obj->PrettyTree();
+  }
+  case printf_part_e::Percent: {
+    printf_part__Percent* obj = static_cast<printf_part__Percent*>(this);
+    return obj->PrettyTree();
+  }
+  default:
+    assert(0);
+  }
+}
+const char* expr_context_str(expr_context_e tag) {
+  switch (tag) {
+  case expr_context_e::Load:
+    return "expr_context.Load";
+  case expr_context_e::Store:
+    return "expr_context.Store";
+  case expr_context_e::Del:
+    return "expr_context.Del";
+  case expr_context_e::AugLoad:
+    return "expr_context.AugLoad";
+  case expr_context_e::AugStore:
+    return "expr_context.AugStore";
+  case expr_context_e::Param:
+    return "expr_context.Param";
+  default:
+    assert(0);
+  }
+}
+const char* type_expr_str(int tag) {
+  switch (tag) {
+  case type_expr_e::Simple:
+    return "type_expr.Simple";
+  case type_expr_e::Compound:
+    return "type_expr.Compound";
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* type_expr__Simple::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("type_expr.Simple"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->name->PrettyTree();
+  L->append(Alloc<field>(StrFromC("name"), x0));
+
+  return out_node;
+}
+
+void type_expr__Simple::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, type_expr_e::Simple)) {
+    return;
+  }
+  enc->Obj(this->name);
+  enc->End(this);
+}
+
+type_expr__Simple* type_expr__Simple::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  type_expr__Simple* obj = Alloc<type_expr__Simple>(x0);
+  return obj;
+}
+
+hnode_t* type_expr__Compound::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("type_expr.Compound"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->name->PrettyTree();
+  L->append(Alloc<field>(StrFromC("name"), x0));
+
+  if (this->params != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<type_expr_t*> it(this->params); !it.Done(); it.Next()) {
+      type_expr_t* i1 = it.Value();
+      x1->children->append(i1->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("params"), x1));
+  }
+
+  return out_node;
+}
+
+void type_expr__Compound::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, type_expr_e::Compound)) {
+    return;
+  }
+  enc->Obj(this->name);
+  if (this->params == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->params));
+    for (ListIter<type_expr_t*> it(this->params); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+type_expr__Compound* type_expr__Compound::DecodeFields(serialize::Decoder* dec)
+                                                       {
+  Token* x0 = Token::Decode(dec);
+  List<type_expr_t*>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<type_expr_t*>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(type_expr_t::Decode(dec));
+    }
+  }
+  type_expr__Compound* obj = Alloc<type_expr__Compound>(x0, x1);
+  return obj;
+}
+
+void type_expr_t::Encode(serialize::Encoder* enc) {
+  switch (this->tag_()) {
+  case type_expr_e::Simple:
+    static_cast<type_expr__Simple*>(this)->Encode(enc);
+    break;
+  case type_expr_e::Compound:
+    static_cast<type_expr__Compound*>(this)->Encode(enc);
+    break;
+  default:
+    assert(0);
+  }
+}
+
+type_expr_t* type_expr_t::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<type_expr_t*>(dec->Ref());
+  }
+  type_expr_t* obj = nullptr;
+  switch (tag) {
+  case type_expr_e::Simple:
+    obj = type_expr__Simple::DecodeFields(dec);
+    break;
+  case type_expr_e::Compound:
+    obj = type_expr__Compound::DecodeFields(dec);
+    break;
+  default:
+    throw Alloc<ValueError>();
+  }
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* type_expr_t::PrettyTree() {
+  switch (this->tag_()) {
+  case type_expr_e::Simple: {
+    type_expr__Simple* obj = static_cast<type_expr__Simple*>(this);
+    return obj->PrettyTree();
+  }
+  case type_expr_e::Compound: {
+    type_expr__Compound* obj = static_cast<type_expr__Compound*>(this);
+    return obj->PrettyTree();
+  }
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* name_type::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("name_type"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->name->PrettyTree();
+  L->append(Alloc<field>(StrFromC("name"), x0));
+
+  if (this->typ) {  // maybe
+    hnode_t* x1 = this->typ->PrettyTree();
+    L->append(Alloc<field>(StrFromC("typ"), x1));
+  }
+
+  return out_node;
+}
+
+void name_type::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, 90)) {
+    return;
+  }
+  enc->Obj(this->name);
+  enc->Obj(this->typ);
+  enc->End(this);
+}
+
+name_type* name_type::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  type_expr_t* x1 = type_expr_t::Decode(dec);
+  name_type* obj = Alloc<name_type>(x0, x1);
+  return obj;
+}
+
+name_type* name_type::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<name_type*>(dec->Ref());
+  }
+  if (tag != 90) {
+    throw Alloc<ValueError>();
+  }
+  name_type* obj = DecodeFields(dec);
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* comprehension::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("comprehension"));
+  List<field*>* L = out_node->fields;
+
+  if (this->lhs != nullptr) {  // array
+    hnode__Array* x0 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<name_type*> it(this->lhs); !it.Done(); it.Next()) {
+      name_type* i0 = it.Value();
+      x0->children->append(i0->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("lhs"), x0));
+  }
+
+  hnode_t* x1 = this->iter->PrettyTree();
+  L->append(Alloc<field>(StrFromC("iter"), x1));
+
+  if (this->cond) {  // maybe
+    hnode_t* x2 = this->cond->PrettyTree();
+    L->append(Alloc<field>(StrFromC("cond"), x2));
+  }
+
+  return out_node;
+}
+
+void comprehension::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, 91)) {
+    return;
+  }
+  if (this->lhs == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->lhs));
+    for (ListIter<name_type*> it(this->lhs); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->Obj(this->iter);
+  enc->Obj(this->cond);
+  enc->End(this);
+}
+
+comprehension* comprehension::DecodeFields(serialize::Decoder* dec) {
+  List<name_type*>* x0 = nullptr;
+  int n0 = dec->Int();
+  if (n0 >= 0) {
+    x0 = Alloc<List<name_type*>>();
+    for (int i = 0; i < n0; ++i) {
+      x0->append(name_type::Decode(dec));
+    }
+  }
+  expr_t* x1 = expr_t::Decode(dec);
+  expr_t* x2 = expr_t::Decode(dec);
+  comprehension* obj = Alloc<comprehension>(x0, x1, x2);
+  return obj;
+}
+
+comprehension* comprehension::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<comprehension*>(dec->Ref());
+  }
+  if (tag != 91) {
+    throw Alloc<ValueError>();
+  }
+  comprehension* obj = DecodeFields(dec);
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* named_arg::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("named_arg"));
+  List<field*>* L = out_node->fields;
+
+  if (this->name) {  // maybe
+    hnode_t* x0 = this->name->PrettyTree();
+    L->append(Alloc<field>(StrFromC("name"), x0));
+  }
+
+  hnode_t* x1 = this->value->PrettyTree();
+  L->append(Alloc<field>(StrFromC("value"), x1));
+
+  return out_node;
+}
+
+void named_arg::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, 92)) {
+    return;
+  }
+  enc->Obj(this->name);
+  enc->Obj(this->value);
+  enc->End(this);
+}
+
+named_arg* named_arg::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  expr_t* x1 = expr_t::Decode(dec);
+  named_arg* obj = Alloc<named_arg>(x0, x1);
+  return obj;
+}
+
+named_arg* named_arg::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<named_arg*>(dec->Ref());
+  }
+  if (tag != 92) {
+    throw Alloc<ValueError>();
+  }
+  named_arg* obj = DecodeFields(dec);
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* subscript::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("subscript"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->obj->PrettyTree();
+  L->append(Alloc<field>(StrFromC("obj"), x0));
+
+  if (this->indices != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<expr_t*> it(this->indices); !it.Done(); it.Next()) {
+      expr_t* i1 = it.Value();
+      x1->children->append(i1->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("indices"), x1));
+  }
+
+  return out_node;
+}
+
+void subscript::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, 93)) {
+    return;
+  }
+  enc->Obj(this->obj);
+  if (this->indices == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->indices));
+    for (ListIter<expr_t*> it(this->indices); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+subscript* subscript::DecodeFields(serialize::Decoder* dec) {
+  expr_t* x0 = expr_t::Decode(dec);
+  List<expr_t*>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<expr_t*>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(expr_t::Decode(dec));
+    }
+  }
+  subscript* obj = Alloc<subscript>(x0, x1);
+  return obj;
+}
+
+subscript* subscript::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<subscript*>(dec->Ref());
+  }
+  if (tag != 93) {
+    throw Alloc<ValueError>();
+  }
+  subscript* obj = DecodeFields(dec);
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* attribute::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("attribute"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->obj->PrettyTree();
+  L->append(Alloc<field>(StrFromC("obj"), x0));
+
+  hnode_t* x1 = this->op->PrettyTree();
+  L->append(Alloc<field>(StrFromC("op"), x1));
+
+  hnode_t* x2 = this->attr->PrettyTree();
+  L->append(Alloc<field>(StrFromC("attr"), x2));
+
+  hnode_t* x3 = Alloc<hnode__Leaf>(StrFromC(expr_context_str(this->ctx)),
+                                   color_e::TypeName);
+  L->append(Alloc<field>(StrFromC("ctx"), x3));
+
+  return out_node;
+}
+
+void attribute::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, 94)) {
+    return;
+  }
+  enc->Obj(this->obj);
+  enc->Obj(this->op);
+  enc->Obj(this->attr);
+  enc->Int(static_cast<int>(this->ctx));
+  enc->End(this);
+}
+
+attribute* attribute::DecodeFields(serialize::Decoder* dec) {
+  expr_t* x0 = expr_t::Decode(dec);
+  Token* x1 = Token::Decode(dec);
+  Token* x2 = Token::Decode(dec);
+  expr_context_t x3 = static_cast<expr_context_t>(dec->Int());
+  attribute* obj = Alloc<attribute>(x0, x1, x2, x3);
+  return obj;
+}
+
+attribute* attribute::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<attribute*>(dec->Ref());
+  }
+  if (tag != 94) {
+    throw Alloc<ValueError>();
+  }
+  attribute* obj = DecodeFields(dec);
+  dec->End(obj);
+  return obj;
+}
+const char* place_expr_str(int tag) {
+  switch (tag) {
+  case place_expr_e::Var:
+    return "place_expr.Var";
+  case place_expr_e::Subscript:
+    return "place_expr.Subscript";
+  case place_expr_e::Attribute:
+    return "place_expr.Attribute";
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* place_expr__Var::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("place_expr.Var"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->name->PrettyTree();
+  L->append(Alloc<field>(StrFromC("name"), x0));
+
+  return out_node;
+}
+
+void place_expr__Var::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, place_expr_e::Var)) {
+    return;
+  }
+  enc->Obj(this->name);
+  enc->End(this);
+}
+
+place_expr__Var* place_expr__Var::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  place_expr__Var* obj = Alloc<place_expr__Var>(x0);
+  return obj;
+}
+
+void place_expr_t::Encode(serialize::Encoder* enc) {
+  switch (this->tag_()) {
+  case place_expr_e::Var:
+    static_cast<place_expr__Var*>(this)->Encode(enc);
+    break;
+  case place_expr_e::Subscript:
+    static_cast<subscript*>(this)->Encode(enc);
+    break;
+  case place_expr_e::Attribute:
+    static_cast<attribute*>(this)->Encode(enc);
+    break;
+  default:
+    assert(0);
+  }
+}
+
+place_expr_t* place_expr_t::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<place_expr_t*>(dec->Ref());
+  }
+  place_expr_t* obj = nullptr;
+  switch (tag) {
+  case place_expr_e::Var:
+    obj = place_expr__Var::DecodeFields(dec);
+    break;
+  case place_expr_e::Subscript:
+    obj = subscript::DecodeFields(dec);
+    break;
+  case place_expr_e::Attribute:
+    obj = attribute::DecodeFields(dec);
+    break;
+  default:
+    throw Alloc<ValueError>();
+  }
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* place_expr_t::PrettyTree() {
+  switch (this->tag_()) {
+  case place_expr_e::Var: {
+    place_expr__Var* obj = static_cast<place_expr__Var*>(this);
+    return obj->PrettyTree();
+  }
+  case place_expr_e::Subscript: {
+    subscript* obj = static_cast<subscript*>(this);
+    return obj->PrettyTree();
+  }
+  case place_expr_e::Attribute: {
+    attribute* obj = static_cast<attribute*>(this);
+    return obj->PrettyTree();
+  }
+  default:
+    assert(0);
+  }
+}
+const char* expr_str(int tag) {
+  switch (tag) {
+  case expr_e::Var:
+    return "expr.Var";
+  case expr_e::Const:
+    return "expr.Const";
+  case expr_e::ShArrayLiteral:
+    return "expr.ShArrayLiteral";
+  case expr_e::RegexLiteral:
+    return "expr.RegexLiteral";
+  case expr_e::SimpleVarSub:
+    return "expr.SimpleVarSub";
+  case expr_e::BracedVarSub:
+    return "expr.BracedVarSub";
+  case expr_e::CommandSub:
+    return "expr.CommandSub";
+  case expr_e::SingleQuoted:
+    return "expr.SingleQuoted";
+  case expr_e::DoubleQuoted:
+    return "expr.DoubleQuoted";
+  case expr_e::BlockArg:
+    return "expr.BlockArg";
+  case expr_e::Lambda:
+    return "expr.Lambda";
+  case expr_e::Unary:
+    return "expr.Unary";
+  case expr_e::Binary:
+    return "expr.Binary";
+  case expr_e::Compare:
+    return "expr.Compare";
+  case expr_e::FuncCall:
+    return "expr.FuncCall";
+  case expr_e::IfExp:
+    return "expr.IfExp";
+  case expr_e::Tuple:
+    return "expr.Tuple";
+  case expr_e::List:
+    return "expr.List";
+  case expr_e::Dict:
+    return "expr.Dict";
+  case expr_e::Implicit:
+    return "expr.Implicit";
+  case expr_e::ListComp:
+    return "expr.ListComp";
+  case expr_e::DictComp:
+    return "expr.DictComp";
+  case expr_e::GeneratorExp:
+    return "expr.GeneratorExp";
+  case expr_e::Range:
+    return "expr.Range";
+  case expr_e::Slice:
+    return "expr.Slice";
+  case expr_e::Subscript:
+    return "expr.Subscript";
+  case expr_e::Attribute:
+    return "expr.Attribute";
+  case expr_e::Spread:
+    return "expr.Spread";
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* expr__Var::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("expr.Var"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->name->PrettyTree();
+  L->append(Alloc<field>(StrFromC("name"), x0));
+
+  return out_node;
+}
+
+void expr__Var::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, expr_e::Var)) {
+    return;
+  }
+  enc->Obj(this->name);
+  enc->End(this);
+}
+
+expr__Var* expr__Var::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  expr__Var* obj = Alloc<expr__Var>(x0);
+  return obj;
+}
+
+hnode_t* expr__Const::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("expr.Const"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->c->PrettyTree();
+  L->append(Alloc<field>(StrFromC("c"), x0));
+
+  return out_node;
+}
+
+void expr__Const::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, expr_e::Const)) {
+    return;
+  }
+  enc->Obj(this->c);
+  enc->End(this);
+}
+
+expr__Const* expr__Const::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  expr__Const* obj = Alloc<expr__Const>(x0);
+  return obj;
+}
+
+hnode_t* expr__RegexLiteral::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("expr.RegexLiteral"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->left->PrettyTree();
+  L->append(Alloc<field>(StrFromC("left"), x0));
+
+  hnode_t* x1 = this->regex->PrettyTree();
+  L->append(Alloc<field>(StrFromC("regex"), x1));
+
+  if (this->flags != nullptr) {  // array
+    hnode__Array* x2 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<Token*> it(this->flags); !it.Done(); it.Next()) {
+      Token* i2 = it.Value();
+      x2->children->append(i2->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("flags"), x2));
+  }
+
+  if (this->trans_pref) {  // maybe
+    hnode_t* x3 = this->trans_pref->PrettyTree();
+    L->append(Alloc<field>(StrFromC("trans_pref"), x3));
+  }
+
+  return out_node;
+}
+
+void expr__RegexLiteral::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, expr_e::RegexLiteral)) {
+    return;
+  }
+  enc->Obj(this->left);
+  enc->Obj(this->regex);
+  if (this->flags == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->flags));
+    for (ListIter<Token*> it(this->flags); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->Obj(this->trans_pref);
+  enc->End(this);
+}
+
+expr__RegexLiteral* expr__RegexLiteral::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  re_t* x1 = re_t::Decode(dec);
+  List<Token*>* x2 = nullptr;
+  int n2 = dec->Int();
+  if (n2 >= 0) {
+    x2 = Alloc<List<Token*>>();
+    for (int i = 0; i < n2; ++i) {
+      x2->append(Token::Decode(dec));
+    }
+  }
+  Token* x3 = Token::Decode(dec);
+  expr__RegexLiteral* obj = Alloc<expr__RegexLiteral>(x0, x1, x2, x3);
+  return obj;
+}
+
+hnode_t* expr__Lambda::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("expr.Lambda"));
+  List<field*>* L = out_node->fields;
+
+  if (this->params != nullptr) {  // array
+    hnode__Array* x0 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<name_type*> it(this->params); !it.Done(); it.Next()) {
+      name_type* i0 = it.Value();
+      x0->children->append(i0->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("params"), x0));
+  }
+
+  hnode_t* x1 = this->body->PrettyTree();
+  L->append(Alloc<field>(StrFromC("body"), x1));
+
+  return out_node;
+}
+
+void expr__Lambda::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, expr_e::Lambda)) {
+    return;
+  }
+  if (this->params == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->params));
+    for (ListIter<name_type*> it(this->params); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->Obj(this->body);
+  enc->End(this);
+}
+
+expr__Lambda* expr__Lambda::DecodeFields(serialize::Decoder* dec) {
+  List<name_type*>* x0 = nullptr;
+  int n0 = dec->Int();
+  if (n0 >= 0) {
+    x0 = Alloc<List<name_type*>>();
+    for (int i = 0; i < n0; ++i) {
+      x0->append(name_type::Decode(dec));
+    }
+  }
+  expr_t* x1 = expr_t::Decode(dec);
+  expr__Lambda* obj = Alloc<expr__Lambda>(x0, x1);
+  return obj;
+}
+
+hnode_t* expr__Unary::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("expr.Unary"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->op->PrettyTree();
+  L->append(Alloc<field>(StrFromC("op"), x0));
+
+  hnode_t* x1 = this->child->PrettyTree();
+  L->append(Alloc<field>(StrFromC("child"), x1));
+
+  return out_node;
+}
+
+void expr__Unary::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, expr_e::Unary)) {
+    return;
+  }
+  enc->Obj(this->op);
+  enc->Obj(this->child);
+  enc->End(this);
+}
+
+expr__Unary* expr__Unary::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  expr_t* x1 = expr_t::Decode(dec);
+  expr__Unary* obj = Alloc<expr__Unary>(x0, x1);
+  return obj;
+}
+
+hnode_t* expr__Binary::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("expr.Binary"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->op->PrettyTree();
+  L->append(Alloc<field>(StrFromC("op"), x0));
+
+  hnode_t* x1 = this->left->PrettyTree();
+  L->append(Alloc<field>(StrFromC("left"), x1));
+
+  hnode_t* x2 = this->right->PrettyTree();
+  L->append(Alloc<field>(StrFromC("right"), x2));
+
+  return out_node;
+}
+
+void expr__Binary::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, expr_e::Binary)) {
+    return;
+  }
+  enc->Obj(this->op);
+  enc->Obj(this->left);
+  enc->Obj(this->right);
+  enc->End(this);
+}
+
+expr__Binary* expr__Binary::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  expr_t* x1 = expr_t::Decode(dec);
+  expr_t* x2 = expr_t::Decode(dec);
+  expr__Binary* obj = Alloc<expr__Binary>(x0, x1, x2);
+  return obj;
+}
+
+hnode_t* expr__Compare::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("expr.Compare"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->left->PrettyTree();
+  L->append(Alloc<field>(StrFromC("left"), x0));
+
+  if (this->ops != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<Token*> it(this->ops); !it.Done(); it.Next()) {
+      Token* i1 = it.Value();
+      x1->children->append(i1->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("ops"), x1));
+  }
+
+  if (this->comparators != nullptr) {  // array
+    hnode__Array* x2 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<expr_t*> it(this->comparators); !it.Done(); it.Next()) {
+      expr_t* i2 = it.Value();
+      x2->children->append(i2->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("comparators"), x2));
+  }
+
+  return out_node;
+}
+
+void expr__Compare::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, expr_e::Compare)) {
+    return;
+  }
+  enc->Obj(this->left);
+  if (this->ops == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->ops));
+    for (ListIter<Token*> it(this->ops); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  if (this->comparators == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->comparators));
+    for (ListIter<expr_t*> it(this->comparators); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+expr__Compare* expr__Compare::DecodeFields(serialize::Decoder* dec) {
+  expr_t* x0 = expr_t::Decode(dec);
+  List<Token*>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<Token*>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(Token::Decode(dec));
+    }
+  }
+  List<expr_t*>* x2 = nullptr;
+  int n2 = dec->Int();
+  if (n2 >= 0) {
+    x2 = Alloc<List<expr_t*>>();
+    for (int i = 0; i < n2; ++i) {
+      x2->append(expr_t::Decode(dec));
+    }
+  }
+  expr__Compare* obj = Alloc<expr__Compare>(x0, x1, x2);
+  return obj;
+}
+
+hnode_t* expr__FuncCall::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("expr.FuncCall"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->func->PrettyTree();
+  L->append(Alloc<field>(StrFromC("func"), x0));
+
+  hnode_t* x1 = this->args->PrettyTree();
+  L->append(Alloc<field>(StrFromC("args"), x1));
+
+  return out_node;
+}
+
+void expr__FuncCall::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, expr_e::FuncCall)) {
+    return;
+  }
+  enc->Obj(this->func);
+  enc->Obj(this->args);
+  enc->End(this);
+}
+
+expr__FuncCall* expr__FuncCall::DecodeFields(serialize::Decoder* dec) {
+  expr_t* x0 = expr_t::Decode(dec);
+  ArgList* x1 = ArgList::Decode(dec);
+  expr__FuncCall* obj = Alloc<expr__FuncCall>(x0, x1);
+  return obj;
+}
+
+hnode_t* expr__IfExp::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("expr.IfExp"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->test->PrettyTree();
+  L->append(Alloc<field>(StrFromC("test"), x0));
+
+  hnode_t* x1 = this->body->PrettyTree();
+  L->append(Alloc<field>(StrFromC("body"), x1));
+
+  hnode_t* x2 = this->orelse->PrettyTree();
+  L->append(Alloc<field>(StrFromC("orelse"), x2));
+
+  return out_node;
+}
+
+void expr__IfExp::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, expr_e::IfExp)) {
+    return;
+  }
+  enc->Obj(this->test);
+  enc->Obj(this->body);
+  enc->Obj(this->orelse);
+  enc->End(this);
+}
+
+expr__IfExp* expr__IfExp::DecodeFields(serialize::Decoder* dec) {
+  expr_t* x0 = expr_t::Decode(dec);
+  expr_t* x1 = expr_t::Decode(dec);
+  expr_t* x2 = expr_t::Decode(dec);
+  expr__IfExp* obj = Alloc<expr__IfExp>(x0, x1, x2);
+  return obj;
+}
+
+hnode_t* expr__Tuple::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("expr.Tuple"));
+  List<field*>* L = out_node->fields;
+
+  if (this->elts != nullptr) {  // array
+    hnode__Array* x0 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<expr_t*> it(this->elts); !it.Done(); it.Next()) {
+      expr_t* i0 = it.Value();
+      x0->children->append(i0->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("elts"), x0));
+  }
+
+  hnode_t* x1 = Alloc<hnode__Leaf>(StrFromC(expr_context_str(this->ctx)),
+                                   color_e::TypeName);
+  L->append(Alloc<field>(StrFromC("ctx"), x1));
+
+  return out_node;
+}
+
+void expr__Tuple::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, expr_e::Tuple)) {
+    return;
+  }
+  if (this->elts == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->elts));
+    for (ListIter<expr_t*> it(this->elts); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->Int(static_cast<int>(this->ctx));
+  enc->End(this);
+}
+
+expr__Tuple* expr__Tuple::DecodeFields(serialize::Decoder* dec) {
+  List<expr_t*>* x0 = nullptr;
+  int n0 = dec->Int();
+  if (n0 >= 0) {
+    x0 = Alloc<List<expr_t*>>();
+    for (int i = 0; i < n0; ++i) {
+      x0->append(expr_t::Decode(dec));
+    }
+  }
+  expr_context_t x1 = static_cast<expr_context_t>(dec->Int());
+  expr__Tuple* obj = Alloc<expr__Tuple>(x0, x1);
+  return obj;
+}
+
+hnode_t* expr__List::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("expr.List"));
+  List<field*>* L = out_node->fields;
+
+  if (this->elts != nullptr) {  // array
+    hnode__Array* x0 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<expr_t*> it(this->elts); !it.Done(); it.Next()) {
+      expr_t* i0 = it.Value();
+      x0->children->append(i0->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("elts"), x0));
+  }
+
+  hnode_t* x1 = Alloc<hnode__Leaf>(StrFromC(expr_context_str(this->ctx)),
+                                   color_e::TypeName);
+  L->append(Alloc<field>(StrFromC("ctx"), x1));
+
+  return out_node;
+}
+
+void expr__List::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, expr_e::List)) {
+    return;
+  }
+  if (this->elts == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->elts));
+    for (ListIter<expr_t*> it(this->elts); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->Int(static_cast<int>(this->ctx));
+  enc->End(this);
+}
+
+expr__List* expr__List::DecodeFields(serialize::Decoder* dec) {
+  List<expr_t*>* x0 = nullptr;
+  int n0 = dec->Int();
+  if (n0 >= 0) {
+    x0 = Alloc<List<expr_t*>>();
+    for (int i = 0; i < n0; ++i) {
+      x0->append(expr_t::Decode(dec));
+    }
+  }
+  expr_context_t x1 = static_cast<expr_context_t>(dec->Int());
+  expr__List* obj = Alloc<expr__List>(x0, x1);
+  return obj;
+}
+
+hnode_t* expr__Dict::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("expr.Dict"));
+  List<field*>* L = out_node->fields;
+
+  if (this->keys != nullptr) {  // array
+    hnode__Array* x0 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<expr_t*> it(this->keys); !it.Done(); it.Next()) {
+      expr_t* i0 = it.Value();
+      x0->children->append(i0->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("keys"), x0));
+  }
+
+  if (this->values != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<expr_t*> it(this->values); !it.Done(); it.Next()) {
+      expr_t* i1 = it.Value();
+      x1->children->append(i1->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("values"), x1));
+  }
+
+  return out_node;
+}
+
+void expr__Dict::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, expr_e::Dict)) {
+    return;
+  }
+  if (this->keys == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->keys));
+    for (ListIter<expr_t*> it(this->keys); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  if (this->values == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->values));
+    for (ListIter<expr_t*> it(this->values); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+expr__Dict* expr__Dict::DecodeFields(serialize::Decoder* dec) {
+  List<expr_t*>* x0 = nullptr;
+  int n0 = dec->Int();
+  if (n0 >= 0) {
+    x0 = Alloc<List<expr_t*>>();
+    for (int i = 0; i < n0; ++i) {
+      x0->append(expr_t::Decode(dec));
+    }
+  }
+  List<expr_t*>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<expr_t*>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(expr_t::Decode(dec));
+    }
+  }
+  expr__Dict* obj = Alloc<expr__Dict>(x0, x1);
+  return obj;
+}
+
+hnode_t* expr__Implicit::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("expr.Implicit"));
+  return out_node;
+}
+
+void expr__Implicit::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, expr_e::Implicit)) {
+    return;
+  }
+  enc->End(this);
+}
+
+expr__Implicit* expr__Implicit::DecodeFields(serialize::Decoder* dec) {
+  expr__Implicit* obj = Alloc<expr__Implicit>();
+  return obj;
+}
+
+hnode_t* expr__ListComp::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("expr.ListComp"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->elt->PrettyTree();
+  L->append(Alloc<field>(StrFromC("elt"), x0));
+
+  if (this->generators != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<comprehension*> it(this->generators); !it.Done(); it.Next()) {
+      comprehension* i1 = it.Value();
+      x1->children->append(i1->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("generators"), x1));
+  }
+
+  return out_node;
+}
+
+void expr__ListComp::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, expr_e::ListComp)) {
+    return;
+  }
+  enc->Obj(this->elt);
+  if (this->generators == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->generators));
+    for (ListIter<comprehension*> it(this->generators); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+expr__ListComp* expr__ListComp::DecodeFields(serialize::Decoder* dec) {
+  expr_t* x0 = expr_t::Decode(dec);
+  List<comprehension*>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<comprehension*>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(comprehension::Decode(dec));
+    }
+  }
+  expr__ListComp* obj = Alloc<expr__ListComp>(x0, x1);
+  return obj;
+}
+
+hnode_t* expr__DictComp::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("expr.DictComp"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->key->PrettyTree();
+  L->append(Alloc<field>(StrFromC("key"), x0));
+
+  hnode_t* x1 = this->value->PrettyTree();
+  L->append(Alloc<field>(StrFromC("value"), x1));
+
+  if (this->generators != nullptr) {  // array
+    hnode__Array* x2 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<comprehension*> it(this->generators); !it.Done(); it.Next()) {
+      comprehension* i2 = it.Value();
+      x2->children->append(i2->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("generators"), x2));
+  }
+
+  return out_node;
+}
+
+void expr__DictComp::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, expr_e::DictComp)) {
+    return;
+  }
+  enc->Obj(this->key);
+  enc->Obj(this->value);
+  if (this->generators == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->generators));
+    for (ListIter<comprehension*> it(this->generators); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+expr__DictComp* expr__DictComp::DecodeFields(serialize::Decoder* dec) {
+  expr_t* x0 = expr_t::Decode(dec);
+  expr_t* x1 = expr_t::Decode(dec);
+  List<comprehension*>* x2 = nullptr;
+  int n2 = dec->Int();
+  if (n2 >= 0) {
+    x2 = Alloc<List<comprehension*>>();
+    for (int i = 0; i < n2; ++i) {
+      x2->append(comprehension::Decode(dec));
+    }
+  }
+  expr__DictComp* obj = Alloc<expr__DictComp>(x0, x1, x2);
+  return obj;
+}
+
+hnode_t* expr__GeneratorExp::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("expr.GeneratorExp"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->elt->PrettyTree();
+  L->append(Alloc<field>(StrFromC("elt"), x0));
+
+  if (this->generators != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<comprehension*> it(this->generators); !it.Done(); it.Next()) {
+      comprehension* i1 = it.Value();
+      x1->children->append(i1->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("generators"), x1));
+  }
+
+  return out_node;
+}
+
+void expr__GeneratorExp::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, expr_e::GeneratorExp)) {
+    return;
+  }
+  enc->Obj(this->elt);
+  if (this->generators == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->generators));
+    for (ListIter<comprehension*> it(this->generators); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+expr__GeneratorExp* expr__GeneratorExp::DecodeFields(serialize::Decoder* dec) {
+  expr_t* x0 = expr_t::Decode(dec);
+  List<comprehension*>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<comprehension*>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(comprehension::Decode(dec));
+    }
+  }
+  expr__GeneratorExp* obj = Alloc<expr__GeneratorExp>(x0, x1);
+  return obj;
+}
+
+hnode_t* expr__Range::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("expr.Range"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->lower->PrettyTree();
+  L->append(Alloc<field>(StrFromC("lower"), x0));
+
+  hnode_t* x1 = this->upper->PrettyTree();
+  L->append(Alloc<field>(StrFromC("upper"), x1));
+
+  return out_node;
+}
+
+void expr__Range::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, expr_e::Range)) {
+    return;
+  }
+  enc->Obj(this->lower);
+  enc->Obj(this->upper);
+  enc->End(this);
+}
+
+expr__Range* expr__Range::DecodeFields(serialize::Decoder* dec) {
+  expr_t* x0 = expr_t::Decode(dec);
+  expr_t* x1 = expr_t::Decode(dec);
+  expr__Range* obj = Alloc<expr__Range>(x0, x1);
+  return obj;
+}
+
+hnode_t* expr__Slice::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("expr.Slice"));
+  List<field*>* L = out_node->fields;
+
+  if (this->lower) {  // maybe
+    hnode_t* x0 = this->lower->PrettyTree();
+    L->append(Alloc<field>(StrFromC("lower"), x0));
+  }
+
+  if (this->upper) {  // maybe
+    hnode_t* x1 = this->upper->PrettyTree();
+    L->append(Alloc<field>(StrFromC("upper"), x1));
+  }
+
+  return out_node;
+}
+
+void expr__Slice::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, expr_e::Slice)) {
+    return;
+  }
+  enc->Obj(this->lower);
+  enc->Obj(this->upper);
+  enc->End(this);
+}
+
+expr__Slice* expr__Slice::DecodeFields(serialize::Decoder* dec) {
+  expr_t* x0 = expr_t::Decode(dec);
+  expr_t* x1 = expr_t::Decode(dec);
+  expr__Slice* obj = Alloc<expr__Slice>(x0, x1);
+  return obj;
+}
+
+hnode_t* expr__Spread::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("expr.Spread"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->child->PrettyTree();
+  L->append(Alloc<field>(StrFromC("child"), x0));
+
+  hnode_t* x1 = Alloc<hnode__Leaf>(StrFromC(expr_context_str(this->ctx)),
+                                   color_e::TypeName);
+  L->append(Alloc<field>(StrFromC("ctx"), x1));
+
+  return out_node;
+}
+
+void expr__Spread::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, expr_e::Spread)) {
+    return;
+  }
+  enc->Obj(this->child);
+  enc->Int(static_cast<int>(this->ctx));
+  enc->End(this);
+}
+
+expr__Spread* expr__Spread::DecodeFields(serialize::Decoder* dec) {
+  expr_t* x0 = expr_t::Decode(dec);
+  expr_context_t x1 = static_cast<expr_context_t>(dec->Int());
+  expr__Spread* obj = Alloc<expr__Spread>(x0, x1);
+  return obj;
+}
+
+void expr_t::Encode(serialize::Encoder* enc) {
+  switch (this->tag_()) {
+  case expr_e::Var:
+    static_cast<expr__Var*>(this)->Encode(enc);
+    break;
+  case expr_e::Const:
+    static_cast<expr__Const*>(this)->Encode(enc);
+    break;
+  case expr_e::ShArrayLiteral:
+    static_cast<sh_array_literal*>(this)->Encode(enc);
+    break;
+  case expr_e::RegexLiteral:
+    static_cast<expr__RegexLiteral*>(this)->Encode(enc);
+    break;
+  case expr_e::SimpleVarSub:
+    static_cast<simple_var_sub*>(this)->Encode(enc);
+    break;
+  case expr_e::BracedVarSub:
+    static_cast<braced_var_sub*>(this)->Encode(enc);
+    break;
+  case expr_e::CommandSub:
+    static_cast<command_sub*>(this)->Encode(enc);
+    break;
+  case expr_e::SingleQuoted:
+    static_cast<single_quoted*>(this)->Encode(enc);
+    break;
+  case expr_e::DoubleQuoted:
+    static_cast<double_quoted*>(this)->Encode(enc);
+    break;
+  case expr_e::BlockArg:
+    static_cast<BlockArg*>(this)->Encode(enc);
+    break;
+  case expr_e::Lambda:
+    static_cast<expr__Lambda*>(this)->Encode(enc);
+    break;
+  case expr_e::Unary:
+    static_cast<expr__Unary*>(this)->Encode(enc);
+    break;
+  case expr_e::Binary:
+    static_cast<expr__Binary*>(this)->Encode(enc);
+    break;
+  case expr_e::Compare:
+    static_cast<expr__Compare*>(this)->Encode(enc);
+    break;
+  case expr_e::FuncCall:
+    static_cast<expr__FuncCall*>(this)->Encode(enc);
+    break;
+  case expr_e::IfExp:
+    static_cast<expr__IfExp*>(this)->Encode(enc);
+    break;
+  case expr_e::Tuple:
+    static_cast<expr__Tuple*>(this)->Encode(enc);
+    break;
+  case expr_e::List:
+    static_cast<expr__List*>(this)->Encode(enc);
+    break;
+  case expr_e::Dict:
+    static_cast<expr__Dict*>(this)->Encode(enc);
+    break;
+  case expr_e::Implicit:
+    static_cast<expr__Implicit*>(this)->Encode(enc);
+    break;
+  case expr_e::ListComp:
+    static_cast<expr__ListComp*>(this)->Encode(enc);
+    break;
+  case expr_e::DictComp:
+    static_cast<expr__DictComp*>(this)->Encode(enc);
+    break;
+  case expr_e::GeneratorExp:
+    static_cast<expr__GeneratorExp*>(this)->Encode(enc);
+    break;
+  case expr_e::Range:
+    static_cast<expr__Range*>(this)->Encode(enc);
+    break;
+  case expr_e::Slice:
+    static_cast<expr__Slice*>(this)->Encode(enc);
+    break;
+  case expr_e::Subscript:
+    static_cast<subscript*>(this)->Encode(enc);
+    break;
+  case expr_e::Attribute:
+    static_cast<attribute*>(this)->Encode(enc);
+    break;
+  case expr_e::Spread:
+    static_cast<expr__Spread*>(this)->Encode(enc);
+    break;
+  default:
+    assert(0);
+  }
+}
+
+expr_t* expr_t::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<expr_t*>(dec->Ref());
+  }
+  expr_t* obj = nullptr;
+  switch (tag) {
+  case expr_e::Var:
+    obj = expr__Var::DecodeFields(dec);
+    break;
+  case expr_e::Const:
+    obj = expr__Const::DecodeFields(dec);
+    break;
+  case expr_e::ShArrayLiteral:
+    obj = sh_array_literal::DecodeFields(dec);
+    break;
+  case expr_e::RegexLiteral:
+    obj = expr__RegexLiteral::DecodeFields(dec);
+    break;
+  case expr_e::SimpleVarSub:
+    obj = simple_var_sub::DecodeFields(dec);
+    break;
+  case expr_e::BracedVarSub:
+    obj = braced_var_sub::DecodeFields(dec);
+    break;
+  case expr_e::CommandSub:
+    obj = command_sub::DecodeFields(dec);
+    break;
+  case expr_e::SingleQuoted:
+    obj = single_quoted::DecodeFields(dec);
+    break;
+  case expr_e::DoubleQuoted:
+    obj = double_quoted::DecodeFields(dec);
+    break;
+  case expr_e::BlockArg:
+    obj = BlockArg::DecodeFields(dec);
+    break;
+  case expr_e::Lambda:
+    obj = expr__Lambda::DecodeFields(dec);
+    break;
+  case expr_e::Unary:
+    obj = expr__Unary::DecodeFields(dec);
+    break;
+  case expr_e::Binary:
+    obj = expr__Binary::DecodeFields(dec);
+    break;
+  case expr_e::Compare:
+    obj = expr__Compare::DecodeFields(dec);
+    break;
+  case expr_e::FuncCall:
+    obj = expr__FuncCall::DecodeFields(dec);
+    break;
+  case expr_e::IfExp:
+    obj = expr__IfExp::DecodeFields(dec);
+    break;
+  case expr_e::Tuple:
+    obj = expr__Tuple::DecodeFields(dec);
+    break;
+  case expr_e::List:
+    obj = expr__List::DecodeFields(dec);
+    break;
+  case expr_e::Dict:
+    obj = expr__Dict::DecodeFields(dec);
+    break;
+  case expr_e::Implicit:
+    obj = expr__Implicit::DecodeFields(dec);
+    break;
+  case expr_e::ListComp:
+    obj = expr__ListComp::DecodeFields(dec);
+    break;
+  case expr_e::DictComp:
+    obj = expr__DictComp::DecodeFields(dec);
+    break;
+  case expr_e::GeneratorExp:
+    obj = expr__GeneratorExp::DecodeFields(dec);
+    break;
+  case expr_e::Range:
+    obj = expr__Range::DecodeFields(dec);
+    break;
+  case expr_e::Slice:
+    obj = expr__Slice::DecodeFields(dec);
+    break;
+  case expr_e::Subscript:
+    obj = subscript::DecodeFields(dec);
+    break;
+  case expr_e::Attribute:
+    obj = attribute::DecodeFields(dec);
+    break;
+  case expr_e::Spread:
+    obj = expr__Spread::DecodeFields(dec);
+    break;
+  default:
+    throw Alloc<ValueError>();
+  }
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* expr_t::PrettyTree() {
+  switch (this->tag_()) {
+  case expr_e::Var: {
+    expr__Var* obj = static_cast<expr__Var*>(this);
+    return obj->PrettyTree();
+  }
+  case expr_e::Const: {
+    expr__Const* obj = static_cast<expr__Const*>(this);
+    return obj->PrettyTree();
+  }
+  case expr_e::ShArrayLiteral: {
+    sh_array_literal* obj = static_cast<sh_array_literal*>(this);
+    return obj->PrettyTree();
+  }
+  case expr_e::RegexLiteral: {
+    expr__RegexLiteral* obj = static_cast<expr__RegexLiteral*>(this);
+    return obj->PrettyTree();
+  }
+  case expr_e::SimpleVarSub: {
+    simple_var_sub* obj = static_cast<simple_var_sub*>(this);
+    return obj->PrettyTree();
+  }
+  case expr_e::BracedVarSub: {
+    braced_var_sub* obj = static_cast<braced_var_sub*>(this);
+    return obj->PrettyTree();
+  }
+  case expr_e::CommandSub: {
+    command_sub* obj = static_cast<command_sub*>(this);
+    return obj->PrettyTree();
+  }
+  case expr_e::SingleQuoted: {
+    single_quoted* obj = static_cast<single_quoted*>(this);
+    return obj->PrettyTree();
+  }
+  case expr_e::DoubleQuoted: {
+    double_quoted* obj = static_cast<double_quoted*>(this);
+    return obj->PrettyTree();
+  }
+  case expr_e::BlockArg: {
+    BlockArg* obj = static_cast<BlockArg*>(this);
+    return obj->PrettyTree();
+  }
+  case expr_e::Lambda: {
+    expr__Lambda* obj = static_cast<expr__Lambda*>(this);
+    return obj->PrettyTree();
+  }
+  case expr_e::Unary: {
+    expr__Unary* obj = static_cast<expr__Unary*>(this);
+    return obj->PrettyTree();
+  }
+  case expr_e::Binary: {
+    expr__Binary* obj = static_cast<expr__Binary*>(this);
+    return obj->PrettyTree();
+  }
+  case expr_e::Compare: {
+    expr__Compare* obj = static_cast<expr__Compare*>(this);
+    return obj->PrettyTree();
+  }
+  case expr_e::FuncCall: {
+    expr__FuncCall* obj = static_cast<expr__FuncCall*>(this);
+    return obj->PrettyTree();
+  }
+  case expr_e::IfExp: {
+    expr__IfExp* obj = static_cast<expr__IfExp*>(this);
+    return obj->PrettyTree();
+  }
+  case expr_e::Tuple: {
+    expr__Tuple* obj = static_cast<expr__Tuple*>(this);
+    return obj->PrettyTree();
+  }
+  case expr_e::List: {
+    expr__List* obj = static_cast<expr__List*>(this);
+    return obj->PrettyTree();
+  }
+  case expr_e::Dict: {
+    expr__Dict* obj = static_cast<expr__Dict*>(this);
+    return obj->PrettyTree();
+  }
+  case expr_e::Implicit: {
+    expr__Implicit* obj = static_cast<expr__Implicit*>(this);
+    return obj->PrettyTree();
+  }
+  case expr_e::ListComp: {
+    expr__ListComp* obj = static_cast<expr__ListComp*>(this);
+    return obj->PrettyTree();
+  }
+  case expr_e::DictComp: {
+    expr__DictComp* obj = static_cast<expr__DictComp*>(this);
+    return obj->PrettyTree();
+  }
+  case expr_e::GeneratorExp: {
+    expr__GeneratorExp* obj = static_cast<expr__GeneratorExp*>(this);
+    return obj->PrettyTree();
+  }
+  case expr_e::Range: {
+    expr__Range* obj = static_cast<expr__Range*>(this);
+    return obj->PrettyTree();
+  }
+  case expr_e::Slice: {
+    expr__Slice* obj = static_cast<expr__Slice*>(this);
+    return obj->PrettyTree();
+  }
+  case expr_e::Subscript: {
+    subscript* obj = static_cast<subscript*>(this);
+    return obj->PrettyTree();
+  }
+  case expr_e::Attribute: {
+    attribute* obj = static_cast<attribute*>(this);
+    return obj->PrettyTree();
+  }
+  case expr_e::Spread: {
+    expr__Spread* obj = static_cast<expr__Spread*>(this);
+    return obj->PrettyTree();
+  }
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* posix_class::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("posix_class"));
+  List<field*>* L = out_node->fields;
+
+  if (this->negated) {  // maybe
+    hnode_t* x0 = this->negated->PrettyTree();
+    L->append(Alloc<field>(StrFromC("negated"), x0));
+  }
+
+  hnode_t* x1 = runtime::NewLeaf(this->name, color_e::StringConst);
+  L->append(Alloc<field>(StrFromC("name"), x1));
+
+  return out_node;
+}
+
+void posix_class::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, 95)) {
+    return;
+  }
+  enc->Obj(this->negated);
+  enc->Str(this->name);
+  enc->End(this);
+}
+
+posix_class* posix_class::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  Str* x1 = dec->Str();
+  posix_class* obj = Alloc<posix_class>(x0, x1);
+  return obj;
+}
+
+posix_class* posix_class::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<posix_class*>(dec->Ref());
+  }
+  if (tag != 95) {
+    throw Alloc<ValueError>();
+  }
+  posix_class* obj = DecodeFields(dec);
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* perl_class::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("perl_class"));
+  List<field*>* L = out_node->fields;
+
+  if (this->negated) {  // maybe
+    hnode_t* x0 = this->negated->PrettyTree();
+    L->append(Alloc<field>(StrFromC("negated"), x0));
+  }
+
+  hnode_t* x1 = runtime::NewLeaf(this->name, color_e::StringConst);
+  L->append(Alloc<field>(StrFromC("name"), x1));
+
+  return out_node;
+}
+
+void perl_class::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, 96)) {
+    return;
+  }
+  enc->Obj(this->negated);
+  enc->Str(this->name);
+  enc->End(this);
+}
+
+perl_class* perl_class::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  Str* x1 = dec->Str();
+  perl_class* obj = Alloc<perl_class>(x0, x1);
+  return obj;
+}
+
+perl_class* perl_class::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<perl_class*>(dec->Ref());
+  }
+  if (tag != 96) {
+    throw Alloc<ValueError>();
+  }
+  perl_class* obj = DecodeFields(dec);
+  dec->End(obj);
+  return obj;
+}
+const char* class_literal_term_str(int tag) {
+  switch (tag) {
+  case class_literal_term_e::PosixClass:
+    return "class_literal_term.PosixClass";
+  case class_literal_term_e::PerlClass:
+    return "class_literal_term.PerlClass";
+  case class_literal_term_e::Range:
+    return "class_literal_term.Range";
+  case class_literal_term_e::CharLiteral:
+    return "class_literal_term.CharLiteral";
+  case class_literal_term_e::SimpleVarSub:
+    return "class_literal_term.SimpleVarSub";
+  case class_literal_term_e::BracedVarSub:
+    return "class_literal_term.BracedVarSub";
+  case class_literal_term_e::SingleQuoted:
+    return "class_literal_term.SingleQuoted";
+  case class_literal_term_e::DoubleQuoted:
+    return "class_literal_term.DoubleQuoted";
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* class_literal_term__Range::PrettyTree() {
+  hnode__Record* out_node =
+runtime::NewRecord(StrFromC("class_literal_term.Range"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->start->PrettyTree();
+  L->append(Alloc<field>(StrFromC("start"), x0));
+
+  hnode_t* x1 = this->end->PrettyTree();
+  L->append(Alloc<field>(StrFromC("end"), x1));
+
+  return out_node;
+}
+
+void class_literal_term__Range::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, class_literal_term_e::Range)) {
+    return;
+  }
+  enc->Obj(this->start);
+  enc->Obj(this->end);
+  enc->End(this);
+}
+
+class_literal_term__Range*
+class_literal_term__Range::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  Token* x1 = Token::Decode(dec);
+  class_literal_term__Range* obj = Alloc<class_literal_term__Range>(x0, x1);
+  return obj;
+}
+
+hnode_t* class_literal_term__CharLiteral::PrettyTree() {
+  hnode__Record* out_node =
+runtime::NewRecord(StrFromC("class_literal_term.CharLiteral"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->tok->PrettyTree();
+  L->append(Alloc<field>(StrFromC("tok"), x0));
+
+  return out_node;
+}
+
+void class_literal_term__CharLiteral::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, class_literal_term_e::CharLiteral)) {
+    return;
+  }
+  enc->Obj(this->tok);
+  enc->End(this);
+}
+
+class_literal_term__CharLiteral*
+class_literal_term__CharLiteral::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  class_literal_term__CharLiteral* obj =
+Alloc<class_literal_term__CharLiteral>(x0);
+  return obj;
+}
+
+void class_literal_term_t::Encode(serialize::Encoder* enc) {
+  switch (this->tag_()) {
+  case class_literal_term_e::PosixClass:
+    static_cast<posix_class*>(this)->Encode(enc);
+    break;
+  case class_literal_term_e::PerlClass:
+    static_cast<perl_class*>(this)->Encode(enc);
+    break;
+  case class_literal_term_e::Range:
+    static_cast<class_literal_term__Range*>(this)->Encode(enc);
+    break;
+  case class_literal_term_e::CharLiteral:
+    static_cast<class_literal_term__CharLiteral*>(this)->Encode(enc);
+    break;
+  case class_literal_term_e::SimpleVarSub:
+    static_cast<simple_var_sub*>(this)->Encode(enc);
+    break;
+  case class_literal_term_e::BracedVarSub:
+    static_cast<braced_var_sub*>(this)->Encode(enc);
+    break;
+  case class_literal_term_e::SingleQuoted:
+    static_cast<single_quoted*>(this)->Encode(enc);
+    break;
+  case class_literal_term_e::DoubleQuoted:
+    static_cast<double_quoted*>(this)->Encode(enc);
+    break;
+  default:
+    assert(0);
+  }
+}
+
+class_literal_term_t* class_literal_term_t::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<class_literal_term_t*>(dec->Ref());
+  }
+  class_literal_term_t* obj = nullptr;
+  switch (tag) {
+  case class_literal_term_e::PosixClass:
+    obj = posix_class::DecodeFields(dec);
+    break;
+  case class_literal_term_e::PerlClass:
+    obj = perl_class::DecodeFields(dec);
+    break;
+  case class_literal_term_e::Range:
+    obj = class_literal_term__Range::DecodeFields(dec);
+    break;
+  case class_literal_term_e::CharLiteral:
+    obj = class_literal_term__CharLiteral::DecodeFields(dec);
+    break;
+  case class_literal_term_e::SimpleVarSub:
+    obj = simple_var_sub::DecodeFields(dec);
+    break;
+  case class_literal_term_e::BracedVarSub:
+    obj = braced_var_sub::DecodeFields(dec);
+    break;
+  case class_literal_term_e::SingleQuoted:
+    obj = single_quoted::DecodeFields(dec);
+    break;
+  case class_literal_term_e::DoubleQuoted:
+    obj = double_quoted::DecodeFields(dec);
+    break;
+  default:
+    throw Alloc<ValueError>();
+  }
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* class_literal_term_t::PrettyTree() {
+  switch (this->tag_()) {
+  case class_literal_term_e::PosixClass: {
+    posix_class* obj = static_cast<posix_class*>(this);
+    return obj->PrettyTree();
+  }
+  case class_literal_term_e::PerlClass: {
+    perl_class* obj = static_cast<perl_class*>(this);
+    return obj->PrettyTree();
+  }
+  case class_literal_term_e::Range: {
+    class_literal_term__Range* obj =
+static_cast<class_literal_term__Range*>(this);
+    return obj->PrettyTree();
+  }
+  case class_literal_term_e::CharLiteral: {
+    class_literal_term__CharLiteral* obj =
+static_cast<class_literal_term__CharLiteral*>(this);
+    return obj->PrettyTree();
+  }
+  case class_literal_term_e::SimpleVarSub: {
+    simple_var_sub* obj = static_cast<simple_var_sub*>(this);
+    return obj->PrettyTree();
+  }
+  case class_literal_term_e::BracedVarSub: {
+    braced_var_sub* obj = static_cast<braced_var_sub*>(this);
+    return obj->PrettyTree();
+  }
+  case class_literal_term_e::SingleQuoted: {
+    single_quoted* obj = static_cast<single_quoted*>(this);
+    return obj->PrettyTree();
+  }
+  case class_literal_term_e::DoubleQuoted: {
+    double_quoted* obj = static_cast<double_quoted*>(this);
+    return obj->PrettyTree();
+  }
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* CharCode::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("CharCode"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = Alloc<hnode__Leaf>(str(this->i), color_e::OtherConst);
+  L->append(Alloc<field>(StrFromC("i"), x0));
+
+  hnode_t* x1 = Alloc<hnode__Leaf>(this->u_braced ? runtime::TRUE_STR :
+                                   runtime::FALSE_STR, color_e::OtherConst);
+  L->append(Alloc<field>(StrFromC("u_braced"), x1));
+
+  hnode_t* x2 = Alloc<hnode__Leaf>(str(this->spid), color_e::OtherConst);
+  L->append(Alloc<field>(StrFromC("spid"), x2));
+
+  return out_node;
+}
+
+void CharCode::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, 97)) {
+    return;
+  }
+  enc->Int(this->i);
+  enc->Bool(this->u_braced);
+  enc->SpanId(this->spid);
+  enc->End(this);
+}
+
+CharCode* CharCode::DecodeFields(serialize::Decoder* dec) {
+  int x0 = dec->Int();
+  bool x1 = dec->Bool();
+  int x2 = dec->SpanId();
+  CharCode* obj = Alloc<CharCode>(x0, x1, x2);
+  return obj;
+}
+
+CharCode* CharCode::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<CharCode*>(dec->Ref());
+  }
+  if (tag != 97) {
+    throw Alloc<ValueError>();
+  }
+  CharCode* obj = DecodeFields(dec);
+  dec->End(obj);
+  return obj;
+}
+const char* char_class_term_str(int tag) {
+  switch (tag) {
+  case char_class_term_e::PosixClass:
+    return "char_class_term.PosixClass";
+  case char_class_term_e::PerlClass:
+    return "char_class_term.PerlClass";
+  case char_class_term_e::Range:
+    return "char_class_term.Range";
+  case char_class_term_e::CharCode:
+    return "char_class_term.CharCode";
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* char_class_term__Range::PrettyTree() {
+  hnode__Record* out_node =
+runtime::NewRecord(StrFromC("char_class_term.Range"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->start->PrettyTree();
+  L->append(Alloc<field>(StrFromC("start"), x0));
+
+  hnode_t* x1 = this->end->PrettyTree();
+  L->append(Alloc<field>(StrFromC("end"), x1));
+
+  return out_node;
+}
+
+void char_class_term__Range::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, char_class_term_e::Range)) {
+    return;
+  }
+  enc->Obj(this->start);
+  enc->Obj(this->end);
+  enc->End(this);
+}
+
+char_class_term__Range*
+char_class_term__Range::DecodeFields(serialize::Decoder* dec) {
+  CharCode* x0 = CharCode::Decode(dec);
+  CharCode* x1 = CharCode::Decode(dec);
+  char_class_term__Range* obj = Alloc<char_class_term__Range>(x0, x1);
+  return obj;
+}
+
+void char_class_term_t::Encode(serialize::Encoder* enc) {
+  switch (this->tag_()) {
+  case char_class_term_e::PosixClass:
+    static_cast<posix_class*>(this)->Encode(enc);
+    break;
+  case char_class_term_e::PerlClass:
+    static_cast<perl_class*>(this)->Encode(enc);
+    break;
+  case char_class_term_e::Range:
+    static_cast<char_class_term__Range*>(this)->Encode(enc);
+    break;
+  case char_class_term_e::CharCode:
+    static_cast<CharCode*>(this)->Encode(enc);
+    break;
+  default:
+    assert(0);
+  }
+}
+
+char_class_term_t* char_class_term_t::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<char_class_term_t*>(dec->Ref());
+  }
+  char_class_term_t* obj = nullptr;
+  switch (tag) {
+  case char_class_term_e::PosixClass:
+    obj = posix_class::DecodeFields(dec);
+    break;
+  case char_class_term_e::PerlClass:
+    obj = perl_class::DecodeFields(dec);
+    break;
+  case char_class_term_e::Range:
+    obj = char_class_term__Range::DecodeFields(dec);
+    break;
+  case char_class_term_e::CharCode:
+    obj = CharCode::DecodeFields(dec);
+    break;
+  default:
+    throw Alloc<ValueError>();
+  }
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* char_class_term_t::PrettyTree() {
+  switch (this->tag_()) {
+  case char_class_term_e::PosixClass: {
+    posix_class* obj = static_cast<posix_class*>(this);
+    return obj->PrettyTree();
+  }
+  case char_class_term_e::PerlClass: {
+    perl_class* obj = static_cast<perl_class*>(this);
+    return obj->PrettyTree();
+  }
+  case char_class_term_e::Range: {
+    char_class_term__Range* obj = static_cast<char_class_term__Range*>(this);
+    return obj->PrettyTree();
+  }
+  case char_class_term_e::CharCode: {
+    CharCode* obj = static_cast<CharCode*>(this);
+    return obj->PrettyTree();
+  }
+  default:
+    assert(0);
+  }
+}
+const char* re_repeat_str(int tag) {
+  switch (tag) {
+  case re_repeat_e::Op:
+    return "re_repeat.Op";
+  case re_repeat_e::Num:
+    return "re_repeat.Num";
+  case re_repeat_e::Range:
+    return "re_repeat.Range";
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* re_repeat__Op::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("re_repeat.Op"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->op->PrettyTree();
+  L->append(Alloc<field>(StrFromC("op"), x0));
+
+  return out_node;
+}
+
+void re_repeat__Op::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, re_repeat_e::Op)) {
+    return;
+  }
+  enc->Obj(this->op);
+  enc->End(this);
+}
+
+re_repeat__Op* re_repeat__Op::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  re_repeat__Op* obj = Alloc<re_repeat__Op>(x0);
+  return obj;
+}
+
+hnode_t* re_repeat__Num::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("re_repeat.Num"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->times->PrettyTree();
+  L->append(Alloc<field>(StrFromC("times"), x0));
+
+  return out_node;
+}
+
+void re_repeat__Num::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, re_repeat_e::Num)) {
+    return;
+  }
+  enc->Obj(this->times);
+  enc->End(this);
+}
+
+re_repeat__Num* re_repeat__Num::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  re_repeat__Num* obj = Alloc<re_repeat__Num>(x0);
+  return obj;
+}
+
+hnode_t* re_repeat__Range::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("re_repeat.Range"));
+  List<field*>* L = out_node->fields;
+
+  if (this->lower) {  // maybe
+    hnode_t* x0 = this->lower->PrettyTree();
+    L->append(Alloc<field>(StrFromC("lower"), x0));
+  }
+
+  if (this->upper) {  // maybe
+    hnode_t* x1 = this->upper->PrettyTree();
+    L->append(Alloc<field>(StrFromC("upper"), x1));
+  }
+
+  return out_node;
+}
+
+void re_repeat__Range::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, re_repeat_e::Range)) {
+    return;
+  }
+  enc->Obj(this->lower);
+  enc->Obj(this->upper);
+  enc->End(this);
+}
+
+re_repeat__Range* re_repeat__Range::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  Token* x1 = Token::Decode(dec);
+  re_repeat__Range* obj = Alloc<re_repeat__Range>(x0, x1);
+  return obj;
+}
+
+void re_repeat_t::Encode(serialize::Encoder* enc) {
+  switch (this->tag_()) {
+  case re_repeat_e::Op:
+    static_cast<re_repeat__Op*>(this)->Encode(enc);
+    break;
+  case re_repeat_e::Num:
+    static_cast<re_repeat__Num*>(this)->Encode(enc);
+    break;
+  case re_repeat_e::Range:
+    static_cast<re_repeat__Range*>(this)->Encode(enc);
+    break;
+  default:
+    assert(0);
+  }
+}
+
+re_repeat_t* re_repeat_t::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<re_repeat_t*>(dec->Ref());
+  }
+  re_repeat_t* obj = nullptr;
+  switch (tag) {
+  case re_repeat_e::Op:
+    obj = re_repeat__Op::DecodeFields(dec);
+    break;
+  case re_repeat_e::Num:
+    obj = re_repeat__Num::DecodeFields(dec);
+    break;
+  case re_repeat_e::Range:
+    obj = re_repeat__Range::DecodeFields(dec);
+    break;
+  default:
+    throw Alloc<ValueError>();
+  }
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* re_repeat_t::PrettyTree() {
+  switch (this->tag_()) {
+  case re_repeat_e::Op: {
+    re_repeat__Op* obj = static_cast<re_repeat__Op*>(this);
+    return obj->PrettyTree();
+  }
+  case re_repeat_e::Num: {
+    re_repeat__Num* obj = static_cast<re_repeat__Num*>(this);
+    return obj->PrettyTree();
+  }
+  case re_repeat_e::Range: {
+    re_repeat__Range* obj = static_cast<re_repeat__Range*>(this);
+    return obj->PrettyTree();
+  }
+  default:
+    assert(0);
+  }
+}
+const char* re_str(int tag) {
+  switch (tag) {
+  case re_e::Token:
+    return "re.Token";
+  case re_e::PosixClass:
+    return "re.PosixClass";
+  case re_e::PerlClass:
+    return "re.PerlClass";
+  case re_e::CharClassLiteral:
+    return "re.CharClassLiteral";
+  case re_e::CharClass:
+    return "re.CharClass";
+  case re_e::Splice:
+    return "re.Splice";
+  case re_e::SimpleVarSub:
+    return "re.SimpleVarSub";
+  case re_e::BracedVarSub:
+    return "re.BracedVarSub";
+  case re_e::SingleQuoted:
+    return "re.SingleQuoted";
+  case re_e::DoubleQuoted:
+    return "re.DoubleQuoted";
+  case re_e::Repeat:
+    return "re.Repeat";
+  case re_e::Seq:
+    return "re.Seq";
+  case re_e::Alt:
+    return "re.Alt";
+  case re_e::Group:
+    return "re.Group";
+  case re_e::Capture:
+    return "re.Capture";
+  case re_e::Backtracking:
+    return "re.Backtracking";
+  case re_e::Primitive:
+    return "re.Primitive";
+  case re_e::LiteralChars:
+    return "re.LiteralChars";
+  default:
+    assert(0);
+  }
+}
+
+hnode_t* re__CharClassLiteral::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("re.CharClassLiteral"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = Alloc<hnode__Leaf>(this->negated ? runtime::TRUE_STR :
+                                   runtime::FALSE_STR, color_e::OtherConst);
+  L->append(Alloc<field>(StrFromC("negated"), x0));
+
+  if (this->terms != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<class_literal_term_t*> it(this->terms); !it.Done();
+         it.Next()) {
+      class_literal_term_t* i1 = it.Value();
+      x1->children->append(i1->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("terms"), x1));
+  }
+
+  return out_node;
+}
+
+void re__CharClassLiteral::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, re_e::CharClassLiteral)) {
+    return;
+  }
+  enc->Bool(this->negated);
+  if (this->terms == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->terms));
+    for (ListIter<class_literal_term_t*> it(this->terms); !it.Done();
+         it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+re__CharClassLiteral* re__CharClassLiteral::DecodeFields(serialize::Decoder*
+                                                         dec) {
+  bool x0 = dec->Bool();
+  List<class_literal_term_t*>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<class_literal_term_t*>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(class_literal_term_t::Decode(dec));
+    }
+  }
+  re__CharClassLiteral* obj = Alloc<re__CharClassLiteral>(x0, x1);
+  return obj;
+}
+
+hnode_t* re__CharClass::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("re.CharClass"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = Alloc<hnode__Leaf>(this->negated ? runtime::TRUE_STR :
+                                   runtime::FALSE_STR, color_e::OtherConst);
+  L->append(Alloc<field>(StrFromC("negated"), x0));
+
+  if (this->terms != nullptr) {  // array
+    hnode__Array* x1 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<char_class_term_t*> it(this->terms); !it.Done(); it.Next()) {
+      char_class_term_t* i1 = it.Value();
+      x1->children->append(i1->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("terms"), x1));
+  }
+
+  return out_node;
+}
+
+void re__CharClass::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, re_e::CharClass)) {
+    return;
+  }
+  enc->Bool(this->negated);
+  if (this->terms == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->terms));
+    for (ListIter<char_class_term_t*> it(this->terms); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+re__CharClass* re__CharClass::DecodeFields(serialize::Decoder* dec) {
+  bool x0 = dec->Bool();
+  List<char_class_term_t*>* x1 = nullptr;
+  int n1 = dec->Int();
+  if (n1 >= 0) {
+    x1 = Alloc<List<char_class_term_t*>>();
+    for (int i = 0; i < n1; ++i) {
+      x1->append(char_class_term_t::Decode(dec));
+    }
+  }
+  re__CharClass* obj = Alloc<re__CharClass>(x0, x1);
+  return obj;
+}
+
+hnode_t* re__Splice::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("re.Splice"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->name->PrettyTree();
+  L->append(Alloc<field>(StrFromC("name"), x0));
+
+  hnode_t* x1 = runtime::NewLeaf(this->var_name, color_e::StringConst);
+  L->append(Alloc<field>(StrFromC("var_name"), x1));
+
+  return out_node;
+}
+
+void re__Splice::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, re_e::Splice)) {
+    return;
+  }
+  enc->Obj(this->name);
+  enc->Str(this->var_name);
+  enc->End(this);
+}
+
+re__Splice* re__Splice::DecodeFields(serialize::Decoder* dec) {
+  Token* x0 = Token::Decode(dec);
+  Str* x1 = dec->Str();
+  re__Splice* obj = Alloc<re__Splice>(x0, x1);
+  return obj;
+}
+
+hnode_t* re__Repeat::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("re.Repeat"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->child->PrettyTree();
+  L->append(Alloc<field>(StrFromC("child"), x0));
+
+  hnode_t* x1 = this->op->PrettyTree();
+  L->append(Alloc<field>(StrFromC("op"), x1));
+
+  return out_node;
+}
+
+void re__Repeat::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, re_e::Repeat)) {
+    return;
+  }
+  enc->Obj(this->child);
+  enc->Obj(this->op);
+  enc->End(this);
+}
+
+re__Repeat* re__Repeat::DecodeFields(serialize::Decoder* dec) {
+  re_t* x0 = re_t::Decode(dec);
+  re_repeat_t* x1 = re_repeat_t::Decode(dec);
+  re__Repeat* obj = Alloc<re__Repeat>(x0, x1);
+  return obj;
+}
+
+hnode_t* re__Seq::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("re.Seq"));
+  List<field*>* L = out_node->fields;
+
+  if (this->children != nullptr) {  // array
+    hnode__Array* x0 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<re_t*> it(this->children); !it.Done(); it.Next()) {
+      re_t* i0 = it.Value();
+      x0->children->append(i0->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("children"), x0));
+  }
+
+  return out_node;
+}
+
+void re__Seq::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, re_e::Seq)) {
+    return;
+  }
+  if (this->children == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->children));
+    for (ListIter<re_t*> it(this->children); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+re__Seq* re__Seq::DecodeFields(serialize::Decoder* dec) {
+  List<re_t*>* x0 = nullptr;
+  int n0 = dec->Int();
+  if (n0 >= 0) {
+    x0 = Alloc<List<re_t*>>();
+    for (int i = 0; i < n0; ++i) {
+      x0->append(re_t::Decode(dec));
+    }
+  }
+  re__Seq* obj = Alloc<re__Seq>(x0);
+  return obj;
+}
+
+hnode_t* re__Alt::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("re.Alt"));
+  List<field*>* L = out_node->fields;
+
+  if (this->children != nullptr) {  // array
+    hnode__Array* x0 = Alloc<hnode__Array>(Alloc<List<hnode_t*>>());
+    for (ListIter<re_t*> it(this->children); !it.Done(); it.Next()) {
+      re_t* i0 = it.Value();
+      x0->children->append(i0->PrettyTree());
+    }
+    L->append(Alloc<field>(StrFromC("children"), x0));
+  }
+
+  return out_node;
+}
+
+void re__Alt::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, re_e::Alt)) {
+    return;
+  }
+  if (this->children == nullptr) {
+    enc->Int(-1);
+  } else {
+    enc->Int(len(this->children));
+    for (ListIter<re_t*> it(this->children); !it.Done(); it.Next()) {
+      enc->Obj(it.Value());
+    }
+  }
+  enc->End(this);
+}
+
+re__Alt* re__Alt::DecodeFields(serialize::Decoder* dec) {
+  List<re_t*>* x0 = nullptr;
+  int n0 = dec->Int();
+  if (n0 >= 0) {
+    x0 = Alloc<List<re_t*>>();
+    for (int i = 0; i < n0; ++i) {
+      x0->append(re_t::Decode(dec));
+    }
+  }
+  re__Alt* obj = Alloc<re__Alt>(x0);
+  return obj;
+}
+
+hnode_t* re__Group::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("re.Group"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->child->PrettyTree();
+  L->append(Alloc<field>(StrFromC("child"), x0));
+
+  return out_node;
+}
+
+void re__Group::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, re_e::Group)) {
+    return;
+  }
+  enc->Obj(this->child);
+  enc->End(this);
+}
+
+re__Group* re__Group::DecodeFields(serialize::Decoder* dec) {
+  re_t* x0 = re_t::Decode(dec);
+  re__Group* obj = Alloc<re__Group>(x0);
+  return obj;
+}
+
+hnode_t* re__Capture::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("re.Capture"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = this->child->PrettyTree();
+  L->append(Alloc<field>(StrFromC("child"), x0));
+
+  if (this->var_name) {  // maybe
+    hnode_t* x1 = this->var_name->PrettyTree();
+    L->append(Alloc<field>(StrFromC("var_name"), x1));
+  }
+
+  return out_node;
+}
+
+void re__Capture::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, re_e::Capture)) {
+    return;
+  }
+  enc->Obj(this->child);
+  enc->Obj(this->var_name);
+  enc->End(this);
+}
+
+re__Capture* re__Capture::DecodeFields(serialize::Decoder* dec) {
+  re_t* x0 = re_t::Decode(dec);
+  Token* x1 = Token::Decode(dec);
+  re__Capture* obj = Alloc<re__Capture>(x0, x1);
+  return obj;
+}
+
+hnode_t* re__Backtracking::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("re.Backtracking"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = Alloc<hnode__Leaf>(this->negated ? runtime::TRUE_STR :
+                                   runtime::FALSE_STR, color_e::OtherConst);
+  L->append(Alloc<field>(StrFromC("negated"), x0));
+
+  hnode_t* x1 = this->name->PrettyTree();
+  L->append(Alloc<field>(StrFromC("name"), x1));
+
+  hnode_t* x2 = this->child->PrettyTree();
+  L->append(Alloc<field>(StrFromC("child"), x2));
+
+  return out_node;
+}
+
+void re__Backtracking::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, re_e::Backtracking)) {
+    return;
+  }
+  enc->Bool(this->negated);
+  enc->Obj(this->name);
+  enc->Obj(this->child);
+  enc->End(this);
+}
+
+re__Backtracking* re__Backtracking::DecodeFields(serialize::Decoder* dec) {
+  bool x0 = dec->Bool();
+  Token* x1 = Token::Decode(dec);
+  re_t* x2 = re_t::Decode(dec);
+  re__Backtracking* obj = Alloc<re__Backtracking>(x0, x1, x2);
+  return obj;
+}
+
+hnode_t* re__Primitive::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("re.Primitive"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = Alloc<hnode__Leaf>(StrFromC(Id_str(this->id)),
+                                   color_e::UserType);
+  L->append(Alloc<field>(StrFromC("id"), x0));
+
+  return out_node;
+}
+
+void re__Primitive::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, re_e::Primitive)) {
+    return;
+  }
+  enc->Int(this->id);
+  enc->End(this);
+}
+
+re__Primitive* re__Primitive::DecodeFields(serialize::Decoder* dec) {
+  Id_t x0 = dec->Int();
+  re__Primitive* obj = Alloc<re__Primitive>(x0);
+  return obj;
+}
+
+hnode_t* re__LiteralChars::PrettyTree() {
+  hnode__Record* out_node = runtime::NewRecord(StrFromC("re.LiteralChars"));
+  List<field*>* L = out_node->fields;
+
+  hnode_t* x0 = runtime::NewLeaf(this->s, color_e::StringConst);
+  L->append(Alloc<field>(StrFromC("s"), x0));
+
+  hnode_t* x1 = Alloc<hnode__Leaf>(str(this->spid), color_e::OtherConst);
+  L->append(Alloc<field>(StrFromC("spid"), x1));
+
+  return out_node;
+}
+
+void re__LiteralChars::Encode(serialize::Encoder* enc) {
+  if (!enc->Begin(this, re_e::LiteralChars)) {
+    return;
+  }
+  enc->Str(this->s);
+  enc->SpanId(this->spid);
+  enc->End(this);
+}
+
+re__LiteralChars* re__LiteralChars::DecodeFields(serialize::Decoder* dec) {
+  Str* x0 = dec->Str();
+  int x1 = dec->SpanId();
+  re__LiteralChars* obj = Alloc<re__LiteralChars>(x0, x1);
+  return obj;
+}
+
+void re_t::Encode(serialize::Encoder* enc) {
+  switch (this->tag_()) {
+  case re_e::Token:
+    static_cast<Token*>(this)->Encode(enc);
+    break;
+  case re_e::PosixClass:
+    static_cast<posix_class*>(this)->Encode(enc);
+    break;
+  case re_e::PerlClass:
+    static_cast<perl_class*>(this)->Encode(enc);
+    break;
+  case re_e::CharClassLiteral:
+    static_cast<re__CharClassLiteral*>(this)->Encode(enc);
+    break;
+  case re_e::CharClass:
+    static_cast<re__CharClass*>(this)->Encode(enc);
+    break;
+  case re_e::Splice:
+    static_cast<re__Splice*>(this)->Encode(enc);
+    break;
+  case re_e::SimpleVarSub:
+    static_cast<simple_var_sub*>(this)->Encode(enc);
+    break;
+  case re_e::BracedVarSub:
+    static_cast<braced_var_sub*>(this)->Encode(enc);
+    break;
+  case re_e::SingleQuoted:
+    static_cast<single_quoted*>(this)->Encode(enc);
+    break;
+  case re_e::DoubleQuoted:
+    static_cast<double_quoted*>(this)->Encode(enc);
+    break;
+  case re_e::Repeat:
+    static_cast<re__Repeat*>(this)->Encode(enc);
+    break;
+  case re_e::Seq:
+    static_cast<re__Seq*>(this)->Encode(enc);
+    break;
+  case re_e::Alt:
+    static_cast<re__Alt*>(this)->Encode(enc);
+    break;
+  case re_e::Group:
+    static_cast<re__Group*>(this)->Encode(enc);
+    break;
+  case re_e::Capture:
+    static_cast<re__Capture*>(this)->Encode(enc);
+    break;
+  case re_e::Backtracking:
+    static_cast<re__Backtracking*>(this)->Encode(enc);
+    break;
+  case re_e::Primitive:
+    static_cast<re__Primitive*>(this)->Encode(enc);
+    break;
+  case re_e::LiteralChars:
+    static_cast<re__LiteralChars*>(this)->Encode(enc);
+    break;
+  default:
+    assert(0);
+  }
+}
+
+re_t* re_t::Decode(serialize::Decoder* dec) {
+  int tag = dec->Begin();
+  if (tag == 0) {
+    return static_cast<re_t*>(dec->Ref());
+  }
+  re_t* obj = nullptr;
+  switch (tag) {
+  case re_e::Token:
+    obj = Token::DecodeFields(dec);
+    break;
+  case re_e::PosixClass:
+    obj = posix_class::DecodeFields(dec);
+    break;
+  case re_e::PerlClass:
+    obj = perl_class::DecodeFields(dec);
+    break;
+  case re_e::CharClassLiteral:
+    obj = re__CharClassLiteral::DecodeFields(dec);
+    break;
+  case re_e::CharClass:
+    obj = re__CharClass::DecodeFields(dec);
+    break;
+  case re_e::Splice:
+    obj = re__Splice::DecodeFields(dec);
+    break;
+  case re_e::SimpleVarSub:
+    obj = simple_var_sub::DecodeFields(dec);
+    break;
+  case re_e::BracedVarSub:
+    obj = braced_var_sub::DecodeFields(dec);
+    break;
+  case re_e::SingleQuoted:
+    obj = single_quoted::DecodeFields(dec);
+    break;
+  case re_e::DoubleQuoted:
+    obj = double_quoted::DecodeFields(dec);
+    break;
+  case re_e::Repeat:
+    obj = re__Repeat::DecodeFields(dec);
+    break;
+  case re_e::Seq:
+    obj = re__Seq::DecodeFields(dec);
+    break;
+  case re_e::Alt:
+    obj = re__Alt::DecodeFields(dec);
+    break;
+  case re_e::Group:
+    obj = re__Group::DecodeFields(dec);
+    break;
+  case re_e::Capture:
+    obj = re__Capture::DecodeFields(dec);
+    break;
+  case re_e::Backtracking:
+    obj = re__Backtracking::DecodeFields(dec);
+    break;
+  case re_e::Primitive:
+    obj = re__Primitive::DecodeFields(dec);
+    break;
+  case re_e::LiteralChars:
+    obj = re__LiteralChars::DecodeFields(dec);
+    break;
+  default:
+    throw Alloc<ValueError>();
+  }
+  dec->End(obj);
+  return obj;
+}
+
+hnode_t* re_t::PrettyTree() {
+  switch (this->tag_()) {
+  case re_e::Token: {
+    Token* obj = static_cast<Token*>(this);
+    return obj->PrettyTree();
+  }
+  case re_e::PosixClass: {
+    posix_class* obj = static_cast<posix_class*>(this);
+    return obj->PrettyTree();
+  }
+  case re_e::PerlClass: {
+    perl_class* obj = static_cast<perl_class*>(this);
+    return obj->PrettyTree();
+  }
+  case re_e::CharClassLiteral: {
+    re__CharClassLiteral* obj = static_cast<re__CharClassLiteral*>(this);
+    return obj->PrettyTree();
+  }
+  case re_e::CharClass: {
+    re__CharClass* obj = static_cast<re__CharClass*>(this);
+    return obj->PrettyTree();
+  }
+  case re_e::Splice: {
+    re__Splice* obj = static_cast<re__Splice*>(this);
+    return obj->PrettyTree();
+  }
+  case re_e::SimpleVarSub: {
+    simple_var_sub* obj = static_cast<simple_var_sub*>(this);
+    return obj->PrettyTree();
+  }
+  case re_e::BracedVarSub: {
+    braced_var_sub* obj = static_cast<braced_var_sub*>(this);
+    return obj->PrettyTree();
+  }
+  case re_e::SingleQuoted: {
+    single_quoted* obj = static_cast<single_quoted*>(this);
+    return obj->PrettyTree();
+  }
+  case re_e::DoubleQuoted: {
+    double_quoted* obj = static_cast<double_quoted*>(this);
+    return obj->PrettyTree();
+  }
+  case re_e::Repeat: {
+    re__Repeat* obj = static_cast<re__Repeat*>(this);
+    return obj->PrettyTree();
+  }
+  case re_e::Seq: {
+    re__Seq* obj = static_cast<re__Seq*>(this);
+    return obj->PrettyTree();
+  }
+  case re_e::Alt: {
+    re__Alt* obj = static_cast<re__Alt*>(this);
+    return obj->PrettyTree();
+  }
+  case re_e::Group: {
+    re__Group* obj = static_cast<re__Group*>(this);
+    return obj->PrettyTree();
+  }
+  case re_e::Capture: {
+    re__Capture* obj = static_cast<re__Capture*>(this);
+    return obj->PrettyTree();
+  }
+  case re_e::Backtracking: {
+    re__Backtracking* obj = static_cast<re__Backtracking*>(this);
+    return obj->PrettyTree();
+  }
+  case re_e::Primitive: {
+    re__Primitive* obj = static_cast<re__Primitive*>(this);
+    return obj->PrettyTree();
+  }
+  case re_e::LiteralChars: {
+    re__LiteralChars* obj = static_cast<re__LiteralChars*>(this);
+    return obj->PrettyTree();
+  }
+  default:
+    assert(0);
+  }
+}
+
+}  // namespace syntax_asdl
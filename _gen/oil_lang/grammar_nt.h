@@ -0,0 +1,93 @@
+// This code is generated by pgen2/grammar.py
+
+namespace grammar_nt {
+  const int augassign = 256;
+  const int and_expr = 257;
+  const int and_test = 258;
+  const int arglist = 259;
+  const int argument = 260;
+  const int arith_expr = 261;
+  const int array_item = 262;
+  const int atom = 263;
+  const int braced_var_sub = 264;
+  const int char_literal = 265;
+  const int class_item = 266;
+  const int class_items = 267;
+  const int class_literal = 268;
+  const int class_literal_term = 269;
+  const int comma_newline = 270;
+  const int command_expr = 271;
+  const int comp_for = 272;
+  const int comp_op = 273;
+  const int comparison = 274;
+  const int data_params = 275;
+  const int dict = 276;
+  const int dict_pair = 277;
+  const int dq_string = 278;
+  const int end_import = 279;
+  const int end_outer = 280;
+  const int end_stmt = 281;
+  const int expr = 282;
+  const int factor = 283;
+  const int func_item = 284;
+  const int func_items = 285;
+  const int func_param = 286;
+  const int func_params = 287;
+  const int import_name = 288;
+  const int import_names = 289;
+  const int lambdef = 290;
+  const int module_item = 291;
+  const int name_type = 292;
+  const int name_type_list = 293;
+  const int named_func = 294;
+  const int not_test = 295;
+  const int oil_arglist = 296;
+  const int oil_expr = 297;
+  const int oil_expr_sub = 298;
+  const int oil_for = 299;
+  const int oil_place_mutation = 300;
+  const int oil_proc = 301;
+  const int oil_var_decl = 302;
+  const int or_test = 303;
+  const int place_list = 304;
+  const int power = 305;
+  const int proc_param = 306;
+  const int proc_params = 307;
+  const int range_char = 308;
+  const int range_expr = 309;
+  const int re_alt = 310;
+  const int re_atom = 311;
+  const int re_flag = 312;
+  const int re_flags = 313;
+  const int regex = 314;
+  const int repeat_op = 315;
+  const int repeat_range = 316;
+  const int semi_newline = 317;
+  const int sh_array_literal = 318;
+  const int sh_command_sub = 319;
+  const int shift_expr = 320;
+  const int simple_var_sub = 321;
+  const int splat_expr = 322;
+  const int sq_string = 323;
+  const int subscript = 324;
+  const int subscriptlist = 325;
+  const int suite = 326;
+  const int tea_class = 327;
+  const int tea_data = 328;
+  const int tea_enum = 329;
+  const int tea_func = 330;
+  const int tea_import = 331;
+  const int tea_module = 332;
+  const int tea_word = 333;
+  const int term = 334;
+  const int test = 335;
+  const int testlist = 336;
+  const int testlist_comp = 337;
+  const int trailer = 338;
+  const int type_expr = 339;
+  const int type_expr_list = 340;
+  const int variant = 341;
+  const int variant_type = 342;
+  const int xor_expr = 343;
+
+}  // namespace grammar_nt
@@ -0,0 +1,1501 @@
+// This code is generated by pgen2/grammar.py
+
+#include <stdint.h>
+
+namespace grammar_tables {
+
+const int kNumLabels = 198;
+const int kFirstSetBytes = 25;
+
+// ilabel -> token or symbol number
+constexpr int16_t kLabels[] = {
+  0,  // 0
+  39,  // 1
+  42,  // 2
+  37,  // 3
+  35,  // 4
+  36,  // 5
+  38,  // 6
+  41,  // 7
+  40,  // 8
+  44,  // 9
+  43,  // 10
+  320,  // 11
+  30,  // 12
+  197,  // 13
+  198,  // 14
+  208,  // 15
+  105,  // 16
+  4,  // 17
+  5,  // 18
+  7,  // 19
+  204,  // 20
+  112,  // 21
+  205,  // 22
+  152,  // 23
+  114,  // 24
+  33,  // 25
+  161,  // 26
+  169,  // 27
+  168,  // 28
+  120,  // 29
+  119,  // 30
+  143,  // 31
+  123,  // 32
+  122,  // 33
+  118,  // 34
+  141,  // 35
+  121,  // 36
+  142,  // 37
+  191,  // 38
+  195,  // 39
+  188,  // 40
+  190,  // 41
+  194,  // 42
+  189,  // 43
+  192,  // 44
+  193,  // 45
+  232,  // 46
+  231,  // 47
+  234,  // 48
+  228,  // 49
+  236,  // 50
+  230,  // 51
+  233,  // 52
+  237,  // 53
+  235,  // 54
+  295,  // 55
+  144,  // 56
+  146,  // 57
+  260,  // 58
+  3,  // 59
+  103,  // 60
+  135,  // 61
+  31,  // 62
+  335,  // 63
+  34,  // 64
+  272,  // 65
+  334,  // 66
+  9,  // 67
+  264,  // 68
+  278,  // 69
+  319,  // 70
+  321,  // 71
+  323,  // 72
+  106,  // 73
+  318,  // 74
+  337,  // 75
+  314,  // 76
+  113,  // 77
+  330,  // 78
+  115,  // 79
+  97,  // 80
+  276,  // 81
+  313,  // 82
+  140,  // 83
+  212,  // 84
+  163,  // 85
+  156,  // 86
+  155,  // 87
+  1,  // 88
+  154,  // 89
+  293,  // 90
+  266,  // 91
+  317,  // 92
+  269,  // 93
+  124,  // 94
+  125,  // 95
+  308,  // 96
+  336,  // 97
+  281,  // 98
+  147,  // 99
+  149,  // 100
+  303,  // 101
+  150,  // 102
+  131,  // 103
+  137,  // 104
+  139,  // 105
+  20,  // 106
+  19,  // 107
+  130,  // 108
+  22,  // 109
+  21,  // 110
+  148,  // 111
+  132,  // 112
+  138,  // 113
+  309,  // 114
+  273,  // 115
+  286,  // 116
+  277,  // 117
+  270,  // 118
+  18,  // 119
+  209,  // 120
+  45,  // 121
+  343,  // 122
+  305,  // 123
+  283,  // 124
+  158,  // 125
+  1,  // 126
+  159,  // 127
+  160,  // 128
+  1,  // 129
+  157,  // 130
+  304,  // 131
+  333,  // 132
+  256,  // 133
+  326,  // 134
+  284,  // 135
+  339,  // 136
+  282,  // 137
+  153,  // 138
+  288,  // 139
+  1,  // 140
+  1,  // 141
+  1,  // 142
+  1,  // 143
+  327,  // 144
+  328,  // 145
+  329,  // 146
+  331,  // 147
+  280,  // 148
+  292,  // 149
+  274,  // 150
+  259,  // 151
+  307,  // 152
+  258,  // 153
+  145,  // 154
+  263,  // 155
+  11,  // 156
+  338,  // 157
+  133,  // 158
+  306,  // 159
+  265,  // 160
+  311,  // 161
+  315,  // 162
+  136,  // 163
+  32,  // 164
+  117,  // 165
+  268,  // 166
+  312,  // 167
+  310,  // 168
+  6,  // 169
+  17,  // 170
+  316,  // 171
+  219,  // 172
+  46,  // 173
+  261,  // 174
+  29,  // 175
+  28,  // 176
+  210,  // 177
+  324,  // 178
+  285,  // 179
+  267,  // 180
+  275,  // 181
+  341,  // 182
+  287,  // 183
+  340,  // 184
+  279,  // 185
+  289,  // 186
+  291,  // 187
+  8,  // 188
+  129,  // 189
+  290,  // 190
+  151,  // 191
+  322,  // 192
+  127,  // 193
+  126,  // 194
+  325,  // 195
+  342,  // 196
+  257,  // 197
+};
+
+struct Arc {
+  int16_t label;
+  int16_t next_state;
+};
+
+struct State {
+  int16_t first_arc;
+  int16_t num_arcs;
+  bool is_final;     // has the arc (0, self)
+  bool accept_only;  // that's the only arc, so the DFA is done
+};
+
+struct Dfa {
+  int16_t first_state;
+  int16_t num_states;
+  uint8_t first_set[kFirstSetBytes];  // bit set of ilabels
+};
+
+constexpr Arc kArcs[] = {
+  {1, 1},
+  {2, 1},
+  {3, 1},
+  {4, 1},
+  {5, 1},
+  {6, 1},
+  {7, 1},
+  {8, 1},
+  {9, 1},
+  {10, 1},
+  {0, 1},
+  {11, 1},
+  {12, 0},
+  {0, 1},
+  {55, 1},
+  {56, 0},
+  {0, 1},
+  {58, 1},
+  {59, 2},
+  {60, 3},
+  {0, 1},
+  {60, 3},
+  {58, 1},
+  {0, 2},
+  {58, 4},
+  {59, 5},
+  {0, 4},
+  {58, 4},
+  {0, 5},
+  {61, 1},
+  {63, 2},
+  {63, 3},
+  {64, 1},
+  {65, 3},
+  {0, 2},
+  {0, 3},
+  {66, 1},
+  {17, 0},
+  {67, 0},
+  {18, 0},
+  {0, 1},
+  {16, 1},
+  {29, 2},
+  {30, 2},
+  {31, 2},
+  {32, 2},
+  {33, 2},
+  {35, 2},
+  {36, 2},
+  {37, 2},
+  {68, 2},
+  {69, 2},
+  {70, 2},
+  {71, 2},
+  {72, 2},
+  {63, 3},
+  {0, 2},
+  {73, 2},
+  {16, 1},
+  {19, 2},
+  {21, 3},
+  {23, 4},
+  {24, 5},
+  {26, 6},
+  {27, 6},
+  {28, 6},
+  {29, 6},
+  {30, 6},
+  {31, 6},
+  {32, 6},
+  {33, 6},
+  {34, 6},
+  {35, 6},
+  {36, 6},
+  {37, 6},
+  {68, 6},
+  {69, 6},
+  {74, 6},
+  {70, 6},
+  {71, 6},
+  {72, 6},
+  {73, 6},
+  {75, 7},
+  {76, 8},
+  {77, 6},
+  {75, 9},
+  {78, 6},
+  {79, 6},
+  {80, 10},
+  {81, 11},
+  {0, 6},
+  {73, 6},
+  {19, 6},
+  {82, 12},
+  {77, 6},
+  {79, 6},
+  {81, 11},
+  {79, 6},
+  {19, 6},
+  {14, 1},
+  {83, 2},
+  {84, 3},
+  {0, 3},
+  {85, 1},
+  {26, 1},
+  {28, 1},
+  {0, 1},
+  {86, 1},
+  {23, 1},
+  {87, 1},
+  {88, 2},
+  {89, 1},
+  {34, 3},
+  {90, 4},
+  {78, 4},
+  {0, 4},
+  {91, 1},
+  {92, 2},
+  {0, 1},
+  {91, 1},
+  {0, 2},
+  {21, 1},
+  {93, 2},
+  {77, 3},
+  {93, 2},
+  {0, 3},
+  {94, 1},
+  {95, 1},
+  {64, 1},
+  {68, 2},
+  {69, 2},
+  {96, 3},
+  {71, 2},
+  {34, 2},
+  {0, 2},
+  {18, 4},
+  {0, 3},
+  {96, 2},
+  {59, 1},
+  {80, 2},
+  {80, 2},
+  {0, 1},
+  {0, 2},
+  {97, 1},
+  {98, 2},
+  {0, 2},
+  {99, 1},
+  {90, 2},
+  {100, 3},
+  {101, 4},
+  {102, 5},
+  {0, 4},
+  {101, 6},
+  {0, 6},
+  {103, 1},
+  {104, 1},
+  {105, 1},
+  {106, 1},
+  {107, 1},
+  {108, 1},
+  {109, 1},
+  {110, 1},
+  {100, 1},
+  {111, 2},
+  {57, 3},
+  {25, 1},
+  {112, 1},
+  {113, 1},
+  {0, 1},
+  {57, 1},
+  {0, 2},
+  {100, 1},
+  {114, 1},
+  {115, 0},
+  {0, 1},
+  {116, 1},
+  {0, 0},
+  {59, 0},
+  {0, 1},
+  {117, 1},
+  {118, 2},
+  {0, 1},
+  {117, 1},
+  {0, 2},
+  {21, 1},
+  {34, 2},
+  {69, 3},
+  {72, 3},
+  {97, 4},
+  {119, 5},
+  {0, 2},
+  {119, 5},
+  {77, 3},
+  {63, 6},
+  {0, 6},
+  {40, 1},
+  {44, 1},
+  {83, 2},
+  {120, 3},
+  {0, 3},
+  {60, 1},
+  {80, 1},
+  {0, 1},
+  {60, 1},
+  {121, 2},
+  {80, 2},
+  {80, 2},
+  {0, 1},
+  {0, 2},
+  {60, 1},
+  {79, 1},
+  {121, 1},
+  {80, 1},
+  {0, 1},
+  {122, 1},
+  {62, 0},
+  {0, 1},
+  {17, 1},
+  {18, 1},
+  {25, 1},
+  {123, 2},
+  {124, 2},
+  {0, 2},
+  {125, 1},
+  {126, 2},
+  {127, 1},
+  {99, 3},
+  {128, 4},
+  {129, 5},
+  {88, 2},
+  {130, 6},
+  {97, 7},
+  {0, 1},
+  {90, 8},
+  {90, 9},
+  {97, 1},
+  {0, 4},
+  {131, 10},
+  {63, 11},
+  {64, 12},
+  {132, 13},
+  {0, 7},
+  {64, 12},
+  {100, 6},
+  {64, 12},
+  {133, 12},
+  {134, 1},
+  {97, 1},
+  {132, 13},
+  {0, 13},
+  {135, 1},
+  {92, 2},
+  {0, 1},
+  {135, 1},
+  {0, 2},
+  {34, 1},
+  {64, 2},
+  {136, 3},
+  {0, 1},
+  {137, 4},
+  {64, 2},
+  {0, 3},
+  {0, 4},
+  {61, 1},
+  {116, 2},
+  {0, 0},
+  {34, 3},
+  {59, 0},
+  {0, 2},
+  {59, 4},
+  {0, 3},
+  {0, 4},
+  {34, 1},
+  {138, 2},
+  {0, 1},
+  {34, 3},
+  {0, 3},
+  {139, 1},
+  {118, 0},
+  {139, 2},
+  {0, 1},
+  {0, 2},
+  {62, 1},
+  {62, 2},
+  {90, 3},
+  {63, 4},
+  {62, 2},
+  {0, 4},
+  {140, 1},
+  {126, 2},
+  {141, 3},
+  {142, 4},
+  {23, 5},
+  {143, 6},
+  {88, 2},
+  {144, 7},
+  {90, 8},
+  {145, 7},
+  {146, 7},
+  {34, 9},
+  {147, 10},
+  {148, 10},
+  {64, 11},
+  {78, 7},
+  {0, 10},
+  {97, 7},
+  {34, 1},
+  {136, 2},
+  {0, 1},
+  {0, 2},
+  {149, 1},
+  {59, 0},
+  {0, 1},
+  {34, 1},
+  {78, 2},
+  {0, 2},
+  {57, 1},
+  {150, 2},
+  {55, 2},
+  {0, 2},
+  {16, 1},
+  {73, 2},
+  {151, 3},
+  {0, 2},
+  {73, 2},
+  {16, 1},
+  {97, 2},
+  {73, 3},
+  {0, 3},
+  {97, 1},
+  {77, 2},
+  {0, 2},
+  {16, 1},
+  {90, 2},
+  {100, 3},
+  {97, 4},
+  {73, 5},
+  {0, 5},
+  {131, 1},
+  {64, 2},
+  {133, 2},
+  {97, 3},
+  {98, 4},
+  {0, 4},
+  {16, 1},
+  {24, 2},
+  {73, 3},
+  {152, 4},
+  {0, 2},
+  {24, 2},
+  {73, 3},
+  {90, 1},
+  {64, 2},
+  {97, 3},
+  {98, 4},
+  {0, 4},
+  {153, 1},
+  {154, 0},
+  {0, 1},
+  {137, 1},
+  {59, 0},
+  {0, 1},
+  {155, 1},
+  {156, 2},
+  {157, 1},
+  {0, 1},
+  {124, 3},
+  {0, 3},
+  {119, 1},
+  {158, 1},
+  {34, 2},
+  {34, 3},
+  {64, 4},
+  {34, 5},
+  {0, 2},
+  {0, 3},
+  {137, 3},
+  {64, 4},
+  {0, 5},
+  {159, 1},
+  {0, 0},
+  {59, 0},
+  {0, 1},
+  {30, 1},
+  {34, 1},
+  {160, 1},
+  {72, 1},
+  {0, 1},
+  {137, 1},
+  {119, 2},
+  {0, 1},
+  {137, 3},
+  {0, 3},
+  {161, 1},
+  {161, 1},
+  {162, 2},
+  {0, 1},
+  {161, 1},
+  {0, 2},
+  {94, 1},
+  {163, 2},
+  {16, 3},
+  {95, 2},
+  {106, 4},
+  {158, 5},
+  {164, 2},
+  {34, 2},
+  {165, 2},
+  {68, 2},
+  {160, 2},
+  {166, 2},
+  {69, 2},
+  {71, 2},
+  {72, 2},
+  {94, 6},
+  {34, 2},
+  {166, 2},
+  {0, 2},
+  {76, 7},
+  {76, 8},
+  {34, 2},
+  {34, 9},
+  {73, 2},
+  {119, 10},
+  {109, 2},
+  {16, 3},
+  {30, 2},
+  {34, 2},
+  {149, 11},
+  {109, 2},
+  {94, 1},
+  {34, 2},
+  {165, 2},
+  {34, 2},
+  {0, 2},
+  {60, 1},
+  {167, 2},
+  {167, 2},
+  {0, 2},
+  {154, 1},
+  {62, 1},
+  {168, 2},
+  {0, 0},
+  {168, 2},
+  {154, 1},
+  {62, 1},
+  {0, 2},
+  {169, 1},
+  {17, 1},
+  {170, 1},
+  {24, 2},
+  {0, 1},
+  {169, 3},
+  {17, 3},
+  {170, 3},
+  {34, 4},
+  {171, 3},
+  {79, 1},
+  {169, 3},
+  {17, 3},
+  {170, 3},
+  {171, 3},
+  {59, 1},
+  {30, 2},
+  {30, 3},
+  {59, 4},
+  {0, 2},
+  {0, 3},
+  {30, 3},
+  {0, 4},
+  {60, 1},
+  {80, 2},
+  {80, 2},
+  {0, 1},
+  {0, 2},
+  {15, 1},
+  {83, 2},
+  {172, 3},
+  {0, 3},
+  {13, 1},
+  {20, 1},
+  {22, 1},
+  {83, 2},
+  {173, 3},
+  {0, 3},
+  {174, 1},
+  {175, 0},
+  {176, 0},
+  {0, 1},
+  {46, 1},
+  {47, 1},
+  {48, 1},
+  {49, 1},
+  {50, 1},
+  {51, 1},
+  {52, 1},
+  {53, 1},
+  {54, 1},
+  {0, 1},
+  {61, 1},
+  {137, 2},
+  {0, 2},
+  {38, 1},
+  {39, 1},
+  {41, 1},
+  {42, 1},
+  {43, 1},
+  {45, 1},
+  {83, 2},
+  {177, 3},
+  {0, 3},
+  {119, 1},
+  {137, 2},
+  {137, 3},
+  {0, 1},
+  {119, 1},
+  {0, 2},
+  {0, 3},
+  {178, 1},
+  {59, 2},
+  {0, 1},
+  {178, 1},
+  {0, 2},
+  {24, 1},
+  {79, 2},
+  {80, 3},
+  {179, 4},
+  {0, 2},
+  {79, 2},
+  {179, 4},
+  {79, 2},
+  {34, 1},
+  {119, 2},
+  {24, 3},
+  {34, 4},
+  {79, 5},
+  {80, 6},
+  {180, 7},
+  {24, 3},
+  {0, 5},
+  {79, 5},
+  {180, 7},
+  {79, 5},
+  {34, 1},
+  {16, 2},
+  {73, 3},
+  {181, 4},
+  {0, 3},
+  {73, 3},
+  {34, 1},
+  {24, 2},
+  {79, 3},
+  {80, 4},
+  {182, 5},
+  {0, 3},
+  {79, 3},
+  {182, 5},
+  {79, 3},
+  {118, 4},
+  {16, 1},
+  {73, 2},
+  {60, 3},
+  {183, 4},
+  {134, 5},
+  {184, 6},
+  {183, 7},
+  {73, 2},
+  {60, 3},
+  {0, 5},
+  {134, 5},
+  {73, 2},
+  {72, 1},
+  {16, 2},
+  {138, 3},
+  {185, 4},
+  {73, 5},
+  {80, 6},
+  {186, 7},
+  {34, 8},
+  {0, 4},
+  {185, 4},
+  {73, 5},
+  {186, 7},
+  {73, 5},
+  {16, 2},
+  {185, 4},
+  {121, 1},
+  {80, 2},
+  {187, 2},
+  {0, 0},
+  {0, 1},
+  {121, 1},
+  {187, 2},
+  {0, 2},
+  {68, 1},
+  {69, 1},
+  {70, 1},
+  {71, 1},
+  {72, 1},
+  {0, 1},
+  {124, 1},
+  {188, 0},
+  {169, 0},
+  {19, 0},
+  {189, 0},
+  {0, 1},
+  {190, 1},
+  {101, 2},
+  {0, 1},
+  {102, 3},
+  {0, 2},
+  {101, 4},
+  {191, 5},
+  {63, 1},
+  {63, 1},
+  {59, 2},
+  {0, 1},
+  {63, 1},
+  {0, 2},
+  {192, 1},
+  {63, 1},
+  {59, 2},
+  {65, 3},
+  {0, 1},
+  {192, 4},
+  {63, 4},
+  {0, 2},
+  {0, 3},
+  {59, 2},
+  {0, 4},
+  {16, 1},
+  {193, 2},
+  {95, 2},
+  {194, 2},
+  {21, 3},
+  {73, 4},
+  {151, 5},
+  {34, 4},
+  {195, 6},
+  {0, 4},
+  {73, 4},
+  {77, 4},
+  {34, 1},
+  {21, 2},
+  {0, 1},
+  {136, 3},
+  {59, 2},
+  {77, 4},
+  {0, 4},
+  {136, 1},
+  {59, 0},
+  {0, 1},
+  {34, 1},
+  {196, 2},
+  {0, 1},
+  {0, 2},
+  {16, 1},
+  {165, 2},
+  {181, 3},
+  {0, 2},
+  {73, 2},
+  {197, 1},
+  {164, 0},
+  {0, 1},
+};
+
+constexpr State kStates[] = {
+  {0, 10, false, false},
+  {10, 1, true, true},
+  {11, 1, false, false},
+  {12, 2, true, false},
+  {14, 1, false, false},
+  {15, 2, true, false},
+  {17, 1, false, false},
+  {18, 3, true, false},
+  {21, 3, true, false},
+  {24, 1, false, false},
+  {25, 2, true, false},
+  {27, 2, true, false},
+  {29, 2, false, false},
+  {31, 1, false, false},
+  {32, 3, true, false},
+  {35, 1, true, true},
+  {36, 1, false, false},
+  {37, 4, true, false},
+  {41, 14, false, false},
+  {55, 1, false, false},
+  {56, 1, true, true},
+  {57, 1, false, false},
+  {58, 23, false, false},
+  {81, 2, false, false},
+  {83, 1, false, false},
+  {84, 2, false, false},
+  {86, 1, false, false},
+  {87, 3, false, false},
+  {90, 1, true, true},
+  {91, 1, false, false},
+  {92, 2, false, false},
+  {94, 1, false, false},
+  {95, 2, false, false},
+  {97, 1, false, false},
+  {98, 1, false, false},
+  {99, 1, false, false},
+  {100, 1, false, false},
+  {101, 1, false, false},
+  {102, 1, true, true},
+  {103, 3, false, false},
+  {106, 1, true, true},
+  {107, 5, false, false},
+  {112, 1, false, false},
+  {113, 1, false, false},
+  {114, 1, false, false},
+  {115, 1, true, true},
+  {116, 1, false, false},
+  {117, 2, true, false},
+  {119, 2, true, false},
+  {121, 1, false, false},
+  {122, 1, false, false},
+  {123, 2, false, false},
+  {125, 1, true, true},
+  {126, 7, false, false},
+  {133, 1, false, false},
+  {134, 1, true, true},
+  {135, 2, true, false},
+  {137, 1, false, false},
+  {138, 2, false, false},
+  {140, 2, true, false},
+  {142, 1, true, true},
+  {143, 1, false, false},
+  {144, 1, false, false},
+  {145, 1, true, true},
+  {146, 1, false, false},
+  {147, 1, false, false},
+  {148, 1, false, false},
+  {149, 1, false, false},
+  {150, 2, true, false},
+  {152, 1, false, false},
+  {153, 1, true, true},
+  {154, 14, false, false},
+  {168, 1, true, true},
+  {169, 2, true, false},
+  {171, 1, false, false},
+  {172, 1, false, false},
+  {173, 2, true, false},
+  {175, 2, true, false},
+  {177, 2, true, false},
+  {179, 1, false, false},
+  {180, 2, true, false},
+  {182, 2, true, false},
+  {184, 4, false, false},
+  {188, 1, false, false},
+  {189, 2, true, false},
+  {191, 1, false, false},
+  {192, 1, false, false},
+  {193, 1, false, false},
+  {194, 1, true, true},
+  {195, 2, false, false},
+  {197, 1, false, false},
+  {198, 1, false, false},
+  {199, 1, true, true},
+  {200, 2, false, false},
+  {202, 1, true, true},
+  {203, 3, false, false},
+  {206, 2, true, false},
+  {208, 1, true, true},
+  {209, 4, false, false},
+  {213, 1, true, true},
+  {214, 1, false, false},
+  {215, 2, true, false},
+  {217, 4, false, false},
+  {221, 1, false, false},
+  {222, 1, true, true},
+  {223, 9, false, false},
+  {232, 1, true, true},
+  {233, 1, false, false},
+  {234, 1, false, false},
+  {235, 2, true, false},
+  {237, 1, false, false},
+  {238, 1, false, false},
+  {239, 3, true, false},
+  {242, 1, false, false},
+  {243, 1, false, false},
+  {244, 2, false, false},
+  {246, 1, false, false},
+  {247, 1, false, false},
+  {248, 2, true, false},
+  {250, 1, false, false},
+  {251, 2, true, false},
+  {253, 2, true, false},
+  {255, 1, false, false},
+  {256, 3, true, false},
+  {259, 1, false, false},
+  {260, 2, true, false},
+  {262, 1, true, true},
+  {263, 3, true, false},
+  {266, 1, false, false},
+  {267, 2, true, false},
+  {269, 2, true, false},
+  {271, 1, true, true},
+  {272, 1, false, false},
+  {273, 2, true, false},
+  {275, 1, false, false},
+  {276, 1, true, true},
+  {277, 1, false, false},
+  {278, 3, true, false},
+  {281, 1, true, true},
+  {282, 1, false, false},
+  {283, 2, false, false},
+  {285, 1, false, false},
+  {286, 1, false, false},
+  {287, 1, true, true},
+  {288, 7, false, false},
+  {295, 1, false, false},
+  {296, 1, false, false},
+  {297, 1, false, false},
+  {298, 1, false, false},
+  {299, 1, false, false},
+  {300, 1, false, false},
+  {301, 1, false, false},
+  {302, 1, false, false},
+  {303, 1, false, false},
+  {304, 1, true, true},
+  {305, 1, false, false},
+  {306, 1, false, false},
+  {307, 2, true, false},
+  {309, 1, true, true},
+  {310, 1, false, false},
+  {311, 2, true, false},
+  {313, 1, false, false},
+  {314, 1, false, false},
+  {315, 1, true, true},
+  {316, 2, false, false},
+  {318, 1, false, false},
+  {319, 1, true, true},
+  {320, 1, false, false},
+  {321, 2, false, false},
+  {323, 1, true, true},
+  {324, 1, false, false},
+  {325, 1, false, false},
+  {326, 1, false, false},
+  {327, 1, false, false},
+  {328, 1, true, true},
+  {329, 1, false, false},
+  {330, 1, false, false},
+  {331, 1, true, true},
+  {332, 1, false, false},
+  {333, 1, false, false},
+  {334, 1, false, false},
+  {335, 1, false, false},
+  {336, 1, false, false},
+  {337, 1, true, true},
+  {338, 1, false, false},
+  {339, 2, false, false},
+  {341, 1, false, false},
+  {342, 1, false, false},
+  {343, 1, true, true},
+  {344, 2, false, false},
+  {346, 2, false, false},
+  {348, 1, true, true},
+  {349, 1, false, false},
+  {350, 1, false, false},
+  {351, 1, false, false},
+  {352, 1, false, false},
+  {353, 1, false, false},
+  {354, 1, false, false},
+  {355, 1, true, true},
+  {356, 1, false, false},
+  {357, 2, true, false},
+  {359, 1, false, false},
+  {360, 2, true, false},
+  {362, 1, false, false},
+  {363, 3, true, false},
+  {366, 1, false, false},
+  {367, 1, true, true},
+  {368, 3, false, false},
+  {371, 1, false, false},
+  {372, 3, true, false},
+  {375, 1, true, true},
+  {376, 1, false, false},
+  {377, 2, true, false},
+  {379, 2, true, false},
+  {381, 2, true, false},
+  {383, 4, false, false},
+  {387, 1, true, true},
+  {388, 1, false, false},
+  {389, 2, true, false},
+  {391, 1, false, false},
+  {392, 1, true, true},
+  {393, 1, false, false},
+  {394, 3, true, false},
+  {397, 2, true, false},
+  {399, 15, false, false},
+  {414, 3, false, false},
+  {417, 1, true, true},
+  {418, 1, false, false},
+  {419, 1, false, false},
+  {420, 1, false, false},
+  {421, 1, false, false},
+  {422, 1, false, false},
+  {423, 2, false, false},
+  {425, 3, false, false},
+  {428, 1, false, false},
+  {429, 1, false, false},
+  {430, 3, false, false},
+  {433, 1, false, false},
+  {434, 1, true, true},
+  {435, 1, false, false},
+  {436, 1, false, false},
+  {437, 2, true, false},
+  {439, 4, true, false},
+  {443, 1, false, false},
+  {444, 3, true, false},
+  {447, 4, false, false},
+  {451, 1, true, true},
+  {452, 5, false, false},
+  {457, 1, false, false},
+  {458, 4, false, false},
+  {462, 2, false, false},
+  {464, 1, false, false},
+  {465, 2, true, false},
+  {467, 1, true, true},
+  {468, 2, true, false},
+  {470, 2, false, false},
+  {472, 2, true, false},
+  {474, 1, true, true},
+  {475, 1, false, false},
+  {476, 1, false, false},
+  {477, 1, false, false},
+  {478, 1, true, true},
+  {479, 3, false, false},
+  {482, 1, false, false},
+  {483, 1, false, false},
+  {484, 1, true, true},
+  {485, 1, false, false},
+  {486, 3, true, false},
+  {489, 9, false, false},
+  {498, 1, true, true},
+  {499, 1, false, false},
+  {500, 1, false, false},
+  {501, 1, true, true},
+  {502, 6, false, false},
+  {508, 1, false, false},
+  {509, 1, false, false},
+  {510, 1, true, true},
+  {511, 2, false, false},
+  {513, 2, true, false},
+  {515, 2, true, false},
+  {517, 1, true, true},
+  {518, 1, false, false},
+  {519, 2, true, false},
+  {521, 2, true, false},
+  {523, 1, false, false},
+  {524, 3, false, false},
+  {527, 1, true, true},
+  {528, 2, false, false},
+  {530, 1, false, false},
+  {531, 1, false, false},
+  {532, 2, false, false},
+  {534, 1, false, false},
+  {535, 3, false, false},
+  {538, 1, false, false},
+  {539, 1, true, true},
+  {540, 2, false, false},
+  {542, 1, false, false},
+  {543, 1, false, false},
+  {544, 1, false, false},
+  {545, 2, false, false},
+  {547, 1, true, true},
+  {548, 1, false, false},
+  {549, 1, false, false},
+  {550, 1, false, false},
+  {551, 3, false, false},
+  {554, 1, true, true},
+  {555, 2, false, false},
+  {557, 2, false, false},
+  {559, 1, false, false},
+  {560, 3, false, false},
+  {563, 2, false, false},
+  {565, 1, false, false},
+  {566, 2, false, false},
+  {568, 1, true, true},
+  {569, 1, false, false},
+  {570, 1, false, false},
+  {571, 1, false, false},
+  {572, 3, false, false},
+  {575, 3, false, false},
+  {578, 1, false, false},
+  {579, 1, true, true},
+  {580, 1, false, false},
+  {581, 2, false, false},
+  {583, 1, false, false},
+  {584, 2, false, false},
+  {586, 4, true, false},
+  {590, 1, true, true},
+  {591, 3, true, false},
+  {594, 5, false, false},
+  {599, 1, true, true},
+  {600, 1, false, false},
+  {601, 5, true, false},
+  {606, 2, false, false},
+  {608, 1, true, true},
+  {609, 2, true, false},
+  {611, 1, false, false},
+  {612, 1, false, false},
+  {613, 1, false, false},
+  {614, 1, false, false},
+  {615, 2, true, false},
+  {617, 2, true, false},
+  {619, 2, false, false},
+  {621, 3, true, false},
+  {624, 3, true, false},
+  {627, 1, true, true},
+  {628, 2, true, false},
+  {630, 5, false, false},
+  {635, 2, false, false},
+  {637, 1, false, false},
+  {638, 1, false, false},
+  {639, 1, true, true},
+  {640, 1, false, false},
+  {641, 1, false, false},
+  {642, 1, false, false},
+  {643, 2, true, false},
+  {645, 1, false, false},
+  {646, 2, false, false},
+  {648, 1, true, true},
+  {649, 1, false, false},
+  {650, 2, true, false},
+  {652, 1, false, false},
+  {653, 2, true, false},
+  {655, 1, true, true},
+  {656, 2, false, false},
+  {658, 1, false, false},
+  {659, 1, true, true},
+  {660, 1, false, false},
+  {661, 1, false, false},
+  {662, 2, true, false},
+};
+
+// Indexed by symbol number - 256
+constexpr Dfa kDfas[] = {
+  {0, 2, {0xfe, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // augassign
+  {2, 2, {0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // and_expr
+  {4, 2, {0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // and_test
+  {6, 6, {0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // arglist
+  {12, 4, {0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // argument
+  {16, 2, {0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // arith_expr
+  {18, 4, {0x00, 0x60, 0x51, 0xe0, 0xfb, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // array_item
+  {22, 13, {0x00, 0xe0, 0xf9, 0xfd, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // atom
+  {35, 4, {0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // braced_var_sub
+  {39, 2, {0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // char_literal
+  {41, 5, {0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // class_item
+  {46, 3, {0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // class_items
+  {49, 4, {0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // class_literal
+  {53, 5, {0x00, 0x40, 0x00, 0x54, 0xc4, 0xff, 0x7f, 0x00, 0x01, 0x00, 0x20, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // class_literal_term
+  {58, 3, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // comma_newline
+  {61, 3, {0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // command_expr
+  {64, 7, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // comp_for
+  {71, 4, {0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x90, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // comp_op
+  {75, 2, {0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // comparison
+  {77, 2, {0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // data_params
+  {79, 3, {0x00, 0x00, 0x20, 0x00, 0xc4, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // dict
+  {82, 7, {0x00, 0x00, 0x20, 0x00, 0xc4, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // dict_pair
+  {89, 4, {0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // dq_string
+  {93, 2, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // end_import
+  {95, 3, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // end_outer
+  {98, 2, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // end_stmt
+  {100, 2, {0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // expr
+  {102, 3, {0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // factor
+  {105, 14, {0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x42, 0x00, 0x00, 0x00, 0x01, 0x08, 0x00, 0x00, 0xe0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // func_item
+  {119, 3, {0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x42, 0x00, 0x00, 0x00, 0x01, 0x08, 0x00, 0x00, 0xe0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // func_items
+  {122, 5, {0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // func_param
+  {127, 5, {0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // func_params
+  {132, 4, {0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // import_name
+  {136, 3, {0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // import_names
+  {139, 5, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // lambdef
+  {144, 12, {0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // module_item
+  {156, 3, {0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // name_type
+  {159, 2, {0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // name_type_list
+  {161, 3, {0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // named_func
+  {164, 3, {0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // not_test
+  {167, 4, {0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // oil_arglist
+  {171, 4, {0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // oil_expr
+  {175, 3, {0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // oil_expr_sub
+  {178, 6, {0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // oil_for
+  {184, 5, {0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // oil_place_mutation
+  {189, 5, {0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // oil_proc
+  {194, 5, {0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // oil_var_decl
+  {199, 2, {0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // or_test
+  {201, 2, {0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // place_list
+  {203, 4, {0x00, 0xe0, 0xf9, 0xfd, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // power
+  {207, 6, {0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00}},  // proc_param
+  {213, 2, {0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00}},  // proc_params
+  {215, 2, {0x00, 0x00, 0x00, 0x54, 0xc4, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // range_char
+  {217, 4, {0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // range_expr
+  {221, 3, {0x00, 0x40, 0x21, 0x14, 0xc4, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x20, 0xc0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x38, 0x00, 0x00, 0x00, 0x00}},  // re_alt
+  {224, 12, {0x00, 0x40, 0x21, 0x14, 0xc4, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x20, 0xc0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x38, 0x00, 0x00, 0x00, 0x00}},  // re_atom
+  {236, 3, {0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00}},  // re_flag
+  {239, 3, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // re_flags
+  {242, 3, {0x00, 0x40, 0x21, 0x14, 0xc4, 0xff, 0x7f, 0x40, 0x00, 0x00, 0x20, 0xc0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x38, 0x00, 0x00, 0x00, 0x00}},  // regex
+  {245, 5, {0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00}},  // repeat_op
+  {250, 5, {0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // repeat_range
+  {255, 3, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // semi_newline
+  {258, 4, {0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // sh_array_literal
+  {262, 4, {0x00, 0x20, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // sh_command_sub
+  {266, 2, {0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // shift_expr
+  {268, 2, {0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // simple_var_sub
+  {270, 3, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // splat_expr
+  {273, 4, {0x00, 0x00, 0x00, 0x00, 0xc0, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // sq_string
+  {277, 4, {0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // subscript
+  {281, 3, {0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // subscriptlist
+  {284, 5, {0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // suite
+  {289, 8, {0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // tea_class
+  {297, 5, {0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // tea_data
+  {302, 6, {0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // tea_enum
+  {308, 8, {0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // tea_func
+  {316, 9, {0x00, 0x00, 0x00, 0x00, 0xc0, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // tea_import
+  {325, 3, {0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x42, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // tea_module
+  {328, 2, {0x00, 0x60, 0x50, 0x00, 0xc0, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // tea_word
+  {330, 2, {0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // term
+  {332, 6, {0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // test
+  {338, 3, {0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // testlist
+  {341, 5, {0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // testlist_comp
+  {346, 7, {0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06}},  // trailer
+  {353, 5, {0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // type_expr
+  {358, 2, {0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // type_expr_list
+  {360, 3, {0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // variant
+  {363, 4, {0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00}},  // variant_type
+  {367, 2, {0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},  // xor_expr
+};
+
+constexpr const char* kSymbolNames[] = {
+  "augassign",
+  "and_expr",
+  "and_test",
+  "arglist",
+  "argument",
+  "arith_expr",
+  "array_item",
+  "atom",
+  "braced_var_sub",
+  "char_literal",
+  "class_item",
+  "class_items",
+  "class_literal",
+  "class_literal_term",
+  "comma_newline",
+  "command_expr",
+  "comp_for",
+  "comp_op",
+  "comparison",
+  "data_params",
+  "dict",
+  "dict_pair",
+  "dq_string",
+  "end_import",
+  "end_outer",
+  "end_stmt",
+  "expr",
+  "factor",
+  "func_item",
+  "func_items",
+  "func_param",
+  "func_params",
+  "import_name",
+  "import_names",
+  "lambdef",
+  "module_item",
+  "name_type",
+  "name_type_list",
+  "named_func",
+  "not_test",
+  "oil_arglist",
+  "oil_expr",
+  "oil_expr_sub",
+  "oil_for",
+  "oil_place_mutation",
+  "oil_proc",
+  "oil_var_decl",
+  "or_test",
+  "place_list",
+  "power",
+  "proc_param",
+  "proc_params",
+  "range_char",
+  "range_expr",
+  "re_alt",
+  "re_atom",
+  "re_flag",
+  "re_flags",
+  "regex",
+  "repeat_op",
+  "repeat_range",
+  "semi_newline",
+  "sh_array_literal",
+  "sh_command_sub",
+  "shift_expr",
+  "simple_var_sub",
+  "splat_expr",
+  "sq_string",
+  "subscript",
+  "subscriptlist",
+  "suite",
+  "tea_class",
+  "tea_data",
+  "tea_enum",
+  "tea_func",
+  "tea_import",
+  "tea_module",
+  "tea_word",
+  "term",
+  "test",
+  "testlist",
+  "testlist_comp",
+  "trailer",
+  "type_expr",
+  "type_expr_list",
+  "variant",
+  "variant_type",
+  "xor_expr",
+};
+
+// Token ID -> ilabel, or -1
+const int kNumTokenLabels = 238;
+constexpr int16_t kTokenLabels[kNumTokenLabels] = {
+  -1, -1, -1, 59, 17, 18, 169, 19, 188, 67, -1, 156, -1, -1, -1, -1,
+  -1, 170, 119, 107, 106, 110, 109, -1, -1, -1, -1, -1, 176, 175, 12, 62,
+  164, 25, 64, 4, 5, 3, 6, 1, 8, 7, 2, 10, 9, 121, 173, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, 80, -1, -1, -1, -1, -1, 60, -1, 16, 73, -1, -1, -1, -1, -1,
+  21, 77, 24, 79, -1, 165, 34, 30, 29, 36, 33, 32, 94, 95, 194, 193,
+  -1, 189, 108, 103, 112, 158, -1, 61, 163, 104, 113, 105, 83, 35, 37, 31,
+  56, 154, 57, 99, 111, 100, 102, 191, 23, 138, 89, 87, 86, 130, 125, 127,
+  128, 26, -1, 85, -1, -1, -1, -1, 28, 27, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 40, 43, 41, 38,
+  44, 45, 42, 39, -1, 13, 14, -1, -1, -1, -1, -1, 20, 22, -1, -1,
+  15, 120, 177, -1, 84, -1, -1, -1, -1, -1, -1, 172, -1, -1, -1, -1,
+  -1, -1, -1, -1, 49, -1, 51, 47, 46, 52, 48, 54, 50, 53,
+};
+
+struct Keyword {
+  const char* name;
+  int len;
+  int16_t label;
+};
+
+constexpr Keyword kKeywords[] = {
+  {"class", 5, 140},
+  {"const", 5, 126},
+  {"data", 4, 141},
+  {"enum", 4, 142},
+  {"import", 6, 143},
+  {"set", 3, 129},
+  {"var", 3, 88},
+};
+
+const int kNumKeywords = 7;
+
+const int kNumDfas = 88;
+const int kMaxStatesPerDfa = 14;
+
+static_assert(kNumDfas <= 256, "parse::Parser::dfas_ is uint8_t");
+static_assert(kMaxStatesPerDfa <= 256, "parse::Parser::states_ is uint8_t");
+static_assert(kNumLabels <= INT16_MAX, "Arc::label is int16_t");
+static_assert(sizeof(kArcs) / sizeof(kArcs[0]) <= INT16_MAX,
+              "State::first_arc is int16_t");
+static_assert(sizeof(kStates) / sizeof(kStates[0]) <= INT16_MAX,
+              "Dfa::first_state is int16_t");
+
+}  // namespace grammar_tables
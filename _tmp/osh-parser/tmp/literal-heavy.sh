@@ -0,0 +1,1200 @@
+# 1: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "1 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 2: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "2 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 3: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "3 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 4: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "4 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 5: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "5 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 6: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "6 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 7: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "7 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 8: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "8 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 9: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "9 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 10: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "10 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 11: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "11 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 12: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "12 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 13: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "13 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 14: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "14 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 15: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "15 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 16: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "16 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 17: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "17 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 18: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "18 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 19: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "19 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 20: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "20 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 21: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "21 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 22: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "22 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 23: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "23 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 24: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "24 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 25: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "25 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 26: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "26 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 27: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "27 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 28: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "28 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 29: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "29 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 30: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "30 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 31: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "31 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 32: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "32 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 33: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "33 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 34: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "34 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 35: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "35 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 36: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "36 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 37: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "37 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 38: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "38 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 39: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "39 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 40: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "40 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 41: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "41 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 42: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "42 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 43: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "43 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 44: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "44 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 45: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "45 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 46: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "46 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 47: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "47 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 48: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "48 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 49: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "49 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 50: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "50 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 51: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "51 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 52: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "52 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 53: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "53 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 54: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "54 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 55: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "55 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 56: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "56 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 57: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "57 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 58: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "58 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 59: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "59 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 60: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "60 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 61: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "61 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 62: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "62 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 63: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "63 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 64: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "64 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 65: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "65 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 66: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "66 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 67: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "67 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 68: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "68 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 69: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "69 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 70: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "70 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 71: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "71 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 72: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "72 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 73: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "73 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 74: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "74 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 75: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "75 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 76: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "76 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 77: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "77 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 78: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "78 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 79: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "79 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 80: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "80 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 81: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "81 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 82: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "82 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 83: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "83 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 84: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "84 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 85: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "85 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 86: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "86 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 87: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "87 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 88: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "88 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 89: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "89 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 90: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "90 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 91: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "91 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 92: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "92 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 93: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "93 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 94: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "94 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 95: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "95 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 96: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "96 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 97: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "97 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 98: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "98 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 99: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "99 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 100: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "100 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 101: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "101 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 102: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "102 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 103: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "103 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 104: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "104 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 105: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "105 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 106: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "106 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 107: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "107 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 108: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "108 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 109: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "109 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 110: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "110 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 111: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "111 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 112: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "112 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 113: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "113 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 114: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "114 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 115: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "115 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 116: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "116 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 117: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "117 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 118: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "118 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 119: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "119 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 120: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "120 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 121: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "121 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 122: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "122 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 123: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "123 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 124: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "124 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 125: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "125 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 126: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "126 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 127: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "127 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 128: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "128 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 129: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "129 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 130: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "130 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 131: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "131 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 132: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "132 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 133: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "133 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 134: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "134 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 135: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "135 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 136: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "136 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 137: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "137 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 138: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "138 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 139: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "139 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 140: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "140 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 141: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "141 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 142: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "142 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 143: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "143 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 144: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "144 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 145: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "145 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 146: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "146 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 147: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "147 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 148: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "148 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 149: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "149 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 150: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "150 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 151: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "151 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 152: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "152 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 153: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "153 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 154: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "154 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 155: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "155 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 156: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "156 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 157: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "157 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 158: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "158 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 159: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "159 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 160: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "160 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 161: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "161 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 162: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "162 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 163: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "163 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 164: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "164 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 165: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "165 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 166: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "166 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 167: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "167 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 168: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "168 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 169: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "169 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 170: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "170 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 171: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "171 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 172: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "172 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 173: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "173 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 174: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "174 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 175: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "175 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 176: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "176 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 177: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "177 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 178: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "178 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 179: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "179 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 180: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "180 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 181: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "181 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 182: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "182 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 183: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "183 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 184: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "184 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 185: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "185 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 186: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "186 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 187: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "187 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 188: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "188 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 189: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "189 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 190: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "190 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 191: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "191 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 192: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "192 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 193: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "193 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 194: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "194 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 195: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "195 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 196: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "196 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 197: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "197 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 198: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "198 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 199: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "199 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
+# 200: The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.
+echo 'The quick brown fox jumps over the lazy dog, again and again. The quick brown fox jumps over the lazy dog, again and again.'
+echo "200 The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again."
+cat <<END
+The quick brown fox jumps over the lazy dog, again and again. $HOME The quick brown fox jumps over the lazy dog, again and again.
+END
@@ -0,0 +1,14000 @@
+_func_1() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_2() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 2; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_3() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 3; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_4() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 4; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_5() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 5; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_6() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 6; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_7() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 7; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_8() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 8; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_9() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 9; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_10() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 10; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_11() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 11; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_12() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 12; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_13() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 13; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_14() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 14; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_15() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 15; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_16() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 16; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_17() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 17; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_18() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 18; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_19() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 19; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_20() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 20; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_21() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 21; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_22() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 22; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_23() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 23; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_24() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 24; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_25() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 25; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_26() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 26; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_27() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 27; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_28() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 28; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_29() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 29; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_30() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 30; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_31() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 31; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_32() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 32; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_33() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 33; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_34() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 34; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_35() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 35; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_36() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 36; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_37() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 37; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_38() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 38; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_39() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 39; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_40() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 40; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_41() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 41; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_42() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 42; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_43() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 43; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_44() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 44; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_45() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 45; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_46() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 46; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_47() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 47; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_48() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 48; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_49() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 49; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_50() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 50; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_51() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 51; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_52() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 52; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_53() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 53; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_54() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 54; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_55() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 55; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_56() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 56; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_57() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 57; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_58() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 58; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_59() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 59; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_60() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 60; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_61() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 61; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_62() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 62; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_63() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 63; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_64() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 64; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_65() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 65; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_66() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 66; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_67() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 67; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_68() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 68; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_69() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 69; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_70() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 70; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_71() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 71; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_72() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 72; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_73() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 73; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_74() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 74; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_75() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 75; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_76() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 76; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_77() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 77; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_78() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 78; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_79() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 79; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_80() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 80; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_81() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 81; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_82() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 82; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_83() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 83; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_84() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 84; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_85() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 85; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_86() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 86; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_87() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 87; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_88() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 88; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_89() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 89; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_90() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 90; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_91() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 91; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_92() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 92; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_93() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 93; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_94() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 94; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_95() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 95; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_96() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 96; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_97() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 97; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_98() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 98; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_99() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 99; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_100() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 100; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_101() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 101; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_102() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 102; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_103() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 103; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_104() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 104; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_105() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 105; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_106() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 106; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_107() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 107; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_108() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 108; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_109() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 109; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_110() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 110; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_111() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 111; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_112() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 112; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_113() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 113; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_114() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 114; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_115() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 115; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_116() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 116; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_117() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 117; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_118() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 118; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_119() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 119; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_120() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 120; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_121() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 121; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_122() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 122; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_123() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 123; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_124() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 124; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_125() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 125; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_126() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 126; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_127() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 127; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_128() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 128; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_129() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 129; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_130() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 130; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_131() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 131; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_132() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 132; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_133() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 133; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_134() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 134; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_135() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 135; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_136() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 136; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_137() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 137; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_138() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 138; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_139() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 139; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_140() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 140; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_141() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 141; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_142() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 142; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_143() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 143; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_144() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 144; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_145() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 145; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_146() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 146; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_147() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 147; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_148() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 148; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_149() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 149; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_150() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 150; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_151() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 151; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_152() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 152; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_153() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 153; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_154() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 154; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_155() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 155; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_156() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 156; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_157() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 157; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_158() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 158; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_159() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 159; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_160() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 160; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_161() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 161; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_162() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 162; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_163() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 163; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_164() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 164; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_165() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 165; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_166() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 166; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_167() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 167; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_168() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 168; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_169() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 169; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_170() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 170; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_171() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 171; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_172() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 172; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_173() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 173; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_174() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 174; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_175() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 175; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_176() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 176; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_177() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 177; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_178() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 178; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_179() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 179; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_180() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 180; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_181() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 181; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_182() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 182; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_183() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 183; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_184() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 184; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_185() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 185; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_186() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 186; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_187() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 187; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_188() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 188; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_189() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 189; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_190() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 190; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_191() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 191; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_192() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 192; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_193() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 193; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_194() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 194; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_195() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 195; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_196() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 196; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_197() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 197; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_198() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 198; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_199() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 199; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_200() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 200; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_201() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 201; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_202() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 202; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_203() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 203; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_204() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 204; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_205() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 205; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_206() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 206; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_207() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 207; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_208() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 208; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_209() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 209; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_210() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 210; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_211() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 211; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_212() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 212; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_213() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 213; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_214() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 214; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_215() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 215; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_216() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 216; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_217() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 217; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_218() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 218; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_219() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 219; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_220() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 220; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_221() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 221; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_222() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 222; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_223() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 223; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_224() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 224; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_225() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 225; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_226() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 226; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_227() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 227; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_228() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 228; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_229() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 229; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_230() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 230; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_231() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 231; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_232() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 232; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_233() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 233; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_234() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 234; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_235() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 235; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_236() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 236; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_237() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 237; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_238() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 238; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_239() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 239; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_240() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 240; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_241() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 241; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_242() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 242; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_243() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 243; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_244() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 244; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_245() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 245; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_246() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 246; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_247() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 247; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_248() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 248; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_249() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 249; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_250() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 250; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_251() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 251; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_252() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 252; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_253() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 253; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_254() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 254; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_255() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 255; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_256() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 256; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_257() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 257; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_258() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 258; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_259() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 259; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_260() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 260; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_261() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 261; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_262() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 262; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_263() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 263; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_264() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 264; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_265() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 265; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_266() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 266; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_267() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 267; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_268() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 268; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_269() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 269; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_270() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 270; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_271() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 271; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_272() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 272; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_273() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 273; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_274() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 274; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_275() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 275; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_276() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 276; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_277() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 277; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_278() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 278; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_279() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 279; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_280() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 280; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_281() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 281; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_282() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 282; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_283() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 283; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_284() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 284; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_285() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 285; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_286() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 286; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_287() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 287; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_288() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 288; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_289() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 289; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_290() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 290; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_291() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 291; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_292() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 292; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_293() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 293; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_294() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 294; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_295() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 295; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_296() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 296; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_297() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 297; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_298() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 298; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_299() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 299; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_300() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 300; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_301() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 301; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_302() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 302; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_303() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 303; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_304() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 304; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_305() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 305; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_306() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 306; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_307() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 307; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_308() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 308; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_309() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 309; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_310() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 310; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_311() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 311; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_312() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 312; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_313() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 313; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_314() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 314; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_315() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 315; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_316() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 316; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_317() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 317; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_318() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 318; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_319() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 319; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_320() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 320; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_321() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 321; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_322() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 322; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_323() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 323; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_324() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 324; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_325() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 325; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_326() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 326; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_327() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 327; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_328() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 328; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_329() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 329; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_330() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 330; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_331() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 331; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_332() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 332; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_333() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 333; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_334() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 334; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_335() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 335; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_336() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 336; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_337() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 337; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_338() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 338; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_339() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 339; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_340() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 340; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_341() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 341; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_342() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 342; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_343() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 343; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_344() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 344; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_345() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 345; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_346() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 346; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_347() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 347; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_348() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 348; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_349() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 349; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_350() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 350; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_351() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 351; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_352() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 352; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_353() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 353; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_354() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 354; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_355() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 355; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_356() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 356; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_357() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 357; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_358() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 358; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_359() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 359; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_360() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 360; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_361() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 361; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_362() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 362; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_363() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 363; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_364() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 364; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_365() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 365; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_366() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 366; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_367() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 367; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_368() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 368; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_369() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 369; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_370() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 370; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_371() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 371; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_372() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 372; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_373() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 373; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_374() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 374; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_375() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 375; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_376() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 376; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_377() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 377; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_378() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 378; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_379() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 379; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_380() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 380; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_381() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 381; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_382() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 382; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_383() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 383; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_384() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 384; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_385() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 385; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_386() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 386; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_387() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 387; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_388() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 388; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_389() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 389; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_390() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 390; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_391() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 391; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_392() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 392; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_393() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 393; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_394() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 394; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_395() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 395; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_396() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 396; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_397() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 397; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_398() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 398; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_399() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 399; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_400() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 400; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_401() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 401; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_402() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 402; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_403() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 403; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_404() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 404; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_405() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 405; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_406() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 406; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_407() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 407; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_408() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 408; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_409() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 409; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_410() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 410; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_411() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 411; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_412() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 412; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_413() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 413; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_414() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 414; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_415() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 415; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_416() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 416; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_417() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 417; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_418() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 418; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_419() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 419; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_420() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 420; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_421() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 421; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_422() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 422; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_423() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 423; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_424() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 424; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_425() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 425; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_426() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 426; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_427() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 427; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_428() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 428; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_429() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 429; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_430() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 430; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_431() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 431; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_432() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 432; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_433() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 433; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_434() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 434; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_435() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 435; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_436() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 436; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_437() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 437; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_438() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 438; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_439() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 439; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_440() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 440; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_441() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 441; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_442() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 442; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_443() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 443; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_444() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 444; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_445() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 445; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_446() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 446; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_447() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 447; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_448() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 448; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_449() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 449; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_450() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 450; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_451() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 451; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_452() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 452; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_453() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 453; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_454() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 454; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_455() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 455; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_456() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 456; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_457() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 457; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_458() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 458; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_459() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 459; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_460() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 460; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_461() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 461; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_462() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 462; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_463() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 463; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_464() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 464; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_465() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 465; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_466() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 466; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_467() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 467; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_468() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 468; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_469() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 469; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_470() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 470; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_471() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 471; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_472() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 472; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_473() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 473; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_474() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 474; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_475() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 475; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_476() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 476; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_477() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 477; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_478() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 478; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_479() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 479; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_480() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 480; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_481() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 481; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_482() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 482; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_483() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 483; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_484() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 484; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_485() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 485; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_486() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 486; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_487() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 487; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_488() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 488; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_489() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 489; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_490() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 490; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_491() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 491; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_492() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 492; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_493() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 493; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_494() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 494; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_495() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 495; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_496() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 496; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_497() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 497; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_498() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 498; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_499() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 499; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_500() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 500; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_501() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 501; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_502() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 502; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_503() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 503; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_504() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 504; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_505() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 505; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_506() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 506; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_507() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 507; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_508() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 508; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_509() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 509; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_510() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 510; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_511() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 511; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_512() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 512; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_513() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 513; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_514() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 514; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_515() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 515; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_516() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 516; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_517() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 517; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_518() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 518; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_519() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 519; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_520() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 520; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_521() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 521; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_522() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 522; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_523() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 523; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_524() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 524; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_525() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 525; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_526() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 526; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_527() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 527; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_528() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 528; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_529() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 529; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_530() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 530; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_531() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 531; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_532() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 532; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_533() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 533; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_534() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 534; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_535() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 535; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_536() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 536; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_537() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 537; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_538() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 538; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_539() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 539; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_540() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 540; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_541() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 541; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_542() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 542; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_543() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 543; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_544() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 544; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_545() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 545; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_546() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 546; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_547() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 547; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_548() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 548; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_549() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 549; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_550() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 550; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_551() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 551; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_552() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 552; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_553() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 553; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_554() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 554; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_555() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 555; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_556() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 556; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_557() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 557; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_558() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 558; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_559() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 559; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_560() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 560; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_561() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 561; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_562() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 562; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_563() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 563; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_564() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 564; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_565() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 565; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_566() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 566; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_567() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 567; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_568() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 568; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_569() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 569; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_570() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 570; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_571() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 571; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_572() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 572; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_573() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 573; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_574() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 574; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_575() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 575; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_576() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 576; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_577() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 577; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_578() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 578; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_579() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 579; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_580() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 580; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_581() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 581; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_582() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 582; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_583() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 583; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_584() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 584; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_585() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 585; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_586() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 586; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_587() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 587; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_588() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 588; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_589() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 589; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_590() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 590; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_591() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 591; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_592() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 592; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_593() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 593; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_594() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 594; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_595() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 595; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_596() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 596; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_597() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 597; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_598() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 598; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_599() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 599; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_600() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 600; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_601() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 601; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_602() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 602; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_603() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 603; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_604() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 604; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_605() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 605; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_606() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 606; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_607() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 607; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_608() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 608; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_609() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 609; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_610() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 610; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_611() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 611; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_612() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 612; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_613() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 613; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_614() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 614; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_615() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 615; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_616() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 616; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_617() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 617; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_618() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 618; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_619() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 619; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_620() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 620; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_621() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 621; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_622() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 622; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_623() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 623; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_624() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 624; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_625() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 625; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_626() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 626; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_627() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 627; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_628() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 628; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_629() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 629; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_630() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 630; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_631() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 631; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_632() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 632; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_633() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 633; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_634() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 634; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_635() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 635; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_636() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 636; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_637() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 637; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_638() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 638; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_639() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 639; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_640() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 640; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_641() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 641; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_642() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 642; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_643() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 643; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_644() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 644; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_645() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 645; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_646() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 646; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_647() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 647; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_648() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 648; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_649() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 649; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_650() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 650; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_651() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 651; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_652() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 652; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_653() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 653; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_654() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 654; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_655() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 655; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_656() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 656; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_657() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 657; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_658() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 658; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_659() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 659; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_660() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 660; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_661() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 661; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_662() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 662; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_663() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 663; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_664() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 664; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_665() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 665; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_666() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 666; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_667() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 667; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_668() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 668; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_669() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 669; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_670() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 670; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_671() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 671; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_672() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 672; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_673() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 673; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_674() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 674; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_675() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 675; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_676() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 676; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_677() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 677; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_678() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 678; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_679() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 679; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_680() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 680; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_681() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 681; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_682() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 682; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_683() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 683; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_684() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 684; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_685() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 685; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_686() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 686; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_687() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 687; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_688() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 688; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_689() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 689; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_690() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 690; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_691() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 691; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_692() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 692; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_693() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 693; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_694() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 694; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_695() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 695; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_696() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 696; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_697() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 697; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_698() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 698; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_699() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 699; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_700() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 700; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_701() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 701; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_702() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 702; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_703() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 703; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_704() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 704; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_705() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 705; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_706() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 706; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_707() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 707; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_708() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 708; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_709() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 709; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_710() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 710; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_711() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 711; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_712() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 712; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_713() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 713; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_714() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 714; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_715() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 715; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_716() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 716; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_717() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 717; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_718() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 718; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_719() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 719; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_720() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 720; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_721() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 721; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_722() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 722; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_723() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 723; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_724() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 724; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_725() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 725; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_726() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 726; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_727() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 727; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_728() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 728; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_729() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 729; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_730() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 730; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_731() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 731; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_732() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 732; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_733() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 733; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_734() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 734; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_735() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 735; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_736() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 736; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_737() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 737; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_738() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 738; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_739() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 739; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_740() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 740; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_741() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 741; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_742() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 742; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_743() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 743; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_744() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 744; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_745() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 745; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_746() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 746; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_747() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 747; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_748() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 748; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_749() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 749; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_750() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 750; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_751() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 751; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_752() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 752; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_753() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 753; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_754() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 754; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_755() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 755; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_756() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 756; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_757() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 757; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_758() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 758; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_759() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 759; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_760() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 760; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_761() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 761; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_762() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 762; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_763() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 763; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_764() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 764; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_765() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 765; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_766() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 766; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_767() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 767; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_768() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 768; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_769() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 769; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_770() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 770; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_771() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 771; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_772() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 772; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_773() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 773; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_774() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 774; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_775() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 775; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_776() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 776; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_777() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 777; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_778() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 778; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_779() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 779; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_780() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 780; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_781() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 781; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_782() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 782; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_783() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 783; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_784() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 784; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_785() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 785; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_786() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 786; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_787() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 787; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_788() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 788; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_789() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 789; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_790() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 790; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_791() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 791; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_792() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 792; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_793() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 793; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_794() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 794; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_795() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 795; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_796() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 796; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_797() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 797; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_798() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 798; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_799() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 799; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_800() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 800; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_801() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 801; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_802() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 802; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_803() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 803; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_804() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 804; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_805() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 805; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_806() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 806; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_807() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 807; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_808() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 808; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_809() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 809; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_810() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 810; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_811() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 811; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_812() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 812; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_813() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 813; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_814() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 814; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_815() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 815; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_816() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 816; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_817() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 817; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_818() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 818; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_819() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 819; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_820() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 820; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_821() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 821; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_822() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 822; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_823() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 823; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_824() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 824; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_825() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 825; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_826() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 826; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_827() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 827; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_828() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 828; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_829() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 829; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_830() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 830; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_831() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 831; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_832() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 832; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_833() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 833; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_834() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 834; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_835() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 835; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_836() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 836; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_837() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 837; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_838() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 838; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_839() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 839; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_840() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 840; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_841() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 841; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_842() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 842; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_843() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 843; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_844() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 844; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_845() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 845; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_846() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 846; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_847() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 847; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_848() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 848; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_849() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 849; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_850() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 850; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_851() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 851; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_852() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 852; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_853() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 853; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_854() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 854; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_855() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 855; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_856() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 856; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_857() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 857; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_858() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 858; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_859() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 859; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_860() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 860; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_861() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 861; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_862() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 862; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_863() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 863; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_864() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 864; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_865() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 865; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_866() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 866; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_867() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 867; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_868() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 868; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_869() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 869; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_870() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 870; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_871() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 871; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_872() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 872; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_873() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 873; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_874() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 874; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_875() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 875; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_876() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 876; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_877() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 877; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_878() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 878; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_879() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 879; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_880() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 880; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_881() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 881; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_882() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 882; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_883() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 883; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_884() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 884; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_885() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 885; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_886() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 886; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_887() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 887; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_888() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 888; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_889() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 889; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_890() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 890; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_891() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 891; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_892() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 892; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_893() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 893; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_894() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 894; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_895() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 895; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_896() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 896; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_897() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 897; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_898() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 898; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_899() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 899; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_900() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 900; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_901() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 901; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_902() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 902; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_903() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 903; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_904() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 904; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_905() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 905; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_906() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 906; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_907() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 907; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_908() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 908; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_909() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 909; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_910() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 910; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_911() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 911; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_912() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 912; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_913() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 913; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_914() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 914; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_915() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 915; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_916() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 916; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_917() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 917; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_918() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 918; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_919() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 919; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_920() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 920; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_921() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 921; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_922() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 922; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_923() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 923; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_924() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 924; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_925() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 925; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_926() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 926; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_927() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 927; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_928() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 928; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_929() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 929; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_930() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 930; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_931() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 931; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_932() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 932; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_933() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 933; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_934() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 934; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_935() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 935; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_936() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 936; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_937() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 937; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_938() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 938; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_939() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 939; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_940() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 940; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_941() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 941; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_942() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 942; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_943() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 943; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_944() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 944; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_945() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 945; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_946() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 946; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_947() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 947; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_948() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 948; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_949() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 949; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_950() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 950; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_951() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 951; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_952() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 952; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_953() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 953; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_954() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 954; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_955() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 955; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_956() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 956; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_957() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 957; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_958() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 958; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_959() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 959; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_960() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 960; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_961() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 961; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_962() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 962; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_963() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 963; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_964() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 964; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_965() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 965; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_966() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 966; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_967() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 967; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_968() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 968; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_969() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 969; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_970() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 970; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_971() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 971; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_972() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 972; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_973() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 973; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_974() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 974; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_975() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 975; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_976() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 976; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_977() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 977; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_978() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 978; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_979() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 979; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_980() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 980; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_981() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 981; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_982() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 982; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_983() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 983; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_984() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 984; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_985() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 985; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_986() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 986; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_987() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 987; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_988() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 988; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_989() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 989; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_990() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 990; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_991() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 991; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_992() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 992; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_993() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 993; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_994() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 994; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_995() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 995; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_996() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 996; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_997() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 997; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_998() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 998; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_999() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 999; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1000() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1000; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1001() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1001; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1002() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1002; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1003() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1003; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1004() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1004; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1005() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1005; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1006() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1006; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1007() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1007; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1008() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1008; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1009() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1009; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1010() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1010; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1011() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1011; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1012() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1012; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1013() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1013; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1014() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1014; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1015() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1015; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1016() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1016; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1017() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1017; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1018() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1018; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1019() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1019; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1020() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1020; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1021() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1021; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1022() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1022; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1023() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1023; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1024() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1024; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1025() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1025; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1026() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1026; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1027() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1027; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1028() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1028; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1029() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1029; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1030() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1030; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1031() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1031; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1032() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1032; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1033() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1033; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1034() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1034; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1035() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1035; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1036() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1036; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1037() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1037; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1038() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1038; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1039() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1039; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1040() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1040; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1041() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1041; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1042() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1042; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1043() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1043; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1044() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1044; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1045() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1045; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1046() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1046; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1047() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1047; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1048() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1048; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1049() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1049; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1050() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1050; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1051() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1051; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1052() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1052; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1053() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1053; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1054() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1054; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1055() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1055; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1056() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1056; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1057() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1057; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1058() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1058; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1059() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1059; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1060() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1060; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1061() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1061; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1062() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1062; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1063() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1063; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1064() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1064; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1065() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1065; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1066() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1066; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1067() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1067; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1068() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1068; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1069() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1069; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1070() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1070; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1071() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1071; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1072() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1072; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1073() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1073; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1074() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1074; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1075() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1075; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1076() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1076; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1077() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1077; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1078() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1078; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1079() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1079; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1080() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1080; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1081() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1081; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1082() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1082; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1083() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1083; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1084() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1084; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1085() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1085; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1086() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1086; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1087() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1087; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1088() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1088; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1089() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1089; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1090() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1090; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1091() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1091; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1092() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1092; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1093() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1093; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1094() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1094; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1095() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1095; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1096() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1096; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1097() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1097; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1098() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1098; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1099() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1099; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1100() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1100; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1101() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1101; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1102() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1102; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1103() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1103; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1104() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1104; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1105() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1105; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1106() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1106; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1107() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1107; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1108() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1108; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1109() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1109; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1110() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1110; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1111() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1111; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1112() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1112; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1113() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1113; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1114() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1114; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1115() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1115; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1116() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1116; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1117() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1117; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1118() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1118; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1119() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1119; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1120() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1120; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1121() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1121; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1122() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1122; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1123() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1123; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1124() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1124; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1125() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1125; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1126() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1126; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1127() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1127; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1128() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1128; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1129() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1129; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1130() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1130; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1131() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1131; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1132() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1132; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1133() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1133; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1134() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1134; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1135() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1135; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1136() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1136; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1137() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1137; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1138() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1138; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1139() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1139; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1140() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1140; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1141() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1141; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1142() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1142; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1143() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1143; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1144() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1144; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1145() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1145; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1146() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1146; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1147() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1147; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1148() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1148; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1149() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1149; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1150() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1150; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1151() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1151; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1152() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1152; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1153() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1153; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1154() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1154; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1155() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1155; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1156() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1156; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1157() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1157; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1158() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1158; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1159() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1159; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1160() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1160; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1161() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1161; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1162() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1162; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1163() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1163; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1164() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1164; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1165() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1165; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1166() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1166; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1167() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1167; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1168() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1168; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1169() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1169; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1170() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1170; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1171() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1171; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1172() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1172; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1173() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1173; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1174() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1174; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1175() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1175; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1176() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1176; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1177() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1177; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1178() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1178; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1179() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1179; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1180() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1180; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1181() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1181; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1182() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1182; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1183() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1183; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1184() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1184; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1185() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1185; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1186() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1186; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1187() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1187; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1188() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1188; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1189() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1189; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1190() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1190; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1191() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1191; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1192() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1192; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1193() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1193; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1194() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1194; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1195() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1195; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1196() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1196; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1197() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1197; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1198() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1198; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1199() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1199; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1200() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1200; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1201() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1201; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1202() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1202; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1203() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1203; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1204() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1204; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1205() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1205; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1206() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1206; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1207() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1207; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1208() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1208; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1209() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1209; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1210() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1210; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1211() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1211; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1212() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1212; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1213() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1213; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1214() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1214; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1215() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1215; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1216() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1216; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1217() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1217; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1218() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1218; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1219() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1219; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1220() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1220; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1221() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1221; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1222() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1222; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1223() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1223; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1224() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1224; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1225() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1225; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1226() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1226; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1227() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1227; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1228() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1228; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1229() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1229; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1230() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1230; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1231() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1231; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1232() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1232; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1233() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1233; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1234() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1234; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1235() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1235; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1236() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1236; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1237() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1237; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1238() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1238; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1239() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1239; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1240() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1240; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1241() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1241; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1242() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1242; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1243() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1243; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1244() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1244; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1245() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1245; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1246() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1246; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1247() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1247; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1248() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1248; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1249() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1249; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1250() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1250; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1251() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1251; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1252() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1252; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1253() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1253; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1254() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1254; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1255() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1255; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1256() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1256; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1257() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1257; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1258() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1258; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1259() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1259; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1260() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1260; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1261() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1261; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1262() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1262; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1263() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1263; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1264() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1264; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1265() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1265; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1266() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1266; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1267() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1267; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1268() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1268; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1269() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1269; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1270() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1270; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1271() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1271; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1272() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1272; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1273() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1273; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1274() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1274; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1275() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1275; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1276() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1276; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1277() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1277; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1278() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1278; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1279() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1279; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1280() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1280; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1281() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1281; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1282() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1282; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1283() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1283; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1284() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1284; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1285() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1285; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1286() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1286; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1287() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1287; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1288() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1288; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1289() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1289; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1290() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1290; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1291() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1291; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1292() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1292; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1293() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1293; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1294() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1294; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1295() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1295; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1296() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1296; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1297() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1297; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1298() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1298; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1299() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1299; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1300() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1300; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1301() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1301; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1302() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1302; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1303() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1303; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1304() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1304; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1305() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1305; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1306() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1306; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1307() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1307; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1308() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1308; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1309() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1309; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1310() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1310; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1311() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1311; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1312() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1312; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1313() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1313; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1314() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1314; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1315() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1315; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1316() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1316; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1317() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1317; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1318() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1318; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1319() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1319; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1320() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1320; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1321() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1321; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1322() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1322; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1323() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1323; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1324() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1324; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1325() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1325; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1326() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1326; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1327() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1327; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1328() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1328; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1329() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1329; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1330() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1330; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1331() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1331; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1332() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1332; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1333() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1333; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1334() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1334; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1335() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1335; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1336() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1336; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1337() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1337; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1338() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1338; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1339() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1339; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1340() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1340; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1341() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1341; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1342() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1342; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1343() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1343; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1344() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1344; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1345() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1345; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1346() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1346; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1347() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1347; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1348() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1348; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1349() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1349; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1350() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1350; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1351() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1351; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1352() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1352; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1353() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1353; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1354() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1354; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1355() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1355; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1356() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1356; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1357() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1357; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1358() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1358; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1359() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1359; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1360() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1360; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1361() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1361; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1362() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1362; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1363() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1363; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1364() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1364; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1365() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1365; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1366() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1366; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1367() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1367; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1368() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1368; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1369() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1369; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1370() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1370; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1371() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1371; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1372() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1372; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1373() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1373; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1374() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1374; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1375() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1375; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1376() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1376; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1377() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1377; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1378() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1378; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1379() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1379; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1380() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1380; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1381() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1381; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1382() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1382; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1383() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1383; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1384() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1384; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1385() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1385; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1386() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1386; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1387() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1387; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1388() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1388; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1389() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1389; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1390() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1390; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1391() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1391; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1392() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1392; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1393() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1393; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1394() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1394; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1395() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1395; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1396() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1396; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1397() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1397; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1398() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1398; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1399() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1399; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1400() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1400; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1401() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1401; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1402() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1402; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1403() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1403; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1404() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1404; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1405() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1405; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1406() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1406; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1407() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1407; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1408() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1408; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1409() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1409; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1410() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1410; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1411() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1411; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1412() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1412; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1413() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1413; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1414() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1414; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1415() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1415; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1416() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1416; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1417() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1417; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1418() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1418; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1419() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1419; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1420() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1420; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1421() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1421; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1422() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1422; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1423() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1423; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1424() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1424; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1425() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1425; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1426() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1426; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1427() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1427; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1428() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1428; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1429() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1429; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1430() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1430; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1431() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1431; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1432() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1432; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1433() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1433; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1434() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1434; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1435() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1435; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1436() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1436; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1437() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1437; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1438() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1438; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1439() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1439; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1440() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1440; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1441() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1441; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1442() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1442; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1443() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1443; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1444() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1444; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1445() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1445; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1446() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1446; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1447() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1447; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1448() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1448; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1449() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1449; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1450() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1450; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1451() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1451; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1452() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1452; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1453() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1453; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1454() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1454; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1455() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1455; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1456() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1456; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1457() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1457; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1458() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1458; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1459() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1459; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1460() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1460; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1461() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1461; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1462() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1462; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1463() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1463; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1464() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1464; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1465() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1465; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1466() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1466; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1467() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1467; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1468() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1468; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1469() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1469; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1470() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1470; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1471() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1471; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1472() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1472; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1473() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1473; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1474() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1474; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1475() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1475; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1476() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1476; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1477() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1477; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1478() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1478; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1479() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1479; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1480() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1480; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1481() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1481; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1482() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1482; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1483() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1483; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1484() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1484; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1485() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1485; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1486() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1486; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1487() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1487; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1488() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1488; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1489() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1489; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1490() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1490; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1491() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1491; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1492() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1492; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1493() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1493; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1494() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1494; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1495() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1495; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1496() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1496; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1497() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1497; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1498() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1498; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1499() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1499; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1500() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1500; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1501() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1501; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1502() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1502; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1503() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1503; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1504() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1504; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1505() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1505; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1506() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1506; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1507() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1507; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1508() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1508; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1509() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1509; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1510() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1510; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1511() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1511; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1512() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1512; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1513() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1513; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1514() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1514; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1515() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1515; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1516() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1516; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1517() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1517; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1518() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1518; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1519() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1519; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1520() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1520; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1521() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1521; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1522() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1522; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1523() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1523; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1524() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1524; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1525() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1525; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1526() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1526; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1527() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1527; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1528() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1528; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1529() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1529; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1530() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1530; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1531() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1531; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1532() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1532; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1533() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1533; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1534() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1534; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1535() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1535; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1536() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1536; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1537() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1537; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1538() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1538; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1539() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1539; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1540() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1540; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1541() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1541; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1542() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1542; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1543() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1543; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1544() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1544; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1545() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1545; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1546() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1546; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1547() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1547; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1548() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1548; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1549() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1549; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1550() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1550; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1551() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1551; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1552() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1552; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1553() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1553; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1554() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1554; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1555() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1555; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1556() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1556; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1557() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1557; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1558() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1558; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1559() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1559; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1560() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1560; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1561() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1561; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1562() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1562; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1563() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1563; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1564() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1564; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1565() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1565; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1566() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1566; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1567() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1567; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1568() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1568; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1569() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1569; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1570() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1570; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1571() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1571; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1572() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1572; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1573() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1573; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1574() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1574; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1575() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1575; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1576() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1576; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1577() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1577; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1578() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1578; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1579() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1579; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1580() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1580; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1581() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1581; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1582() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1582; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1583() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1583; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1584() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1584; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1585() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1585; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1586() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1586; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1587() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1587; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1588() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1588; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1589() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1589; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1590() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1590; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1591() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1591; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1592() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1592; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1593() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1593; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1594() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1594; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1595() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1595; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1596() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1596; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1597() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1597; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1598() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1598; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1599() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1599; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1600() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1600; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1601() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1601; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1602() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1602; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1603() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1603; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1604() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1604; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1605() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1605; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1606() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1606; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1607() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1607; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1608() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1608; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1609() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1609; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1610() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1610; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1611() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1611; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1612() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1612; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1613() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1613; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1614() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1614; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1615() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1615; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1616() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1616; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1617() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1617; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1618() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1618; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1619() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1619; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1620() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1620; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1621() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1621; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1622() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1622; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1623() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1623; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1624() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1624; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1625() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1625; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1626() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1626; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1627() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1627; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1628() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1628; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1629() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1629; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1630() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1630; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1631() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1631; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1632() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1632; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1633() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1633; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1634() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1634; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1635() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1635; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1636() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1636; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1637() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1637; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1638() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1638; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1639() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1639; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1640() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1640; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1641() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1641; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1642() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1642; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1643() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1643; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1644() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1644; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1645() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1645; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1646() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1646; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1647() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1647; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1648() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1648; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1649() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1649; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1650() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1650; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1651() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1651; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1652() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1652; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1653() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1653; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1654() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1654; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1655() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1655; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1656() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1656; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1657() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1657; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1658() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1658; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1659() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1659; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1660() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1660; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1661() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1661; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1662() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1662; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1663() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1663; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1664() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1664; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1665() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1665; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1666() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1666; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1667() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1667; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1668() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1668; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1669() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1669; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1670() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1670; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1671() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1671; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1672() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1672; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1673() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1673; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1674() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1674; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1675() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1675; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1676() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1676; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1677() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1677; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1678() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1678; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1679() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1679; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1680() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1680; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1681() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1681; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1682() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1682; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1683() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1683; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1684() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1684; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1685() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1685; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1686() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1686; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1687() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1687; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1688() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1688; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1689() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1689; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1690() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1690; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1691() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1691; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1692() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1692; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1693() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1693; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1694() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1694; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1695() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1695; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1696() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1696; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1697() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1697; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1698() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1698; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1699() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1699; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1700() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1700; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1701() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1701; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1702() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1702; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1703() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1703; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1704() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1704; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1705() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1705; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1706() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1706; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1707() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1707; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1708() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1708; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1709() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1709; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1710() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1710; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1711() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1711; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1712() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1712; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1713() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1713; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1714() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1714; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1715() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1715; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1716() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1716; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1717() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1717; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1718() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1718; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1719() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1719; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1720() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1720; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1721() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1721; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1722() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1722; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1723() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1723; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1724() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1724; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1725() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1725; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1726() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1726; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1727() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1727; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1728() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1728; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1729() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1729; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1730() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1730; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1731() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1731; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1732() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1732; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1733() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1733; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1734() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1734; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1735() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1735; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1736() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1736; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1737() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1737; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1738() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1738; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1739() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1739; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1740() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1740; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1741() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1741; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1742() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1742; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1743() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1743; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1744() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1744; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1745() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1745; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1746() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1746; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1747() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1747; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1748() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1748; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1749() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1749; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1750() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1750; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1751() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1751; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1752() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1752; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1753() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1753; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1754() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1754; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1755() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1755; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1756() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1756; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1757() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1757; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1758() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1758; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1759() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1759; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1760() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1760; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1761() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1761; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1762() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1762; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1763() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1763; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1764() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1764; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1765() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1765; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1766() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1766; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1767() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1767; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1768() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1768; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1769() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1769; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1770() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1770; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1771() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1771; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1772() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1772; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1773() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1773; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1774() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1774; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1775() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1775; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1776() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1776; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1777() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1777; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1778() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1778; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1779() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1779; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1780() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1780; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1781() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1781; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1782() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1782; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1783() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1783; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1784() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1784; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1785() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1785; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1786() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1786; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1787() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1787; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1788() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1788; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1789() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1789; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1790() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1790; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1791() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1791; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1792() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1792; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1793() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1793; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1794() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1794; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1795() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1795; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1796() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1796; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1797() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1797; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1798() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1798; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1799() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1799; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1800() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1800; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1801() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1801; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1802() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1802; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1803() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1803; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1804() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1804; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1805() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1805; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1806() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1806; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1807() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1807; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1808() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1808; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1809() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1809; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1810() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1810; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1811() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1811; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1812() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1812; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1813() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1813; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1814() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1814; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1815() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1815; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1816() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1816; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1817() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1817; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1818() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1818; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1819() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1819; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1820() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1820; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1821() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1821; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1822() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1822; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1823() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1823; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1824() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1824; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1825() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1825; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1826() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1826; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1827() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1827; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1828() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1828; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1829() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1829; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1830() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1830; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1831() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1831; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1832() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1832; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1833() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1833; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1834() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1834; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1835() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1835; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1836() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1836; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1837() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1837; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1838() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1838; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1839() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1839; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1840() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1840; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1841() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1841; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1842() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1842; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1843() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1843; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1844() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1844; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1845() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1845; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1846() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1846; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1847() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1847; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1848() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1848; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1849() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1849; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1850() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1850; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1851() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1851; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1852() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1852; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1853() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1853; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1854() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1854; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1855() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1855; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1856() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1856; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1857() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1857; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1858() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1858; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1859() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1859; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1860() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1860; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1861() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1861; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1862() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1862; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1863() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1863; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1864() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1864; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1865() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1865; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1866() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1866; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1867() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1867; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1868() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1868; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1869() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1869; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1870() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1870; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1871() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1871; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1872() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1872; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1873() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1873; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1874() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1874; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1875() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1875; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1876() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1876; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1877() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1877; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1878() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1878; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1879() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1879; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1880() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1880; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1881() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1881; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1882() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1882; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1883() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1883; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1884() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1884; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1885() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1885; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1886() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1886; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1887() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1887; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1888() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1888; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1889() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1889; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1890() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1890; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1891() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1891; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1892() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1892; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1893() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1893; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1894() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1894; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1895() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1895; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1896() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1896; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1897() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1897; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1898() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1898; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1899() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1899; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1900() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1900; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1901() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1901; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1902() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1902; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1903() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1903; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1904() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1904; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1905() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1905; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1906() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1906; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1907() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1907; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1908() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1908; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1909() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1909; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1910() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1910; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1911() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1911; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1912() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1912; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1913() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1913; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1914() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1914; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1915() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1915; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1916() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1916; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1917() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1917; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1918() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1918; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1919() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1919; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1920() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1920; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1921() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1921; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1922() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1922; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1923() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1923; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1924() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1924; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1925() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1925; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1926() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1926; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1927() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1927; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1928() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1928; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1929() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1929; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1930() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1930; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1931() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1931; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1932() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1932; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1933() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1933; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1934() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1934; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1935() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1935; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1936() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1936; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1937() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1937; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1938() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1938; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1939() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1939; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1940() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1940; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1941() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1941; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1942() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1942; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1943() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1943; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1944() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1944; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1945() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1945; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1946() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1946; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1947() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1947; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1948() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1948; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1949() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1949; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1950() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1950; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1951() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1951; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1952() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1952; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1953() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1953; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1954() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1954; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1955() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1955; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1956() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1956; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1957() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1957; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1958() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1958; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1959() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1959; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1960() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1960; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1961() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1961; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1962() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1962; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1963() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1963; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1964() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1964; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1965() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1965; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1966() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1966; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1967() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1967; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1968() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1968; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1969() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1969; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1970() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1970; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1971() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1971; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1972() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1972; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1973() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1973; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1974() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1974; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1975() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1975; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1976() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1976; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1977() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1977; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1978() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1978; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1979() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1979; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1980() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1980; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1981() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1981; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1982() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1982; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1983() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1983; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1984() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1984; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1985() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1985; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1986() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1986; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1987() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1987; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1988() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1988; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1989() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1989; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1990() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1990; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1991() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1991; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1992() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1992; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1993() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1993; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1994() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1994; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1995() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1995; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1996() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1996; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1997() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1997; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1998() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1998; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_1999() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 1999; i++ )); do echo "${i}x"; done ;;
+  esac
+}
+_func_2000() {
+  local cur=${COMP_WORDS[COMP_CWORD]:-} i
+  case $cur in
+    -*) COMPREPLY=( $(compgen -W '--help --version' -- "$cur") ) ;;
+    *) for (( i = 0; i < 2000; i++ )); do echo "${i}x"; done ;;
+  esac
+}
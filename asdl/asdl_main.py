@@ -4,6 +4,7 @@ asdl_main.py - Generate Python and C from ASDL schemas.
 """
 from __future__ import print_function
 
+import hashlib
 import optparse
 import os
 import sys
@@ -45,9 +46,21 @@ def Options():
       action='store_true', default=True,
       help='Generate 0 arg and N arg constructors, in Python and C++')
 
+  # for syntax.asdl, which is stored in the parse cache
+  p.add_option(
+      '--serialize-methods', dest='serialize_methods',
+      action='store_true', default=False,
+      help='Generate Encode() and Decode() methods, using asdl/serialize.py')
+
   return p
 
 
+def _Fingerprint(schema_path):
+  """Identifies the schema that serialized trees were written with."""
+  with open(schema_path) as f:
+    return hashlib.md5(f.read()).hexdigest()[:16]
+
+
 class UserType(object):
   """
   TODO: Delete this class after we have modules with 'use'?
@@ -126,6 +139,10 @@ using id_kind_asdl::Id_t;
 
 """)
 
+      if opts.serialize_methods:
+        f.write('namespace serialize { class Encoder; class Decoder; }\n')
+        f.write('\n')
+
       for use in schema_ast.uses:
         # Forward declarations in the header, like
         # namespace syntax_asdl { class command_t; }
@@ -149,10 +166,14 @@ namespace %s {
       v = gen_cpp.ForwardDeclareVisitor(f)
       v.VisitModule(schema_ast)
 
+      if opts.serialize_methods:
+        f.write('extern Str* SERIALIZE_FINGERPRINT;\n\n')
+
       debug_info = {}
       v2 = gen_cpp.ClassDefVisitor(f, pretty_print_methods=opts.pretty_print_methods,
                                    simple_int_sums=_SIMPLE,
-                                   debug_info=debug_info)
+                                   debug_info=debug_info,
+                                   serialize_methods=opts.serialize_methods)
       v2.VisitModule(schema_ast)
 
       f.write("""
@@ -188,6 +209,8 @@ tags_to_types = \\
         f.write("""\
 #include "prebuilt/asdl/runtime.mycpp.h"  // generated code uses wrappers here
 """)
+        if opts.serialize_methods:
+          f.write('#include "cpp/asdl_serialize.h"\n')
 
         # To call pretty-printing methods
         for use in schema_ast.uses:
@@ -214,7 +237,12 @@ namespace %s {
 
 """ % ns)
 
-        v3 = gen_cpp.MethodDefVisitor(f, simple_int_sums=_SIMPLE)
+        if opts.serialize_methods:
+          f.write('GLOBAL_STR(SERIALIZE_FINGERPRINT, "%s");\n' %
+                  _Fingerprint(schema_path))
+
+        v3 = gen_cpp.MethodDefVisitor(f, simple_int_sums=_SIMPLE,
+                                      serialize_methods=opts.serialize_methods)
         v3.VisitModule(schema_ast)
 
         f.write("""
@@ -268,11 +296,22 @@ from _devbuild.gen.hnode_asdl import color_e, hnode, hnode_e, hnode_t, field
 
 """)
 
+    if opts.serialize_methods:
+      f.write("""\
+if TYPE_CHECKING:
+  from asdl.serialize import Encoder, Decoder
+
+# Stored with serialized trees, so they're rejected after the schema changes
+SERIALIZE_FINGERPRINT = %r
+
+""" % _Fingerprint(schema_path))
+
     abbrev_mod_entries = dir(abbrev_mod) if abbrev_mod else []
     v = gen_python.GenMyPyVisitor(f, abbrev_mod_entries,
                                   pretty_print_methods=opts.pretty_print_methods,
                                   py_init_n=opts.py_init_n,
-                                  simple_int_sums=_SIMPLE)
+                                  simple_int_sums=_SIMPLE,
+                                  serialize_methods=opts.serialize_methods)
     v.VisitModule(schema_ast)
 
     if abbrev_mod:
@@ -166,6 +166,15 @@ class Field(AST):
       else:
         return self.typ.name
 
+    def IsSpanId(self):
+      # By convention, 'int span_id', 'int left_spid', 'int* spids' etc. hold
+      # span IDs, which are renumbered when a tree is serialized.
+      if self.TypeName() != 'int':
+        return False
+      n = self.name
+      return (n in ('span_id', 'spid', 'spids') or n.endswith('_spid') or
+              n.endswith('_span_id'))
+
     def Print(self, f, indent):
         ind = indent * '  '
         f.write('%sField %r ' % (ind, self.name))
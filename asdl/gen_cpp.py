@@ -196,13 +196,73 @@ def _HNodeExpr(abbrev, typ, var_name):
   return code_str, none_guard
 
 
+def _EncodeStmt(field, typ, var_name):
+  """Statement that encodes a value, for the Encode() method."""
+  type_name = typ.name
+
+  if type_name == 'int':
+    if field.IsSpanId():
+      return 'enc->SpanId(%s);' % var_name
+    return 'enc->Int(%s);' % var_name
+
+  if type_name == 'id':
+    return 'enc->Int(%s);' % var_name
+
+  if type_name == 'bool':
+    return 'enc->Bool(%s);' % var_name
+
+  if type_name == 'string':
+    return 'enc->Str(%s);' % var_name
+
+  if typ.resolved and isinstance(typ.resolved, ast.SimpleSum):
+    return 'enc->Int(static_cast<int>(%s));' % var_name
+
+  if typ.resolved and isinstance(typ.resolved, (ast.Sum, ast.Product)):
+    return 'enc->Obj(%s);' % var_name
+
+  raise RuntimeError("Can't serialize field %r of type %r" %
+                     (field.name, type_name))
+
+
+def _DecodeExpr(field, typ):
+  """Expression that decodes a value, for the DecodeFields() method."""
+  type_name = typ.name
+
+  if type_name == 'int':
+    if field.IsSpanId():
+      return 'dec->SpanId()'
+    return 'dec->Int()'
+
+  if type_name == 'id':
+    return 'dec->Int()'
+
+  if type_name == 'bool':
+    return 'dec->Bool()'
+
+  if type_name == 'string':
+    return 'dec->Str()'
+
+  if typ.resolved and isinstance(typ.resolved, ast.SimpleSum):
+    return 'static_cast<%s_t>(dec->Int())' % type_name
+
+  if typ.resolved and isinstance(typ.resolved, ast.Sum):
+    return '%s_t::Decode(dec)' % type_name
+
+  if typ.resolved and isinstance(typ.resolved, ast.Product):
+    return '%s::Decode(dec)' % type_name
+
+  raise RuntimeError("Can't serialize field %r of type %r" %
+                     (field.name, type_name))
+
+
 class ClassDefVisitor(visitor.AsdlVisitor):
   """Generate C++ declarations and type-safe enums."""
 
   def __init__(self, f, e_suffix=True,
                pretty_print_methods=True,
                simple_int_sums=None,
-               debug_info=None):
+               debug_info=None,
+               serialize_methods=False):
     """
     Args:
       f: file to write to
@@ -211,6 +271,7 @@ class ClassDefVisitor(visitor.AsdlVisitor):
     visitor.AsdlVisitor.__init__(self, f)
     self.e_suffix = e_suffix
     self.pretty_print_methods = pretty_print_methods
+    self.serialize_methods = serialize_methods
     self.simple_int_sums = simple_int_sums or []
     self.debug_info = debug_info if debug_info is not None else {}
 
@@ -339,6 +400,10 @@ class ClassDefVisitor(visitor.AsdlVisitor):
       for abbrev in PRETTY_METHODS:
         self.Emit('  hnode_t* %s();' % abbrev)
 
+    if self.serialize_methods:
+      self.Emit('  void Encode(serialize::Encoder* enc);')
+      self.Emit('  static %s_t* Decode(serialize::Decoder* dec);' % sum_name)
+
     Emit('  DISALLOW_COPY_AND_ASSIGN(%(sum_name)s_t)')
     Emit('};')
     Emit('')
@@ -430,6 +495,15 @@ class ClassDefVisitor(visitor.AsdlVisitor):
         self.Emit('  hnode_t* %s();' % abbrev, depth)
       self.Emit('')
 
+    if self.serialize_methods:
+      self.Emit('  void Encode(serialize::Encoder* enc);', depth)
+      if isinstance(ast_node, ast.Product):
+        self.Emit('  static %s* Decode(serialize::Decoder* dec);' % class_name,
+                  depth)
+      self.Emit('  static %s* DecodeFields(serialize::Decoder* dec);' %
+                class_name, depth)
+      self.Emit('')
+
     #
     # Members
     #
@@ -469,10 +543,13 @@ class MethodDefVisitor(visitor.AsdlVisitor):
   dependencies.
   """
   def __init__(self, f, e_suffix=True, pretty_print_methods=True,
-               simple_int_sums=None):
+               simple_int_sums=None, serialize_methods=False):
     visitor.AsdlVisitor.__init__(self, f)
     self.e_suffix = e_suffix
     self.simple_int_sums = simple_int_sums or []
+    self.serialize_methods = serialize_methods
+
+    self._product_counter = 64  # matches ClassDefVisitor
 
   def _EmitCodeForField(self, abbrev, field, counter):
     """Generate code that returns an hnode for a field."""
@@ -606,6 +683,126 @@ class MethodDefVisitor(visitor.AsdlVisitor):
       self.Emit('  return _AbbreviatedTree();')
     self.Emit('}')
 
+  def _EmitSerializeMethods(self, class_name, ast_node, all_fields, tag):
+    """Encode(), DecodeFields(), and Decode() for products."""
+    self.Emit('')
+    self.Emit('void %s::Encode(serialize::Encoder* enc) {' % class_name)
+    self.Emit('  if (!enc->Begin(this, %s)) {' % tag)
+    self.Emit('    return;')
+    self.Emit('  }')
+    for f in all_fields:
+      var_name = 'this->%s' % f.name
+      if f.IsArray():
+        item_type = _GetCppType(f.typ.children[0])
+        self.Emit('  if (%s == nullptr) {' % var_name)
+        self.Emit('    enc->Int(-1);')
+        self.Emit('  } else {')
+        self.Emit('    enc->Int(len(%s));' % var_name)
+        self.Emit('    for (ListIter<%s> it(%s); !it.Done(); it.Next()) {' %
+                  (item_type, var_name))
+        self.Emit('      %s' % _EncodeStmt(f, f.typ.children[0], 'it.Value()'))
+        self.Emit('    }')
+        self.Emit('  }')
+      elif f.IsMaybe():
+        self.Emit('  %s' % _EncodeStmt(f, f.typ.children[0], var_name))
+      else:
+        self.Emit('  %s' % _EncodeStmt(f, f.typ, var_name))
+    self.Emit('  enc->End(this);')
+    self.Emit('}')
+
+    self.Emit('')
+    self.Emit('%s* %s::DecodeFields(serialize::Decoder* dec) {' %
+              (class_name, class_name))
+    for i, f in enumerate(all_fields):
+      out_val_name = 'x%d' % i
+      c_type = _GetCppType(f.typ)
+      if f.IsArray():
+        item_typ = f.typ.children[0]
+        self.Emit('  %s %s = nullptr;' % (c_type, out_val_name))
+        self.Emit('  int n%d = dec->Int();' % i)
+        self.Emit('  if (n%d >= 0) {' % i)
+        self.Emit('    %s = Alloc<List<%s>>();' %
+                  (out_val_name, _GetCppType(item_typ)))
+        self.Emit('    for (int i = 0; i < n%d; ++i) {' % i)
+        self.Emit('      %s->append(%s);' %
+                  (out_val_name, _DecodeExpr(f, item_typ)))
+        self.Emit('    }')
+        self.Emit('  }')
+      elif f.IsMaybe():
+        self.Emit('  %s %s = %s;' %
+                  (c_type, out_val_name, _DecodeExpr(f, f.typ.children[0])))
+      else:
+        self.Emit('  %s %s = %s;' %
+                  (c_type, out_val_name, _DecodeExpr(f, f.typ)))
+
+    n = len(ast_node.fields)
+    args = ['x%d' % i for i in xrange(n)]
+    self.Emit('  %s* obj = Alloc<%s>(%s);' %
+              (class_name, class_name, ', '.join(args)))
+    # Attributes like spids aren't constructor params
+    for i, f in enumerate(all_fields[n:]):
+      self.Emit('  obj->%s = x%d;' % (f.name, n + i))
+    self.Emit('  return obj;')
+    self.Emit('}')
+
+    if isinstance(ast_node, ast.Product):
+      self.Emit('')
+      self.Emit('%s* %s::Decode(serialize::Decoder* dec) {' %
+                (class_name, class_name))
+      self.Emit('  int tag = dec->Begin();')
+      self.Emit('  if (tag == 0) {')
+      self.Emit('    return static_cast<%s*>(dec->Ref());' % class_name)
+      self.Emit('  }')
+      self.Emit('  if (tag != %s) {' % tag)
+      self.Emit('    throw Alloc<ValueError>();')
+      self.Emit('  }')
+      self.Emit('  %s* obj = DecodeFields(dec);' % class_name)
+      self.Emit('  dec->End(obj);')
+      self.Emit('  return obj;')
+      self.Emit('}')
+
+  def _EmitSumSerializeMethods(self, sum, sum_name):
+    """Dispatch on the tag, WITHOUT using 'virtual'."""
+    self.Emit('')
+    self.Emit('void %s_t::Encode(serialize::Encoder* enc) {' % sum_name)
+    self.Emit('  switch (this->tag_()) {')
+    for variant in sum.types:
+      if variant.shared_type:
+        subtype_name = variant.shared_type
+      else:
+        subtype_name = '%s__%s' % (sum_name, variant.name)
+      self.Emit('  case %s_e::%s:' % (sum_name, variant.name))
+      self.Emit('    static_cast<%s*>(this)->Encode(enc);' % subtype_name)
+      self.Emit('    break;')
+    self.Emit('  default:')
+    self.Emit('    assert(0);')
+    self.Emit('  }')
+    self.Emit('}')
+
+    self.Emit('')
+    self.Emit('%s_t* %s_t::Decode(serialize::Decoder* dec) {' %
+              (sum_name, sum_name))
+    self.Emit('  int tag = dec->Begin();')
+    self.Emit('  if (tag == 0) {')
+    self.Emit('    return static_cast<%s_t*>(dec->Ref());' % sum_name)
+    self.Emit('  }')
+    self.Emit('  %s_t* obj = nullptr;' % sum_name)
+    self.Emit('  switch (tag) {')
+    for variant in sum.types:
+      if variant.shared_type:
+        subtype_name = variant.shared_type
+      else:
+        subtype_name = '%s__%s' % (sum_name, variant.name)
+      self.Emit('  case %s_e::%s:' % (sum_name, variant.name))
+      self.Emit('    obj = %s::DecodeFields(dec);' % subtype_name)
+      self.Emit('    break;')
+    self.Emit('  default:')
+    self.Emit('    throw Alloc<ValueError>();')
+    self.Emit('  }')
+    self.Emit('  dec->End(obj);')
+    self.Emit('  return obj;')
+    self.Emit('}')
+
   def _EmitStrFunction(self, sum, sum_name, depth, strong=False, simple=False):
     if self.e_suffix:  # note: can be i_suffix too
       if simple:
@@ -652,6 +849,11 @@ class MethodDefVisitor(visitor.AsdlVisitor):
         tag = '%s_e::%s' % (sum_name, variant.name)
         class_name = '%s__%s' % (sum_name, variant.name)
         self._EmitPrettyPrintMethods(class_name, all_fields, variant)
+        if self.serialize_methods:
+          self._EmitSerializeMethods(class_name, variant, all_fields, tag)
+
+    if self.serialize_methods:
+      self._EmitSumSerializeMethods(sum, sum_name)
 
     # Emit dispatch WITHOUT using 'virtual'
     for func_name in PRETTY_METHODS:
@@ -681,3 +883,7 @@ class MethodDefVisitor(visitor.AsdlVisitor):
     #self._GenClass(product, product.attributes, name, None, depth)
     all_fields = product.fields + product.attributes
     self._EmitPrettyPrintMethods(name, all_fields, product)
+    if self.serialize_methods:
+      self._EmitSerializeMethods(name, product, all_fields,
+                                 str(self._product_counter))
+    self._product_counter += 1
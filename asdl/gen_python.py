@@ -171,19 +171,80 @@ def _HNodeExpr(abbrev, typ, var_name):
   return code_str, none_guard
 
 
+def _EncodeStmt(field, typ, var_name):
+  """Statement that encodes a value, for the Encode() method."""
+  type_name = typ.name
+
+  if type_name == 'int':
+    if field.IsSpanId():
+      return 'enc.SpanId(%s)' % var_name
+    return 'enc.Int(%s)' % var_name
+
+  if type_name == 'id':
+    return 'enc.Int(%s)' % var_name
+
+  if type_name == 'bool':
+    return 'enc.Bool(%s)' % var_name
+
+  if type_name == 'string':
+    return 'enc.Str(%s)' % var_name
+
+  if typ.resolved and isinstance(typ.resolved, ast.SimpleSum):
+    return 'enc.Int(%s)' % var_name
+
+  if typ.resolved and isinstance(typ.resolved, (ast.Sum, ast.Product)):
+    return 'enc.Obj(%s)' % var_name
+
+  raise RuntimeError("Can't serialize field %r of type %r" %
+                     (field.name, type_name))
+
+
+def _DecodeExpr(field, typ, simple_int_sums):
+  """Expression that decodes a value, for the Decode() method."""
+  type_name = typ.name
+
+  if type_name == 'int':
+    if field.IsSpanId():
+      return 'dec.SpanId()'
+    return 'dec.Int()'
+
+  if type_name == 'id':
+    return 'dec.Int()'
+
+  if type_name == 'bool':
+    return 'dec.Bool()'
+
+  if type_name == 'string':
+    return 'dec.Str()'
+
+  if typ.resolved and isinstance(typ.resolved, ast.SimpleSum):
+    if type_name in simple_int_sums:
+      return 'dec.Int()'
+    return '%s_t(dec.Int())' % type_name
+
+  if typ.resolved and isinstance(typ.resolved, ast.Sum):
+    return '%s_t.Decode(dec)' % type_name
+
+  if typ.resolved and isinstance(typ.resolved, ast.Product):
+    return '%s.Decode(dec)' % type_name
+
+  raise RuntimeError("Can't serialize field %r of type %r" %
+                     (field.name, type_name))
+
 
 class GenMyPyVisitor(visitor.AsdlVisitor):
   """Generate Python code with MyPy type annotations."""
 
   def __init__(self, f, abbrev_mod_entries=None, e_suffix=True,
                pretty_print_methods=True, py_init_n=False,
-               simple_int_sums=None):
+               simple_int_sums=None, serialize_methods=False):
 
     visitor.AsdlVisitor.__init__(self, f)
     self.abbrev_mod_entries = abbrev_mod_entries or []
     self.e_suffix = e_suffix
     self.pretty_print_methods = pretty_print_methods
     self.py_init_n = py_init_n
+    self.serialize_methods = serialize_methods
 
     # For Id to use different code gen.  It's used like an integer, not just
     # like an enum.
@@ -301,6 +362,103 @@ class GenMyPyVisitor(visitor.AsdlVisitor):
 
       self.Emit('  L.append(field(%r, %s))' % (field.name, out_val_name), depth)
 
+  def _EmitSerializeMethods(self, class_name, all_fields, tag_num, is_product):
+    """Encode(), DecodeFields(), and Decode() for products."""
+    def Emit(s):
+      self.Emit(s, reflow=False)
+
+    Emit('  def Encode(self, enc):')
+    Emit('    # type: (Encoder) -> None')
+    Emit('    if not enc.Begin(self, %d):' % tag_num)
+    Emit('      return')
+    for f in all_fields:
+      var_name = 'self.%s' % f.name
+      if f.IsArray():
+        Emit('    if %s is None:' % var_name)
+        Emit('      enc.Int(-1)')
+        Emit('    else:')
+        Emit('      enc.Int(len(%s))' % var_name)
+        Emit('      for item in %s:' % var_name)
+        Emit('        %s' % _EncodeStmt(f, f.typ.children[0], 'item'))
+      elif f.IsMaybe():
+        Emit('    %s' % _EncodeStmt(f, f.typ.children[0], var_name))
+      else:
+        Emit('    %s' % _EncodeStmt(f, f.typ, var_name))
+    Emit('    enc.End(self)')
+    Emit('')
+
+    Emit('  @staticmethod')
+    Emit('  def DecodeFields(dec):')
+    Emit('    # type: (Decoder) -> %s' % class_name)
+    args = []
+    for i, f in enumerate(all_fields):
+      out_val_name = 'x%d' % i
+      if f.IsArray():
+        item_typ = f.typ.children[0]
+        Emit('    %s = None  # type: Optional[%s]' %
+             (out_val_name, _MyPyType(f.typ)))
+        Emit('    n%d = dec.Int()' % i)
+        Emit('    if n%d >= 0:' % i)
+        Emit('      %s = []' % out_val_name)
+        Emit('      for _ in xrange(n%d):' % i)
+        Emit('        %s.append(%s)' % (
+            out_val_name, _DecodeExpr(f, item_typ, self.simple_int_sums)))
+      elif f.IsMaybe():
+        Emit('    %s = %s' % (
+            out_val_name,
+            _DecodeExpr(f, f.typ.children[0], self.simple_int_sums)))
+      else:
+        Emit('    %s = %s' % (
+            out_val_name, _DecodeExpr(f, f.typ, self.simple_int_sums)))
+      args.append(out_val_name)
+    Emit('    return %s(%s)' % (class_name, ', '.join(args)))
+    Emit('')
+
+    if is_product:
+      Emit('  @staticmethod')
+      Emit('  def Decode(dec):')
+      Emit('    # type: (Decoder) -> %s' % class_name)
+      Emit('    tag = dec.Begin()')
+      Emit('    if tag == 0:')
+      Emit('      return cast(%s, dec.Ref())' % class_name)
+      Emit('    if tag != %d:' % tag_num)
+      Emit("      raise ValueError('Invalid tag %%d for %s' %% tag)" %
+           class_name)
+      Emit('    obj = %s.DecodeFields(dec)' % class_name)
+      Emit('    dec.End(obj)')
+      Emit('    return obj')
+      Emit('')
+
+  def _EmitSumDecode(self, sum, sum_name):
+    """Every variant has its own Encode(), but Decode() has to dispatch on
+    the tag."""
+    def Emit(s):
+      self.Emit(s, reflow=False)
+
+    Emit('')
+    Emit('@staticmethod')
+    Emit('def Decode(dec):')
+    Emit('  # type: (Decoder) -> %s_t' % sum_name)
+    Emit('  tag = dec.Begin()')
+    Emit('  if tag == 0:')
+    Emit('    return cast(%s_t, dec.Ref())' % sum_name)
+    for i, variant in enumerate(sum.types):
+      if variant.shared_type:
+        subtype_name = variant.shared_type
+      else:
+        subtype_name = '%s__%s' % (sum_name, variant.name)
+      Emit('  %s tag == %s_e.%s:' % ('if' if i == 0 else 'elif', sum_name,
+                                      variant.name))
+      if i == 0:
+        Emit('    obj = %s.DecodeFields(dec)  # type: %s_t' %
+             (subtype_name, sum_name))
+      else:
+        Emit('    obj = %s.DecodeFields(dec)' % subtype_name)
+    Emit('  else:')
+    Emit("    raise ValueError('Invalid tag %%d for %s_t' %% tag)" % sum_name)
+    Emit('  dec.End(obj)')
+    Emit('  return obj')
+
   def _GenClass(self, ast_node, attributes, class_name, base_classes, depth,
                 tag_num):
     """Used for Constructor and Product."""
@@ -366,6 +524,10 @@ class GenMyPyVisitor(visitor.AsdlVisitor):
       self.Emit('    return %s(%s)' % (class_name, ', '.join(default_vals)))
       self.Emit('')
 
+    if self.serialize_methods:
+      self._EmitSerializeMethods(class_name, all_fields, tag_num,
+                                 isinstance(ast_node, ast.Product))
+
     if not self.pretty_print_methods:
       return
 
@@ -484,6 +646,9 @@ class GenMyPyVisitor(visitor.AsdlVisitor):
     self.Emit('  # type: () -> int')
     self.Emit('  return self._type_tag')
 
+    if self.serialize_methods:
+      self._EmitSumDecode(sum, sum_name)
+
     # This is what we would do in C++, but we don't need it in Python because
     # every function is virtual.
     if 0:
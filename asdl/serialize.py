@@ -0,0 +1,226 @@
+"""
+serialize.py - Binary encoding of ASDL trees, e.g. for the parse cache.
+
+Schemas generated with --serialize-methods have Encode() and Decode() methods
+that call the primitives here.  The format:
+
+- Integers are zigzag varints.
+- Strings are a length, or -1 for None, followed by the bytes.
+- Objects start with a header: 0 for None, 2*i + 1 for the i-th object
+  already written, or 2*tag for a new object, followed by its fields.  So
+  sharing is preserved, e.g. Tokens that point to the same SourceLine.
+- Span IDs are renumbered with AddSpanRange() and SetSpanBase(), so a tree can
+  be loaded into an arena at a different position than it was saved from.
+
+The C++ version is in cpp/asdl_serialize.h.
+"""
+from __future__ import print_function
+
+import bisect
+
+from asdl import runtime
+
+from typing import List, Dict, Any
+
+
+class Encoder(object):
+
+  def __init__(self):
+    # type: () -> None
+    self.chunks = []  # type: List[str]
+
+    # id() of each object -> its index.  Objects are kept alive in a list so
+    # their id() isn't reused.
+    self.memo = {}  # type: Dict[int, int]
+    self.objs = []  # type: List[Any]
+
+    self.span_starts = []  # type: List[int]
+    self.span_ends = []  # type: List[int]
+    self.span_offsets = []  # type: List[int]
+    self.num_spans = 0
+
+  def Seed(self, obj):
+    # type: (Any) -> None
+    """Register an object that the Decoder will also be seeded with.
+
+    It's written as a reference instead of being encoded.
+    """
+    self.memo[id(obj)] = len(self.objs)
+    self.objs.append(obj)
+
+  def AddSpanRange(self, start, end):
+    # type: (int, int) -> None
+    """Span IDs in [start, end) are written as offsets into the ranges added
+    so far.  Other span IDs are written as runtime.NO_SPID.
+
+    Ranges must be added in increasing order.
+    """
+    self.span_starts.append(start)
+    self.span_ends.append(end)
+    self.span_offsets.append(self.num_spans)
+    self.num_spans += end - start
+
+  def NumSpans(self):
+    # type: () -> int
+    return self.num_spans
+
+  def Int(self, i):
+    # type: (int) -> None
+    z = i * 2 if i >= 0 else -i * 2 - 1
+    while z >= 0x80:
+      self.chunks.append(chr((z & 0x7f) | 0x80))
+      z >>= 7
+    self.chunks.append(chr(z))
+
+  def Bool(self, b):
+    # type: (bool) -> None
+    self.chunks.append('\1' if b else '\0')
+
+  def Str(self, s):
+    # type: (str) -> None
+    if s is None:
+      self.Int(-1)
+    else:
+      self.Int(len(s))
+      self.chunks.append(s)
+
+  def SpanId(self, span_id):
+    # type: (int) -> None
+    i = bisect.bisect_right(self.span_starts, span_id) - 1
+    if i >= 0 and span_id < self.span_ends[i]:
+      self.Int(self.span_offsets[i] + span_id - self.span_starts[i])
+    else:
+      self.Int(runtime.NO_SPID)
+
+  def Null(self):
+    # type: () -> None
+    self.Int(0)
+
+  def Obj(self, obj):
+    # type: (Any) -> None
+    if obj is None:
+      self.Null()
+    else:
+      obj.Encode(self)
+
+  def Begin(self, obj, tag):
+    # type: (Any, int) -> bool
+    """Write an object header.  Returns True if the fields should follow."""
+    index = self.memo.get(id(obj))
+    if index is not None:
+      self.Int(index * 2 + 1)
+      return False
+    self.Int(tag * 2)
+    return True
+
+  def End(self, obj):
+    # type: (Any) -> None
+    """Called after the fields of a new object are written."""
+    self.memo[id(obj)] = len(self.objs)
+    self.objs.append(obj)
+
+  def Finish(self):
+    # type: () -> str
+    return ''.join(self.chunks)
+
+
+class Decoder(object):
+
+  def __init__(self, s):
+    # type: (str) -> None
+    self.s = s
+    self.pos = 0
+    self.objs = []  # type: List[Any]
+    self.ref = None  # type: Any
+    self.span_base = 0
+
+  def Seed(self, obj):
+    # type: (Any) -> None
+    self.objs.append(obj)
+
+  def SetSpanBase(self, base):
+    # type: (int) -> None
+    """Span IDs are decoded as offsets from base."""
+    self.span_base = base
+
+  def Int(self):
+    # type: () -> int
+    s = self.s
+    pos = self.pos
+    z = 0
+    shift = 0
+    while True:
+      if pos >= len(s):
+        raise ValueError('Unexpected end of data')
+      b = ord(s[pos])
+      pos += 1
+      z |= (b & 0x7f) << shift
+      if b < 0x80:
+        break
+      shift += 7
+    self.pos = pos
+    return (z >> 1) if z & 1 == 0 else -(z >> 1) - 1
+
+  def Bool(self):
+    # type: () -> bool
+    if self.pos >= len(self.s):
+      raise ValueError('Unexpected end of data')
+    b = self.s[self.pos]
+    self.pos += 1
+    return b != '\0'
+
+  def Str(self):
+    # type: () -> str
+    n = self.Int()
+    if n < 0:
+      return None
+    end = self.pos + n
+    if end > len(self.s):
+      raise ValueError('Unexpected end of data')
+    result = self.s[self.pos:end]
+    self.pos = end
+    return result
+
+  def SpanId(self):
+    # type: () -> int
+    i = self.Int()
+    if i == runtime.NO_SPID:
+      return i
+    return self.span_base + i
+
+  def Begin(self):
+    # type: () -> int
+    """Read an object header.
+
+    Returns the tag of a new object, whose fields follow.  Otherwise returns
+    0, and Ref() is None or an object that was already decoded.
+    """
+    h = self.Int()
+    if h & 1:
+      index = h >> 1
+      if index >= len(self.objs):
+        raise ValueError('Invalid object reference %d' % index)
+      self.ref = self.objs[index]
+      return 0
+    if h == 0:
+      self.ref = None
+    return h >> 1
+
+  def Ref(self):
+    # type: () -> Any
+    return self.ref
+
+  def End(self, obj):
+    # type: (Any) -> None
+    """Called after a new object's fields are decoded."""
+    self.objs.append(obj)
+
+  def Done(self):
+    # type: () -> bool
+    return self.pos == len(self.s)
+
+  def Finish(self):
+    # type: () -> None
+    """Release the table of decoded objects."""
+    self.objs = []
+    self.ref = None
@@ -13,6 +13,10 @@
 #              also integer counter
 # - bubble_sort: indexed array (bash uses a linked list?)
 # - palindrome: string, slicing, unicode
+# - str_append: s+=x in a loop, which shouldn't be quadratic
+# - array_append: a+=(x) in a loop, likewise
+# - dynamic_scope: reading and writing globals from deep in the call stack
+# - printf_loop: printf with the same format in a loop
 # - parse_help: realistic shell-only string processing, which I didn't write.
 #
 # TODO:
@@ -126,6 +130,51 @@ array_ref-tasks() {
 #EOF
 }
 
+# s+=x should be amortized O(1), not a copy of s
+str_append-tasks() {
+  local provenance=$1
+
+  cat $provenance | filter-provenance bash "$OSH_CPP_REGEX" |
+  while read fields; do
+    for n in 10000 100000 1000000; do
+      echo "str_append $n _" | xargs -n 3 -- echo "$fields"
+    done
+  done
+}
+
+array_append-tasks() {
+  local provenance=$1
+
+  cat $provenance | filter-provenance bash "$OSH_CPP_REGEX" |
+  while read fields; do
+    for n in 10000 100000 1000000; do
+      echo "array_append $n _" | xargs -n 3 -- echo "$fields"
+    done
+  done
+}
+
+dynamic_scope-tasks() {
+  local provenance=$1
+
+  cat $provenance | filter-provenance bash "$OSH_CPP_REGEX" |
+  while read fields; do
+    for depth in 10 100 1000; do
+      echo "dynamic_scope $depth 1000" | xargs -n 3 -- echo "$fields"
+    done
+  done
+}
+
+printf_loop-tasks() {
+  local provenance=$1
+
+  cat $provenance | filter-provenance bash "$OSH_CPP_REGEX" |
+  while read fields; do
+    for n in 1000 10000 100000; do
+      echo "printf_loop $n _" | xargs -n 3 -- echo "$fields"
+    done
+  done
+}
+
 palindrome-tasks() {
   local provenance=$1
 
@@ -219,6 +268,47 @@ array_ref-one() {
   seq $n | shuf | $runtime benchmarks/compute/array_ref.$(ext $runtime) $mode
 }
 
+str_append-one() {
+  ### Run one str_append task (string building)
+
+  local name=${1:-str_append}
+  local runtime=$2
+  local n=${3:-1000}
+
+  $runtime benchmarks/compute/str_append.$(ext $runtime) $n
+}
+
+array_append-one() {
+  ### Run one array_append task (array building)
+
+  local name=${1:-array_append}
+  local runtime=$2
+  local n=${3:-1000}
+
+  $runtime benchmarks/compute/array_append.$(ext $runtime) $n
+}
+
+dynamic_scope-one() {
+  ### Run one dynamic_scope task (variable lookup)
+
+  local name=${1:-dynamic_scope}
+  local runtime=$2
+  local depth=${3:-100}
+  local iters=${4:-1000}
+
+  $runtime benchmarks/compute/dynamic_scope.$(ext $runtime) $depth $iters
+}
+
+printf_loop-one() {
+  ### Run one printf_loop task (formatting)
+
+  local name=${1:-printf_loop}
+  local runtime=$2
+  local n=${3:-1000}
+
+  $runtime benchmarks/compute/printf_loop.$(ext $runtime) $n
+}
+
 palindrome-one() {
   ### Run one palindrome task (strings)
 
@@ -257,6 +347,18 @@ bubble_sort-all() { task-all bubble_sort "$@"; }
 # Array that is not quadratic
 array_ref-all() { task-all array_ref "$@"; }
 
+# Appending to a string in a loop
+str_append-all() { task-all str_append "$@"; }
+
+# Appending to an array in a loop
+array_append-all() { task-all array_append "$@"; }
+
+# Reading and writing globals from deep in the call stack
+dynamic_scope-all() { task-all dynamic_scope "$@"; }
+
+# printf with the same format in a loop
+printf_loop-all() { task-all printf_loop "$@"; }
+
 # Hm osh is a little slower here
 palindrome-all() { task-all palindrome "$@"; }
 
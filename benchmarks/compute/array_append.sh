@@ -0,0 +1,24 @@
+#!/usr/bin/env bash
+#
+# Build a big array by appending to it in a loop.  A shell that copies the
+# whole array on every a+=(x) is quadratic.
+#
+# Usage:
+#   ./array_append.sh N
+
+set -o nounset
+set -o pipefail
+set -o errexit
+
+main() {
+  local n=${1:-1000}
+
+  local -a a=()
+  for (( i = 0; i < n; ++i )); do
+    a+=("item$i")
+  done
+
+  echo len=${#a[@]}
+}
+
+main "$@"
@@ -0,0 +1,44 @@
+#!/usr/bin/env bash
+#
+# Read and write globals from the bottom of a deep stack of function calls.
+# With dynamic scope, a shell that searches every frame for each variable is
+# O(depth) per read and per write.
+#
+# Usage:
+#   ./dynamic_scope.sh DEPTH ITERS
+
+set -o nounset
+set -o pipefail
+set -o errexit
+
+# Plenty of globals, like a big script
+for (( i = 0; i < 100; ++i )); do
+  eval "g$i=$i"
+done
+
+recurse() {
+  local depth=$1
+  local iters=$2
+
+  # Each frame has its own locals too
+  local frame=$depth
+  local -a frame_args=("$@")
+
+  if (( depth > 0 )); then
+    recurse $(( depth - 1 )) $iters
+    return
+  fi
+
+  local sum=0
+  for (( i = 0; i < iters; ++i )); do
+    sum=$(( sum + g0 + g50 + g99 ))
+
+    # Assign to an existing global, and bind a new one each time
+    g50=$(( i % 7 ))
+    unset -v tmp
+    tmp=$i
+  done
+  echo sum=$sum tmp=$tmp
+}
+
+recurse "${1:-100}" "${2:-1000}"
@@ -0,0 +1,30 @@
+#!/usr/bin/env bash
+#
+# Format numbers and strings with printf in a loop.  The format string is the
+# same each time, so a shell shouldn't parse it again.
+#
+# Usage:
+#   ./printf_loop.sh N
+
+set -o nounset
+set -o pipefail
+set -o errexit
+
+main() {
+  local n=${1:-1000}
+
+  local line
+  local total=0
+  for (( i = 0; i < n; ++i )); do
+    printf -v line '%-8s %05d %x\n' "row$i" $i $i
+    (( total += ${#line} ))
+  done
+
+  # Leftover args reuse the format
+  printf '%s=%d ' a 1 b 2 c 3
+  echo
+
+  echo total=$total
+}
+
+main "$@"
@@ -0,0 +1,24 @@
+#!/usr/bin/env bash
+#
+# Build a long string by appending to it in a loop.  A shell that copies the
+# whole string on every s+=x is quadratic.
+#
+# Usage:
+#   ./str_append.sh N
+
+set -o nounset
+set -o pipefail
+set -o errexit
+
+main() {
+  local n=${1:-1000}
+
+  local s=''
+  for (( i = 0; i < n; ++i )); do
+    s+="frag$i "
+  done
+
+  echo len=${#s}
+}
+
+main "$@"
@@ -261,6 +261,36 @@ run-tasks() {
   # TODO: OIL_GC_STATS_FD and tsv_column_from_files.py
 }
 
+long-session() {
+  ### Memory used by an interactive shell after many commands
+
+  # The arena releases the tokens of each top-level command, so max RSS
+  # shouldn't grow much with the number of commands.
+
+  local bin=${1:-_bin/cxx-opt/osh}
+  local max_commands=${2:-500000}
+  ninja $bin
+
+  local dir=$BASE_DIR/long-session
+  mkdir -p $dir
+
+  local input=$dir/commands.txt
+  seq $max_commands | awk '{ print "x=$(( x + " $1 " )); echo \"$x\" > /dev/null" }' \
+    > $input
+
+  local tsv_out=$dir/times.tsv
+  time-tsv --print-header --rusage --field num_commands > $tsv_out
+
+  local n
+  for n in $(( max_commands / 100 )) $(( max_commands / 10 )) $max_commands; do
+    head -n $n $input |
+      time-tsv -o $tsv_out --append --rusage --field $n -- \
+        $bin -i --rcfile /dev/null > /dev/null 2>&1
+  done
+
+  cat $tsv_out
+}
+
 fd-demo() {
   local out=_tmp/gc/demo.txt
 
@@ -182,6 +182,33 @@ cachegrind-parse-configure-coreutils() {
   cat $out
 }
 
+heap-per-line() {
+  ### Heap usage per line parsed, e.g. to measure the size of the token table
+
+  local bin=${1:-_bin/cxx-opt/oils-for-unix}
+  local files=${2:-benchmarks/osh-parser-files.txt}
+  ninja $bin
+
+  local out=$BASE_DIR/heap-per-line.tsv
+  mkdir -p $BASE_DIR
+
+  # 'max survived' is the most objects live after any collection
+  printf 'num_lines\tbytes_allocated\tbytes_per_line\tmax_survived\tpath\n' > $out
+
+  grep -v '^#' $files | while read path; do
+    local num_lines stats bytes survived
+    num_lines=$(wc -l < $path)
+    stats=$(OIL_GC_STATS=1 $bin --ast-format none -n $path 2>&1 >/dev/null)
+    bytes=$(echo "$stats" | awk '/bytes allocated/ { print $4 }')
+    survived=$(echo "$stats" | awk '/max survived/ { print $4 }')
+
+    printf '%d\t%d\t%d\t%d\t%s\n' \
+      $num_lines $bytes $(( bytes / (num_lines + 1) )) $survived $path
+  done >> $out
+
+  cat $out
+}
+
 cachegrind-demo() {
   #local sh=bash
   local sh=zsh
@@ -522,4 +549,40 @@ soil-run() {
   benchmarks/report.sh stage3 $BASE_DIR
 }
 
+
+#
+# Lexer throughput on long literal runs
+#
+
+readonly LITERAL_HEAVY=$BASE_DIR/tmp/literal-heavy.sh
+
+# Long comments, quoted strings and here docs, which the native lexer skips
+# over with FindAnyByte()
+gen-literal-heavy() {
+  local n=${1:-5000}
+
+  local text='The quick brown fox jumps over the lazy dog, again and again.'
+  mkdir -p $(dirname $LITERAL_HEAVY)
+  for i in $(seq $n); do
+    cat <<EOF
+# $i: $text $text
+echo '$text $text'
+echo "$i $text \$HOME $text"
+cat <<END
+$text \$HOME $text
+END
+EOF
+  done > $LITERAL_HEAVY
+  wc -l -c $LITERAL_HEAVY
+}
+
+lex-throughput() {
+  local osh=${1:-$OSH_CPP_NINJA_BUILD}
+
+  gen-literal-heavy
+  for i in 1 2 3; do
+    time $osh -n $LITERAL_HEAVY > /dev/null
+  done
+}
+
 "$@"
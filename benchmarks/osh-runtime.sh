@@ -95,6 +95,10 @@ run-tasks() {
         argv=( testdata/osh-runtime/abuild -h )
         ;;
 
+      builtin-pipelines)
+        argv=( testdata/osh-runtime/builtin_pipelines.sh )
+        ;;
+
       configure.cpython)
         argv=( $PY27_DIR/configure )
         working_dir=$files_out_dir
@@ -180,6 +184,7 @@ print-tasks() {
   local -a workloads=(
     hello-world
     abuild-print-help
+    builtin-pipelines
 
     configure.cpython
     configure.ocaml
@@ -188,10 +193,11 @@ print-tasks() {
   )
 
   if test -n "${QUICKLY:-}"; then
-    # Just do the first two
+    # Just do the first three
     workloads=(
       hello-world
       abuild-print-help
+      builtin-pipelines
     )
   fi
 
@@ -162,4 +162,53 @@ strace-zip() {
   strace python -S _tmp/app.zip
 }
 
+#
+# Parse cache: OSH_PARSE_CACHE_DIR
+#
+
+readonly PARSE_CACHE_LIB=_tmp/startup/lib.sh
+readonly PARSE_CACHE_DIR=_tmp/startup/parse-cache
+
+# A big "bashrc" with many functions, like a completion library
+gen-sourced-lib() {
+  local n=${1:-2000}
+
+  mkdir -p $(dirname $PARSE_CACHE_LIB)
+  for i in $(seq $n); do
+    cat <<EOF
+_func_$i() {
+  local cur=\${COMP_WORDS[COMP_CWORD]:-} i
+  case \$cur in
+    -*) COMPREPLY=( \$(compgen -W '--help --version' -- "\$cur") ) ;;
+    *) for (( i = 0; i < $i; i++ )); do echo "\${i}x"; done ;;
+  esac
+}
+EOF
+  done > $PARSE_CACHE_LIB
+  wc -l $PARSE_CACHE_LIB
+}
+
+# Compare sourcing the lib with and without the cache.  'cold' parses and
+# saves the file, and 'warm' loads it.
+parse-cache() {
+  local osh=${1:-bin/osh}
+
+  gen-sourced-lib
+
+  echo 'no cache'
+  time-callback $osh -c "source $PARSE_CACHE_LIB"
+
+  rm -r -f $PARSE_CACHE_DIR
+  echo 'cold cache'
+  OSH_PARSE_CACHE_DIR=$PARSE_CACHE_DIR time-callback \
+    $osh -c "source $PARSE_CACHE_LIB"
+
+  for i in 1 2 3; do
+    echo 'warm cache'
+    OSH_PARSE_CACHE_DIR=$PARSE_CACHE_DIR time-callback \
+      $osh -c "source $PARSE_CACHE_LIB"
+  done
+  ls -l $PARSE_CACHE_DIR
+}
+
 "$@"
@@ -45,6 +45,7 @@ def NinjaGraph(ru):
         matrix = ninja_lib.COMPILERS_VARIANTS + ninja_lib.GC_PERF_VARIANTS,
 
         deps = [
+          '//cpp/asdl_serialize',
           '//cpp/core',
           '//cpp/libc',
           '//cpp/fanos',
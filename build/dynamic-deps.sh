@@ -68,18 +68,24 @@ _gen/
 .*_def\.py
 .*_spec\.py
 asdl/py.*
+asdl/serialize.py
 core/pyos.py
 core/pyutil.py
 core/optview.py
 frontend/py.*.py
 frontend/consts.py
 frontend/match.py
+pgen2/grammar.py
 pgen2/parse.py
+pgen2/pnode.py
 pylib/path_stat.py
 oil_lang/builtin_oil.py
 oil_lang/expr_eval.py
 oil_lang/objects.py
 osh/bool_stat.py
+osh/ifs_split.py
+osh/printf_format.py
+osh/utf8.py
 tea/.*
 EOF
 
@@ -29,6 +29,10 @@ int main(int argc, char **argv) {
     $main_module::run_tests();
   }
 
+  if (mylib::gStdout) {
+    mylib::gStdout->flush();  // it batches writes
+  }
+
   gHeap.CleanProcessExit();
 }
 EOF
@@ -48,6 +52,8 @@ int main(int argc, char **argv) {
 
   int status = $main_namespace::main(args);
 
+  pyos::FlushStdout();  // mylib::Stdout() batches writes
+
   gHeap.FastProcessExit();
 
   return status;
@@ -408,7 +408,7 @@ class Rules(object):
     return sources
 
   def asdl_library(self, asdl_path, deps = None,
-      pretty_print_methods=True):
+      pretty_print_methods=True, serialize_methods=False):
 
     deps = deps or []
 
@@ -429,6 +429,10 @@ class Rules(object):
       outputs = [out_header]
       asdl_flags += '--no-pretty-print-methods'
 
+    if serialize_methods:
+      asdl_flags += ' --serialize-methods'
+      deps.append('//cpp/asdl_serialize')
+
     debug_mod = prefix + '_debug.py'
     outputs.append(debug_mod)
 
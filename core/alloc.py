@@ -11,11 +11,12 @@ Arena, and the entire Arena can be discarded at once.
 Also, we don't want to save comment lines.
 """
 
-from _devbuild.gen.syntax_asdl import source_t, Token, SourceLine
+from _devbuild.gen.id_kind_asdl import Id, Id_t
+from _devbuild.gen.syntax_asdl import source, source_t, Token, SourceLine
 from asdl import runtime
 from core.pyerror import log
 
-from typing import List, Any
+from typing import List, Optional, Any
 
 _ = log
 
@@ -92,6 +93,26 @@ class ctx_Location(object):
     self.arena.PopSource()
 
 
+class _TokenSegment(object):
+  """Tokens lexed during one top-level command, stored as parallel arrays.
+
+  Storing arrays rather than a List[Token] means the arena doesn't keep a GC
+  object alive for every token ever lexed.
+  """
+  def __init__(self, first_span_id):
+    # type: (int) -> None
+    self.first_span_id = first_span_id
+    self.ids = []  # type: List[Id_t]
+    self.cols = []  # type: List[int]
+    self.lengths = []  # type: List[int]
+    self.lines = []  # type: List[SourceLine]
+    self.vals = []  # type: List[Optional[str]]
+
+    # Whether the tokens are needed after the command runs, e.g. because it
+    # defined a function
+    self.pinned = False
+
+
 class Arena(object):
   """A collection line spans and associated debug info.
 
@@ -105,8 +126,18 @@ class Arena(object):
     # All lines that haven't been discarded.  For LST formatting.
     self.lines_list = []  # type: List[SourceLine]
 
-    # indexed by span_id
-    self.tokens = []  # type: List[Token]
+    # The token table, indexed by span_id.  GetToken() creates Token objects
+    # on demand.
+    #
+    # The interactive shell starts a new segment for each top-level command,
+    # and releases the last one unless it was pinned.  Span IDs are global, so
+    # the segments that are still alive have increasing first_span_id.
+    self.cur_seg = _TokenSegment(0)
+    self.segments = [self.cur_seg]  # type: List[_TokenSegment]
+    self.next_span_id = 0
+
+    # For span IDs of released tokens
+    self.released_line = None  # type: Optional[SourceLine]
 
     # reuse these instances in many line_span instances
     self.source_instances = []  # type: List[source_t]
@@ -188,6 +219,7 @@ class Arena(object):
 
     #log('*** SAVED %d lines', len(saved))
 
+    self.PinSegment()  # the block may be evaluated later
     self.DiscardLines()
     return saved
 
@@ -245,25 +277,109 @@ class Arena(object):
     return ''.join(pieces)
 
   def NewTokenId(self, id_, col, length, src_line, val):
-    # type: (int, int, int, SourceLine, str) -> int
-    span_id = len(self.tokens)  # spids are just array indices
-    tok = Token(id_, col, length, span_id, src_line, val)
-    self.tokens.append(tok)
+    # type: (Id_t, int, int, SourceLine, Optional[str]) -> int
+    seg = self.cur_seg
+    seg.ids.append(id_)
+    seg.cols.append(col)
+    seg.lengths.append(length)
+    seg.lines.append(src_line)
+    seg.vals.append(val)
+
+    span_id = self.next_span_id
+    self.next_span_id += 1
     return span_id
 
   def NewToken(self, id_, col, length, src_line, val):
-    # type: (int, int, int, SourceLine, str) -> Token
+    # type: (Id_t, int, int, SourceLine, Optional[str]) -> Token
     span_id = self.NewTokenId(id_, col, length, src_line, val)
-    return self.tokens[span_id]
+    return Token(id_, col, length, span_id, src_line, val)
+
+  def PopToken(self):
+    # type: () -> None
+    """Remove the last token, so its span ID is reused."""
+    seg = self.cur_seg
+    assert len(seg.ids), "Can't pop a token from an earlier segment"
+    seg.ids.pop()
+    seg.cols.pop()
+    seg.lengths.pop()
+    seg.lines.pop()
+    seg.vals.pop()
+    self.next_span_id -= 1
+
+  def PinSegment(self):
+    # type: () -> None
+    """Keep the tokens of the current command after it runs.
+
+    Called for code that can be run or reported on later: function and proc
+    definitions, saved blocks, and cached parses like trap handlers.
+    """
+    self.cur_seg.pinned = True
+
+  def StartSegment(self):
+    # type: () -> None
+    """Start a segment for the next top-level command.
+
+    The current segment is released unless it's pinned.
+    """
+    if not self.cur_seg.pinned:
+      self.segments.pop()
+    self.cur_seg = _TokenSegment(self.next_span_id)
+    self.segments.append(self.cur_seg)
+
+  def _FindSegment(self, span_id):
+    # type: (int) -> Optional[_TokenSegment]
+    """Return the segment containing span_id, or None if it was released."""
+    if span_id >= self.cur_seg.first_span_id:
+      return self.cur_seg  # common case
+
+    # Binary search for the last segment starting at or before span_id
+    lo = 0
+    hi = len(self.segments) - 1
+    while lo < hi:
+      mid = (lo + hi + 1) // 2
+      if self.segments[mid].first_span_id <= span_id:
+        lo = mid
+      else:
+        hi = mid - 1
+
+    seg = self.segments[lo]
+    i = span_id - seg.first_span_id
+    if 0 <= i and i < len(seg.ids):
+      return seg
+    return None
+
+  def _ReleasedToken(self, span_id):
+    # type: (int) -> Token
+    if self.released_line is None:
+      src = source.Synthetic('code from an earlier command')
+      self.released_line = SourceLine(0, '', src)
+    return Token(Id.Unknown_Tok, 0, 0, span_id, self.released_line, None)
+
+  def HasToken(self, span_id):
+    # type: (int) -> bool
+    """Whether the token for a span ID is still in the table."""
+    return self._FindSegment(span_id) is not None
 
   def GetToken(self, span_id):
     # type: (int) -> Token
+    """Return a new Token with the location info for a span ID.
+
+    It's not the same object the lexer returned, so changes to that token
+    (e.g. its ID) aren't reflected.
+    """
     assert span_id != runtime.NO_SPID, span_id
-    assert span_id < len(self.tokens), \
-      'Span ID out of range: %d is greater than %d' % (span_id, len(self.tokens))
-    return self.tokens[span_id]
+    assert span_id < self.next_span_id, \
+      'Span ID out of range: %d is greater than %d' % (span_id, self.next_span_id)
+
+    seg = self._FindSegment(span_id)
+    if seg is None:
+      return self._ReleasedToken(span_id)
+
+    i = span_id - seg.first_span_id
+    return Token(seg.ids[i], seg.cols[i], seg.lengths[i], span_id,
+                 seg.lines[i], seg.vals[i])
 
   def LastSpanId(self):
     # type: () -> int
     """Return one past the last span ID."""
-    return len(self.tokens)
+    return self.next_span_id
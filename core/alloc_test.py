@@ -29,6 +29,68 @@ class AllocTest(unittest.TestCase):
 
     arena.PopSource()
 
+  def testTokenTable(self):
+    arena = self.arena
+    arena.PushSource(source.MainFile('one.oil'))
+    line = arena.AddLine('echo hi', 1)
+
+    t = arena.NewToken(Id.Lit_Chars, 0, 4, line, 'echo')
+    self.assertEqual(0, t.span_id)
+    span_id = arena.NewTokenId(Id.WS_Space, 4, 1, line, None)
+    self.assertEqual(1, span_id)
+
+    # Tokens are created on demand, with the same location info
+    t2 = arena.GetToken(0)
+    self.assertEqual(Id.Lit_Chars, t2.id)
+    self.assertEqual(4, t2.length)
+    self.assertEqual('echo', t2.tval)
+    self.assertEqual(line, t2.line)
+
+    t3 = arena.GetToken(1)
+    self.assertEqual(4, t3.col)
+    self.assertEqual(None, t3.tval)
+
+    # The span ID is reused
+    arena.PopToken()
+    self.assertEqual(1, arena.LastSpanId())
+    t4 = arena.NewToken(Id.Lit_Chars, 5, 2, line, 'hi')
+    self.assertEqual(1, t4.span_id)
+    self.assertEqual('hi', arena.GetToken(1).tval)
+
+    arena.PopSource()
+
+  def testSegments(self):
+    arena = self.arena
+    arena.PushSource(source.MainFile('one.oil'))
+    line = arena.AddLine('f() { echo hi; }', 1)
+
+    # Pinned segment, e.g. for a function definition
+    spid0 = arena.NewTokenId(Id.Lit_Chars, 0, 1, line, 'f')
+    arena.PinSegment()
+    arena.StartSegment()
+
+    # Released segment
+    line = arena.AddLine('echo hi', 1)
+    spid1 = arena.NewTokenId(Id.Lit_Chars, 0, 4, line, 'echo')
+    arena.StartSegment()
+
+    line = arena.AddLine('echo bye', 1)
+    spid2 = arena.NewTokenId(Id.Lit_Chars, 5, 3, line, 'bye')
+    self.assertEqual(3, arena.LastSpanId())
+
+    self.assertEqual('f', arena.GetToken(spid0).tval)
+    self.assertEqual('bye', arena.GetToken(spid2).tval)
+
+    # Span IDs stay valid, but the location info is gone
+    t = arena.GetToken(spid1)
+    self.assertEqual(Id.Unknown_Tok, t.id)
+    self.assertEqual(spid1, t.span_id)
+    self.assertEqual('', t.line.content)
+
+    self.assertEqual(2, len(arena.segments))
+
+    arena.PopSource()
+
   def testPushSource(self):
     arena = self.arena
 
@@ -163,6 +163,8 @@ class MinimalDisplay(_IDisplay):
     self.f.write(self.prompt_state.last_prompt_str)
     self.f.write(self.comp_state.line_until_tab)
 
+    self.f.flush()
+
   def _PrintCandidates(self, unused_subst, matches, unused_match_len):
     # type: (Optional[str], List[str], int) -> None
     #log('_PrintCandidates %s', matches)
@@ -51,6 +51,7 @@ from core import state
 from core import ui
 from core import util
 from frontend import consts
+from frontend import lexer
 from frontend import reader
 from mycpp import mylib
 from mycpp.mylib import print_stderr
@@ -955,7 +956,7 @@ class RootCompleter(CompletionAction):
         # readline splits at ':' so we have to prepend '-$' to every completed
         # variable name.
         self.comp_ui_state.display_pos = _TokenStart(arena, t2) + 1  # 1 for $
-        to_complete = t2.tval[1:]
+        to_complete = lexer.TokenVal(t2)[1:]
         n = len(to_complete)
         for name in self.mem.VarNames():
           if name.startswith(to_complete):
@@ -965,7 +966,7 @@ class RootCompleter(CompletionAction):
       # echo ${P
       if t2.id == Id.VSub_Name and IsDummy(t1):
         self.comp_ui_state.display_pos = _TokenStart(arena, t2)  # no offset
-        to_complete = t2.tval
+        to_complete = lexer.TokenVal(t2)
         n = len(to_complete)
         for name in self.mem.VarNames():
           if name.startswith(to_complete):
@@ -975,7 +976,7 @@ class RootCompleter(CompletionAction):
       # echo $(( VAR
       if t2.id == Id.Lit_ArithVarLike and IsDummy(t1):
         self.comp_ui_state.display_pos = _TokenStart(arena, t2)  # no offset
-        to_complete = t2.tval
+        to_complete = lexer.TokenVal(t2)
         n = len(to_complete)
         for name in self.mem.VarNames():
           if name.startswith(to_complete):
@@ -1000,7 +1001,7 @@ class RootCompleter(CompletionAction):
         # +1 for ~
         self.comp_ui_state.display_pos = _TokenStart(arena, t2) + 1
 
-        to_complete = t2.tval[1:]
+        to_complete = lexer.TokenVal(t2)[1:]
         n = len(to_complete)
         for u in pyos.GetAllUsers():  # catch errors?
           name = u.pw_name
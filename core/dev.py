@@ -198,8 +198,13 @@ def _PrintShValue(val, buf):
     elif case(value_e.MaybeStrArray):
       val = cast(value__MaybeStrArray, UP_val)
       parts = ['(']
-      for s in val.strs:
-        parts.append(qsn.maybe_shell_encode(s))
+      if val.indices is None:
+        for s in val.strs:
+          parts.append(qsn.maybe_shell_encode(s))
+      else:
+        # Sparse arrays show the index of each entry, like declare -p
+        for k, s in enumerate(val.strs):
+          parts.append('[%d]=%s' % (val.indices[k], qsn.maybe_shell_encode(s)))
       parts.append(')')
       result = ' '.join(parts)
 
@@ -305,6 +310,7 @@ class Tracer(object):
       except error.Parse as e:
         ps4_word = word_.ErrorWord(
             "<ERROR: Can't parse PS4: %s>" % e.UserErrorString())
+      self.parse_ctx.arena.PinSegment()  # it's cached
       self.parse_cache[ps4] = ps4_word
 
     # Mutate objects to save allocations
@@ -385,8 +391,6 @@ class Tracer(object):
       # Async cases
       elif case(trace_e.ProcessSub):
         buf.write('proc sub %d\n' % pid)
-      elif case(trace_e.HereDoc):
-        buf.write('here doc %d\n' % pid)
       elif case(trace_e.Fork):
         buf.write('fork %d\n' % pid)
       elif case(trace_e.PipelinePart):
@@ -3,14 +3,12 @@ executor.py
 """
 from __future__ import print_function
 
-from errno import EINTR
-
 from _devbuild.gen.id_kind_asdl import Id
 from _devbuild.gen.option_asdl import builtin_i
 from _devbuild.gen.runtime_asdl import redirect, trace
 from _devbuild.gen.syntax_asdl import (
     command_e, command__Simple, command__Pipeline, command__ControlFlow,
-    command_sub, compound_word, loc
+    command_sub, compound_word, loc, word_e
 )
 from asdl import runtime
 from core import dev
@@ -23,10 +21,11 @@ from core import vm
 from frontend import consts
 from frontend import lexer
 from frontend import location
+from osh import word_
 
 import posix_ as posix
 
-from typing import cast, Dict, List, TYPE_CHECKING
+from typing import cast, Any, Dict, List, Optional, TYPE_CHECKING
 if TYPE_CHECKING:
   from _devbuild.gen.runtime_asdl import (
       cmd_value__Argv, CommandStatus, StatusArray, Proc
@@ -39,6 +38,31 @@ if TYPE_CHECKING:
 _ = log
 
 
+# Builtins that only write to stdout.  When one is the first stage of a
+# pipeline, it runs in the shell process.  See _CanRunStageInShell().
+_IN_SHELL_STAGE_BUILTINS = ['echo', 'printf', 'true', 'false', ':']
+
+# The default size of a pipe buffer on Linux.  A writer with more output than
+# this blocks until the reader takes it, and can get SIGPIPE.
+_PIPE_CAPACITY = 65536
+
+
+class ctx_CloseFd(object):
+  """Close a descriptor when the block is done, even if it raised."""
+
+  def __init__(self, fd):
+    # type: (int) -> None
+    self.fd = fd
+
+  def __enter__(self):
+    # type: () -> None
+    pass
+
+  def __exit__(self, type, value, traceback):
+    # type: (Any, Any, Any) -> None
+    posix.close(self.fd)
+
+
 class _ProcessSubFrame(object):
   def __init__(self):
     # type: () -> None
@@ -126,21 +150,28 @@ class ShellExecutor(vm._Executor):
 
     builtin_func = self.builtins[builtin_id]
 
-    with vm.ctx_FlushStdout():
-      # note: could be second word, like 'builtin read'
-      with ui.ctx_Location(self.errfmt, cmd_val.arg_spids[0]):
-        try:
-          status = builtin_func.Run(cmd_val)
-          assert isinstance(status, int)
-        except error.Usage as e:
-          arg0 = cmd_val.argv[0]
-          # fill in default location.  e.g. osh/state.py raises UsageError without
-          # span_id.
-          if e.span_id == runtime.NO_SPID:
-            e.span_id = self.errfmt.CurrentLocation()
-          # e.g. 'type' doesn't accept flag '-x'
-          self.errfmt.PrefixPrint(e.msg, '%r ' % arg0, loc.Span(e.span_id))
-          status = 2  # consistent error code for usage error
+    # note: could be second word, like 'builtin read'
+    with ui.ctx_Location(self.errfmt, cmd_val.arg_spids[0]):
+      try:
+        status = builtin_func.Run(cmd_val)
+        assert isinstance(status, int)
+      except error.Usage as e:
+        arg0 = cmd_val.argv[0]
+        # fill in default location.  e.g. osh/state.py raises UsageError without
+        # span_id.
+        if e.span_id == runtime.NO_SPID:
+          e.span_id = self.errfmt.CurrentLocation()
+        # e.g. 'type' doesn't accept flag '-x'
+        self.errfmt.PrefixPrint(e.msg, '%r ' % arg0, loc.Span(e.span_id))
+        status = 2  # consistent error code for usage error
+      except IOError as e:
+        # Stdout batches writes, so this only happens when the batch fills up.
+        # Errors that are left over are reported when it's flushed, e.g. after
+        # 'echo hi >/dev/full'.
+        self.errfmt.PrefixPrint('write error: %s' % posix.strerror(e.errno),
+                                '%r ' % cmd_val.argv[0],
+                                loc.Span(cmd_val.arg_spids[0]))
+        status = 1
 
     return status
 
@@ -202,7 +233,7 @@ class ShellExecutor(vm._Executor):
 
         with dev.ctx_Tracer(self.tracer, 'proc', argv):
           # NOTE: Functions could call 'exit 42' directly, etc.
-          status = self.cmd_ev.RunProc(proc_node, argv[1:], arg0_spid)
+          status = self.cmd_ev.RunProc(proc_node, argv, arg0_spid)
         return status
 
     # Notes:
@@ -303,16 +334,78 @@ class ShellExecutor(vm._Executor):
       self.job_state.AddJob(p)  # show in 'jobs' list
     return 0
 
-  def RunPipeline(self, node, status_out):
-    # type: (command__Pipeline, CommandStatus) -> None
+  def _CanRunStageInShell(self, node):
+    # type: (command_t) -> bool
+    """Can this pipeline stage run in the shell process, rather than a forked
+    one?
+
+    It must be a builtin that only writes to stdout, with words that can't
+    change shell state when evaluated.
 
+    A forked writer gets SIGPIPE when the reader exits early, e.g. in
+    'printf ... | head'.  RunPipeline() forks a process to write output that
+    doesn't fit in a pipe, so the status is the same.
+    """
+    if node.tag_() != command_e.Simple:
+      return False
+    simple = cast(command__Simple, node)
+
+    if (len(simple.words) == 0 or len(simple.redirects) or
+        len(simple.more_env) or simple.typed_args or simple.block):
+      return False
+
+    for w in simple.words:
+      if w.tag_() != word_e.Compound:  # e.g. brace expansion
+        return False
+      if not word_.IsPure(cast(compound_word, w)):
+        return False
+
+    ok, arg0, _ = word_.StaticEval(simple.words[0])
+    if not ok or arg0 not in _IN_SHELL_STAGE_BUILTINS:
+      return False
+    if arg0 in self.procs:  # builtins can be redefined as functions
+      return False
+
+    if arg0 == 'printf':
+      # 'printf -v' assigns a variable, so the format must be static
+      if len(simple.words) < 2:
+        return False
+      ok, arg1, _ = word_.StaticEval(simple.words[1])
+      if not ok or arg1.startswith('-'):
+        return False
+
+    return True
+
+  def _RunStageToFile(self, node, fd):
+    # type: (command_t, int) -> None
+    """Run a pipeline stage in this process, with stdout going to the
+    anonymous file fd.  Then rewind it so it can be read.
+    """
+    # Like a stage in a child process, it doesn't change $_
+    last_arg = self.mem.last_arg
+    with process.ctx_Stdout(self.fd_state, fd):
+      self.cmd_ev.ExecuteAndCatch(node)
+    self.mem.SetLastArgument(last_arg)
+
+    pyos.Rewind(fd)
+
+  def _RunPipelineStages(self, first, children, status_out):
+    # type: (Optional[process.Process], List[command_t], CommandStatus) -> None
+    """Run a pipeline, starting with the process 'first' if it's not None.
+
+    The caller adds the location of 'first' to status_out.
+    """
     pi = process.Pipeline(self.exec_opts.sigpipe_status_ok())
     self.job_state.AddPipeline(pi)
 
+    if first:
+      first.Init_ParentPipeline(pi)
+      pi.Add(first)
+
     # First n-1 processes (which is empty when n == 1)
-    n = len(node.children)
+    n = len(children)
     for i in xrange(n - 1):
-      child = node.children[i]
+      child = children[i]
 
       # TODO: determine these locations at parse time?
       status_out.pipe_spids.append(location.SpanForCommand(child))
@@ -321,13 +414,55 @@ class ShellExecutor(vm._Executor):
       p.Init_ParentPipeline(pi)
       pi.Add(p)
 
-    last_child = node.children[n-1]
+    last_child = children[n-1]
     # Last piece of code is in THIS PROCESS.  'echo foo | read line; echo $line'
     pi.AddLast((self.cmd_ev, last_child))
     status_out.pipe_spids.append(location.SpanForCommand(last_child))
 
+    status_out.pipe_status = pi.Run(self.waiter, self.fd_state)
+
+  def RunPipeline(self, node, status_out):
+    # type: (command__Pipeline, CommandStatus) -> None
+
+    children = node.children
     with dev.ctx_Tracer(self.tracer, 'pipeline', None):
-      status_out.pipe_status = pi.Run(self.waiter, self.fd_state)
+      if len(children) > 1 and self._CanRunStageInShell(children[0]):
+        # Run the first stage in THIS PROCESS, buffering its output.  The rest
+        # of the pipeline reads it as stdin, so 'echo $x | read y' doesn't
+        # fork at all.
+        first = children[0]
+        status_out.pipe_spids.append(location.SpanForCommand(first))
+        fd = pyos.OpenAnonymousFile()
+        with ctx_CloseFd(fd):
+          self._RunStageToFile(first, fd)
+          first_status = self.cmd_ev.LastStatus()
+
+          if pyos.NumUnread(fd) > _PIPE_CAPACITY:
+            # A forked stage would block on the pipe, and get SIGPIPE if the
+            # reader exits early, e.g. 'printf ... | head'.  So write the
+            # output from a child process, which does the same.
+            thunk = process.StageOutputThunk(fd, first_status, first)
+            p = process.Process(thunk, self.job_state, self.tracer)
+            self._RunPipelineStages(p, children[1:], status_out)
+            return
+
+          with process.ctx_Pipe(self.fd_state, fd):
+            if len(children) == 2:
+              # Like Pipeline.Run(), but stdin is already redirected
+              last_child = children[1]
+              status_out.pipe_spids.append(location.SpanForCommand(last_child))
+              self.cmd_ev.ExecuteAndCatch(last_child)
+              rest_status = [self.cmd_ev.LastStatus()]
+            else:
+              self._RunPipelineStages(None, children[1:], status_out)
+              rest_status = status_out.pipe_status
+
+        pipe_status = [first_status]
+        pipe_status.extend(rest_status)
+        status_out.pipe_status = pipe_status
+
+      else:
+        self._RunPipelineStages(None, children, status_out)
 
   def RunSubshell(self, node):
     # type: (command_t) -> int
@@ -368,21 +503,12 @@ class ShellExecutor(vm._Executor):
     p.Start(trace.CommandSub())
     #log('Command sub started %d', pid)
 
-    chunks = []  # type: List[str]
     posix.close(w)  # not going to write
-    while True:
-      n, err_num = pyos.Read(r, 4096, chunks)
-
-      if n < 0:
-        if err_num == EINTR:
-          pass  # retry
-        else:
-          # Like the top level IOError handler
-          e_die_status(2, 'osh I/O error: %s' % posix.strerror(err_num))
-
-      elif n == 0:  # EOF
-        break
+    stdout_str, err_num = pyos.DrainPipe(r)
     posix.close(r)
+    if err_num != 0:
+      # Like the top level IOError handler
+      e_die_status(2, 'osh I/O error: %s' % posix.strerror(err_num))
 
     status = p.Wait(self.waiter)
 
@@ -406,9 +532,9 @@ class ShellExecutor(vm._Executor):
       self.mem.SetLastStatus(status)
 
     # Runtime errors test case: # $("echo foo > $@")
-    # Why rstrip()?
+    # DrainPipe() strips trailing newlines.  Why?
     # https://unix.stackexchange.com/questions/17747/why-does-shell-command-substitution-gobble-up-a-trailing-newline-char
-    return ''.join(chunks).rstrip('\n')
+    return stdout_str
 
   def RunProcessSub(self, cs_part):
     # type: (command_sub) -> str
@@ -17,6 +17,7 @@ from _devbuild.gen.syntax_asdl import (
 )
 from core import error
 from core import process
+from core import pyos
 from core import ui
 from core import util
 from core.pyerror import log
@@ -28,9 +29,10 @@ from mycpp.mylib import print_stderr, tagswitch
 import fanos
 import posix_ as posix
 
-from typing import cast, Any, List, TYPE_CHECKING
+from typing import cast, Any, List, Tuple, Optional, TYPE_CHECKING
 if TYPE_CHECKING:
   from core.comp_ui import _IDisplay
+  from core.parse_cache import CachedFile, Recorder
   from core.ui import ErrorFormatter
   from frontend import parse_lib
   from osh.cmd_parse import CommandParser
@@ -198,6 +200,7 @@ def Interactive(flag, cmd_ev, c_parser, display, prompt_plugin, errfmt):
   done = False
   while not done:
     mylib.MaybeCollect()  # manual GC point
+    pyos.FlushStdout()  # output of the last command, before the prompt
 
     # - This loop has a an odd structure because we want to do cleanup after
     # every 'break'.  (The ones without 'done = True' were 'continue')
@@ -281,6 +284,9 @@ def Interactive(flag, cmd_ev, c_parser, display, prompt_plugin, errfmt):
 
     cmd_ev.RunPendingTraps()  # Run trap handlers even if we get just ENTER
 
+    # Release the tokens for this command, unless it defined a function, etc.
+    c_parser.arena.StartSegment()
+
     # Cleanup after every command (or failed command).
 
     # Reset internal newline state.
@@ -299,10 +305,14 @@ def Interactive(flag, cmd_ev, c_parser, display, prompt_plugin, errfmt):
 
 
 
-def Batch(cmd_ev, c_parser, errfmt, cmd_flags=0):
-  # type: (CommandEvaluator, CommandParser, ui.ErrorFormatter, int) -> int
+def Batch(cmd_ev, c_parser, errfmt, cmd_flags=0, recorder=None):
+  # type: (CommandEvaluator, CommandParser, ui.ErrorFormatter, int, Optional[Recorder]) -> int
   """Loop for batch execution.
 
+  Args:
+    recorder: If passed, each node is saved as it's parsed, for the parse
+      cache.
+
   Returns:
     int status, e.g. 2 on parse error
 
@@ -324,16 +334,23 @@ def Batch(cmd_ev, c_parser, errfmt, cmd_flags=0):
   """
   status = 0
   while True:
+    if recorder:
+      recorder.BeginNode()
     try:
       node = c_parser.ParseLogicalLine()  # can raise ParseError
       if node is None:  # EOF
         c_parser.CheckForPendingHereDocs()  # can raise ParseError
+        if recorder:
+          recorder.SetComplete()
         break
     except error.Parse as e:
       errfmt.PrettyPrintError(e)
       status = 2
       break
 
+    if recorder:
+      recorder.EndNode(node)
+
     # After every "logical line", no lines will be referenced by the Arena.
     # Tokens in the LST still point to many lines, but lines with only comment
     # or whitespace won't be reachable, so the GC will free them.
@@ -356,8 +373,31 @@ def Batch(cmd_ev, c_parser, errfmt, cmd_flags=0):
   return status
 
 
-def ParseWholeFile(c_parser):
-  # type: (CommandParser) -> command_t
+def BatchCached(cmd_ev, cached, cmd_flags=0):
+  # type: (CommandEvaluator, CachedFile, int) -> Tuple[int, bool]
+  """Like Batch(), but run nodes loaded from the parse cache.
+
+  Returns:
+    (status, done).  done is False if the next node may parse differently
+    now, e.g. because an alias was defined.  Then the caller parses the rest
+    of the file, starting at cached.ResumeLine().
+  """
+  status = 0
+  while True:
+    node = cached.NextNode()
+    if node is None:
+      return status, cached.AtEnd()
+
+    is_return, is_fatal = cmd_ev.ExecuteAndCatch(node, cmd_flags=cmd_flags)
+    status = cmd_ev.LastStatus()
+    if is_return or is_fatal:
+      return status, True
+
+    mylib.MaybeCollect()  # manual GC point
+
+
+def ParseWholeFile(c_parser, recorder=None):
+  # type: (CommandParser, Optional[Recorder]) -> command_t
   """Parse an entire shell script.
 
   This uses the same logic as Batch().  Used by:
@@ -365,8 +405,13 @@ def ParseWholeFile(c_parser):
   - oshc translate
   - Used by 'trap' to store code.  But 'source' and 'eval' use Batch().
 
+  The recorder saves the result as a single node.
+
   Note: it does NOT call DiscardLines
   """
+  if recorder:
+    recorder.BeginNode()
+
   children = []  # type: List[command_t]
   while True:
     node = c_parser.ParseLogicalLine()  # can raise ParseError
@@ -378,6 +423,11 @@ def ParseWholeFile(c_parser):
     mylib.MaybeCollect()  # manual GC point
 
   if len(children) == 1:
-    return children[0]
+    result = children[0]
   else:
-    return command.CommandList(children)
+    result = command.CommandList(children)
+
+  if recorder:
+    recorder.EndNode(result)
+    recorder.SetComplete()
+  return result
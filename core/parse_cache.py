@@ -0,0 +1,401 @@
+"""
+parse_cache.py - Reuse the LST of code that was already parsed.
+
+- ParseCache saves sourced files to disk.  It's enabled by setting
+  OSH_PARSE_CACHE_DIR.  Each file in that directory holds the nodes of one
+  sourced file, in the format of asdl/serialize.py, along with the tokens they
+  refer to.
+- CodeCache keeps the nodes of recently parsed strings in memory, for 'eval',
+  'trap', and $PROMPT_COMMAND.
+
+Shell parsing isn't context-free: aliases and parse options can change the
+parse of later lines, and they can be changed by earlier lines of the same
+code.  So we save what each node's parse depended on, and check it before
+running the node.  If anything differs, the caller parses the rest of the code
+from the line where that node started.
+
+Code isn't saved if any of its parses expanded an alias, if it failed to
+parse, or if it didn't run to the end, e.g. because of 'return'.
+"""
+from __future__ import print_function
+
+from _devbuild.gen.syntax_asdl import command_t, source_t, SourceLine
+from _devbuild.gen import syntax_asdl
+from asdl import serialize
+from core import pyos
+from core.pyerror import log
+from core import util
+
+import posix_ as posix
+
+from typing import List, Dict, Optional, cast, TYPE_CHECKING
+if TYPE_CHECKING:
+  from core.state import MutableOpts
+  from frontend.parse_lib import ParseContext
+  from osh.cmd_parse import CommandParser
+
+_ = log
+
+# Change this when the layout below changes.  Changes to the schema are
+# detected with syntax_asdl.SERIALIZE_FINGERPRINT.
+_MAGIC = 'OSH parse cache 1'
+
+
+def _CacheFileName(path):
+  # type: (str) -> str
+  """Escape an absolute path so it can be a file name."""
+  return path.replace('%', '%25').replace('/', '%2F')
+
+
+class CachedFile(object):
+  """The nodes of a file or string, and a position in them."""
+
+  def __init__(self, mutable_opts, aliases):
+    # type: (MutableOpts, Dict[str, str]) -> None
+    self.mutable_opts = mutable_opts
+    self.aliases = aliases
+
+    self.nodes = []  # type: List[command_t]
+    self.opts_keys = []  # type: List[str]
+    self.lookups = []  # type: List[List[str]]
+    self.start_lines = []  # type: List[int]
+    self.pos = 0
+
+  def Add(self, node, opts_key, lookups, start_line):
+    # type: (command_t, str, List[str], int) -> None
+    self.nodes.append(node)
+    self.opts_keys.append(opts_key)
+    self.lookups.append(lookups)
+    self.start_lines.append(start_line)
+
+  def NextNode(self):
+    # type: () -> Optional[command_t]
+    """Return the next node if it would be parsed the same way now.
+
+    Returns None at the end, or if the node has to be parsed again.
+    """
+    i = self.pos
+    if i == len(self.nodes):
+      return None
+
+    if self.mutable_opts.ParseOptionsKey() != self.opts_keys[i]:
+      return None
+    for name in self.lookups[i]:
+      if name in self.aliases:
+        return None
+
+    self.pos += 1
+    return self.nodes[i]
+
+  def AtEnd(self):
+    # type: () -> bool
+    return self.pos == len(self.nodes)
+
+  def Copy(self):
+    # type: () -> CachedFile
+    """Return a new position in the same nodes, e.g. for a recursive eval."""
+    c = CachedFile(self.mutable_opts, self.aliases)
+    c.nodes = self.nodes
+    c.opts_keys = self.opts_keys
+    c.lookups = self.lookups
+    c.start_lines = self.start_lines
+    return c
+
+  def ResumeLine(self):
+    # type: () -> int
+    """The line where parsing should start if NextNode() returned None."""
+    return self.start_lines[self.pos]
+
+
+class Recorder(object):
+  """Passed to main_loop.Batch() to save each node as it's parsed.
+
+  The nodes are collected in a CachedFile.  For the disk cache, they're also
+  encoded right after they're parsed, before they run.  The CachedFile keeps
+  them alive until Finish(), since the Encoder memo is keyed by identity.
+  """
+
+  def __init__(self, c_parser, parse_ctx, mutable_opts, aliases):
+    # type: (CommandParser, ParseContext, MutableOpts, Dict[str, str]) -> None
+    self.c_parser = c_parser
+    self.arena = parse_ctx.arena
+    self.parse_ctx = parse_ctx
+    self.mutable_opts = mutable_opts
+    self.aliases = aliases
+
+    self.cached = CachedFile(mutable_opts, aliases)
+    self.first_span_id = self.arena.LastSpanId()
+
+    self.ok = True  # false if the code can't be cached
+    self.complete = False  # true when EOF is reached
+
+    self.start_span_id = 0
+    self.start_line = 0
+
+    # For the disk cache
+    self.path = ''
+    self.key = ''
+    self.enc = None  # type: Optional[serialize.Encoder]
+
+  def StartEncoding(self, path, key, src, version_str):
+    # type: (str, str, source_t, str) -> None
+    self.path = path
+    self.key = key
+
+    enc = serialize.Encoder()
+    self.enc = enc
+    enc.Seed(src)  # not encoded; the loader passes it
+    enc.Str(_MAGIC)
+    enc.Str(version_str)
+    enc.Str(syntax_asdl.SERIALIZE_FINGERPRINT)
+    enc.Str(self.key)
+
+  def BeginNode(self):
+    # type: () -> None
+    # We can only resume parsing at a line boundary
+    if not self.c_parser.lexer.AtLineEnd():
+      self.ok = False
+    self.start_span_id = self.arena.LastSpanId()
+    self.start_line = self.c_parser.line_reader.line_num
+    self.parse_ctx.alias_lookups = []
+
+  def EndNode(self, node):
+    # type: (command_t) -> None
+    lookups = self.parse_ctx.alias_lookups
+    self.parse_ctx.alias_lookups = None
+    if not self.ok:
+      return
+
+    for name in lookups:
+      if name in self.aliases:  # the parse expanded an alias
+        self.ok = False
+        return
+
+    opts_key = self.mutable_opts.ParseOptionsKey()
+    self.cached.Add(node, opts_key, lookups, self.start_line)
+
+    enc = self.enc
+    if enc is None:
+      return
+
+    enc.Bool(True)  # another node follows
+    enc.Str(opts_key)
+    enc.Int(len(lookups))
+    for name in lookups:
+      enc.Str(name)
+    enc.Int(self.start_line)
+
+    # The tokens lexed for this node, so error messages can point to them
+    end_span_id = self.arena.LastSpanId()
+    enc.AddSpanRange(self.start_span_id, end_span_id)
+    enc.Int(end_span_id - self.start_span_id)
+    for span_id in xrange(self.start_span_id, end_span_id):
+      tok = self.arena.GetToken(span_id)
+      enc.Int(tok.id)
+      enc.Int(tok.col)
+      enc.Int(tok.length)
+      enc.Obj(tok.line)
+      enc.Str(tok.tval)
+
+    node.Encode(enc)
+
+  def SetComplete(self):
+    # type: () -> None
+    self.complete = True
+
+  def Result(self):
+    # type: () -> Optional[CachedFile]
+    """Returns the nodes, or None if they shouldn't be saved."""
+    self.parse_ctx.alias_lookups = None  # in case of a parse error
+    if self.ok and self.complete:
+      return self.cached
+    return None
+
+  def Finish(self):
+    # type: () -> str
+    """Returns the encoded file, or '' if it shouldn't be saved."""
+    cached = self.Result()
+    self.enc.Bool(False)  # no more nodes
+    s = self.enc.Finish()
+    if cached:
+      return s
+    return ''
+
+
+class ParseCache(object):
+
+  def __init__(self, cache_dir, version_str, parse_ctx, mutable_opts,
+               aliases):
+    # type: (str, str, ParseContext, MutableOpts, Dict[str, str]) -> None
+    self.cache_dir = cache_dir
+    self.version_str = version_str
+    self.parse_ctx = parse_ctx
+    self.arena = parse_ctx.arena
+    self.mutable_opts = mutable_opts
+    self.aliases = aliases
+
+  def _CachePath(self, path):
+    # type: (str) -> str
+    if not path.startswith('/'):
+      path = '%s/%s' % (posix.getcwd(), path)
+    return '%s/%s' % (self.cache_dir, _CacheFileName(path))
+
+  def Load(self, path, src):
+    # type: (str, source_t) -> Optional[CachedFile]
+    """Return the cached nodes of a file, or None if they're missing or stale.
+
+    Args:
+      src: The source_t of the lines, which is shared with the cache file.
+    """
+    try:
+      key = pyos.FileCacheKey(path)
+      s = pyos.ReadFile(self._CachePath(path))
+    except (IOError, OSError) as e:
+      return None
+
+    dec = serialize.Decoder(s)
+    dec.Seed(src)
+    try:
+      cached = self._Decode(dec, key)
+    except ValueError as e:  # corrupt file
+      cached = None
+    dec.Finish()
+
+    if cached:
+      # We don't know which nodes define functions, so keep the tokens in the
+      # interactive shell.  See Arena.PinSegment().
+      self.arena.PinSegment()
+    return cached
+
+  def _Decode(self, dec, key):
+    # type: (serialize.Decoder, str) -> Optional[CachedFile]
+    if (dec.Str() != _MAGIC or dec.Str() != self.version_str or
+        dec.Str() != syntax_asdl.SERIALIZE_FINGERPRINT or dec.Str() != key):
+      return None
+
+    # Tokens are added to the arena like the lexer would, but span IDs start
+    # where the arena is now.
+    dec.SetSpanBase(self.arena.LastSpanId())
+
+    cached = CachedFile(self.mutable_opts, self.aliases)
+    while dec.Bool():
+      opts_key = dec.Str()
+      lookups = []  # type: List[str]
+      n = dec.Int()
+      for _ in xrange(n):
+        lookups.append(dec.Str())
+      start_line = dec.Int()
+
+      n = dec.Int()
+      for _ in xrange(n):
+        id_ = dec.Int()
+        col = dec.Int()
+        length = dec.Int()
+        line = SourceLine.Decode(dec)
+        tval = dec.Str()
+        self.arena.NewTokenId(id_, col, length, line, tval)
+
+      node = command_t.Decode(dec)
+      cached.Add(node, opts_key, lookups, start_line)
+
+    if not dec.Done():
+      return None
+    return cached
+
+  def StartRecording(self, path, c_parser, src):
+    # type: (str, CommandParser, source_t) -> Optional[Recorder]
+    """Return a Recorder to pass to main_loop.Batch(), or None."""
+    try:
+      key = pyos.FileCacheKey(path)
+    except (IOError, OSError) as e:
+      return None
+
+    rec = Recorder(c_parser, self.parse_ctx, self.mutable_opts, self.aliases)
+    rec.StartEncoding(path, key, src, self.version_str)
+    return rec
+
+  def Save(self, rec):
+    # type: (Recorder) -> None
+    """Save a recorded file if it ran to the end.
+
+    Must be called even if Batch() raised, to release the Recorder.
+    """
+    s = rec.Finish()
+    if len(s) == 0:
+      return
+
+    try:
+      # Don't save it if the file changed while we were reading it
+      if pyos.FileCacheKey(rec.path) != rec.key:
+        return
+      pyos.WriteFileAtomic(self._CachePath(rec.path), s)
+    except (IOError, OSError) as e:
+      pass  # the cache is best effort
+
+
+class _CodeEntry(util.CacheEntry):
+
+  def __init__(self, cached, first_span_id):
+    # type: (CachedFile, int) -> None
+    util.CacheEntry.__init__(self)
+    self.cached = cached
+    self.first_span_id = first_span_id
+
+
+class CodeCache(object):
+  """An LRU cache of parsed strings, e.g. for 'eval' in a loop.
+
+  Keys are chosen by the caller, and include the code string.
+  """
+
+  def __init__(self, parse_ctx, mutable_opts, aliases, max_entries=64,
+               max_code_len=16 * 1024):
+    # type: (ParseContext, MutableOpts, Dict[str, str], int, int) -> None
+    self.parse_ctx = parse_ctx
+    self.arena = parse_ctx.arena
+    self.mutable_opts = mutable_opts
+    self.aliases = aliases
+    self.max_code_len = max_code_len
+
+    self.entries = util.LruCache(max_entries)
+
+  def Get(self, key):
+    # type: (str) -> Optional[CachedFile]
+    """Return the nodes saved for key, or None.
+
+    The caller still checks each node with NextNode().
+    """
+    e = self.entries.Get(key)
+    if e is None:
+      return None
+    entry = cast(_CodeEntry, e)
+
+    # The interactive shell releases the tokens of each command unless
+    # they're pinned.  Then locations in the nodes would be lost.
+    if (len(entry.cached.nodes) and
+        not self.arena.HasToken(entry.first_span_id)):
+      self.entries.Remove(key)
+      return None
+
+    return entry.cached.Copy()
+
+  def StartRecording(self, c_parser, code_len):
+    # type: (CommandParser, int) -> Optional[Recorder]
+    """Return a Recorder to pass to main_loop.Batch(), or None."""
+    if code_len > self.max_code_len:
+      return None  # probably not run again, e.g. eval "$(cat script.sh)"
+    return Recorder(c_parser, self.parse_ctx, self.mutable_opts, self.aliases)
+
+  def Save(self, key, rec):
+    # type: (str, Recorder) -> None
+    """Save recorded nodes if they were all parsed.
+
+    Must be called even if parsing failed, to release the Recorder.
+    """
+    cached = rec.Result()
+    if cached is None:
+      # Don't keep checking stale nodes, e.g. after an alias was defined
+      self.entries.Remove(key)
+      return
+
+    self.entries.Put(key, _CodeEntry(cached, rec.first_span_id))
@@ -0,0 +1,274 @@
+#!/usr/bin/env python2
+"""
+parse_cache_test.py: Tests for parse_cache.py
+"""
+from __future__ import print_function
+
+import os
+import shutil
+import tempfile
+import unittest
+
+from _devbuild.gen.syntax_asdl import source
+from asdl import pybase
+from core import alloc
+from core import error
+from core import main_loop
+from core import parse_cache  # module under test
+from core import state
+from core import test_lib
+from frontend import reader
+
+
+def _IsSpanIdField(name):
+  return (name in ('span_id', 'spid', 'spids') or name.endswith('_spid') or
+          name.endswith('_span_id'))
+
+
+def _SameLocation(arena1, spid1, arena2, spid2):
+  if spid1 == -1 or spid2 == -1:
+    return spid1 == spid2
+  t1 = arena1.GetToken(spid1)
+  t2 = arena2.GetToken(spid2)
+  return (t1.id == t2.id and t1.col == t2.col and t1.length == t2.length and
+          t1.line.line_num == t2.line.line_num)
+
+
+def _TreesEqual(arena1, left, arena2, right):
+  """Like test_lib.AsdlEqual, but span IDs must point to the same tokens."""
+  if left is None or right is None:
+    return left is right
+
+  if isinstance(left, (int, str, bool, pybase.SimpleObj)):
+    return left == right
+
+  if isinstance(left, list):
+    if len(left) != len(right):
+      return False
+    for a, b in zip(left, right):
+      if not _TreesEqual(arena1, a, arena2, b):
+        return False
+    return True
+
+  assert isinstance(left, pybase.CompoundObj), left
+  if type(left) != type(right):
+    return False
+
+  for name in left.__slots__:
+    a = getattr(left, name)
+    b = getattr(right, name)
+    if _IsSpanIdField(name):
+      if isinstance(a, list):
+        if len(a) != len(b):
+          return False
+        for x, y in zip(a, b):
+          if not _SameLocation(arena1, x, arena2, y):
+            return False
+      elif not _SameLocation(arena1, a, arena2, b):
+        return False
+    elif not _TreesEqual(arena1, a, arena2, b):
+      return False
+  return True
+
+
+_CODE = """\
+# comment
+f() {
+  echo "$1" ${x:-default} $(( 1 + 2 ))
+}
+x=1; echo hi
+
+cat <<EOF
+here $x
+EOF
+ls
+"""
+
+
+class ParseCacheTest(unittest.TestCase):
+
+  def setUp(self):
+    self.tmp_dir = tempfile.mkdtemp()
+    self.path = os.path.join(self.tmp_dir, 'lib.sh')
+    self.cache_dir = os.path.join(self.tmp_dir, 'cache')
+
+    with open(self.path, 'w') as f:
+      f.write(_CODE)
+
+  def tearDown(self):
+    shutil.rmtree(self.tmp_dir)
+
+  def _MakeCache(self, aliases):
+    arena = alloc.Arena()
+    mem = state.Mem('', [], arena, [])
+    parse_opts, _, mutable_opts = state.MakeOpts(mem, None)
+    parse_ctx = test_lib.InitParseContext(arena=arena, aliases=aliases,
+                                          parse_opts=parse_opts)
+    cache = parse_cache.ParseCache(self.cache_dir, '0.0.0', parse_ctx,
+                                   mutable_opts, aliases)
+    return cache, parse_ctx
+
+  def _Record(self, cache, parse_ctx, src):
+    """Like main_loop.Batch() with a recorder, but without running nodes."""
+    f = open(self.path)
+    line_reader = reader.FileLineReader(f, parse_ctx.arena)
+    c_parser = parse_ctx.MakeOshParser(line_reader)
+
+    rec = cache.StartRecording(self.path, c_parser, src)
+    nodes = []
+    while True:
+      rec.BeginNode()
+      node = c_parser.ParseLogicalLine()
+      if node is None:
+        c_parser.CheckForPendingHereDocs()
+        rec.SetComplete()
+        break
+      rec.EndNode(node)
+      nodes.append(node)
+    cache.Save(rec)
+    f.close()
+    return nodes
+
+  def testRoundTrip(self):
+    cache1, parse_ctx1 = self._MakeCache({})
+    src1 = source.SourcedFile(self.path, -1)
+    with alloc.ctx_Location(parse_ctx1.arena, src1):
+      nodes = self._Record(cache1, parse_ctx1, src1)
+    self.assertEqual(4, len(nodes))
+
+    # A new shell, where the arena already has some tokens
+    cache2, parse_ctx2 = self._MakeCache({})
+    arena2 = parse_ctx2.arena
+    arena2.PushSource(source.MainFile('main.sh'))
+    line = arena2.AddLine('echo', 1)
+    arena2.NewTokenId(0, 0, 4, line, 'echo')
+
+    src2 = source.SourcedFile(self.path, -1)
+    cached = cache2.Load(self.path, src2)
+    self.assertNotEqual(None, cached)
+
+    for node in nodes:
+      loaded = cached.NextNode()
+      self.assertTrue(
+          _TreesEqual(parse_ctx1.arena, node, arena2, loaded),
+          'Expected %s, got %s' % (node, loaded))
+    self.assertEqual(None, cached.NextNode())
+    self.assertTrue(cached.AtEnd())
+
+    # Lines point to the source passed in
+    tok = arena2.GetToken(arena2.LastSpanId() - 1)
+    self.assertEqual(src2, tok.line.src)
+
+  def testInvalidation(self):
+    aliases = {}
+    cache, parse_ctx = self._MakeCache(aliases)
+    src = source.SourcedFile(self.path, -1)
+    with alloc.ctx_Location(parse_ctx.arena, src):
+      self._Record(cache, parse_ctx, src)
+
+    # 'ls' on line 10 would be parsed differently now
+    aliases['ls'] = 'ls --color'
+    cached = cache.Load(self.path, src)
+    for i in xrange(3):
+      self.assertNotEqual(None, cached.NextNode())
+    self.assertEqual(None, cached.NextNode())
+    self.assertFalse(cached.AtEnd())
+    self.assertEqual(10, cached.ResumeLine())
+
+    # A parse option changed
+    cached = cache.Load(self.path, src)
+    cache.mutable_opts.SetAnyOption('parse_paren', True)
+    self.assertEqual(None, cached.NextNode())
+    self.assertEqual(1, cached.ResumeLine())
+
+    # The file changed
+    with open(self.path, 'a') as f:
+      f.write('echo more\n')
+    self.assertEqual(None, cache.Load(self.path, src))
+
+  def testAliasExpansionNotSaved(self):
+    cache, parse_ctx = self._MakeCache({'ls': 'ls --color'})
+    src = source.SourcedFile(self.path, -1)
+    with alloc.ctx_Location(parse_ctx.arena, src):
+      self._Record(cache, parse_ctx, src)
+    self.assertEqual(None, cache.Load(self.path, src))
+
+
+class CodeCacheTest(unittest.TestCase):
+
+  def _MakeCache(self, aliases, max_entries):
+    arena = alloc.Arena()
+    arena.PushSource(source.MainFile('main.sh'))
+    mem = state.Mem('', [], arena, [])
+    parse_opts, _, mutable_opts = state.MakeOpts(mem, None)
+    parse_ctx = test_lib.InitParseContext(arena=arena, aliases=aliases,
+                                          parse_opts=parse_opts)
+    cache = parse_cache.CodeCache(parse_ctx, mutable_opts, aliases,
+                                  max_entries=max_entries)
+    return cache, parse_ctx
+
+  def _Parse(self, cache, parse_ctx, code_str):
+    line_reader = reader.StringLineReader(code_str, parse_ctx.arena)
+    c_parser = parse_ctx.MakeOshParser(line_reader)
+    rec = cache.StartRecording(c_parser, len(code_str))
+    try:
+      node = main_loop.ParseWholeFile(c_parser, recorder=rec)
+    finally:
+      if rec:
+        cache.Save(code_str, rec)  # like Trap._ParseTrapCode()
+    return node
+
+  def testLru(self):
+    cache, parse_ctx = self._MakeCache({}, 2)
+    self.assertEqual(None, cache.Get('echo a'))
+
+    a = self._Parse(cache, parse_ctx, 'echo a')
+    self._Parse(cache, parse_ctx, 'echo b')
+
+    cached = cache.Get('echo a')
+    self.assertEqual(a, cached.NextNode())
+    self.assertEqual(None, cached.NextNode())
+
+    # A copy is returned each time
+    self.assertEqual(a, cache.Get('echo a').NextNode())
+
+    # 'echo b' is the least recently used
+    self._Parse(cache, parse_ctx, 'echo c')
+    self.assertNotEqual(None, cache.Get('echo a'))
+    self.assertEqual(None, cache.Get('echo b'))
+    self.assertNotEqual(None, cache.Get('echo c'))
+
+    # Too long
+    cache.max_code_len = 3
+    self._Parse(cache, parse_ctx, 'echo d')
+    self.assertEqual(None, cache.Get('echo d'))
+
+  def testInvalidation(self):
+    aliases = {}
+    cache, parse_ctx = self._MakeCache(aliases, 10)
+    self._Parse(cache, parse_ctx, 'll; echo')
+
+    aliases['ll'] = 'ls -l'
+    self.assertEqual(None, cache.Get('ll; echo').NextNode())
+
+    # Not saved when an alias is expanded
+    self._Parse(cache, parse_ctx, 'll; echo')
+    self.assertEqual(None, cache.Get('ll; echo'))
+
+    # Or when the code doesn't parse
+    try:
+      self._Parse(cache, parse_ctx, 'if true')
+    except error.Parse:
+      pass
+    self.assertEqual(None, cache.Get('if true'))
+    self.assertEqual(None, parse_ctx.alias_lookups)
+
+    # The interactive shell released the tokens
+    parse_ctx.arena.StartSegment()
+    self._Parse(cache, parse_ctx, 'echo x')
+    parse_ctx.arena.StartSegment()
+    self.assertEqual(None, cache.Get('echo x'))
+
+
+if __name__ == '__main__':
+  unittest.main()
@@ -69,6 +69,10 @@ NO_FD = -1
 # bookkeeping), and dash/zsh (10) and mksh (24)
 _SHELL_MIN_FD = 100
 
+# Here doc bodies up to this size are written directly to a pipe.  Pipes hold
+# at least one page, even when the kernel limits their size.
+_HERE_DOC_PIPE_MAX = 4096
+
 # Style for 'jobs' builtin
 STYLE_DEFAULT = 0
 STYLE_LONG = 1
@@ -93,7 +97,6 @@ class _FdFrame(object):
   def __init__(self):
     # type: () -> None
     self.saved = []  # type: List[_RedirFrame]
-    self.need_wait = []  # type: List[Process]
 
   def Forget(self):
     # type: () -> None
@@ -103,7 +106,6 @@ class _FdFrame(object):
         posix.close(rf.saved_fd)
 
     del self.saved[:]  # like list.clear() in Python 3.3
-    del self.need_wait[:]
 
   def __repr__(self):
     # type: () -> str
@@ -116,20 +118,16 @@ class FdState(object):
   For example, you can do 'myfunc > out.txt' without forking.  Child processes
   inherit our state.
   """
-  def __init__(self, errfmt, job_state, mem, tracer, waiter):
-    # type: (ErrorFormatter, JobState, Mem, Optional[dev.Tracer], Optional[Waiter]) -> None
+  def __init__(self, errfmt, mem):
+    # type: (ErrorFormatter, Mem) -> None
     """
     Args:
       errfmt: for errors
-      job_state: For keeping track of _HereDocWriterThunk
     """
     self.errfmt = errfmt
-    self.job_state = job_state
     self.cur_frame = _FdFrame()  # for the top level
     self.stack = [self.cur_frame]
     self.mem = mem
-    self.tracer = tracer
-    self.waiter = waiter
 
   def Open(self, path):
     # type: (str) -> mylib.LineReader
@@ -185,6 +183,10 @@ class FdState(object):
     # type: (int) -> bool
     """Save fd to a new location and remember to restore it later."""
     #log('---- _PushSave %s', fd)
+    if fd == 1:
+      # Write what builtins batched to the old stdout before replacing it
+      pyos.FlushStdout()
+
     ok = True
     try:
       new_fd = SaveFd(fd)
@@ -291,10 +293,6 @@ class FdState(object):
     # type: (int) -> None
     self.cur_frame.saved.append(_RedirFrame(NO_FD, fd, False))
 
-  def _PushWait(self, proc):
-    # type: (Process) -> None
-    self.cur_frame.need_wait.append(proc)
-
   def _ApplyRedirect(self, r):
     # type: (redirect) -> None
     arg = r.arg
@@ -379,37 +377,23 @@ class FdState(object):
       elif case(redirect_arg_e.HereDoc):
         arg = cast(redirect_arg__HereDoc, UP_arg)
 
-        # NOTE: Do these descriptors have to be moved out of the range 0-9?
-        read_fd, write_fd = posix.pipe()
-
-        self._PushDup(read_fd, r.loc)  # stdin is now the pipe
-
-        # We can't close like we do in the filename case above?  The writer can
-        # get a "broken pipe".
-        self._PushClose(read_fd)
-
-        thunk = _HereDocWriterThunk(write_fd, arg.body)
-
-        # TODO: Use PIPE_SIZE to save a process in the case of small here docs,
-        # which are the common case.  (dash does this.)
-        start_process = True
-        #start_process = False
-
-        if start_process:
-          here_proc = Process(thunk, self.job_state, self.tracer)
-
-          # NOTE: we could close the read pipe here, but it doesn't really
-          # matter because we control the code.
-          here_proc.Start(trace.HereDoc())
-          #log('Started %s as %d', here_proc, pid)
-          self._PushWait(here_proc)
-
-          # Now that we've started the child, close it in the parent.
-          posix.close(write_fd)
-
-        else:
+        # No process is started to write the body, unlike in earlier versions.
+        if len(arg.body) <= _HERE_DOC_PIPE_MAX:
+          # Common case: the body fits in the pipe buffer, so writing it all
+          # can't block.  (dash does this.)
+          read_fd, write_fd = posix.pipe()
           posix.write(write_fd, arg.body)
           posix.close(write_fd)
+        else:
+          # Write it to an anonymous file, and read it from the start, like
+          # bash 5.1.  (Other shells use temp files for all here docs.)
+          read_fd = pyos.OpenAnonymousFile()
+          posix.write(read_fd, arg.body)
+          pyos.Rewind(read_fd)
+
+        # NOTE: Do these descriptors have to be moved out of the range 0-9?
+        self._PushDup(read_fd, r.loc)  # stdin is now the pipe or file
+        self._PushClose(read_fd)
 
   def Push(self, redirects):
     # type: (List[redirect]) -> bool
@@ -446,10 +430,31 @@ class FdState(object):
     self._PushDup(r, redir_loc.Fd(0))
     return True
 
+  def PushStdout(self, w):
+    # type: (int) -> bool
+    """Save the current stdout and make it go to descriptor 'w'.
+
+    For a pipeline stage that runs in this process, e.g. 'echo' in
+
+    echo foo | read line; echo $line
+    """
+    new_frame = _FdFrame()
+    self.stack.append(new_frame)
+    self.cur_frame = new_frame
+
+    self._PushDup(w, redir_loc.Fd(1))
+    return True
+
   def Pop(self):
     # type: () -> None
     frame = self.stack.pop()
     #log('< Pop %s', frame)
+    for rf in frame.saved:
+      if rf.orig_fd == 1:
+        # The caller reports errors, e.g. for 'echo hi >/dev/full'
+        pyos.FlushStdout()
+        break
+
     for rf in reversed(frame.saved):
       if rf.saved_fd == NO_FD:
         #log('Close %d', orig)
@@ -469,10 +474,6 @@ class FdState(object):
         posix.close(rf.saved_fd)
         #log('dup2 %s %s', saved, orig)
 
-    # Wait for here doc processes to finish.
-    for proc in frame.need_wait:
-      unused_status = proc.Wait(self.waiter)
-
   def MakePermanent(self):
     # type: () -> None
     self.cur_frame.Forget()
@@ -587,6 +588,7 @@ class ExternalProgram(object):
         finally:  # TODO: use context manager
           f.close()
 
+    pyos.FlushStdout()  # the new program can't write our batch
     try:
       posix.execve(argv0_path, argv, environ)
     except OSError as e:
@@ -730,36 +732,36 @@ class SubProgramThunk(Thunk):
     posix._exit(status)
 
 
-class _HereDocWriterThunk(Thunk):
-  """Write a here doc to one end of a pipe.
+class StageOutputThunk(Thunk):
+  """Write the output of a pipeline stage that already ran in the shell
+  process.
 
-  May be be executed in either a child process or the main shell process.
+  Used when the output is more than a pipe holds.  Like the stage in its own
+  process, it blocks on the pipe, and gets SIGPIPE if the reader exits early.
+  See ShellExecutor.RunPipeline().
   """
-  def __init__(self, w, body_str):
-    # type: (int, str) -> None
-    self.w = w
-    self.body_str = body_str
+
+  def __init__(self, fd, status, node):
+    # type: (int, int, command_t) -> None
+    self.fd = fd  # the output, rewound
+    self.status = status  # of the stage
+    self.node = node
 
   def UserString(self):
     # type: () -> str
-
-    # You can hit Ctrl-Z and the here doc writer will be suspended!  Other
-    # shells don't have this problem because they use temp files!  That's a bit
-    # unfortunate.
-    return '[here doc writer]'
+    return '[subprog] %s' % ui.CommandType(self.node)
 
   def Run(self):
     # type: () -> None
-    """
-    do_exit: For small pipelines
-    """
-    #log('Writing %r', self.body_str)
-    posix.write(self.w, self.body_str)
-    #log('Wrote %r', self.body_str)
-    posix.close(self.w)
-    #log('Closed %d', self.w)
+    chunks = []  # type: List[str]
+    while True:
+      n, _ = pyos.Read(self.fd, 65536, chunks)
+      if n <= 0:
+        break
+      posix.write(1, chunks[0])
+      del chunks[:]
 
-    posix._exit(0)
+    posix._exit(self.status)
 
 
 class Job(object):
@@ -885,6 +887,10 @@ class Process(Job):
     #
     # The whole job control mechanism is complicated and hacky.
 
+    # Otherwise output that builtins batched would be written by both
+    # processes, or after the child's output.
+    pyos.FlushStdout()
+
     pid = posix.fork()
     if pid < 0:
       # When does this happen?
@@ -993,6 +999,22 @@ class ctx_Pipe(object):
     self.fd_state.Pop()
 
 
+class ctx_Stdout(object):
+
+  def __init__(self, fd_state, fd):
+    # type: (FdState, int) -> None
+    fd_state.PushStdout(fd)
+    self.fd_state = fd_state
+
+  def __enter__(self):
+    # type: () -> None
+    pass
+
+  def __exit__(self, type, value, traceback):
+    # type: (Any, Any, Any) -> None
+    self.fd_state.Pop()
+
+
 class Pipeline(Job):
   """A pipeline of processes to run.
 
@@ -1464,6 +1486,10 @@ class Waiter(object):
     | Done(int pid, int status)  -- process done
     | EINTR(bool sigint)         -- may or may not retry
     """
+    # Our output comes before that of processes we wait for, e.g. for
+    # 'echo 1; { sleep 0.1; echo 2; } & wait'
+    pyos.FlushStdout()
+
     pid, status = pyos.WaitPid()
     if pid < 0:  # error case
       err_num = status
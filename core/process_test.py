@@ -56,7 +56,7 @@ class ProcessTest(unittest.TestCase):
     self.tracer = dev.Tracer(None, exec_opts, mutable_opts, mem, mylib.Stderr())
     self.waiter = process.Waiter(self.job_state, exec_opts, trap_state, self.tracer)
     errfmt = ui.ErrorFormatter(self.arena)
-    self.fd_state = process.FdState(errfmt, self.job_state, None, self.tracer, None)
+    self.fd_state = process.FdState(errfmt, None)
     self.ext_prog = process.ExternalProgram('', self.fd_state, errfmt,
                                             util.NullDebugFile())
 
@@ -5,12 +5,14 @@ Like py{error,util}.py, it won't be translated to C++.
 """
 from __future__ import print_function
 
-from errno import EINTR
+from errno import EINTR, EEXIST
+import os
 import pwd
 import resource
 import signal
 import select
 import sys
+import tempfile
 import termios  # for read -n
 import time
 
@@ -31,9 +33,17 @@ NEWLINE_CH = 10  # ord('\n')
 
 
 def FlushStdout():
-  # type: () -> None
-  """Flush CPython buffers."""
-  sys.stdout.flush()
+  # type: () -> int
+  """Flush CPython buffers.
+
+  Return 0 for success, or an error code.  Builtins that write to a full
+  disk, e.g. 'echo hi >/dev/full', turn it into a status.
+  """
+  try:
+    sys.stdout.flush()
+  except IOError as e:
+    return e.errno
+  return 0
 
 
 def WaitPid():
@@ -44,6 +54,8 @@ def WaitPid():
     # - WUNTRACED is necessary to get stopped jobs.  What about WCONTINUED?
     # - We don't retry on EINTR, because the 'wait' builtin should be
     #   interruptable.
+    # - The C++ version blocks in poll() on a self-pipe instead, so a signal
+    #   can't be lost between checking for it and blocking.
     pid, status = posix.waitpid(-1, WUNTRACED)
   except OSError as e:
     return -1, e.errno
@@ -84,6 +96,57 @@ def Read(fd, n, chunks):
     return length, 0
 
 
+def DrainPipe(fd):
+  # type: (int) -> Tuple[str, int]
+  """
+  Read from fd until EOF into a single string, and strip trailing newlines.
+  Used for command subs.
+
+  The C++ version grows one buffer geometrically instead of building a list of
+  chunks, so large outputs aren't copied several times.
+
+  Returns:
+    ('', errno) on failure
+    (output, 0) on success.  EINTR is retried.
+  """
+  chunks = []  # type: List[str]
+  while True:
+    n, err_num = Read(fd, 4096, chunks)
+    if n < 0:
+      if err_num == EINTR:
+        continue  # retry
+      return '', err_num
+    if n == 0:  # EOF
+      break
+  return ''.join(chunks).rstrip('\n'), 0
+
+
+def OpenAnonymousFile():
+  # type: () -> int
+  """
+  Return a read-write descriptor for a file with no name, e.g. to buffer the
+  output of a builtin that runs in the shell process.
+
+  The C++ version uses memfd_create(), so the data never touches the disk.
+  """
+  f = tempfile.TemporaryFile()
+  fd = os.dup(f.fileno())
+  f.close()
+  return fd
+
+
+def Rewind(fd):
+  # type: (int) -> None
+  """Seek to the beginning of a file, so what was written can be read."""
+  os.lseek(fd, 0, os.SEEK_SET)
+
+
+def NumUnread(fd):
+  # type: (int) -> int
+  """Return the number of bytes in a file after its current offset."""
+  return os.fstat(fd).st_size - os.lseek(fd, 0, os.SEEK_CUR)
+
+
 def ReadByte(fd):
   # type: (int) -> Tuple[int, int]
   """
@@ -275,9 +338,10 @@ def OsType():
 def InputAvailable(fd):
   # type: (int) -> bool
   # similar to lib/sh/input_avail.c in bash
-  # read, write, except
-  r, w, exc = select.select([fd], [], [fd], 0)
-  return len(r) != 0
+  # poll() rather than select(), which can't handle fd >= FD_SETSIZE
+  p = select.poll()
+  p.register(fd, select.POLLIN)
+  return len(p.poll(0)) != 0
 
 
 UNTRAPPED_SIGWINCH = -1
@@ -390,3 +454,65 @@ def MakeDirCacheKey(path):
   """
   st = posix.stat(path)
   return (path, int(st.st_mtime))
+
+
+def FileCacheKey(path):
+  # type: (str) -> str
+  """
+  Returns a string that changes when the file is modified or replaced, for
+  caches of file contents, e.g. core/parse_cache.py.
+
+  Raises OSError.
+  """
+  st = os.stat(path)
+  # The C++ version has nanosecond precision.  CPython's float st_mtime
+  # doesn't, but the key only has to be stable within one binary.
+  return '%d %d %d %.9f' % (st.st_dev, st.st_ino, st.st_size, st.st_mtime)
+
+
+def ReadFile(path):
+  # type: (str) -> str
+  """Read a whole file.  Raises OSError."""
+  fd = os.open(path, os.O_RDONLY, 0)
+  try:
+    chunks = []  # type: List[str]
+    while True:
+      chunk = os.read(fd, 64 * 1024)
+      if len(chunk) == 0:
+        break
+      chunks.append(chunk)
+  finally:
+    os.close(fd)
+  return ''.join(chunks)
+
+
+def WriteFileAtomic(path, contents):
+  # type: (str, str) -> None
+  """
+  Write a file by renaming a temp file over it, so concurrent readers see
+  either the old or new contents.  The parent directory is created if it
+  doesn't exist, but not its ancestors.
+
+  Raises OSError.
+  """
+  dir_name = os.path.dirname(path)
+  if len(dir_name):
+    try:
+      os.mkdir(dir_name, 0o755)
+    except OSError as e:
+      if e.errno != EEXIST:
+        raise
+
+  tmp = '%s.%d.tmp' % (path, os.getpid())
+  fd = os.open(tmp, os.O_WRONLY | os.O_CREAT | os.O_TRUNC, 0o644)
+  try:
+    pos = 0
+    while pos < len(contents):
+      pos += os.write(fd, contents[pos:])
+  finally:
+    os.close(fd)
+  try:
+    os.rename(tmp, path)
+  except OSError:
+    os.unlink(tmp)
+    raise
@@ -19,6 +19,7 @@ from core import error
 from core import executor
 from core import completion
 from core import main_loop
+from core import parse_cache
 from core import pyos
 from core import process
 from core import shell_native
@@ -303,7 +304,7 @@ def Main(lang, arg_r, environ, login_shell, loader, readline):
   cmd_deps.mutable_opts = mutable_opts
 
   job_state = process.JobState()
-  fd_state = process.FdState(errfmt, job_state, mem, None, None)
+  fd_state = process.FdState(errfmt, mem)
 
   my_pid = posix.getpid()
 
@@ -332,13 +333,11 @@ def Main(lang, arg_r, environ, login_shell, loader, readline):
   else:
     trace_f = util.DebugFile(mylib.Stderr())
   tracer = dev.Tracer(parse_ctx, exec_opts, mutable_opts, mem, trace_f)
-  fd_state.tracer = tracer  # circular dep
 
   signal_safe = pyos.InitSignalSafe()
   trap_state = builtin_trap.TrapState(signal_safe)
 
   waiter = process.Waiter(job_state, exec_opts, signal_safe, tracer)
-  fd_state.waiter = waiter
 
   cmd_deps.debug_f = debug_f
 
@@ -452,16 +451,26 @@ def Main(lang, arg_r, environ, login_shell, loader, readline):
                                                      unsafe_arith, errfmt)
   builtins[builtin_i.unset] = builtin_assign.Unset(mem, procs, unsafe_arith,
                                                    errfmt)
+  # Parses of 'eval', 'trap', and $PROMPT_COMMAND code that's run repeatedly
+  code_cache = parse_cache.CodeCache(parse_ctx, mutable_opts, aliases)
+
   builtins[builtin_i.eval] = builtin_meta.Eval(parse_ctx, exec_opts, cmd_ev,
-                                               tracer, errfmt)
+                                               tracer, errfmt, code_cache)
   builtins[builtin_i.read] = builtin_misc.Read(splitter, mem, parse_ctx,
                                                cmd_ev, errfmt)
   mapfile = builtin_misc.MapFile(mem, errfmt, cmd_ev)
   builtins[builtin_i.mapfile] = mapfile
   builtins[builtin_i.readarray] = mapfile
 
+  # Opt-in cache of parsed sourced files.  See core/parse_cache.py.
+  parse_cache_dir = environ.get('OSH_PARSE_CACHE_DIR')
+  cache = None  # type: Optional[parse_cache.ParseCache]
+  if parse_cache_dir is not None:
+    cache = parse_cache.ParseCache(parse_cache_dir, version_str, parse_ctx,
+                                   mutable_opts, aliases)
+
   source_builtin = builtin_meta.Source(parse_ctx, search_path, cmd_ev,
-                                       fd_state, tracer, errfmt)
+                                       fd_state, tracer, errfmt, cache)
   builtins[builtin_i.source] = source_builtin
   builtins[builtin_i.dot] = source_builtin
 
@@ -481,7 +490,8 @@ def Main(lang, arg_r, environ, login_shell, loader, readline):
   if mylib.PYTHON:
     builtins[builtin_i.json] = builtin_oil.Json(mem, expr_ev, errfmt)
 
-  builtins[builtin_i.trap] = builtin_trap.Trap(trap_state, parse_ctx, tracer, errfmt)
+  builtins[builtin_i.trap] = builtin_trap.Trap(trap_state, parse_ctx, tracer, errfmt,
+                                               code_cache)
 
   # History evaluation is a no-op if readline is None.
   hist_ev = history.Evaluator(readline, hist_ctx, debug_f)
@@ -635,7 +645,8 @@ def Main(lang, arg_r, environ, login_shell, loader, readline):
     assert line_reader is not None
     line_reader.Reset()  # After sourcing startup file, render $PS1
 
-    prompt_plugin = prompt.UserPlugin(mem, parse_ctx, cmd_ev, errfmt)
+    prompt_plugin = prompt.UserPlugin(mem, parse_ctx, cmd_ev, errfmt,
+                                      code_cache)
     try:
       status = main_loop.Interactive(flag, cmd_ev, c_parser, display,
                                      prompt_plugin, errfmt)
@@ -678,5 +689,12 @@ def Main(lang, arg_r, environ, login_shell, loader, readline):
     cmd_ev.MaybeRunExitTrap(box)
     status = box[0]
 
+    # Builtins batch their output, so a write error may only show up now.
+    err_num = pyos.FlushStdout()
+    if err_num != 0:
+      print_stderr('osh: write error: %s' % posix.strerror(err_num))
+      if status == 0:
+        status = 1
+
   # NOTE: We haven't closed the file opened with fd_state.Open
   return status
@@ -33,6 +33,7 @@ from frontend import location
 from frontend import match
 from mycpp import mylib
 from mycpp.mylib import print_stderr, tagswitch, iteritems, NewDict
+from osh import sh_array
 from osh import split
 from pylib import os_path
 from pylib import path_stat
@@ -610,6 +611,17 @@ class MutableOpts(object):
     else:
       return overlay[-1]  # the top value
 
+  def ParseOptionsKey(self):
+    # type: () -> str
+    """Return a string that's equal for option states that parse the same.
+
+    e.g. for the parse cache.
+    """
+    chars = []  # type: List[str]
+    for opt_num in consts.PARSE_OPTION_NUMS:
+      chars.append('1' if self.Get(opt_num) else '0')
+    return ''.join(chars)
+
   def _Set(self, opt_num, b):
     # type: (int, bool) -> None
     """Used to disable errexit.  For bash compatibility in command sub."""
@@ -830,13 +842,49 @@ class MutableOpts(object):
       print('shopt -%s %s' % ('s' if b else 'u', consts.OptionName(opt_num)))
 
 
+class _Binding(object):
+  """The cells bound to one name, one per frame, from the outermost frame in.
+
+  Mem keeps a _Binding for every name it has seen (shallow binding), so
+  looking up a variable with dynamic scope takes one dict lookup rather than
+  one per frame.
+  """
+
+  def __init__(self):
+    # type: () -> None
+    self.cells = []  # type: List[cell]
+    self.frames = []  # type: List[int]  # indices into Mem.var_stack, sorted
+
+  def Find(self, frame_i):
+    # type: (int) -> Optional[cell]
+    """Return the cell bound in the given frame, or None."""
+    k = len(self.frames) - 1
+    while k >= 0:
+      f = self.frames[k]
+      if f == frame_i:
+        return self.cells[k]
+      if f < frame_i:
+        break
+      k -= 1
+    return None
+
+
 class _ArgFrame(object):
-  """Stack frame for arguments array."""
+  """Stack frame for arguments array.
 
-  def __init__(self, argv):
-    # type: (List[str]) -> None
+  The positional params are a view of argv starting at num_shifted, so
+  neither a function call nor 'shift' copies them.  argv is never mutated,
+  and may be shared with the caller.
+  """
+
+  def __init__(self, argv, num_shifted):
+    # type: (List[str], int) -> None
     self.argv = argv
-    self.num_shifted = 0
+    self.num_shifted = num_shifted
+
+    # The list that GetArgv() returns.  It's computed when "$@" is first
+    # expanded, and shared until the next shift or set --.
+    self.view = None  # type: Optional[List[str]]
 
   def __repr__(self):
     # type: () -> str
@@ -860,16 +908,30 @@ class _ArgFrame(object):
 
   def GetArgv(self):
     # type: () -> List[str]
-    return self.argv[self.num_shifted : ]
+    if self.view is None:
+      if self.num_shifted == 0:
+        self.view = self.argv
+      else:
+        self.view = self.argv[self.num_shifted : ]
+    return self.view
 
   def GetNumArgs(self):
     # type: () -> int
     return len(self.argv) - self.num_shifted
 
+  def Shift(self, n):
+    # type: (int) -> bool
+    if self.num_shifted + n > len(self.argv):
+      return False
+    self.num_shifted += n
+    self.view = None
+    return True
+
   def SetArgv(self, argv):
     # type: (List[str]) -> None
     self.argv = argv
     self.num_shifted = 0
+    self.view = None
 
 
 if mylib.PYTHON:
@@ -905,6 +967,8 @@ if mylib.PYTHON:
           val = cast(value__MaybeStrArray, cell.val)
           cell_json['type'] = 'MaybeStrArray'
           cell_json['value'] = val.strs
+          if val.indices is not None:
+            cell_json['indices'] = val.indices
 
         elif case(value_e.AssocArray):
           val = cast(value__AssocArray, cell.val)
@@ -1251,10 +1315,13 @@ class Mem(object):
     self.unsafe_arith = None  # type: sh_expr_eval.UnsafeArith
 
     self.dollar0 = dollar0
-    self.argv_stack = [_ArgFrame(argv)]
+    self.argv_stack = [_ArgFrame(argv, 0)]
     frame = NewDict()  # type: Dict[str, cell]
     self.var_stack = [frame]
 
+    # Every cell in var_stack is also in bindings.  See _Bind() and _Unbind().
+    self.bindings = NewDict()  # type: Dict[str, _Binding]
+
     self.arena = arena
 
     # The debug_stack isn't strictly necessary for execution.  We use it for
@@ -1289,6 +1356,12 @@ class Mem(object):
 
     self.last_bg_pid = -1  # Uninitialized value mutable public variable
 
+    # s+=x writes into this buffer, which has spare capacity, instead of
+    # copying the string.  While it's set, append_cell.val is stale.  See
+    # AppendString() and _FinishAppend().
+    self.append_cell = None  # type: Optional[cell]
+    self.append_buf = None  # type: Optional[mylib.BufWriter]
+
   def __repr__(self):
     # type: () -> str
     parts = []  # type: List[str]
@@ -1314,6 +1387,7 @@ class Mem(object):
     # type: () -> Tuple[Any, Any, Any]
     """Copy state before unwinding the stack."""
     if mylib.PYTHON:
+      self._FinishAppend()
       var_stack = [_DumpVarFrame(frame) for frame in self.var_stack]
       argv_stack = [frame.Dump() for frame in self.argv_stack]
       debug_stack = []  # type: List[Dict[str, Any]]
@@ -1407,8 +1481,12 @@ class Mem(object):
 
   def PushCall(self, func_name, def_spid, argv):
     # type: (str, int, List[str]) -> None
-    """For function calls."""
-    self.argv_stack.append(_ArgFrame(argv))
+    """For function calls.
+
+    Like a command's argv, argv[0] is the name of the function, and isn't one
+    of the positional params.
+    """
+    self.argv_stack.append(_ArgFrame(argv, 1))
     frame = NewDict()  # type: Dict[str, cell]
     self.var_stack.append(frame)
 
@@ -1421,14 +1499,14 @@ class Mem(object):
   def PopCall(self):
     # type: () -> None
     self._PopDebugStack()
-    self.var_stack.pop()
+    self._PopFrame()
     self.argv_stack.pop()
 
   def PushSource(self, source_name, argv):
     # type: (str, List[str]) -> None
     """For 'source foo.sh 1 2 3."""
     if len(argv):
-      self.argv_stack.append(_ArgFrame(argv))
+      self.argv_stack.append(_ArgFrame(argv, 0))
     # Match bash's behavior for ${FUNCNAME[@]}.  But it would be nicer to add
     # the name of the script here?
     self._PushDebugStack(source_name, None, source_name)
@@ -1453,11 +1531,12 @@ class Mem(object):
   def PopTemp(self):
     # type: () -> None
     self._PopDebugStack()
-    self.var_stack.pop()
+    self._PopFrame()
 
   def TopNamespace(self):
     # type: () -> Dict[str, runtime_asdl.cell]
     """For eval_to_dict()."""
+    self._FinishAppend()  # the caller reads cell.val
     return self.var_stack[-1]
 
   def _PushDebugStack(self, bash_source, func_name, source_name):
@@ -1485,11 +1564,7 @@ class Mem(object):
 
   def Shift(self, n):
     # type: (int) -> int
-    frame = self.argv_stack[-1]
-    num_args = len(frame.argv)
-
-    if (frame.num_shifted + n) <= num_args:
-      frame.num_shifted += n
+    if self.argv_stack[-1].Shift(n):
       return 0  # success
     else:
       return 1  # silent error
@@ -1508,7 +1583,7 @@ class Mem(object):
 
   def GetArgv(self):
     # type: () -> List[str]
-    """For $* and $@."""
+    """For $* and $@.  The caller must not modify the result."""
     return self.argv_stack[-1].GetArgv()
 
   def SetArgv(self, argv):
@@ -1547,62 +1622,137 @@ class Mem(object):
   # Named Vars
   #
 
+  def _PopFrame(self):
+    # type: () -> None
+    frame = self.var_stack.pop()
+    for name, cell in iteritems(frame):
+      if cell is self.append_cell:  # local s; s+=x; return
+        self._FinishAppend()
+      binding = self.bindings[name]
+      binding.cells.pop()  # the innermost binding is in this frame
+      binding.frames.pop()
+
+  def _Bind(self, frame_i, name, cell):
+    # type: (int, str, cell) -> None
+    """Set var_stack[frame_i][name] = cell, and update self.bindings."""
+    self.var_stack[frame_i][name] = cell
+
+    binding = self.bindings.get(name)
+    if binding is None:
+      binding = _Binding()
+      self.bindings[name] = binding
+
+    frames = binding.frames
+    cells = binding.cells
+
+    # Usually the binding is in the innermost frame, so k == n
+    n = len(frames)
+    k = n
+    while k > 0 and frames[k - 1] >= frame_i:
+      k -= 1
+
+    if k < n and frames[k] == frame_i:
+      cells[k] = cell  # replace
+      return
+
+    frames.append(frame_i)
+    cells.append(cell)
+    i = n
+    while i > k:
+      frames[i] = frames[i - 1]
+      cells[i] = cells[i - 1]
+      i -= 1
+    frames[k] = frame_i
+    cells[k] = cell
+
+  def _Unbind(self, frame_i, name):
+    # type: (int, str) -> None
+    """Remove name from var_stack[frame_i] and self.bindings."""
+    mylib.dict_erase(self.var_stack[frame_i], name)
+
+    binding = self.bindings[name]
+    k = len(binding.frames) - 1
+    while k >= 0:
+      if binding.frames[k] == frame_i:
+        binding.frames.pop(k)
+        binding.cells.pop(k)
+        break
+      k -= 1
+
   def _ResolveNameOnly(self, name, which_scopes):
-    # type: (str, scope_t) -> Tuple[Optional[cell], Dict[str, cell]]
+    # type: (str, scope_t) -> Tuple[Optional[cell], int]
     """Helper for getting and setting variable.
 
+    Like _LookupCell(), but the cell's value is current, even if s+=x was
+    appending to it.
+    """
+    cell, frame_i = self._LookupCell(name, which_scopes)
+    if cell is not None and cell is self.append_cell:
+      self._FinishAppend()
+    return cell, frame_i
+
+  def _LookupCell(self, name, which_scopes):
+    # type: (str, scope_t) -> Tuple[Optional[cell], int]
+    """Find the cell for a name, without resolving namerefs.
+
     Returns:
       cell: The cell corresponding to looking up 'name' with the given mode, or
         None if it's not found.
-      name_map: The name_map it should be set to or deleted from.
+      frame_i: The index of the frame in var_stack it should be set in or
+        deleted from.  Pass it to _Bind() and _Unbind(), so they don't search
+        for it.
     """
+    no_cell = None  # type: Optional[runtime_asdl.cell]
+    binding = self.bindings.get(name)
+    top = len(self.var_stack) - 1
+
     if which_scopes == scope_e.Dynamic:
-      for i in xrange(len(self.var_stack) - 1, -1, -1):
-        name_map = self.var_stack[i]
-        if name in name_map:
-          cell = name_map[name]
-          return cell, name_map
-      no_cell = None  # type: Optional[runtime_asdl.cell]
-      return no_cell, self.var_stack[0]  # set in global name_map
+      if binding and len(binding.cells):
+        return binding.cells[-1], binding.frames[-1]
+      return no_cell, 0  # set in global frame
 
     if which_scopes == scope_e.LocalOnly:
-      name_map = self.var_stack[-1]
-      return name_map.get(name), name_map
+      if binding:
+        return binding.Find(top), top
+      return no_cell, top
 
     if which_scopes == scope_e.GlobalOnly:
-      name_map = self.var_stack[0]
-      return name_map.get(name), name_map
+      if binding and len(binding.frames) and binding.frames[0] == 0:
+        return binding.cells[0], 0
+      return no_cell, 0
 
     if which_scopes == scope_e.LocalOrGlobal:
-      # Local
-      name_map = self.var_stack[-1]
-      cell = name_map.get(name)
-      if cell:
-        return cell, name_map
+      if binding:
+        # Local
+        cell = binding.Find(top)
+        if cell:
+          return cell, top
 
-      # Global
-      name_map = self.var_stack[0]
-      return name_map.get(name), name_map
+        # Global
+        if len(binding.frames) and binding.frames[0] == 0:
+          return binding.cells[0], 0
+      return no_cell, 0
 
     if which_scopes == scope_e.Parent:
       assert len(self.var_stack) >= 2
-      name_map = self.var_stack[-2]
-      return name_map.get(name), name_map
+      if binding:
+        return binding.Find(top - 1), top - 1
+      return no_cell, top - 1
 
     raise AssertionError()
 
   def _ResolveNameOrRef(self, name, which_scopes, is_setref, ref_trail=None):
-    # type: (str, scope_t, bool, Optional[List[str]]) -> Tuple[Optional[cell], Dict[str, cell], str]
+    # type: (str, scope_t, bool, Optional[List[str]]) -> Tuple[Optional[cell], int, str]
     """Look up a cell and namespace, but respect the nameref flag.
 
     Resolving namerefs does RECURSIVE calls.
     """
-    cell, name_map = self._ResolveNameOnly(name, which_scopes)
+    cell, frame_i = self._ResolveNameOnly(name, which_scopes)
 
     if cell is None or not cell.nameref:
       if is_setref:
         e_die("setref requires a nameref (:out param)")
-      return cell, name_map, name  # not a nameref
+      return cell, frame_i, name  # not a nameref
 
     val = cell.val
     UP_val = val
@@ -1614,7 +1764,7 @@ class Mem(object):
         if self.exec_opts.strict_nameref():
           e_die('nameref %r is undefined' % name)
         else:
-          return cell, name_map, name  # fallback
+          return cell, frame_i, name  # fallback
 
       elif case(value_e.Str):
         val = cast(value__Str, UP_val)
@@ -1634,7 +1784,7 @@ class Mem(object):
         # Bash has this odd behavior of clearing the nameref bit when
         # ref=#invalid#.  strict_nameref avoids it.
         cell.nameref = False
-        return cell, name_map, name  # fallback
+        return cell, frame_i, name  # fallback
 
     # Check for circular namerefs.
     if ref_trail is None:
@@ -1647,9 +1797,9 @@ class Mem(object):
     # 'declare -n' uses dynamic scope.  'setref' uses parent scope to avoid the
     # problem of 2 procs containing the same variable name.
     which_scopes = scope_e.Parent if is_setref else scope_e.Dynamic
-    cell, name_map, cell_name = self._ResolveNameOrRef(new_name, which_scopes,
-                                                       False, ref_trail=ref_trail)
-    return cell, name_map, cell_name
+    cell, frame_i, cell_name = self._ResolveNameOrRef(new_name, which_scopes,
+                                                      False, ref_trail=ref_trail)
+    return cell, frame_i, cell_name
 
   def IsAssocArray(self, name):
     # type: (str) -> bool
@@ -1708,7 +1858,7 @@ class Mem(object):
 
         if flags & SetNameref or flags & ClearNameref:
           # declare -n ref=x  # refers to the ref itself
-          cell, name_map = self._ResolveNameOnly(lval.name, which_scopes)
+          cell, frame_i = self._ResolveNameOnly(lval.name, which_scopes)
           cell_name = lval.name
         else:
           # ref=x  # mutates THROUGH the reference
@@ -1719,9 +1869,9 @@ class Mem(object):
           #    braced_var_sub
           # 3. Turn braced_var_sub into an lvalue, and call
           #    self.unsafe_arith.SetValue() wrapper with ref_trail
-          cell, name_map, cell_name = self._ResolveNameOrRef(lval.name,
-                                                             which_scopes,
-                                                             is_setref)
+          cell, frame_i, cell_name = self._ResolveNameOrRef(lval.name,
+                                                            which_scopes,
+                                                            is_setref)
 
         if cell:
           # Clear before checking readonly bit.
@@ -1759,7 +1909,7 @@ class Mem(object):
                                    bool(flags & SetReadOnly),
                                    bool(flags & SetNameref),
                                    val)
-          name_map[cell_name] = cell
+          self._Bind(frame_i, cell_name, cell)
 
         # Maintain invariant that only strings and undefined cells can be
         # exported.
@@ -1792,10 +1942,10 @@ class Mem(object):
         # bash/mksh have annoying behavior of letting you do LHS assignment to
         # Undef, which then turns into an INDEXED array.  (Undef means that set
         # -o nounset fails.)
-        cell, name_map, _ = self._ResolveNameOrRef(lval.name, which_scopes,
-                                                   is_setref)
+        cell, frame_i, _ = self._ResolveNameOrRef(lval.name, which_scopes,
+                                                  is_setref)
         if not cell:
-          self._BindNewArrayWithEntry(name_map, lval, rval, flags)
+          self._BindNewArrayWithEntry(frame_i, lval, rval, flags)
           return
 
         if cell.readonly:
@@ -1805,7 +1955,7 @@ class Mem(object):
         # undef[0]=y is allowed
         with tagswitch(UP_cell_val) as case2:
           if case2(value_e.Undef):
-            self._BindNewArrayWithEntry(name_map, lval, rval, flags)
+            self._BindNewArrayWithEntry(frame_i, lval, rval, flags)
             return
 
           elif case2(value_e.Str):
@@ -1815,25 +1965,9 @@ class Mem(object):
 
           elif case2(value_e.MaybeStrArray):
             cell_val = cast(value__MaybeStrArray, UP_cell_val)
-            strs = cell_val.strs
-
-            n = len(strs)
-            index = lval.index
-            if index < 0:  # a[-1]++ computes this twice; could we avoid it?
-              index += n
-
-            if 0 <= index and index < n:
-              strs[index] = rval.s
-            else:
-              # Fill it in with None.  It could look like this:
-              # ['1', 2, 3, None, None, '4', None]
-              # Then ${#a[@]} counts the entries that are not None.
-              #
-              # TODO: strict_array for Oil arrays won't auto-fill.
-              n = index - len(strs) + 1
-              for i in xrange(n):
-                strs.append(None)
-              strs[lval.index] = rval.s
+            if not sh_array.SetItem(cell_val, lval.index, rval.s):
+              e_die("Index %d is out of bounds" % lval.index,
+                    loc.Span(left_spid))
             return
 
         # This could be an object, eggex object, etc.  It won't be
@@ -1851,8 +1985,8 @@ class Mem(object):
 
         left_spid = lval.blame_spid
 
-        cell, name_map, _ = self._ResolveNameOrRef(lval.name, which_scopes,
-                                                   is_setref)
+        cell, _, _ = self._ResolveNameOrRef(lval.name, which_scopes,
+                                            is_setref)
         if cell.readonly:
           e_die("Can't assign to readonly associative array", loc.Span(left_spid))
 
@@ -1865,17 +1999,15 @@ class Mem(object):
       else:
         raise AssertionError(lval.tag_())
 
-  def _BindNewArrayWithEntry(self, name_map, lval, val, flags):
-    # type: (Dict[str, cell], lvalue__Indexed, value__Str, int) -> None
-    """Fill 'name_map' with a new indexed array entry."""
-    no_str = None  # type: Optional[str]
-    items = [no_str] * lval.index
-    items.append(val.s)
-    new_value = value.MaybeStrArray(items)
+  def _BindNewArrayWithEntry(self, frame_i, lval, val, flags):
+    # type: (int, lvalue__Indexed, value__Str, int) -> None
+    """Bind a new indexed array entry in var_stack[frame_i]."""
+    new_value = sh_array.New(lval.index, val.s)
 
     # arrays can't be exported; can't have AssocArray flag
     readonly = bool(flags & SetReadOnly)
-    name_map[lval.name] = runtime_asdl.cell(False, readonly, False, new_value)
+    self._Bind(frame_i, lval.name,
+               runtime_asdl.cell(False, readonly, False, new_value))
 
   def InternalSetGlobal(self, name, new_val):
     # type: (str, value_t) -> None
@@ -1890,6 +2022,8 @@ class Mem(object):
     Use case: SHELLOPTS.
     """
     cell = self.var_stack[0][name]
+    if cell is self.append_cell:
+      self._FinishAppend()
     cell.val = new_val
 
   def GetValue(self, name, which_scopes=scope_e.Shopt):
@@ -1913,9 +2047,12 @@ class Mem(object):
 
     if name == 'ARGV':
       # TODO:
-      # - Reuse the MaybeStrArray?
       # - @@ could be an alias for ARGV (in command mode, but not expr mode)
-      return value.MaybeStrArray(self.GetArgv())
+
+      # Copy it, because a value can be mutated, e.g. by 'append'
+      strs = []  # type: List[str]
+      strs.extend(self.GetArgv())
+      return value.MaybeStrArray(strs, None)
 
     # "Registers"
     if name == '_status':
@@ -1937,15 +2074,15 @@ class Mem(object):
 
     if name in ('PIPESTATUS', '_pipeline_status'):
       pipe_strs = [str(i) for i in self.pipe_status[-1]] # type: List[str]
-      return value.MaybeStrArray(pipe_strs)
+      return value.MaybeStrArray(pipe_strs, None)
 
     if name == '_process_sub_status':  # Oil naming convention
       # TODO: Shouldn't these be real integers?
       sub_strs = [str(i) for i in self.process_sub_status[-1]] # type: List[str]
-      return value.MaybeStrArray(sub_strs)
+      return value.MaybeStrArray(sub_strs, None)
 
     if name == 'BASH_REMATCH':
-      return value.MaybeStrArray(self.regex_matches[-1])  # top of stack
+      return value.MaybeStrArray(self.regex_matches[-1], None)  # top of stack
 
     # Do lookup of system globals before looking at user variables.  Note: we
     # could optimize this at compile-time like $?.  That would break
@@ -1960,7 +2097,7 @@ class Mem(object):
         if frame.source_name is not None:
           strs.append('source')  # bash doesn't tell you the filename.
         # Temp stacks are ignored
-      return value.MaybeStrArray(strs)  # TODO: Reuse this object too?
+      return value.MaybeStrArray(strs, None)  # TODO: Reuse this object too?
 
     # This isn't the call source, it's the source of the function DEFINITION
     # (or the sourced # file itself).
@@ -1969,7 +2106,7 @@ class Mem(object):
       for frame in reversed(self.debug_stack):
         if frame.bash_source is not None:
           strs.append(frame.bash_source)
-      return value.MaybeStrArray(strs)  # TODO: Reuse this object too?
+      return value.MaybeStrArray(strs, None)  # TODO: Reuse this object too?
 
     # This is how bash source SHOULD be defined, but it's not!
     if 0:
@@ -1985,7 +2122,7 @@ class Mem(object):
           span = self.arena.GetToken(frame.call_spid)
           source_str = ui.GetLineSourceString(self.arena, span.line_id)
           strs.append(source_str)
-        return value.MaybeStrArray(strs)  # TODO: Reuse this object too?
+        return value.MaybeStrArray(strs, None)  # TODO: Reuse this object too?
 
     if name == 'BASH_LINENO':
       strs = []
@@ -1999,7 +2136,7 @@ class Mem(object):
         token = self.arena.GetToken(frame.call_spid)
         line_num = token.line.line_num
         strs.append(str(line_num))
-      return value.MaybeStrArray(strs)  # TODO: Reuse this object too?
+      return value.MaybeStrArray(strs, None)  # TODO: Reuse this object too?
 
     if name == 'LINENO':
       assert self.current_spid != -1, self.current_spid
@@ -2042,6 +2179,82 @@ class Mem(object):
     cell, _ = self._ResolveNameOnly(name, which_scopes)
     return cell
 
+  def _CellToAppend(self, name, tag, which_scopes):
+    # type: (str, int, scope_t) -> Optional[cell]
+    """Return the cell that s+=x or a+=(x) can mutate, or None.
+
+    This doesn't call _ResolveNameOnly(), so that appending to a string
+    doesn't finish it.
+    """
+    cell, _ = self._LookupCell(name, which_scopes)
+    if cell is None or cell.readonly or cell.nameref:
+      return None
+    if cell.val.tag_() != tag:
+      return None
+
+    # In a proc, s+=x reads a global s but creates a local one
+    read_scopes = self.ScopesForReading()
+    if which_scopes != read_scopes:
+      read_cell, _ = self._LookupCell(name, read_scopes)
+      if read_cell is not cell:
+        return None
+
+    return cell
+
+  def AppendString(self, name, s, which_scopes):
+    # type: (str, str, scope_t) -> bool
+    """Implement s+=x without copying s.
+
+    The first append copies s into a BufWriter, and later ones write to its
+    spare capacity, so appending in a loop is amortized O(1).  Any lookup of
+    the cell, or a walk over the frames, finishes the string first.  A read
+    between appends costs one copy of s, like the read itself.
+
+    Returns:
+      False if the caller should use PlusEquals() and SetValue() instead, e.g.
+      because the variable isn't a string.
+    """
+    cell = self._CellToAppend(name, value_e.Str, which_scopes)
+    if cell is None:
+      return False
+
+    if cell is not self.append_cell:
+      self._FinishAppend()
+      val = cast(value__Str, cell.val)
+      self.append_buf = mylib.BufWriter()
+      self.append_buf.write(val.s)
+      self.append_cell = cell
+
+    self.append_buf.write(s)
+    return True
+
+  def _FinishAppend(self):
+    # type: () -> None
+    """Store the string that AppendString() built in its cell.
+
+    In C++, BufWriter.getvalue() hands over its buffer without copying it.
+    """
+    if self.append_cell is None:
+      return
+    self.append_cell.val = value.Str(self.append_buf.getvalue())
+    self.append_cell = None
+    self.append_buf = None
+
+  def AppendArray(self, name, strs, which_scopes):
+    # type: (str, List[str], scope_t) -> bool
+    """Implement a+=(x y) by extending the existing list.
+
+    Like a[i]=x, this mutates the value in the cell.  Returns False if the
+    caller should use PlusEquals() and SetValue() instead.
+    """
+    cell = self._CellToAppend(name, value_e.MaybeStrArray, which_scopes)
+    if cell is None:
+      return False
+
+    val = cast(value__MaybeStrArray, cell.val)
+    sh_array.Append(val, strs)
+    return True
+
   def Unset(self, lval, which_scopes):
     # type: (lvalue_t, scope_t) -> bool
     """
@@ -2067,7 +2280,7 @@ class Mem(object):
     if which_scopes == scope_e.Shopt:
       which_scopes = self.ScopesForWriting()
 
-    cell, name_map, cell_name = self._ResolveNameOrRef(var_name, which_scopes, False)
+    cell, frame_i, cell_name = self._ResolveNameOrRef(var_name, which_scopes, False)
     if not cell:
       return False  # 'unset' builtin falls back on functions
     if cell.readonly:
@@ -2077,7 +2290,7 @@ class Mem(object):
       if case(lvalue_e.Named):  # unset x
         # Make variables in higher scopes visible.
         # example: test/spec.sh builtin-vars -r 24 (ble.sh)
-        mylib.dict_erase(name_map, cell_name)
+        self._Unbind(frame_i, cell_name)
 
         # alternative that some shells use:
         #   name_map[cell_name].val = value.Undef()
@@ -2097,27 +2310,7 @@ class Mem(object):
           raise error.Runtime("%r isn't an array" % var_name)
 
         val = cast(value__MaybeStrArray, UP_val)
-        strs = val.strs
-
-        n = len(strs)
-        last_index = n - 1
-        index = lval.index
-        if index < 0:
-          index += n
-
-        if index == last_index:
-          # Special case: The array SHORTENS if you unset from the end.  You
-          # can tell with a+=(3 4)
-          strs.pop()
-        elif 0 <= index and index < last_index:
-          strs[index] = None
-        else:
-          # If it's not found, it's not an error.  In other words, 'unset'
-          # ensures that a value doesn't exist, regardless of whether it
-          # existed.  It's idempotent.
-          # (Ousterhout specifically argues that the strict behavior was a
-          # mistake for Tcl!)
-          pass
+        sh_array.UnsetItem(val, lval.index)
 
       elif case(lvalue_e.Keyed):  # unset 'A["K"]'
         lval = cast(lvalue__Keyed, UP_lval)
@@ -2160,7 +2353,7 @@ class Mem(object):
     We don't use SetValue() because even if rval is None, it will make an Undef
     value in a scope.
     """
-    cell, name_map = self._ResolveNameOnly(name, self.ScopesForReading())
+    cell, _ = self._ResolveNameOnly(name, self.ScopesForReading())
     if cell:
       if flag & ClearExport:
         cell.exported = False
@@ -2178,6 +2371,7 @@ class Mem(object):
     # - If an exported variable is changed.
     # - If the set of exported variables changes.
 
+    self._FinishAppend()
     exported = {}  # type: Dict[str, str]
     # Search from globals up.  Names higher on the stack will overwrite names
     # lower on the stack.
@@ -2217,6 +2411,7 @@ class Mem(object):
   def GetAllVars(self):
     # type: () -> Dict[str, str]
     """Get all variables and their values, for 'set' builtin. """
+    self._FinishAppend()
     result = {}  # type: Dict[str, str]
     for scope in self.var_stack:
       for name, cell in iteritems(scope):
@@ -2230,6 +2425,7 @@ class Mem(object):
   def GetAllCells(self, which_scopes):
     # type: (scope_t) -> Dict[str, cell]
     """Get all variables and their values, for 'set' builtin. """
+    self._FinishAppend()
     result = {}  # type: Dict[str, cell]
 
     if which_scopes == scope_e.Dynamic:
@@ -2324,7 +2520,7 @@ def BuiltinSetArray(mem, name, a):
   Used by compadjust, read -a, etc.
   """
   assert isinstance(a, list)
-  BuiltinSetValue(mem, location.LName(name), value.MaybeStrArray(a))
+  BuiltinSetValue(mem, location.LName(name), value.MaybeStrArray(a, None))
 
 
 def SetGlobalString(mem, name, s):
@@ -2339,7 +2535,8 @@ def SetGlobalArray(mem, name, a):
   # type: (Mem, str, List[str]) -> None
   """Used by completion, shell initialization, etc."""
   assert isinstance(a, list)
-  mem.SetValue(location.LName(name), value.MaybeStrArray(a), scope_e.GlobalOnly)
+  mem.SetValue(location.LName(name), value.MaybeStrArray(a, None),
+               scope_e.GlobalOnly)
 
 
 def ExportGlobalString(mem, name, s):
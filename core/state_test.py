@@ -33,7 +33,7 @@ class MemTest(unittest.TestCase):
 
   def testGet(self):
     mem = _InitMem()
-    mem.PushCall('my-func', 0, ['a', 'b'])
+    mem.PushCall('my-func', 0, ['my-func', 'a', 'b'])
     print(mem.GetValue('HOME'))
     mem.PopCall()
     print(mem.GetValue('NONEXISTENT'))
@@ -92,11 +92,49 @@ class MemTest(unittest.TestCase):
     self.assertEqual(1, len(mem.var_stack))
     self.assertEqual('1', mem.var_stack[-1]['x'].val.s)
 
+  def testShallowBinding(self):
+    mem = _InitMem()
+
+    def _Get(name, which_scopes):
+      val = mem.GetValue(name, which_scopes)
+      return val.s if val.tag_() == value_e.Str else None
+
+    mem.SetValue(location.LName('x'), value.Str('g'), scope_e.GlobalOnly)
+    mem.PushCall('f', 0, ['f'])
+    mem.SetValue(location.LName('x'), value.Str('f'), scope_e.LocalOnly)
+    mem.PushCall('g', 0, ['g'])
+
+    self.assertEqual('f', _Get('x', scope_e.Dynamic))
+    self.assertEqual(None, _Get('x', scope_e.LocalOnly))
+    self.assertEqual('g', _Get('x', scope_e.GlobalOnly))
+    self.assertEqual('g', _Get('x', scope_e.LocalOrGlobal))
+    self.assertEqual('f', _Get('x', scope_e.Parent))
+
+    # A new global doesn't hide the local in f
+    mem.SetValue(location.LName('y'), value.Str('f'), scope_e.Parent)
+    mem.SetValue(location.LName('y'), value.Str('g'), scope_e.GlobalOnly)
+    self.assertEqual('f', _Get('y', scope_e.Dynamic))
+
+    # unset x makes the global visible
+    mem.Unset(location.LName('x'), scope_e.Dynamic)
+    self.assertEqual('g', _Get('x', scope_e.Dynamic))
+
+    mem.SetValue(location.LName('x'), value.Str('h'), scope_e.LocalOnly)
+    self.assertEqual('h', _Get('x', scope_e.Dynamic))
+
+    mem.PopCall()
+    self.assertEqual('g', _Get('x', scope_e.Dynamic))
+    self.assertEqual('f', _Get('y', scope_e.Dynamic))
+
+    mem.PopCall()
+    self.assertEqual('g', _Get('x', scope_e.Dynamic))
+    self.assertEqual('g', _Get('y', scope_e.Dynamic))
+
   def testSetVarClearFlag(self):
     mem = _InitMem()
     print(mem)
 
-    mem.PushCall('my-func', 0, ['ONE'])
+    mem.PushCall('my-func', 0, ['my-func', 'ONE'])
     self.assertEqual(2, len(mem.var_stack))  # internal details
 
     # local x=y
@@ -105,7 +143,7 @@ class MemTest(unittest.TestCase):
     self.assertEqual('y', mem.var_stack[-1]['x'].val.s)
 
     # New frame
-    mem.PushCall('my-func', 0, ['TWO'])
+    mem.PushCall('my-func', 0, ['my-func', 'TWO'])
     self.assertEqual(3, len(mem.var_stack))  # internal details
 
     # x=y -- test out dynamic scope
@@ -164,7 +202,7 @@ class MemTest(unittest.TestCase):
     # COMPREPLY=(1 2 3)
     # invariant to enforce: arrays can't be exported
     mem.SetValue(
-        location.LName('COMPREPLY'), value.MaybeStrArray(['1', '2', '3']),
+        location.LName('COMPREPLY'), value.MaybeStrArray(['1', '2', '3'], None),
         scope_e.GlobalOnly)
     self.assertEqual(
         ['1', '2', '3'], mem.var_stack[0]['COMPREPLY'].val.strs)
@@ -222,7 +260,8 @@ class MemTest(unittest.TestCase):
     # a[1]=(x y z)  # illegal but doesn't parse anyway
     if 0:
       try:
-        mem.SetValue(lhs, value.MaybeStrArray(['x', 'y', 'z']), scope_e.Dynamic)
+        mem.SetValue(lhs, value.MaybeStrArray(['x', 'y', 'z'], None),
+                     scope_e.Dynamic)
       except error.FatalRuntime as e:
         pass
       else:
@@ -272,6 +311,70 @@ class MemTest(unittest.TestCase):
     e = mem.GetExported()
     self.assertEqual('u', e['U'])
 
+  def testAppendString(self):
+    mem = _InitMem()
+
+    # s+=x on an undefined variable isn't done in place
+    self.assertEqual(
+        False, mem.AppendString('s', 'x', scope_e.Dynamic))
+
+    mem.SetValue(location.LName('s'), value.Str('a'), scope_e.Dynamic)
+    self.assertEqual(True, mem.AppendString('s', 'b', scope_e.Dynamic))
+    self.assertEqual(True, mem.AppendString('s', 'c', scope_e.Dynamic))
+
+    val = mem.GetValue('s', scope_e.Dynamic)
+    test_lib.AssertAsdlEqual(self, value.Str('abc'), val)
+
+    # Appending after a read doesn't change the value that was read
+    self.assertEqual(True, mem.AppendString('s', 'd', scope_e.Dynamic))
+    test_lib.AssertAsdlEqual(self, value.Str('abc'), val)
+    val = mem.GetValue('s', scope_e.Dynamic)
+    test_lib.AssertAsdlEqual(self, value.Str('abcd'), val)
+
+    # export sees the whole string
+    mem.SetValue(
+        location.LName('s'), None, scope_e.Dynamic, flags=state.SetExport)
+    self.assertEqual(True, mem.AppendString('s', 'e', scope_e.Dynamic))
+    self.assertEqual('abcde', mem.GetExported()['s'])
+
+    # Appending to another variable finishes the first one
+    mem.SetValue(location.LName('t'), value.Str(''), scope_e.Dynamic)
+    self.assertEqual(True, mem.AppendString('s', 'f', scope_e.Dynamic))
+    self.assertEqual(True, mem.AppendString('t', 'g', scope_e.Dynamic))
+    self.assertEqual(True, mem.AppendString('t', 'h', scope_e.Dynamic))
+    self.assertEqual('abcdef', mem.GetAllVars()['s'])
+    self.assertEqual('gh', mem.GetAllVars()['t'])
+
+    # Assigning replaces what was appended
+    self.assertEqual(True, mem.AppendString('t', 'i', scope_e.Dynamic))
+    mem.SetValue(location.LName('t'), value.Str('z'), scope_e.Dynamic)
+    self.assertEqual(True, mem.AppendString('t', 'y', scope_e.Dynamic))
+    val = mem.GetValue('t', scope_e.Dynamic)
+    test_lib.AssertAsdlEqual(self, value.Str('zy'), val)
+
+    mem.SetValue(
+        location.LName('r'), value.Str('x'), scope_e.Dynamic,
+        flags=state.SetReadOnly)
+    self.assertEqual(False, mem.AppendString('r', 'y', scope_e.Dynamic))
+
+  def testAppendArray(self):
+    mem = _InitMem()
+
+    self.assertEqual(
+        False, mem.AppendArray('a', ['x'], scope_e.Dynamic))
+
+    mem.SetValue(
+        location.LName('a'), value.MaybeStrArray(['x'], None), scope_e.Dynamic)
+    self.assertEqual(True, mem.AppendArray('a', ['y', 'z'], scope_e.Dynamic))
+
+    val = mem.GetValue('a', scope_e.Dynamic)
+    test_lib.AssertAsdlEqual(
+        self, value.MaybeStrArray(['x', 'y', 'z'], None), val)
+
+    # Can't append an array to a string
+    mem.SetValue(location.LName('s'), value.Str('s'), scope_e.Dynamic)
+    self.assertEqual(False, mem.AppendArray('s', ['y'], scope_e.Dynamic))
+
   def testUnset(self):
     mem = _InitMem()
     # unset a
@@ -284,12 +387,16 @@ class MemTest(unittest.TestCase):
 
   def testArgv(self):
     mem = _InitMem()
-    mem.PushCall('my-func', 0, ['a', 'b'])
+    mem.PushCall('my-func', 0, ['my-func', 'a', 'b'])
     self.assertEqual(['a', 'b'], mem.GetArgv())
 
-    mem.PushCall('my-func', 0, ['x', 'y'])
+    mem.PushCall('my-func', 0, ['my-func', 'x', 'y'])
     self.assertEqual(['x', 'y'], mem.GetArgv())
 
+    # "$@" is computed once per shift
+    argv = mem.GetArgv()
+    self.assertIs(argv, mem.GetArgv())
+
     status = mem.Shift(1)
     self.assertEqual(['y'], mem.GetArgv())
     self.assertEqual(0, status)
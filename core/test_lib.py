@@ -65,7 +65,8 @@ def PrintableString(s):
 
 def TokensEqual(left, right):
   # Ignoring location in CompoundObj.__eq__ now, but we might want this later.
-  return left.id == right.id and left.tval == right.tval
+  return (left.id == right.id and
+          lexer.TokenVal(left) == lexer.TokenVal(right))
   #return left == right
 
 
@@ -184,7 +185,7 @@ def InitCommandEvaluator(
 
   errfmt = ui.ErrorFormatter(arena)
   job_state = process.JobState()
-  fd_state = process.FdState(errfmt, job_state, None, None, None)
+  fd_state = process.FdState(errfmt, None)
   aliases = {} if aliases is None else aliases
   procs = {}
 
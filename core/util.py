@@ -11,7 +11,9 @@ util.py - Common infrastructure.
 from __future__ import print_function
 
 from mycpp import mylib
-from typing import Any
+from mycpp.mylib import iteritems
+
+from typing import Any, Dict, Optional
 
 
 class UserExit(Exception):
@@ -35,6 +37,60 @@ class HistoryError(Exception):
     return 'history: %s' % self.msg
 
 
+class CacheEntry(object):
+  """Base class for values in an LruCache."""
+
+  def __init__(self):
+    # type: () -> None
+    self.last_used = 0
+
+
+class LruCache(object):
+  """A small cache keyed by strings, which evicts the least recently used entry.
+
+  Callers subclass CacheEntry, and cast() what Get() returns.  Eviction scans
+  every entry, so keep max_entries small.
+  """
+
+  def __init__(self, max_entries):
+    # type: (int) -> None
+    self.max_entries = max_entries
+    self.entries = {}  # type: Dict[str, CacheEntry]
+    self.clock = 0
+
+  def Get(self, key):
+    # type: (str) -> Optional[CacheEntry]
+    entry = self.entries.get(key)
+    if entry is not None:
+      self.clock += 1
+      entry.last_used = self.clock
+    return entry
+
+  def Put(self, key, entry):
+    # type: (str, CacheEntry) -> None
+    if key not in self.entries and len(self.entries) >= self.max_entries:
+      self._EvictOne()
+    self.clock += 1
+    entry.last_used = self.clock
+    self.entries[key] = entry
+
+  def Remove(self, key):
+    # type: (str) -> None
+    if key in self.entries:
+      mylib.dict_erase(self.entries, key)
+
+  def _EvictOne(self):
+    # type: () -> None
+    lru_key = None  # type: Optional[str]
+    lru_time = -1
+    for key, entry in iteritems(self.entries):
+      if lru_key is None or entry.last_used < lru_time:
+        lru_key = key
+        lru_time = entry.last_used
+    if lru_key is not None:
+      mylib.dict_erase(self.entries, lru_key)
+
+
 class _DebugFile(object):
 
   def __init__(self):
@@ -20,6 +20,27 @@ class UtilTest(unittest.TestCase):
     n = util.NullDebugFile()
     n.write('foo')
 
+  def testLruCache(self):
+    cache = util.LruCache(2)
+    a = util.CacheEntry()
+    cache.Put('a', a)
+    cache.Put('b', util.CacheEntry())
+    self.assertEqual(a, cache.Get('a'))
+
+    # 'b' is the least recently used
+    cache.Put('c', util.CacheEntry())
+    self.assertEqual(a, cache.Get('a'))
+    self.assertEqual(None, cache.Get('b'))
+    self.assertEqual(2, len(cache.entries))
+
+    # Replacing an entry doesn't evict another one
+    cache.Put('c', util.CacheEntry())
+    self.assertEqual(a, cache.Get('a'))
+
+    cache.Remove('a')
+    cache.Remove('a')
+    self.assertEqual(None, cache.Get('a'))
+
 
 if __name__ == '__main__':
   unittest.main()
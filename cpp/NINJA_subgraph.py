@@ -71,6 +71,20 @@ def NinjaGraph(ru):
       ],
   )
 
+  ru.cc_library(
+      '//cpp/asdl_serialize',
+      srcs = ['cpp/asdl_serialize.cc'],
+      deps = ['//mycpp/runtime'],
+  )
+
+  ru.cc_binary(
+      'cpp/asdl_serialize_test.cc',
+      deps = [
+        '//cpp/asdl_serialize',
+        '//frontend/syntax.asdl',
+        ],
+      matrix = ninja_lib.COMPILERS_VARIANTS)
+
   ru.cc_library(
       '//cpp/frontend_pyreadline', 
       srcs = [
@@ -138,6 +152,8 @@ def NinjaGraph(ru):
         'cpp/osh_tdop.cc',
         ],
       deps = [
+        '//core/runtime.asdl',
+        '//frontend/consts',
         '//frontend/syntax.asdl', 
         '//cpp/core', 
         '//mycpp/runtime', 
@@ -158,8 +174,14 @@ def NinjaGraph(ru):
       deps = [
         '//mycpp/runtime',
         '//frontend/syntax.asdl',
+        '//oil_lang/grammar',
         ])
 
+  ru.cc_binary(
+      'cpp/pgen2_test.cc',
+      deps = ['//cpp/pgen2'],
+      matrix = ninja_lib.COMPILERS_VARIANTS)
+
   ru.cc_library(
       '//cpp/pylib', 
       srcs = ['cpp/pylib.cc'],
@@ -71,6 +71,8 @@ unit() {
 
     run-one-test     cpp/osh_test '' $variant
 
+    run-one-test     cpp/pgen2_test '' $variant
+
     run-one-test     cpp/pylib_test '' $variant
 
     run-one-test     cpp/stdlib_test '' $variant
@@ -105,6 +107,8 @@ coverage() {
 
   run-one-test     cpp/osh_test $compiler $variant
 
+  run-one-test     cpp/pgen2_test $compiler $variant
+
   run-one-test     cpp/pylib_test $compiler $variant
 
   run-one-test     cpp/stdlib_test $compiler $variant
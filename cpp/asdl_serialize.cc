@@ -0,0 +1,185 @@
+// asdl_serialize.cc: Replacement for asdl/serialize.py
+
+#include "cpp/asdl_serialize.h"
+
+#include <algorithm>  // std::upper_bound
+
+namespace serialize {
+
+static const int kNoSpid = -1;  // runtime::NO_SPID
+
+Encoder::Encoder()
+    : GC_CLASS_FIXED(header_, kZeroMask, sizeof(Encoder)),
+      buf_(new std::string()),
+      memo_(new std::unordered_map<void*, int>()),
+      span_ranges_(new std::vector<SpanRange>()),
+      num_objs_(0),
+      num_spans_(0) {
+}
+
+void Encoder::Seed(void* obj) {
+  (*memo_)[obj] = num_objs_++;
+}
+
+void Encoder::AddSpanRange(int start, int end) {
+  span_ranges_->push_back({start, end, num_spans_});
+  num_spans_ += end - start;
+}
+
+void Encoder::Int(int i) {
+  // zigzag, then varint
+  uint64_t z = i >= 0 ? static_cast<uint64_t>(i) * 2
+                      : static_cast<uint64_t>(-(i + 1)) * 2 + 1;
+  while (z >= 0x80) {
+    buf_->push_back(static_cast<char>((z & 0x7f) | 0x80));
+    z >>= 7;
+  }
+  buf_->push_back(static_cast<char>(z));
+}
+
+void Encoder::Bool(bool b) {
+  buf_->push_back(b ? '\1' : '\0');
+}
+
+void Encoder::Str(::Str* s) {
+  if (s == nullptr) {
+    Int(-1);
+  } else {
+    Int(len(s));
+    buf_->append(s->data_, len(s));
+  }
+}
+
+void Encoder::SpanId(int span_id) {
+  // Find the last range starting at or before span_id
+  auto it = std::upper_bound(
+      span_ranges_->begin(), span_ranges_->end(), span_id,
+      [](int id, const SpanRange& r) { return id < r.start; });
+  if (it != span_ranges_->begin()) {
+    --it;
+    if (span_id < it->end) {
+      Int(it->offset + span_id - it->start);
+      return;
+    }
+  }
+  Int(kNoSpid);
+}
+
+void Encoder::Null() {
+  Int(0);
+}
+
+bool Encoder::Begin(void* obj, int tag) {
+  auto it = memo_->find(obj);
+  if (it != memo_->end()) {
+    Int(it->second * 2 + 1);
+    return false;
+  }
+  Int(tag * 2);
+  return true;
+}
+
+void Encoder::End(void* obj) {
+  (*memo_)[obj] = num_objs_++;
+}
+
+::Str* Encoder::Finish() {
+  ::Str* result = StrFromC(buf_->data(), buf_->size());
+
+  delete buf_;
+  delete memo_;
+  delete span_ranges_;
+  buf_ = nullptr;
+  memo_ = nullptr;
+  span_ranges_ = nullptr;
+
+  return result;
+}
+
+Decoder::Decoder(::Str* s)
+    : GC_CLASS_FIXED(header_, field_mask(), sizeof(Decoder)),
+      s_(s),
+      pos_(0),
+      span_base_(0),
+      ref_(nullptr),
+      objs_(new std::vector<void*>()) {
+}
+
+void Decoder::Seed(void* obj) {
+  objs_->push_back(obj);
+}
+
+int Decoder::Int() {
+  const unsigned char* data = reinterpret_cast<unsigned char*>(s_->data_);
+  int n = len(s_);
+  uint64_t z = 0;
+  int shift = 0;
+  while (true) {
+    if (pos_ >= n || shift > 63) {
+      throw Alloc<ValueError>();
+    }
+    unsigned char b = data[pos_++];
+    z |= static_cast<uint64_t>(b & 0x7f) << shift;
+    if (b < 0x80) {
+      break;
+    }
+    shift += 7;
+  }
+  return (z & 1) ? -static_cast<int>(z >> 1) - 1 : static_cast<int>(z >> 1);
+}
+
+bool Decoder::Bool() {
+  if (pos_ >= len(s_)) {
+    throw Alloc<ValueError>();
+  }
+  return s_->data_[pos_++] != '\0';
+}
+
+::Str* Decoder::Str() {
+  int n = Int();
+  if (n < 0) {
+    return nullptr;
+  }
+  if (n > len(s_) - pos_) {
+    throw Alloc<ValueError>();
+  }
+  ::Str* result = StrFromC(s_->data_ + pos_, n);
+  pos_ += n;
+  return result;
+}
+
+int Decoder::SpanId() {
+  int i = Int();
+  if (i == kNoSpid) {
+    return i;
+  }
+  return span_base_ + i;
+}
+
+int Decoder::Begin() {
+  int h = Int();
+  if (h & 1) {
+    int index = h >> 1;
+    if (index < 0 || index >= static_cast<int>(objs_->size())) {
+      throw Alloc<ValueError>();
+    }
+    ref_ = (*objs_)[index];
+    return 0;
+  }
+  if (h == 0) {
+    ref_ = nullptr;
+  }
+  return h >> 1;
+}
+
+void Decoder::End(void* obj) {
+  objs_->push_back(obj);
+}
+
+void Decoder::Finish() {
+  delete objs_;
+  objs_ = nullptr;
+  ref_ = nullptr;
+}
+
+}  // namespace serialize
@@ -0,0 +1,111 @@
+// asdl_serialize.h: Replacement for asdl/serialize.py
+
+#ifndef ASDL_SERIALIZE_H
+#define ASDL_SERIALIZE_H
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "mycpp/runtime.h"
+
+namespace serialize {
+
+// Writes the format described in asdl/serialize.py.
+//
+// The memo and output buffer live outside the GC heap, so Finish() must be
+// called to free them.  The objects being encoded must stay alive until then,
+// which is true when there's no collection point in between.
+class Encoder {
+ public:
+  Encoder();
+
+  void Seed(void* obj);
+  void AddSpanRange(int start, int end);
+  int NumSpans() {
+    return num_spans_;
+  }
+
+  void Int(int i);
+  void Bool(bool b);
+  void Str(::Str* s);
+  void SpanId(int span_id);
+  void Null();
+
+  // Generated code calls this for fields of sum and product types
+  template <typename T>
+  void Obj(T* obj) {
+    if (obj == nullptr) {
+      Null();
+    } else {
+      obj->Encode(this);
+    }
+  }
+
+  bool Begin(void* obj, int tag);
+  void End(void* obj);
+
+  ::Str* Finish();
+
+ private:
+  struct SpanRange {
+    int start;
+    int end;
+    int offset;
+  };
+
+  GC_OBJ(header_);
+  std::string* buf_;
+  std::unordered_map<void*, int>* memo_;
+  std::vector<SpanRange>* span_ranges_;
+  int num_objs_;
+  int num_spans_;
+
+  DISALLOW_COPY_AND_ASSIGN(Encoder)
+};
+
+// Decoded objects are only referenced by the memo, so the caller must not
+// reach a collection point until the tree is rooted.  Finish() frees the memo.
+class Decoder {
+ public:
+  explicit Decoder(::Str* s);
+
+  void Seed(void* obj);
+  void SetSpanBase(int base) {
+    span_base_ = base;
+  }
+
+  int Int();
+  bool Bool();
+  ::Str* Str();
+  int SpanId();
+
+  int Begin();
+  void* Ref() {
+    return ref_;
+  }
+  void End(void* obj);
+
+  bool Done() {
+    return pos_ == len(s_);
+  }
+  void Finish();
+
+  static constexpr uint16_t field_mask() {
+    return maskbit(offsetof(Decoder, s_));
+  }
+
+ private:
+  GC_OBJ(header_);
+  ::Str* s_;
+  int pos_;
+  int span_base_;
+  void* ref_;  // not traced, see above
+  std::vector<void*>* objs_;
+
+  DISALLOW_COPY_AND_ASSIGN(Decoder)
+};
+
+}  // namespace serialize
+
+#endif  // ASDL_SERIALIZE_H
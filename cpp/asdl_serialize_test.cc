@@ -0,0 +1,105 @@
+#include "cpp/asdl_serialize.h"
+
+#include "_gen/frontend/syntax.asdl.h"
+#include "vendor/greatest.h"
+
+using id_kind_asdl::Id;
+using syntax_asdl::compound_word;
+using syntax_asdl::SourceLine;
+using syntax_asdl::source;
+using syntax_asdl::Token;
+using syntax_asdl::word_part_t;
+
+TEST primitives_test() {
+  auto enc = Alloc<serialize::Encoder>();
+  enc->Int(0);
+  enc->Int(-1);
+  enc->Int(300);
+  enc->Int(-70000);
+  enc->Bool(true);
+  enc->Str(StrFromC("a\0b", 3));
+  enc->Str(nullptr);
+  Str* s = enc->Finish();
+
+  auto dec = Alloc<serialize::Decoder>(s);
+  ASSERT_EQ(0, dec->Int());
+  ASSERT_EQ(-1, dec->Int());
+  ASSERT_EQ(300, dec->Int());
+  ASSERT_EQ(-70000, dec->Int());
+  ASSERT_EQ(true, dec->Bool());
+  ASSERT(str_equals(StrFromC("a\0b", 3), dec->Str()));
+  ASSERT_EQ(nullptr, dec->Str());
+  ASSERT(dec->Done());
+
+  // Truncated data
+  bool caught = false;
+  try {
+    dec->Int();
+  } catch (ValueError* e) {
+    caught = true;
+  }
+  ASSERT(caught);
+  dec->Finish();
+
+  PASS();
+}
+
+TEST tree_test() {
+  auto src = Alloc<source::SourcedFile>(StrFromC("lib.sh"), 3);
+  auto line = Alloc<SourceLine>(1, StrFromC("echo hi\n"), src);
+  auto t1 = Alloc<Token>(Id::Lit_Chars, 0, 4, 10, line, StrFromC("echo"));
+  auto t2 = Alloc<Token>(Id::Lit_Chars, 5, 2, 11, line, nullptr);
+  auto w = Alloc<compound_word>(NewList<word_part_t*>({t1, t2, t1}));
+
+  auto enc = Alloc<serialize::Encoder>();
+  enc->Seed(src);
+  enc->AddSpanRange(10, 12);
+  ASSERT_EQ(2, enc->NumSpans());
+  w->Encode(enc);
+  Str* s = enc->Finish();
+
+  auto dec = Alloc<serialize::Decoder>(s);
+  dec->Seed(src);
+  dec->SetSpanBase(100);
+  compound_word* w2 = compound_word::Decode(dec);
+  ASSERT(dec->Done());
+  dec->Finish();
+
+  ASSERT(w2 != w);
+  ASSERT_EQ(3, len(w2->parts));
+
+  Token* u1 = static_cast<Token*>(w2->parts->index_(0));
+  Token* u2 = static_cast<Token*>(w2->parts->index_(1));
+  ASSERT_EQ(Id::Lit_Chars, u1->id);
+  ASSERT_EQ(4, u1->length);
+  ASSERT(str_equals(StrFromC("echo"), u1->tval));
+  ASSERT_EQ(nullptr, u2->tval);
+
+  // Span IDs are renumbered
+  ASSERT_EQ(100, u1->span_id);
+  ASSERT_EQ(101, u2->span_id);
+
+  // Sharing is preserved, and the seeded object isn't copied
+  ASSERT_EQ(u1, w2->parts->index_(2));
+  ASSERT(u1->line != line);
+  ASSERT_EQ(u1->line, u2->line);
+  ASSERT_EQ(src, u1->line->src);
+
+  PASS();
+}
+
+GREATEST_MAIN_DEFS();
+
+int main(int argc, char** argv) {
+  gHeap.Init();
+
+  GREATEST_MAIN_BEGIN();
+
+  RUN_TEST(primitives_test);
+  RUN_TEST(tree_test);
+
+  gHeap.CleanProcessExit();
+
+  GREATEST_MAIN_END(); /* display results */
+  return 0;
+}
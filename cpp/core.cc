@@ -4,11 +4,15 @@
 
 #include <ctype.h>  // ispunct()
 #include <errno.h>
-#include <math.h>  // fmod()
-#include <pwd.h>   // passwd
+#include <fcntl.h>   // F_SETPIPE_SZ
+#include <limits.h>  // INT_MAX, PATH_MAX
+#include <math.h>    // fmod()
+#include <poll.h>    // poll()
+#include <pwd.h>     // passwd
 #include <signal.h>
+#include <sys/ioctl.h>     // ioctl(), FIONREAD
+#include <sys/mman.h>      // memfd_create()
 #include <sys/resource.h>  // getrusage
-#include <sys/select.h>    // select(), FD_ISSET, FD_SET, FD_ZERO
 #include <sys/stat.h>      // stat
 #include <sys/times.h>     // tms / times()
 #include <sys/utsname.h>   // uname
@@ -22,16 +26,126 @@ namespace pyos {
 
 SignalSafe* gSignalSafe = nullptr;
 
+// WaitPid() blocks in poll() on a self-pipe, rather than in waitpid().  Every
+// signal handler writes a byte to the pipe, including one for SIGCHLD, so there
+// is no window where a signal can arrive without waking us up.
+//
+// Both ends are non-blocking, close-on-exec, and above the range of
+// descriptors that users can redirect.  See _SHELL_MIN_FD in core/process.py.
+static int gWakeupFds[2] = {-1, -1};
+static pid_t gWakeupOwner = -1;  // forked subshells need their own pipe
+
+// Incremented by signal_handler(), i.e. for signals that the shell is
+// interested in.  The SIGCHLD handler only wakes up the waiter.
+static volatile sig_atomic_t gNumSignals = 0;
+
+const int kWakeupMinFd = 100;
+
+static void WakeUp() {
+  int saved_errno = errno;
+  int fd = gWakeupFds[1];
+  if (fd >= 0) {
+    char c = 0;
+    // If the pipe is full, the waiter is already going to wake up
+    (void)!::write(fd, &c, 1);
+  }
+  errno = saved_errno;
+}
+
+static void sigchld_handler(int sig_num) {
+  WakeUp();
+}
+
+static int MoveToShellRange(int fd) {
+  int new_fd = ::fcntl(fd, F_DUPFD_CLOEXEC, kWakeupMinFd);
+  ::close(fd);
+  if (new_fd >= 0) {
+    ::fcntl(new_fd, F_SETFL, ::fcntl(new_fd, F_GETFL) | O_NONBLOCK);
+  }
+  return new_fd;
+}
+
+// Create the self-pipe for this process.  A child created by fork() shares the
+// parent's pipe, so it makes its own before it waits.
+static void InitWakeupPipe() {
+  int old_read = gWakeupFds[0];
+  int old_write = gWakeupFds[1];
+
+  int fds[2];
+  if (::pipe(fds) < 0) {
+    throw Alloc<OSError>(errno);
+  }
+  int read_fd = MoveToShellRange(fds[0]);
+  int write_fd = MoveToShellRange(fds[1]);
+  if (read_fd < 0 || write_fd < 0) {
+    throw Alloc<OSError>(errno);
+  }
+
+  gWakeupFds[0] = read_fd;
+  gWakeupFds[1] = write_fd;  // handlers may start writing here
+  gWakeupOwner = ::getpid();
+
+  if (old_read >= 0) {
+    ::close(old_read);
+    ::close(old_write);
+  }
+}
+
+static void DrainWakeupPipe() {
+  char buf[64];
+  while (::read(gWakeupFds[0], buf, sizeof(buf)) > 0) {
+  }
+}
+
 Tuple2<int, int> WaitPid() {
-  int status;
-  int result = ::waitpid(-1, &status, WUNTRACED);
-  if (result < 0) {
-    if (errno == EINTR && gSignalSafe->PollSigInt()) {
-      throw Alloc<KeyboardInterrupt>();
+  if (gWakeupFds[0] < 0) {
+    // InitSignalSafe() wasn't called, e.g. in unit tests
+    int status;
+    int result = ::waitpid(-1, &status, WUNTRACED);
+    if (result < 0) {
+      return Tuple2<int, int>(-1, errno);
+    }
+    return Tuple2<int, int>(result, status);
+  }
+
+  if (gWakeupOwner != ::getpid()) {
+    InitWakeupPipe();
+  }
+
+  // Like waitpid(), we're only interrupted by signals that arrive while we're
+  // waiting.
+  int num_signals = gNumSignals;
+
+  while (true) {
+    // Drain BEFORE polling the kernel, so a SIGCHLD that arrives after
+    // waitpid() leaves a byte in the pipe.
+    DrainWakeupPipe();
+
+    int status;
+    int result = ::waitpid(-1, &status, WUNTRACED | WNOHANG);
+    if (result > 0) {
+      return Tuple2<int, int>(result, status);
+    }
+    if (result < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return Tuple2<int, int>(-1, errno);  // e.g. ECHILD
+    }
+
+    // result == 0: there are children, but none has changed state
+    if (gNumSignals != num_signals) {
+      if (gSignalSafe->PollSigInt()) {
+        throw Alloc<KeyboardInterrupt>();
+      }
+      return Tuple2<int, int>(-1, EINTR);
+    }
+
+    struct pollfd pfd = {gWakeupFds[0], POLLIN, 0};
+    if (::poll(&pfd, 1, -1) < 0 && errno != EINTR) {
+      return Tuple2<int, int>(-1, errno);
     }
-    return Tuple2<int, int>(-1, errno);
   }
-  return Tuple2<int, int>(result, status);
 }
 
 Tuple2<int, int> Read(int fd, int n, List<Str*>* chunks) {
@@ -55,6 +169,119 @@ Tuple2<int, int> Read(int fd, int n, List<Str*>* chunks) {
   return Tuple2<int, int>(length, 0);
 }
 
+// Most command subs output a line or two, so start small.
+const int kDrainInitialSize = 4096;
+
+// After this much output, ask the kernel for a bigger pipe buffer, so the
+// writer and reader context switch less.  We don't do it up front because
+// pipe memory is a limited per-user resource.
+const int kDrainGrowPipeAfter = 64 * 1024;
+const int kDrainPipeSize = 1024 * 1024;
+
+Tuple2<Str*, int> DrainPipe(int fd) {
+  int cap = kDrainInitialSize;
+  int length = 0;
+  Str* buf = OverAllocatedStr(cap);
+#ifdef F_SETPIPE_SZ
+  bool pipe_resized = false;
+#endif
+
+  while (true) {
+    if (length == cap) {
+      if (cap > INT_MAX / 2) {
+        return Tuple2<Str*, int>(kEmptyString, ENOMEM);
+      }
+      // Grow geometrically, but make room for everything that's already
+      // waiting in the pipe, so one growth step can absorb it.
+      int avail = 0;
+      if (::ioctl(fd, FIONREAD, &avail) < 0) {
+        avail = 0;
+      }
+      int new_cap = std::max(cap * 2, length + avail);
+
+      Str* bigger = OverAllocatedStr(new_cap);
+      memcpy(bigger->data_, buf->data_, length);
+      buf = bigger;
+      cap = new_cap;
+
+#ifdef F_SETPIPE_SZ
+      if (!pipe_resized && length >= kDrainGrowPipeAfter) {
+        // Best effort: fails harmlessly if fd isn't a pipe, or if the size is
+        // above /proc/sys/fs/pipe-max-size
+        ::fcntl(fd, F_SETPIPE_SZ, kDrainPipeSize);
+        pipe_resized = true;
+      }
+#endif
+    }
+
+    int n = ::read(fd, buf->data_ + length, cap - length);
+    if (n < 0) {
+      if (errno == EINTR) {
+        if (gSignalSafe->PollSigInt()) {
+          throw Alloc<KeyboardInterrupt>();
+        }
+        continue;  // retry
+      }
+      return Tuple2<Str*, int>(kEmptyString, errno);
+    }
+    if (n == 0) {  // EOF
+      break;
+    }
+    length += n;
+  }
+
+  // Strip trailing newlines in place, rather than copying with rstrip()
+  while (length > 0 && buf->data_[length - 1] == '\n') {
+    length--;
+  }
+  if (length == 0) {
+    return Tuple2<Str*, int>(kEmptyString, 0);
+  }
+
+  buf->data_[length] = '\0';
+  buf->MaybeShrink(length);
+  return Tuple2<Str*, int>(buf, 0);
+}
+
+int OpenAnonymousFile() {
+#ifdef MFD_CLOEXEC
+  int fd = ::memfd_create("osh", MFD_CLOEXEC);
+  if (fd >= 0) {
+    return fd;
+  }
+  // e.g. ENOSYS on old kernels; fall back on an unlinked temp file
+#endif
+  const char* tmp_dir = getenv("TMPDIR");
+  char path[PATH_MAX];
+  snprintf(path, sizeof(path), "%s/osh-XXXXXX", tmp_dir ? tmp_dir : "/tmp");
+  int fd2 = ::mkstemp(path);
+  if (fd2 < 0) {
+    throw Alloc<OSError>(errno);
+  }
+  ::unlink(path);
+  ::fcntl(fd2, F_SETFD, FD_CLOEXEC);
+  return fd2;
+}
+
+void Rewind(int fd) {
+  if (::lseek(fd, 0, SEEK_SET) < 0) {
+    throw Alloc<OSError>(errno);
+  }
+}
+
+int NumUnread(int fd) {
+  struct stat st;
+  if (::fstat(fd, &st) < 0) {
+    throw Alloc<OSError>(errno);
+  }
+  off_t pos = ::lseek(fd, 0, SEEK_CUR);
+  if (pos < 0) {
+    throw Alloc<OSError>(errno);
+  }
+  off_t n = st.st_size - pos;
+  return n > INT_MAX ? INT_MAX : static_cast<int>(n);
+}
+
 Tuple2<int, int> ReadByte(int fd) {
   unsigned char buf[1];
   ssize_t n = read(fd, &buf, 1);
@@ -202,6 +429,7 @@ void PrintTimes() {
   }
   long ticks_per_sec = sysconf(_SC_CLK_TCK);
 
+  mylib::Stdout()->flush();  // we write with stdio below
   PrintClock(t.tms_utime, ticks_per_sec);
   putc(' ', stdout);
   PrintClock(t.tms_stime, ticks_per_sec);
@@ -213,11 +441,20 @@ void PrintTimes() {
 }
 
 bool InputAvailable(int fd) {
-  fd_set fds;
-  FD_ZERO(&fds);
-  struct timeval timeout = {0};  // return immediately
-  FD_SET(fd, &fds);
-  return select(FD_SETSIZE, &fds, NULL, NULL, &timeout) > 0;
+  // poll() rather than select(), which can't handle fd >= FD_SETSIZE
+  struct pollfd pfd = {fd, POLLIN, 0};
+  return ::poll(&pfd, 1, 0) > 0;  // return immediately
+}
+
+static void InstallSigChldHandler() {
+  struct sigaction act = {};
+  act.sa_handler = sigchld_handler;
+  // Other blocking calls like read() shouldn't see EINTR because a child
+  // exited.  poll() in WaitPid() is interrupted regardless of SA_RESTART.
+  act.sa_flags = SA_RESTART;
+  if (sigaction(SIGCHLD, &act, nullptr) != 0) {
+    throw Alloc<OSError>(errno);
+  }
 }
 
 SignalSafe* InitSignalSafe() {
@@ -226,10 +463,20 @@ SignalSafe* InitSignalSafe() {
 
   RegisterSignalInterest(SIGINT);  // for KeyboardInterrupt checks
 
+  InitWakeupPipe();
+  InstallSigChldHandler();
+
   return gSignalSafe;
 }
 
 void Sigaction(int sig_num, sighandler_t handler) {
+  // The default action for SIGCHLD is to ignore it, but WaitPid() still needs
+  // to be woken up, e.g. after 'trap - CHLD'
+  if (sig_num == SIGCHLD && handler == SIG_DFL && gWakeupFds[1] >= 0) {
+    InstallSigChldHandler();
+    return;
+  }
+
   struct sigaction act = {};
   act.sa_handler = handler;
   if (sigaction(sig_num, &act, nullptr) != 0) {
@@ -240,6 +487,8 @@ void Sigaction(int sig_num, sighandler_t handler) {
 static void signal_handler(int sig_num) {
   assert(gSignalSafe != nullptr);
   gSignalSafe->UpdateFromSignalHandler(sig_num);
+  gNumSignals++;
+  WakeUp();
 }
 
 void RegisterSignalInterest(int sig_num) {
@@ -257,6 +506,118 @@ Tuple2<Str*, int>* MakeDirCacheKey(Str* path) {
   return Alloc<Tuple2<Str*, int>>(path, st.st_mtime);
 }
 
+Str* FileCacheKey(Str* path) {
+  struct stat st;
+  if (::stat(path->data(), &st) == -1) {
+    throw Alloc<OSError>(errno);
+  }
+
+  char buf[128];
+  int n = snprintf(buf, sizeof(buf), "%lu %lu %lld %lld.%09ld",
+                   static_cast<unsigned long>(st.st_dev),
+                   static_cast<unsigned long>(st.st_ino),
+                   static_cast<long long>(st.st_size),
+                   static_cast<long long>(st.st_mtim.tv_sec),
+                   static_cast<long>(st.st_mtim.tv_nsec));
+  return StrFromC(buf, n);
+}
+
+Str* ReadFile(Str* path) {
+  int fd = ::open(path->data(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    throw Alloc<OSError>(errno);
+  }
+
+  // Size the buffer with fstat(), so the common case is one read() plus one
+  // that returns EOF
+  struct stat st;
+  if (::fstat(fd, &st) == -1) {
+    int err_num = errno;
+    ::close(fd);
+    throw Alloc<OSError>(err_num);
+  }
+  int cap = st.st_size + 1;
+  int length = 0;
+  Str* buf = OverAllocatedStr(cap);
+
+  while (true) {
+    if (length == cap) {
+      Str* bigger = OverAllocatedStr(cap * 2);
+      memcpy(bigger->data_, buf->data_, length);
+      buf = bigger;
+      cap *= 2;
+    }
+    int n = ::read(fd, buf->data_ + length, cap - length);
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      int err_num = errno;
+      ::close(fd);
+      throw Alloc<OSError>(err_num);
+    }
+    if (n == 0) {
+      break;
+    }
+    length += n;
+  }
+  ::close(fd);
+
+  buf->data_[length] = '\0';
+  buf->MaybeShrink(length);
+  return buf;
+}
+
+void WriteFileAtomic(Str* path, Str* contents) {
+  char tmp[PATH_MAX];
+
+  const char* slash = strrchr(path->data(), '/');
+  if (slash != nullptr && slash != path->data()) {
+    int n = slash - path->data();
+    if (n >= PATH_MAX) {
+      throw Alloc<OSError>(ENAMETOOLONG);
+    }
+    memcpy(tmp, path->data(), n);
+    tmp[n] = '\0';
+    if (::mkdir(tmp, 0755) == -1 && errno != EEXIST) {
+      throw Alloc<OSError>(errno);
+    }
+  }
+
+  if (snprintf(tmp, sizeof(tmp), "%s.%d.tmp", path->data(), getpid()) >=
+      static_cast<int>(sizeof(tmp))) {
+    throw Alloc<OSError>(ENAMETOOLONG);
+  }
+  int fd = ::open(tmp, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  if (fd < 0) {
+    throw Alloc<OSError>(errno);
+  }
+
+  const char* p = contents->data();
+  int remaining = len(contents);
+  while (remaining > 0) {
+    int n = ::write(fd, p, remaining);
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      int err_num = errno;
+      ::close(fd);
+      ::unlink(tmp);
+      throw Alloc<OSError>(err_num);
+    }
+    p += n;
+    remaining -= n;
+  }
+  ::close(fd);
+
+  if (::rename(tmp, path->data()) == -1) {
+    int err_num = errno;
+    ::unlink(tmp);
+    throw Alloc<OSError>(err_num);
+  }
+}
+
 }  // namespace pyos
 
 namespace pyutil {
@@ -332,7 +693,8 @@ Str* strerror(IOError_OSError* e) {
 }
 
 grammar::Grammar* LoadOilGrammar(_ResourceLoader*) {
-  return nullptr;
+  // The tables are compiled in, see cpp/pgen2.h
+  return Alloc<grammar::Grammar>();
 }
 
 }  // namespace pyutil
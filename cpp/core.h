@@ -37,6 +37,10 @@ const int UNTRAPPED_SIGWINCH = -1;
 
 Tuple2<int, int> WaitPid();
 Tuple2<int, int> Read(int fd, int n, List<Str*>* chunks);
+Tuple2<Str*, int> DrainPipe(int fd);
+int OpenAnonymousFile();
+void Rewind(int fd);
+int NumUnread(int fd);
 Tuple2<int, int> ReadByte(int fd);
 Str* ReadLine();
 Dict<Str*, Str*>* Environ();
@@ -86,9 +90,16 @@ void PrintTimes();
 
 bool InputAvailable(int fd);
 
-inline void FlushStdout() {
-  // Flush libc buffers
-  fflush(stdout);
+inline int FlushStdout() {
+  // Flush writes batched by mylib::Stdout(), then libc buffers.  Return an
+  // error code rather than throwing, since callers like FdState::Pop() may be
+  // cleaning up after another error.
+  try {
+    mylib::Stdout()->flush();
+  } catch (IOError_OSError* e) {
+    return e->errno_;
+  }
+  return 0;
 }
 
 class TermState {
@@ -214,6 +225,10 @@ void RegisterSignalInterest(int sig_num);
 
 Tuple2<Str*, int>* MakeDirCacheKey(Str* path);
 
+Str* FileCacheKey(Str* path);
+Str* ReadFile(Str* path);
+void WriteFileAtomic(Str* path, Str* contents);
+
 }  // namespace pyos
 
 namespace pyutil {
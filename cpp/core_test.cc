@@ -2,9 +2,12 @@
 
 #include <errno.h>        // errno
 #include <fcntl.h>        // O_RDWR
+#include <poll.h>         // poll()
 #include <signal.h>       // SIG*, kill()
+#include <sys/select.h>   // FD_SETSIZE
 #include <sys/stat.h>     // stat
 #include <sys/utsname.h>  // uname
+#include <sys/wait.h>     // waitpid()
 #include <unistd.h>       // getpid(), getuid(), environ
 
 #include "cpp/stdlib.h"         // posix::getcwd
@@ -12,7 +15,7 @@
 #include "vendor/greatest.h"
 
 TEST for_test_coverage() {
-  pyos::FlushStdout();
+  ASSERT_EQ(0, pyos::FlushStdout());
   auto loader = pyutil::GetResourceLoader();
 
   Str* version = pyutil::GetVersion(loader);
@@ -138,6 +141,69 @@ TEST pyos_read_test() {
   PASS();
 }
 
+TEST pyos_drain_pipe_test() {
+  // Fork a writer so we can test outputs bigger than the pipe buffer
+  for (int n : {0, 1, 4095, 4096, 4097, 300 * 1000}) {
+    int fd[2];
+    ASSERT_EQ(0, ::pipe(fd));
+
+    pid_t pid = ::fork();
+    if (pid == 0) {
+      close(fd[0]);
+      for (int i = 0; i < n; ++i) {
+        ASSERT_EQ(1, ::write(fd[1], i % 100 == 99 ? "\n" : "x", 1));
+      }
+      ASSERT_EQ(3, ::write(fd[1], "\n\n\n", 3));
+      _exit(0);
+    }
+    close(fd[1]);
+
+    Tuple2<Str*, int> tup = pyos::DrainPipe(fd[0]);
+    close(fd[0]);
+    int status;
+    ASSERT_EQ(pid, ::waitpid(pid, &status, 0));
+
+    Str* s = tup.at0();
+    ASSERT_EQ_FMT(0, tup.at1(), "%d");
+
+    // Trailing newlines are stripped
+    int expected = n;
+    while (expected > 0 && (expected - 1) % 100 == 99) {
+      expected--;
+    }
+    ASSERT_EQ_FMT(expected, len(s), "%d");
+    ASSERT_EQ('\0', s->data_[len(s)]);
+    if (expected) {
+      ASSERT_EQ('x', s->data_[0]);
+      ASSERT_EQ('x', s->data_[expected - 1]);
+    }
+  }
+
+  // Error is returned, not thrown
+  Tuple2<Str*, int> tup = pyos::DrainPipe(-1);
+  ASSERT_EQ_FMT(EBADF, tup.at1(), "%d");
+  ASSERT_EQ(0, len(tup.at0()));
+
+  PASS();
+}
+
+TEST pyos_anonymous_file_test() {
+  int fd = pyos::OpenAnonymousFile();
+  ASSERT(fd >= 0);
+  ASSERT_EQ(5, write(fd, "hello", 5));
+  ASSERT_EQ(0, pyos::NumUnread(fd));
+
+  pyos::Rewind(fd);
+  ASSERT_EQ(5, pyos::NumUnread(fd));
+
+  char buf[2];
+  ASSERT_EQ(2, read(fd, buf, 2));
+  ASSERT_EQ(3, pyos::NumUnread(fd));
+
+  close(fd);
+  PASS();
+}
+
 TEST pyos_test() {
   Tuple3<double, double, double> t = pyos::Time();
   ASSERT(t.at0() > 0.0);
@@ -262,6 +328,103 @@ TEST signal_test() {
   PASS();
 }
 
+TEST wait_pid_stress_test() {
+  pyos::InitSignalSafe();
+
+  // Many short-lived children, which exit while we're forking others.  Each
+  // one must be reaped exactly once, without hanging.
+  const int kNumChildren = 2000;
+  for (int i = 0; i < kNumChildren; ++i) {
+    pid_t pid = ::fork();
+    ASSERT(pid >= 0);
+    if (pid == 0) {
+      _exit(i % 256);
+    }
+  }
+
+  int sum = 0;
+  for (int i = 0; i < kNumChildren; ++i) {
+    Tuple2<int, int> tup = pyos::WaitPid();
+    ASSERT(tup.at0() > 0);
+    ASSERT(WIFEXITED(tup.at1()));
+    sum += WEXITSTATUS(tup.at1());
+  }
+  int expected = 0;
+  for (int i = 0; i < kNumChildren; ++i) {
+    expected += i % 256;
+  }
+  ASSERT_EQ_FMT(expected, sum, "%d");
+
+  // Nothing left
+  Tuple2<int, int> tup = pyos::WaitPid();
+  ASSERT_EQ_FMT(-1, tup.at0(), "%d");
+  ASSERT_EQ_FMT(ECHILD, tup.at1(), "%d");
+
+  PASS();
+}
+
+TEST wait_pid_signal_test() {
+  pyos::InitSignalSafe();
+  pyos::RegisterSignalInterest(SIGUSR1);
+
+  // The parent closes this pipe when it has been interrupted
+  int done[2];
+  ASSERT_EQ(0, ::pipe(done));
+
+  // A signal the shell is interested in interrupts the wait, like EINTR.  A
+  // signal that arrives before WaitPid() starts doesn't, so keep sending it.
+  pid_t pid = ::fork();
+  ASSERT(pid >= 0);
+  if (pid == 0) {
+    close(done[1]);
+    while (true) {
+      kill(getppid(), SIGUSR1);
+      struct pollfd pfd = {done[0], POLLIN, 0};
+      if (poll(&pfd, 1, 10) > 0) {  // EOF
+        break;
+      }
+    }
+    _exit(42);
+  }
+  close(done[0]);
+
+  Tuple2<int, int> tup = pyos::WaitPid();
+  ASSERT_EQ_FMT(-1, tup.at0(), "%d");
+  ASSERT_EQ_FMT(EINTR, tup.at1(), "%d");
+
+  // Discard signals that are still coming
+  pyos::Sigaction(SIGUSR1, SIG_IGN);
+  close(done[1]);
+
+  // But SIGCHLD doesn't interrupt it, even after 'trap - CHLD'
+  pyos::Sigaction(SIGCHLD, SIG_DFL);
+  tup = pyos::WaitPid();
+  ASSERT_EQ_FMT(pid, tup.at0(), "%d");
+  ASSERT_EQ_FMT(42, WEXITSTATUS(tup.at1()), "%d");
+
+  PASS();
+}
+
+TEST input_available_test() {
+  int fd[2];
+  ASSERT_EQ(0, ::pipe(fd));
+  ASSERT_EQ(false, pyos::InputAvailable(fd[0]));
+
+  // select() can't handle this
+  int high_fd = ::fcntl(fd[0], F_DUPFD, FD_SETSIZE + 10);
+  ASSERT(high_fd >= FD_SETSIZE);
+  ASSERT_EQ(false, pyos::InputAvailable(high_fd));
+
+  ASSERT_EQ(1, ::write(fd[1], "x", 1));
+  ASSERT_EQ(true, pyos::InputAvailable(fd[0]));
+  ASSERT_EQ(true, pyos::InputAvailable(high_fd));
+
+  close(fd[0]);
+  close(fd[1]);
+  close(high_fd);
+  PASS();
+}
+
 TEST signal_safe_test() {
   pyos::SignalSafe signal_safe;
 
@@ -326,6 +489,36 @@ TEST dir_cache_key_test() {
   PASS();
 }
 
+TEST file_cache_test() {
+  char dir[] = "/tmp/core_test_XXXXXX";
+  ASSERT(mkdtemp(dir) != nullptr);
+  Str* path = str_concat(StrFromC(dir), StrFromC("/sub/f"));
+
+  Str* contents = StrFromC("foo\0bar", 7);
+  pyos::WriteFileAtomic(path, contents);  // creates sub/
+  ASSERT(str_equals(contents, pyos::ReadFile(path)));
+
+  Str* key1 = pyos::FileCacheKey(path);
+  ASSERT(str_equals(key1, pyos::FileCacheKey(path)));
+
+  pyos::WriteFileAtomic(path, StrFromC("x"));  // replaces it
+  ASSERT(str_equals(StrFromC("x"), pyos::ReadFile(path)));
+  ASSERT(!str_equals(key1, pyos::FileCacheKey(path)));
+
+  int ec = -1;
+  try {
+    pyos::ReadFile(StrFromC("nonexistent_ZZ"));
+  } catch (IOError_OSError* e) {
+    ec = e->errno_;
+  }
+  ASSERT(ec == ENOENT);
+
+  ::unlink(path->data());
+  ::rmdir(str_concat(StrFromC(dir), StrFromC("/sub"))->data());
+  ::rmdir(dir);
+  PASS();
+}
+
 GREATEST_MAIN_DEFS();
 
 int main(int argc, char** argv) {
@@ -340,15 +533,21 @@ int main(int argc, char** argv) {
   RUN_TEST(uname_test);
   RUN_TEST(pyos_readbyte_test);
   RUN_TEST(pyos_read_test);
+  RUN_TEST(pyos_drain_pipe_test);
+  RUN_TEST(pyos_anonymous_file_test);
   RUN_TEST(pyos_test);  // non-hermetic
   RUN_TEST(pyutil_test);
   RUN_TEST(strerror_test);
 
   RUN_TEST(signal_test);
   RUN_TEST(signal_safe_test);
+  RUN_TEST(wait_pid_stress_test);
+  RUN_TEST(wait_pid_signal_test);
+  RUN_TEST(input_available_test);
 
   RUN_TEST(passwd_test);
   RUN_TEST(dir_cache_key_test);
+  RUN_TEST(file_cache_test);
 
   gHeap.CleanProcessExit();
 
@@ -136,8 +136,6 @@ void _CreateActions(Action_c* in, Dict<Str*, args::_Action*>* out) {
 }
 
 // "Inflate" the static C data into a heap-allocated ASDL data structure.
-//
-// TODO: Make a GLOBAL CACHE?  It could be shared between subinterpreters even?
 flag_spec::_FlagSpec* CreateSpec(FlagSpec_c* in) {
   auto out = Alloc<flag_spec::_FlagSpec>();
   out->arity0 = NewList<Str*>();
@@ -186,40 +184,37 @@ flag_spec::_FlagSpecAndMore* CreateSpec2(FlagSpecAndMore_c* in) {
   return out;
 }
 
-flag_spec::_FlagSpec* LookupFlagSpec(Str* spec_name) {
-  int i = 0;
-  while (true) {
-    const char* name = kFlagSpecs[i].name;
-    if (name == nullptr) {
-      break;
-    }
-    if (str_equals0(name, spec_name)) {
-      // log("%s found", spec_name->data_);
-      return CreateSpec(&kFlagSpecs[i]);
-    }
+// Specs are inflated on first use and then shared, like the global FlagSpec
+// objects in Python.  They're never mutated; args::_Attributes copies the
+// defaults.
+static flag_spec::_FlagSpec* gFlagSpecs[arg_types::kNumFlagSpecs];
+static flag_spec::_FlagSpecAndMore*
+    gFlagSpecsAndMore[arg_types::kNumFlagSpecsAndMore];
 
-    i++;
+flag_spec::_FlagSpec* LookupFlagSpec(Str* spec_name) {
+  int i = arg_types::FlagSpecIndex(spec_name);
+  if (i == -1) {
+    // log("%s not found", spec_name->data_);
+    return nullptr;
+  }
+  if (gFlagSpecs[i] == nullptr) {
+    gFlagSpecs[i] = CreateSpec(&kFlagSpecs[i]);
+    gHeap.RootGlobalVar(gFlagSpecs[i]);
   }
-  // log("%s not found", spec_name->data_);
-  return nullptr;
+  return gFlagSpecs[i];
 }
 
 flag_spec::_FlagSpecAndMore* LookupFlagSpec2(Str* spec_name) {
-  int i = 0;
-  while (true) {
-    const char* name = kFlagSpecsAndMore[i].name;
-    if (name == nullptr) {
-      break;
-    }
-    if (str_equals0(name, spec_name)) {
-      // log("%s found", spec_name->data_);
-      return CreateSpec2(&kFlagSpecsAndMore[i]);
-    }
-
-    i++;
+  int i = arg_types::FlagSpecAndMoreIndex(spec_name);
+  if (i == -1) {
+    // log("%s not found", spec_name->data_);
+    return nullptr;
+  }
+  if (gFlagSpecsAndMore[i] == nullptr) {
+    gFlagSpecsAndMore[i] = CreateSpec2(&kFlagSpecsAndMore[i]);
+    gHeap.RootGlobalVar(gFlagSpecsAndMore[i]);
   }
-  // log("%s not found", spec_name->data_);
-  return nullptr;
+  return gFlagSpecsAndMore[i];
 }
 
 args::_Attributes* Parse(Str* spec_name, args::Reader* arg_r) {
@@ -1,5 +1,7 @@
 #include "cpp/frontend_flag_spec.h"
 
+#include "_gen/frontend/arg_types.h"
+
 #include "vendor/greatest.h"
 
 using runtime_asdl::flag_type_e;
@@ -79,6 +81,12 @@ TEST flag_spec_test() {
   spec = flag_spec::LookupFlagSpec(StrFromC("zzz"));
   ASSERT(spec == nullptr);
 
+  // Not found even when the hash slot is occupied
+  spec = flag_spec::LookupFlagSpec(StrFromC("readonl"));
+  ASSERT(spec == nullptr);
+  spec = flag_spec::LookupFlagSpec(StrFromC(""));
+  ASSERT(spec == nullptr);
+
   flag_spec::_FlagSpecAndMore* spec2;
 
   spec2 = flag_spec::LookupFlagSpec2(StrFromC("main"));
@@ -87,6 +95,16 @@ TEST flag_spec_test() {
   spec2 = flag_spec::LookupFlagSpec2(StrFromC("zzz"));
   ASSERT(spec2 == nullptr);
 
+  // Every spec in the generated tables can be found
+  for (int i = 0; i < arg_types::kNumFlagSpecs; ++i) {
+    Str* name = StrFromC(arg_types::kFlagSpecs[i].name);
+    ASSERT(arg_types::FlagSpecIndex(name) == i);
+  }
+  for (int i = 0; i < arg_types::kNumFlagSpecsAndMore; ++i) {
+    Str* name = StrFromC(arg_types::kFlagSpecsAndMore[i].name);
+    ASSERT(arg_types::FlagSpecAndMoreIndex(name) == i);
+  }
+
   int i = 0;
   while (true) {
     DefaultPair_c* d = &(defaults_2[i]);
@@ -113,6 +131,25 @@ TEST flag_spec_test() {
   PASS();
 }
 
+TEST lookup_cache_test() {
+  // Specs are inflated once, then shared
+  flag_spec::_FlagSpec* spec = flag_spec::LookupFlagSpec(StrFromC("read"));
+  ASSERT(spec != nullptr);
+  ASSERT_EQ(spec, flag_spec::LookupFlagSpec(StrFromC("read")));
+
+  flag_spec::_FlagSpecAndMore* spec2 =
+      flag_spec::LookupFlagSpec2(StrFromC("set"));
+  ASSERT(spec2 != nullptr);
+  ASSERT_EQ(spec2, flag_spec::LookupFlagSpec2(StrFromC("set")));
+
+  // They survive collection
+  gHeap.Collect();
+  ASSERT_EQ(spec, flag_spec::LookupFlagSpec(StrFromC("read")));
+  ASSERT(len(spec->defaults) > 0);
+
+  PASS();
+}
+
 TEST show_sizeof() {
   log("sizeof(flag_spec::_FlagSpecAndMore) = %d",
       sizeof(flag_spec::_FlagSpecAndMore));
@@ -145,6 +182,7 @@ int main(int argc, char** argv) {
   GREATEST_MAIN_BEGIN();
 
   RUN_TEST(flag_spec_test);
+  RUN_TEST(lookup_cache_test);
   RUN_TEST(show_sizeof);
 
   gHeap.CleanProcessExit();
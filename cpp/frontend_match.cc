@@ -24,6 +24,26 @@ Tuple2<Id_t, int> OneToken(lex_mode_t lex_mode, Str* line, int start_pos) {
   return Tuple2<Id_t, int>(static_cast<Id_t>(id), end_pos);
 }
 
+void OshTokens(lex_mode_t lex_mode, Str* line, int start_pos, int max_tokens,
+               List<int>* buf) {
+  buf->clear();
+
+  const unsigned char* s = reinterpret_cast<const unsigned char*>(line->data_);
+  int n = len(line);
+  int pos = start_pos;
+  for (int i = 0; i < max_tokens; ++i) {
+    int id;
+    int end_pos;
+    MatchOshToken(static_cast<int>(lex_mode), s, n, pos, &id, &end_pos);
+    buf->append(id);
+    buf->append(end_pos);
+    if (id == Id::Eol_Tok) {
+      break;
+    }
+    pos = end_pos;
+  }
+}
+
 Tuple2<Id_t, Str*> SimpleLexer::Next() {
   int id;
   int end_pos;
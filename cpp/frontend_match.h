@@ -17,6 +17,11 @@ using types_asdl::lex_mode_t;
 // The big lexer
 Tuple2<Id_t, int> OneToken(lex_mode_t lex_mode, Str* line, int start_pos);
 
+// Lex up to max_tokens tokens in one mode, stopping after Eol_Tok.  The
+// (id, end_pos) pairs replace the contents of buf.
+void OshTokens(lex_mode_t lex_mode, Str* line, int start_pos, int max_tokens,
+               List<int>* buf);
+
 // There are 5 secondary lexers with matchers of this type
 typedef void (*MatchFunc)(const unsigned char* line, int line_len,
                           int start_pos, int* id, int* end_pos);
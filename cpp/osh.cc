@@ -3,9 +3,11 @@
 #include "cpp/osh.h"
 
 #include <fcntl.h>  // AT_* Constants
+#include <string.h>  // memcpy
 #include <sys/stat.h>
 #include <unistd.h>
 
+#include "_gen/frontend/consts.h"
 #include "mycpp/gc_builtins.h"
 // To avoid circular dependency with e_die()
 #include "prebuilt/core/error.mycpp.h"
@@ -153,3 +155,357 @@ bool DoBinaryOp(Id_t op_id, Str* s1, Str* s2) {
 }
 
 }  // namespace bool_stat
+
+namespace ifs_split {
+
+using runtime_asdl::char_kind_i;
+using runtime_asdl::emit_i;
+using runtime_asdl::span_e;
+using runtime_asdl::state_i;
+
+Str* CharKinds(Str* ifs_whitespace, Str* ifs_other) {
+  Str* result = NewStr(256);
+  char* kinds = result->data_;
+  memset(kinds, char_kind_i::Black, 256);
+  kinds['\\'] = char_kind_i::Backslash;
+  for (int i = 0; i < len(ifs_other); ++i) {
+    kinds[static_cast<uint8_t>(ifs_other->data_[i])] = char_kind_i::DE_Gray;
+  }
+  for (int i = 0; i < len(ifs_whitespace); ++i) {
+    kinds[static_cast<uint8_t>(ifs_whitespace->data_[i])] =
+        char_kind_i::DE_White;
+  }
+  return result;
+}
+
+// Runs the state machine in ifs_split.py over the bytes of s.  The Sink gets
+// the same sequence of spans that Spans() returns.
+template <class Sink>
+static void RunStateMachine(Str* s, Str* char_kinds, bool allow_escape,
+                            Sink* sink) {
+  const uint8_t* data = reinterpret_cast<const uint8_t*>(s->data_);
+  const char* kinds = char_kinds->data_;
+  int n = len(s);
+  if (n == 0) {
+    return;
+  }
+
+  // Ad hoc rule from POSIX: ignore leading whitespace
+  int i = 0;
+  while (i < n && kinds[data[i]] == char_kind_i::DE_White) {
+    i++;
+  }
+  if (i != 0) {
+    sink->Add(span_e::Delim, i);
+  }
+  if (i == n) {
+    return;
+  }
+
+  int state = state_i::Start;
+  while (state != state_i::Done) {
+    int ch;
+    if (i < n) {
+      ch = kinds[data[i]];
+      if (ch == char_kind_i::Backslash && !allow_escape) {
+        ch = char_kind_i::Black;
+      }
+    } else {
+      ch = char_kind_i::Sentinel;
+    }
+
+    Tuple2<int, int> edge = consts::IfsEdge(state, ch);
+    int new_state = edge.at0();
+    DCHECK(new_state != state_i::Invalid);
+
+    switch (edge.at1()) {
+    case emit_i::Part:
+      sink->Add(span_e::Black, i);
+      break;
+    case emit_i::Delim:
+      sink->Add(span_e::Delim, i);  // ignored delimiter
+      break;
+    case emit_i::Empty:
+      sink->Add(span_e::Delim, i);  // ignored delimiter
+      sink->Add(span_e::Black, i);  // EMPTY part that is NOT ignored
+      break;
+    case emit_i::Escape:
+      sink->Add(span_e::Backslash, i);
+      break;
+    }
+
+    state = new_state;
+    i++;
+  }
+}
+
+class SpanSink {
+ public:
+  explicit SpanSink(List<Tuple2<span_t, int>*>* spans) : spans_(spans) {
+  }
+  void Add(span_t span_type, int end_index) {
+    spans_->append(Alloc<Tuple2<span_t, int>>(span_type, end_index));
+  }
+
+ private:
+  List<Tuple2<span_t, int>*>* spans_;
+};
+
+// Like SpansToParts() in ifs_split.py, but it slices s as the spans arrive.
+class PartSink {
+ public:
+  PartSink(Str* s, List<Str*>* parts)
+      : s_(s),
+        parts_(parts),
+        start_index_(0),
+        join_next_(false),
+        last_span_was_black_(false) {
+  }
+  void Add(span_t span_type, int end_index) {
+    switch (span_type) {
+    case span_e::Black: {
+      Str* part =
+          StrFromC(s_->data_ + start_index_, end_index - start_index_);
+      int num_parts = len(parts_);
+      if (num_parts && join_next_) {
+        // Rare: an escaped delimiter
+        parts_->set(num_parts - 1, str_concat(parts_->index_(-1), part));
+        join_next_ = false;
+      } else {
+        parts_->append(part);
+      }
+      last_span_was_black_ = true;
+    } break;
+
+    case span_e::Backslash:
+      if (last_span_was_black_) {
+        join_next_ = true;
+      }
+      last_span_was_black_ = false;
+      break;
+
+    default:
+      last_span_was_black_ = false;
+      break;
+    }
+    start_index_ = end_index;
+  }
+
+ private:
+  Str* s_;
+  List<Str*>* parts_;
+  int start_index_;
+  bool join_next_;
+  bool last_span_was_black_;
+};
+
+List<Tuple2<span_t, int>*>* Spans(Str* s, Str* char_kinds, bool allow_escape) {
+  auto spans = NewList<Tuple2<span_t, int>*>();
+  SpanSink sink(spans);
+  RunStateMachine(s, char_kinds, allow_escape, &sink);
+  return spans;
+}
+
+List<Str*>* Parts(Str* s, Str* char_kinds, bool allow_escape) {
+  auto parts = NewList<Str*>();
+  PartSink sink(s, parts);
+  RunStateMachine(s, char_kinds, allow_escape, &sink);
+  return parts;
+}
+
+}  // namespace ifs_split
+
+namespace printf_format {
+
+static void WritePadded(mylib::BufWriter* buf, const char* s, int n, int width,
+                        bool left) {
+  int pad = width - n;
+  if (!left) {
+    buf->WriteRepeated(' ', pad);
+  }
+  buf->WriteRaw(s, n);
+  if (left) {
+    buf->WriteRepeated(' ', pad);
+  }
+}
+
+void WriteStr(mylib::BufWriter* buf, Str* s, int width, int precision,
+              bool left) {
+  int n = len(s);
+  if (precision >= 0 && precision < n) {
+    n = precision;
+  }
+  WritePadded(buf, s->data_, n, width, left);
+}
+
+// Like printf_format.py, but the digits are formatted on the stack, and the
+// zeros and spaces are written straight to the buffer.
+void WriteInt(mylib::BufWriter* buf, int d, Str* typ, int width, int precision,
+              bool zero, bool left) {
+  const char* fmt;
+  switch (typ->data_[0]) {
+  case 'o':
+    fmt = "%o";
+    break;
+  case 'x':
+    fmt = "%x";
+    break;
+  case 'X':
+    fmt = "%X";
+    break;
+  default:  // diu
+    fmt = "%d";
+    break;
+  }
+
+  char s[kIntBufSize];
+  int n = snprintf(s, kIntBufSize, fmt, d);
+  int sign_len = s[0] == '-' ? 1 : 0;
+
+  // There are TWO different ways to ZERO PAD, and they differ on the
+  // negative sign!  See spec/builtin-printf
+  int num_zeros = 0;
+  if (width >= 0 && zero) {
+    num_zeros = width - n;  // [%06d] -42 becomes [-00042] (6 TOTAL)
+  } else if (precision > 0 && n < precision) {
+    num_zeros = precision - (n - sign_len);  // [%6.6d] -42 -> [-000042]
+  }
+
+  if (num_zeros <= 0) {
+    WritePadded(buf, s, n, width, left);
+    return;
+  }
+
+  int pad = width - (n + num_zeros);
+  if (!left) {
+    buf->WriteRepeated(' ', pad);
+  }
+  buf->WriteRaw(s, sign_len);
+  buf->WriteRepeated('0', num_zeros);
+  buf->WriteRaw(s + sign_len, n - sign_len);
+  if (left) {
+    buf->WriteRepeated(' ', pad);
+  }
+}
+
+}  // namespace printf_format
+
+namespace utf8 {
+
+const uint64_t kHighBits = 0x8080808080808080ULL;
+
+// Returns the position of the first byte >= 0x80 at or after i, or n.  Checks
+// 8 bytes at a time, which the compiler can vectorize.
+static int SkipAscii(const char* data, int i, int n) {
+  while (i + 8 <= n) {
+    uint64_t word;
+    memcpy(&word, data + i, 8);
+    if (word & kHighBits) {
+      break;
+    }
+    i += 8;
+  }
+  while (i < n && static_cast<uint8_t>(data[i]) < 0x80) {
+    i++;
+  }
+  return i;
+}
+
+// Like _CharLen() in utf8.py
+static inline int CharLen(uint8_t b) {
+  if ((b >> 7) == 0b0) {
+    return 1;
+  }
+  if ((b >> 5) == 0b110) {
+    return 2;
+  }
+  if ((b >> 4) == 0b1110) {
+    return 3;
+  }
+  if ((b >> 3) == 0b11110) {
+    return 4;
+  }
+  return -1;  // a continuation byte, or invalid
+}
+
+// Like _Next() in utf8.py
+static int NextChar(const char* data, int i, int n) {
+  int length = CharLen(data[i]);
+  if (length == -1 || i + length > n) {
+    return -1;
+  }
+  for (int j = i + 1; j < i + length; ++j) {
+    if ((static_cast<uint8_t>(data[j]) >> 6) != 0b10) {
+      return -1;
+    }
+  }
+  return i + length;
+}
+
+bool IsAscii(Str* s) {
+  int n = len(s);
+  return SkipAscii(s->data_, 0, n) == n;
+}
+
+int CountChars(Str* s) {
+  const char* data = s->data_;
+  int n = len(s);
+  int num_chars = 0;
+  int i = 0;
+  while (true) {
+    int end = SkipAscii(data, i, n);
+    num_chars += end - i;
+    if (end == n) {
+      return num_chars;
+    }
+    i = NextChar(data, end, n);
+    if (i == -1) {
+      return -1;
+    }
+    num_chars++;
+  }
+}
+
+int Advance(Str* s, int num_chars, int byte_offset) {
+  const char* data = s->data_;
+  int n = len(s);
+  int i = byte_offset;
+  while (num_chars > 0 && i < n) {
+    // Skip ASCII, but no more than the characters we need
+    int limit = n - i < num_chars ? n : i + num_chars;
+    int end = SkipAscii(data, i, limit);
+    num_chars -= end - i;
+    i = end;
+    if (num_chars == 0 || i == n) {
+      break;
+    }
+    i = NextChar(data, i, n);
+    if (i == -1) {
+      return -1;
+    }
+    num_chars--;
+  }
+  return i;
+}
+
+int Retreat(Str* s, int num_chars, int byte_offset) {
+  const char* data = s->data_;
+  int i = byte_offset;
+  for (; num_chars > 0; --num_chars) {
+    int end = i;
+    uint8_t b;
+    do {
+      if (i == 0) {
+        return -1;  // not enough characters
+      }
+      b = data[--i];
+    } while ((b >> 6) == 0b10);
+
+    if (CharLen(b) != end - i) {
+      return -1;
+    }
+  }
+  return i;
+}
+
+}  // namespace utf8
@@ -3,6 +3,7 @@
 #ifndef LEAKY_OSH_H
 #define LEAKY_OSH_H
 
+#include "_gen/core/runtime.asdl.h"
 #include "_gen/frontend/syntax.asdl.h"
 #include "cpp/osh_tdop.h"
 #include "mycpp/runtime.h"
@@ -31,6 +32,34 @@ bool DoBinaryOp(Id_t op_id, Str* s1, Str* s2);
 
 }  // namespace bool_stat
 
+namespace ifs_split {
+
+using runtime_asdl::span_t;
+
+Str* CharKinds(Str* ifs_whitespace, Str* ifs_other);
+List<Tuple2<span_t, int>*>* Spans(Str* s, Str* char_kinds, bool allow_escape);
+List<Str*>* Parts(Str* s, Str* char_kinds, bool allow_escape);
+
+}  // namespace ifs_split
+
+namespace printf_format {
+
+void WriteStr(mylib::BufWriter* buf, Str* s, int width, int precision,
+              bool left);
+void WriteInt(mylib::BufWriter* buf, int d, Str* typ, int width, int precision,
+              bool zero, bool left);
+
+}  // namespace printf_format
+
+namespace utf8 {
+
+bool IsAscii(Str* s);
+int CountChars(Str* s);
+int Advance(Str* s, int num_chars, int byte_offset);
+int Retreat(Str* s, int num_chars, int byte_offset);
+
+}  // namespace utf8
+
 namespace sh_expr_eval {
 
 inline bool IsLower(Str* ch) {
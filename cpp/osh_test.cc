@@ -33,6 +33,109 @@ TEST functions_test() {
   PASS();
 }
 
+// Returns the parts joined with |, for easy comparison
+Str* SplitParts(Str* char_kinds, const char* s, bool allow_escape = true) {
+  List<Str*>* parts = ifs_split::Parts(StrFromC(s), char_kinds, allow_escape);
+  return StrFromC("|")->join(parts);
+}
+
+TEST ifs_split_test() {
+  Str* default_ifs = ifs_split::CharKinds(StrFromC(" \t\n"), StrFromC(""));
+  ASSERT_EQ(256, len(default_ifs));
+
+  ASSERT(str_equals0("", SplitParts(default_ifs, "")));
+  ASSERT(str_equals0("", SplitParts(default_ifs, " \t ")));
+  ASSERT(str_equals0("a|b", SplitParts(default_ifs, "  a \tb\n")));
+  ASSERT(str_equals0("a b|c", SplitParts(default_ifs, "a\\ b c")));
+  ASSERT(str_equals0("a\\|b", SplitParts(default_ifs, "a\\ b", false)));
+
+  // IFS='_ '
+  Str* mixed = ifs_split::CharKinds(StrFromC(" "), StrFromC("_"));
+  ASSERT(str_equals0("a||b", SplitParts(mixed, "a __ b")));
+  ASSERT(str_equals0("|a", SplitParts(mixed, " _ a _ ")));
+
+  // Bytes above 127
+  ASSERT(str_equals0("\xce\xbc|\xff", SplitParts(mixed, "\xce\xbc_\xff")));
+
+  // The spans that read uses
+  List<Tuple2<runtime_asdl::span_t, int>*>* spans =
+      ifs_split::Spans(StrFromC(" a_b"), mixed, true);
+  ASSERT_EQ(4, len(spans));
+  ASSERT(spans->index_(0)->at0() == runtime_asdl::span_e::Delim);
+  ASSERT_EQ(1, spans->index_(0)->at1());
+  ASSERT(spans->index_(1)->at0() == runtime_asdl::span_e::Black);
+  ASSERT_EQ(2, spans->index_(1)->at1());
+  ASSERT(spans->index_(3)->at0() == runtime_asdl::span_e::Black);
+  ASSERT_EQ(4, spans->index_(3)->at1());
+
+  PASS();
+}
+
+// Returns what printf_format::WriteInt() writes
+Str* FormatInt(int d, const char* typ, int width, int precision,
+               bool zero = false, bool left = false) {
+  auto buf = Alloc<mylib::BufWriter>();
+  printf_format::WriteInt(buf, d, StrFromC(typ), width, precision, zero, left);
+  return buf->getvalue();
+}
+
+TEST printf_format_test() {
+  auto buf = Alloc<mylib::BufWriter>();
+  printf_format::WriteStr(buf, StrFromC("hello"), 7, 3, false);
+  printf_format::WriteStr(buf, StrFromC("|"), -1, -1, false);
+  printf_format::WriteStr(buf, StrFromC("ab"), 4, -1, true);
+  ASSERT(str_equals0("    hel|ab  ", buf->getvalue()));
+
+  ASSERT(str_equals0("42", FormatInt(42, "d", -1, -1)));
+  ASSERT(str_equals0("  -42", FormatInt(-42, "d", 5, -1)));
+  ASSERT(str_equals0("-42  ", FormatInt(-42, "d", 5, -1, false, true)));
+  ASSERT(str_equals0("ff", FormatInt(255, "x", -1, -1)));
+  ASSERT(str_equals0("FF", FormatInt(255, "X", -1, -1)));
+  ASSERT(str_equals0("377", FormatInt(255, "o", -1, -1)));
+
+  // The two kinds of zero padding
+  ASSERT(str_equals0("-00042", FormatInt(-42, "d", 6, -1, true)));
+  ASSERT(str_equals0("-000042", FormatInt(-42, "d", 6, 6)));
+  ASSERT(str_equals0("  0042", FormatInt(42, "d", 6, 4)));
+  ASSERT(str_equals0("-42", FormatInt(-42, "d", -1, 3)));
+
+  PASS();
+}
+
+TEST utf8_test() {
+  // Long enough to check 8 bytes at a time.  mu is 2 bytes.
+  Str* ascii = StrFromC("0123456789abcdef0123");
+  Str* mixed = StrFromC("0123456789\xce\xbc" "abcdef");
+  Str* bad = StrFromC("0123456789ab\xff");
+
+  ASSERT(utf8::IsAscii(ascii));
+  ASSERT(!utf8::IsAscii(mixed));
+  ASSERT(utf8::IsAscii(StrFromC("")));
+
+  ASSERT_EQ_FMT(20, utf8::CountChars(ascii), "%d");
+  ASSERT_EQ_FMT(17, utf8::CountChars(mixed), "%d");
+  ASSERT_EQ_FMT(-1, utf8::CountChars(bad), "%d");
+  // Incomplete character
+  ASSERT_EQ_FMT(-1, utf8::CountChars(StrFromC("0123456789\xce")), "%d");
+
+  ASSERT_EQ_FMT(15, utf8::Advance(ascii, 15, 0), "%d");
+  ASSERT_EQ_FMT(20, utf8::Advance(ascii, 99, 3), "%d");
+  ASSERT_EQ_FMT(12, utf8::Advance(mixed, 11, 0), "%d");
+  ASSERT_EQ_FMT(14, utf8::Advance(mixed, 3, 10), "%d");
+  ASSERT_EQ_FMT(12, utf8::Advance(bad, 12, 0), "%d");
+  ASSERT_EQ_FMT(-1, utf8::Advance(bad, 13, 0), "%d");
+
+  ASSERT_EQ_FMT(17, utf8::Retreat(ascii, 3, 20), "%d");
+  ASSERT_EQ_FMT(10, utf8::Retreat(mixed, 7, 18), "%d");
+  ASSERT_EQ_FMT(9, utf8::Retreat(mixed, 8, 18), "%d");
+  // Not enough characters, or lands in the middle of one
+  ASSERT_EQ_FMT(-1, utf8::Retreat(ascii, 21, 20), "%d");
+  ASSERT_EQ_FMT(-1, utf8::Retreat(mixed, 1, 11), "%d");
+  ASSERT_EQ_FMT(-1, utf8::Retreat(bad, 1, 13), "%d");
+
+  PASS();
+}
+
 GREATEST_MAIN_DEFS();
 
 int main(int argc, char** argv) {
@@ -42,6 +145,9 @@ int main(int argc, char** argv) {
 
   RUN_TEST(bool_stat_test);
   RUN_TEST(functions_test);
+  RUN_TEST(ifs_split_test);
+  RUN_TEST(printf_format_test);
+  RUN_TEST(utf8_test);
 
   gHeap.CleanProcessExit();
 
@@ -2,14 +2,129 @@
 
 #include "pgen2.h"
 
+#include "_gen/oil_lang/grammar_tables.h"
+
+using pnode::PNode;
+using syntax_asdl::Token;
+
+namespace gt = grammar_tables;
+
+namespace grammar {
+
+int Grammar::TokenLabel(int id) {
+  if (id < 0 || id >= gt::kNumTokenLabels) {
+    return -1;
+  }
+  return gt::kTokenLabels[id];
+}
+
+int Grammar::KeywordLabel(Str* s) {
+  int n = len(s);
+  for (int i = 0; i < gt::kNumKeywords; ++i) {
+    const gt::Keyword& k = gt::kKeywords[i];
+    if (k.len == n && memcmp(k.name, s->data_, n) == 0) {
+      return k.label;
+    }
+  }
+  return -1;
+}
+
+Str* Grammar::SymbolName(int num) {
+  return StrFromC(gt::kSymbolNames[num - 256]);
+}
+
+}  // namespace grammar
+
 namespace parse {
 
+static inline bool InFirstSet(const gt::Dfa& dfa, int ilabel) {
+  return dfa.first_set[ilabel >> 3] & (1 << (ilabel & 7));
+}
+
 void Parser::setup(int start) {
-  assert(0);
+  rootnode = Alloc<PNode>(start, nullptr, NewList<PNode*>());
+  nodes_[0] = rootnode;
+  dfas_[0] = start - 256;
+  states_[0] = 0;
+  depth_ = 1;
+}
+
+// Same algorithm as parse.py, but the arcs, accept states, and first sets come
+// from the generated tables.
+bool Parser::addtoken(int typ, Token* opaque, int ilabel) {
+  while (true) {
+    const gt::Dfa& dfa = gt::kDfas[dfas_[depth_ - 1]];
+    const gt::State* st = &gt::kStates[dfa.first_state + states_[depth_ - 1]];
+
+    const gt::Arc* arc = &gt::kArcs[st->first_arc];
+    const gt::Arc* end = arc + st->num_arcs;
+    for (; arc != end; ++arc) {
+      if (arc->label == ilabel) {
+        // Shift a token; we're done with it
+        shift(typ, opaque, arc->next_state);
+
+        // Pop while we are in an accept-only state
+        while (true) {
+          const gt::Dfa& top = gt::kDfas[dfas_[depth_ - 1]];
+          if (!gt::kStates[top.first_state + states_[depth_ - 1]].accept_only) {
+            break;
+          }
+          pop();
+          if (depth_ == 0) {
+            return true;  // Done parsing!
+          }
+        }
+        return false;  // Done with this token
+      }
+
+      int t = gt::kLabels[arc->label];
+      if (t >= 256 && InFirstSet(gt::kDfas[t - 256], ilabel)) {
+        // Push a symbol, and continue the outer loop
+        push(t, opaque, arc->next_state);
+        break;
+      }
+    }
+    if (arc != end) {
+      continue;
+    }
+
+    if (!st->is_final) {
+      // No success finding a transition
+      throw Alloc<ParseError>(StrFromC("bad input"), typ, opaque);
+    }
+    // An accepting state, pop it and try something else
+    pop();
+    if (depth_ == 0) {
+      // Done parsing, but another token is input
+      throw Alloc<ParseError>(StrFromC("too much input"), typ, opaque);
+    }
+  }
+}
+
+void Parser::shift(int typ, Token* opaque, int newstate) {
+  PNode* newnode = Alloc<PNode>(typ, opaque, nullptr);
+  nodes_[depth_ - 1]->children->append(newnode);
+  states_[depth_ - 1] = newstate;
+}
+
+void Parser::push(int typ, Token* opaque, int newstate) {
+  if (depth_ == kMaxDepth) {
+    throw Alloc<ParseError>(StrFromC("expression is too deeply nested"), typ,
+                            opaque);
+  }
+  states_[depth_ - 1] = newstate;
+
+  PNode* newnode = Alloc<PNode>(typ, opaque, NewList<PNode*>());
+  nodes_[depth_ - 1]->children->append(newnode);  // see pgen2.h
+
+  nodes_[depth_] = newnode;
+  dfas_[depth_] = typ - 256;
+  states_[depth_] = 0;
+  depth_++;
 }
 
-bool Parser::addtoken(int typ, syntax_asdl::Token* opaque, int ilabel) {
-  assert(0);
+void Parser::pop() {
+  depth_--;  // the node is already in its parent's children
 }
 
 }  // namespace parse
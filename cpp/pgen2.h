@@ -1,4 +1,8 @@
-// pgen2.h
+// pgen2.h: Replacement for pgen2/parse.py, pgen2/grammar.py, and
+// pgen2/pnode.py
+//
+// The parsing tables are constant arrays generated from
+// oil_lang/grammar.pgen2 by pgen2/grammar.py.
 
 #ifndef LEAKY_PGEN2_H
 #define LEAKY_PGEN2_H
@@ -7,45 +11,115 @@
 #include "_gen/frontend/syntax.asdl.h"
 #include "mycpp/runtime.h"
 
-// Hacky forward declaration for translated pgen2/pnode.py
-// Note: it's probably better to express PNode in ASDL, like Token.
 namespace pnode {
-class PNode;
-}
-// Hacky stub
+
+class PNode {
+ public:
+  PNode(int typ, syntax_asdl::Token* tok, List<PNode*>* children)
+      : GC_CLASS_FIXED(header_, field_mask(), sizeof(PNode)),
+        tok(tok),
+        children(children),
+        typ(typ) {
+  }
+
+  GC_OBJ(header_);
+  syntax_asdl::Token* tok;
+  List<PNode*>* children;
+  int typ;  // token or non-terminal
+
+  static constexpr uint16_t field_mask() {
+    return maskbit(offsetof(PNode, tok)) | maskbit(offsetof(PNode, children));
+  }
+
+  DISALLOW_COPY_AND_ASSIGN(PNode)
+};
+
+}  // namespace pnode
+
 namespace grammar {
-class Grammar;
-}
+
+// In C++, the grammar is a constant, so this object has no state.  The
+// accessors look up the generated tables.
+class Grammar {
+ public:
+  Grammar() : GC_CLASS_FIXED(header_, kZeroMask, sizeof(Grammar)) {
+  }
+
+  int TokenLabel(int id);
+  int KeywordLabel(Str* s);
+  Str* SymbolName(int num);
+
+  GC_OBJ(header_);
+
+  DISALLOW_COPY_AND_ASSIGN(Grammar)
+};
+
+}  // namespace grammar
 
 namespace parse {
 
 class ParseError {
  public:
-  ParseError(Str* msg, int type_, syntax_asdl::Token* tok);
+  ParseError(Str* msg, int type_, syntax_asdl::Token* tok)
+      : GC_CLASS_FIXED(header_, field_mask(), sizeof(ParseError)),
+        msg(msg),
+        tok(tok),
+        type(type_) {
+  }
 
+  GC_OBJ(header_);
   Str* msg;
   syntax_asdl::Token* tok;
   int type;
+
+  static constexpr uint16_t field_mask() {
+    return maskbit(offsetof(ParseError, msg)) |
+           maskbit(offsetof(ParseError, tok));
+  }
 };
 
+// A table-driven LL(1) parser.  The stack is a fixed-size array in the
+// object, so parsing doesn't allocate anything but the PNodes.  ExprParser
+// reuses a Parser across parses.
+//
+// Unlike parse.py, a node is appended to its parent's children when it's
+// pushed, not when it's popped.  The result is the same, but every node on the
+// stack is reachable from rootnode, so the GC doesn't need to trace the stack.
 class Parser {
  public:
-  // In C, the grammar is a constant, so the grammar arg is ignored.  (We can't
-  // get easily rid of it because the call site has to type check and run in
-  // Python.)
-  explicit Parser(grammar::Grammar* grammar) {
+  // The grammar arg is ignored.  (We can't easily get rid of it because the
+  // call site has to type check and run in Python.)
+  explicit Parser(grammar::Grammar* grammar)
+      : GC_CLASS_FIXED(header_, field_mask(), sizeof(Parser)),
+        rootnode(nullptr),
+        depth_(0) {
   }
   void setup(int start);
   bool addtoken(int typ, syntax_asdl::Token* opaque, int ilabel);
 
-  // Probably should delete these
-  // void shift(int typ, syntax_asdl::Token* opaque, int newstate);
-  // void push(int typ, syntax_asdl::Token* opaque, Tuple2<List<List<Tuple2<int,
-  // int>*>*>*, Dict<int, int>*>* newdfa, int newstate);  void pop();
-
-  // grammar::Grammar* grammar;
+  GC_OBJ(header_);
+  // Unlike parse.py, this is set by setup(), but it's only complete after
+  // addtoken() returns true.
   pnode::PNode* rootnode;
-  // List<parse::_StackItem*>* stack;
+
+  static constexpr uint16_t field_mask() {
+    return maskbit(offsetof(Parser, rootnode));
+  }
+
+  // Each level of brackets in an expression takes about 16 entries
+  static const int kMaxDepth = 512;
+
+ private:
+  void shift(int typ, syntax_asdl::Token* opaque, int newstate);
+  void push(int typ, syntax_asdl::Token* opaque, int newstate);
+  void pop();
+
+  int depth_;
+  pnode::PNode* nodes_[kMaxDepth];  // not traced, see above
+  uint8_t dfas_[kMaxDepth];         // symbol number - 256
+  uint8_t states_[kMaxDepth];
+
+  DISALLOW_COPY_AND_ASSIGN(Parser)
 };
 
 }  // namespace parse
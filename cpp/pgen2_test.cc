@@ -0,0 +1,124 @@
+#include "cpp/pgen2.h"
+
+#include "_gen/oil_lang/grammar_nt.h"
+#include "vendor/greatest.h"
+
+using id_kind_asdl::Id;
+using pnode::PNode;
+using syntax_asdl::Token;
+
+Token* MakeToken(int id, const char* s) {
+  return Alloc<Token>(id, -1, -1, -1, nullptr, StrFromC(s));
+}
+
+TEST grammar_test() {
+  auto gr = Alloc<grammar::Grammar>();
+
+  ASSERT(gr->TokenLabel(Id::Expr_DecInt) > 0);
+  ASSERT(gr->TokenLabel(Id::Arith_Plus) > 0);
+  ASSERT_EQ(-1, gr->TokenLabel(Id::Lit_Chars));
+  ASSERT_EQ(-1, gr->TokenLabel(1000));
+
+  ASSERT(gr->KeywordLabel(StrFromC("var")) > 0);
+  ASSERT_EQ(-1, gr->KeywordLabel(StrFromC("va")));
+  ASSERT_EQ(-1, gr->KeywordLabel(StrFromC("variable")));
+
+  ASSERT(str_equals(StrFromC("command_expr"),
+                    gr->SymbolName(grammar_nt::command_expr)));
+
+  PASS();
+}
+
+// Returns the number of tokens consumed, or -1 for a parse error
+int Parse(parse::Parser* p, grammar::Grammar* gr, int start,
+          std::initializer_list<int> ids) {
+  p->setup(start);
+  int n = 0;
+  for (int id : ids) {
+    n++;
+    try {
+      if (p->addtoken(id, MakeToken(id, "x"), gr->TokenLabel(id))) {
+        return n;
+      }
+    } catch (parse::ParseError* e) {
+      return -1;
+    }
+  }
+  return n;
+}
+
+// The rightmost leaf of the tree
+PNode* LastLeaf(PNode* node) {
+  while (node->children) {
+    node = node->children->index_(len(node->children) - 1);
+  }
+  return node;
+}
+
+TEST parser_test() {
+  auto gr = Alloc<grammar::Grammar>();
+  auto p = Alloc<parse::Parser>(gr);
+  int start = grammar_nt::command_expr;
+
+  // 1 + 2
+  ASSERT_EQ(4, Parse(p, gr, start,
+                     {Id::Expr_DecInt, Id::Arith_Plus, Id::Expr_DecInt,
+                      Id::Op_Newline}));
+  PNode* root = p->rootnode;
+  ASSERT_EQ(start, root->typ);
+  ASSERT_EQ(2, len(root->children));  // testlist end_stmt
+  ASSERT_EQ(Id::Op_Newline, LastLeaf(root)->typ);
+
+  // The parser is reused, and doesn't touch the old tree
+  ASSERT_EQ(4, Parse(p, gr, start,
+                     {Id::Op_LBracket, Id::Expr_DecInt, Id::Op_RBracket,
+                      Id::Eof_Real}));
+  ASSERT(p->rootnode != root);
+  ASSERT_EQ(Id::Op_Newline, LastLeaf(root)->typ);
+  ASSERT_EQ(Id::Eof_Real, LastLeaf(p->rootnode)->typ);
+
+  // Bad input
+  ASSERT_EQ(-1, Parse(p, gr, start, {Id::Op_RParen}));
+  ASSERT_EQ(-1, Parse(p, gr, start, {Id::Expr_DecInt, Id::Expr_DecInt}));
+
+  PASS();
+}
+
+TEST nesting_test() {
+  auto gr = Alloc<grammar::Grammar>();
+  auto p = Alloc<parse::Parser>(gr);
+  int start = grammar_nt::command_expr;
+
+  // ((((1)))) is fine, but too many brackets exhaust the stack
+  p->setup(start);
+  int levels = 0;
+  try {
+    for (levels = 0; levels < 1000; ++levels) {
+      p->addtoken(Id::Op_LParen, MakeToken(Id::Op_LParen, "("),
+                  gr->TokenLabel(Id::Op_LParen));
+    }
+  } catch (parse::ParseError* e) {
+    ASSERT(str_equals(StrFromC("expression is too deeply nested"), e->msg));
+  }
+  ASSERT(levels > 20);
+  ASSERT(levels < 1000);
+
+  PASS();
+}
+
+GREATEST_MAIN_DEFS();
+
+int main(int argc, char** argv) {
+  gHeap.Init();
+
+  GREATEST_MAIN_BEGIN();
+
+  RUN_TEST(grammar_test);
+  RUN_TEST(parser_test);
+  RUN_TEST(nesting_test);
+
+  gHeap.CleanProcessExit();
+
+  GREATEST_MAIN_END(); /* display results */
+  return 0;
+}
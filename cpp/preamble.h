@@ -14,6 +14,7 @@
 #include "_gen/frontend/syntax.asdl.h"
 #include "_gen/frontend/types.asdl.h"
 #include "_gen/oil_lang/grammar_nt.h"
+#include "cpp/asdl_serialize.h"
 #include "cpp/core.h"
 #include "cpp/fanos.h"
 #include "cpp/frontend_flag_spec.h"
@@ -54,6 +54,24 @@ int open(Str* path, int flags, int perms) {
   return result;
 }
 
+void write(int fd, Str* s) {
+  // Like posix_write() in pyext/posixmodule.c, retry on EINTR.  Unlike it,
+  // loop on partial writes, e.g. to a pipe that's filled up.
+  char* p = s->data_;
+  int n = len(s);
+  while (n > 0) {
+    ssize_t num_written = ::write(fd, p, n);
+    if (num_written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      throw Alloc<OSError>(errno);
+    }
+    p += num_written;
+    n -= num_written;
+  }
+}
+
 void dup2(int oldfd, int newfd) {
   if (::dup2(oldfd, newfd) < 0) {
     throw Alloc<OSError>(errno);
@@ -97,15 +97,8 @@ inline void _exit(int status) {
   ::_exit(status);
 }
 
-inline void write(int fd, Str* s) {
-  //
-  // IMPORTANT TODO: Write in a loop like posix_write() in pyext/posixmodule.c
-  //
-
-  if (::write(fd, s->data_, len(s)) < 0) {
-    throw Alloc<OSError>(errno);
-  }
-}
+// Writes all of s, unlike ::write()
+void write(int fd, Str* s);
 
 // Can we use fcntl instead?
 void dup2(int oldfd, int newfd);
@@ -2,6 +2,8 @@
 
 #include <errno.h>
 #include <sys/stat.h>
+#include <sys/wait.h>  // waitpid()
+#include <unistd.h>    // fork()
 
 #include "mycpp/gc_builtins.h"
 #include "vendor/greatest.h"
@@ -56,6 +58,48 @@ TEST open_test() {
   PASS();
 }
 
+TEST write_test() {
+  // More than a pipe buffer, so the writer blocks and may write partially
+  const int n = 300000;
+  Str* big = NewStr(n);
+  memset(big->data_, 'x', n);
+
+  Tuple2<int, int> fds = posix::pipe();
+  pid_t pid = fork();
+  if (pid == 0) {
+    posix::close(fds.at0());
+    posix::write(fds.at1(), big);
+    _exit(0);
+  }
+  posix::close(fds.at1());
+
+  char buf[4096];
+  int total = 0;
+  while (true) {
+    ssize_t r = read(fds.at0(), buf, sizeof(buf));
+    if (r <= 0) {
+      break;
+    }
+    total += r;
+  }
+  posix::close(fds.at0());
+  ASSERT_EQ(n, total);
+
+  int status;
+  ASSERT_EQ(pid, waitpid(pid, &status, 0));
+  ASSERT_EQ(0, WEXITSTATUS(status));
+
+  bool caught = false;
+  try {
+    posix::write(-1, big);
+  } catch (IOError_OSError* e) {
+    caught = true;
+  }
+  ASSERT(caught);
+
+  PASS();
+}
+
 TEST time_test() {
   int ts = time_::time();
   log("ts = %d", ts);
@@ -135,6 +179,7 @@ int main(int argc, char** argv) {
   RUN_TEST(posix_test);
   RUN_TEST(putenv_test);
   RUN_TEST(open_test);
+  RUN_TEST(write_test);
   RUN_TEST(time_test);
   RUN_TEST(mtime_demo);
   RUN_TEST(listdir_test);
@@ -137,7 +137,8 @@ def NinjaGraph(ru):
 
   ru.asdl_library(
       'frontend/syntax.asdl',
-      deps = ['//frontend/id_kind.asdl'])
+      deps = ['//frontend/id_kind.asdl'],
+      serialize_methods = True)
 
   ru.cc_binary(
       'frontend/syntax_asdl_test.cc',
@@ -167,6 +167,56 @@ def _WriteDefaults(cc_f, defaults_name, defaults):
 ''')
 
 
+def _NameHash(s, seed):
+  """32-bit FNV-1a with a seed.  Must match _NameHash() in the generated C++."""
+  h = seed
+  for c in s:
+    h = ((h ^ ord(c)) * 16777619) & 0xFFFFFFFF
+  return h
+
+
+def _PerfectHash(names):
+  """Find a seed so that the names hash to distinct slots.
+
+  Returns (seed, slots), where slots is a list of indices into names, or -1.
+  """
+  size = 1
+  while size < 4 * len(names):  # sparse enough that a seed is found quickly
+    size *= 2
+
+  for seed in xrange(1000000):
+    slots = [-1] * size
+    for i, name in enumerate(names):
+      j = _NameHash(name, seed) & (size - 1)
+      if slots[j] != -1:
+        break
+      slots[j] = i
+    else:
+      return seed, slots
+
+  raise AssertionError("Couldn't find a perfect hash for %s" % names)
+
+
+def _WriteIndexFunc(cc_f, func_name, table_name, names):
+  seed, slots = _PerfectHash(names)
+
+  cc_f.write('static const int16_t %s_slots[] = {\n' % func_name)
+  for i in xrange(0, len(slots), 16):
+    cc_f.write('    %s,\n' % ', '.join(str(j) for j in slots[i:i+16]))
+  cc_f.write("""\
+};
+
+int %s(Str* spec_name) {
+  int i = %s_slots[_NameHash(spec_name, %d) & %d];
+  if (i != -1 && str_equals0(%s[i].name, spec_name)) {
+    return i;
+  }
+  return -1;
+}
+
+""" % (func_name, func_name, seed, len(slots) - 1, table_name))
+
+
 def Cpp(specs, header_f, cc_f):
   counter = itertools.count()
 
@@ -290,14 +340,22 @@ class %s {
 """)
 
   header_f.write("""
+const int kNumFlagSpecs = %d;
+const int kNumFlagSpecsAndMore = %d;
+
 extern FlagSpec_c kFlagSpecs[];
 extern FlagSpecAndMore_c kFlagSpecsAndMore[];
 
+// Perfect hashes of the spec names.  Return an index into the arrays above, or
+// -1 if there's no such spec.
+int FlagSpecIndex(Str* spec_name);
+int FlagSpecAndMoreIndex(Str* spec_name);
+
 }  // namespace arg_types
 
 #endif  // ARG_TYPES_H
 
-""")
+""" % (len(flag_spec.FLAG_SPEC), len(flag_spec.FLAG_SPEC_AND_MORE)))
 
   cc_f.write("""\
 // arg_types.cc is generated by frontend/flag_gen.py
@@ -406,8 +464,23 @@ namespace arg_types {
   cc_f.write("""\
     {},
 };
+
+static inline uint32_t _NameHash(Str* s, uint32_t seed) {
+  uint32_t h = seed;
+  int n = len(s);
+  for (int i = 0; i < n; ++i) {
+    h = (h ^ static_cast<unsigned char>(s->data_[i])) * 16777619;
+  }
+  return h;
+}
+
 """)
 
+  _WriteIndexFunc(cc_f, 'FlagSpecIndex', 'kFlagSpecs',
+                  sorted(flag_spec.FLAG_SPEC))
+  _WriteIndexFunc(cc_f, 'FlagSpecAndMoreIndex', 'kFlagSpecsAndMore',
+                  sorted(flag_spec.FLAG_SPEC_AND_MORE))
+
   cc_f.write("""\
 }  // namespace arg_types
 """)
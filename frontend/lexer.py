@@ -10,14 +10,13 @@ lexer.py - Library for lexing.
 
 from _devbuild.gen.syntax_asdl import Token, SourceLine
 from _devbuild.gen.types_asdl import lex_mode_t, lex_mode_e
-from _devbuild.gen.id_kind_asdl import Id_t, Id, Id_str, Kind
+from _devbuild.gen.id_kind_asdl import Id_t, Id, Id_str
 from asdl import runtime
 from core.pyerror import log
 from mycpp import mylib
-from frontend import consts
 from frontend import match
 
-from typing import List, Tuple, Optional, Counter, TYPE_CHECKING
+from typing import List, Tuple, Counter, TYPE_CHECKING
 if TYPE_CHECKING:
   from core.alloc import Arena
   from frontend.reader import _Reader
@@ -36,8 +35,14 @@ def IsPlusEquals(tok):
 
 def TokenVal(tok):
   # type: (Token) -> str
-  """Compute string value on demand."""
-  return tok.line.content[tok.col : tok.col + tok.length]
+  """Compute string value on demand, and cache it on the token.
+
+  LineLexer.Read() doesn't copy the value out of the line, since most tokens
+  are never inspected.
+  """
+  if tok.tval is None:
+    tok.tval = tok.line.content[tok.col : tok.col + tok.length]
+  return tok.tval
 
 
 def TokenSliceLeft(tok, left_index):
@@ -64,12 +69,24 @@ def DummyToken(id_, val):
   return Token(id_, col, length, runtime.NO_SPID, None, val)
 
 
+# Upper bound on the number of tokens LineLexer lexes ahead
+_MAX_BATCH = 32
+
+
 class LineLexer(object):
   def __init__(self, arena):
     # type: (Arena) -> None
     self.arena = arena
     self.replace_last_token = False  # For MaybeUnreadOne
 
+    # Tokens lexed ahead in one call, as (id, end_pos) pairs.  See
+    # _NextToken().
+    self.batch = []  # type: List[int]
+    self.batch_i = 0  # index of the next pair
+    self.batch_mode = lex_mode_e.ShCommand  # the mode they were lexed in
+    self.batch_pos = 0  # where the next pair starts
+    self.batch_size = 1  # how many tokens to lex next time
+
     self.Reset(None, 0)  # Invalid src_line to start
 
   def __repr__(self):
@@ -82,6 +99,14 @@ class LineLexer(object):
     self.src_line = src_line
     self.line_pos = line_pos
 
+    del self.batch[:]  # they were for the old line
+    self.batch_i = 0
+
+  def AtEnd(self):
+    # type: () -> bool
+    """Whether the current line has been consumed."""
+    return self.src_line is None or self.line_pos == len(self.src_line.content)
+
   def MaybeUnreadOne(self):
     # type: () -> bool
     """Return True if we can unread one character, or False otherwise.
@@ -203,6 +228,45 @@ class LineLexer(object):
     else:
       return ord(self.src_line.content[pos])
 
+  def _NextToken(self, lex_mode, line_str, line_pos):
+    # type: (lex_mode_t, str, int) -> Tuple[Id_t, int]
+    """Returns (id, end_pos) of the token at line_pos.
+
+    The parser chooses the mode of each token, so tokens lexed ahead are only
+    used if the mode and position match.  We lex more at a time while they
+    match, and fewer when the mode changes.
+    """
+    batch = self.batch
+    i = self.batch_i
+    n = len(batch)
+    if i < n and lex_mode == self.batch_mode and line_pos == self.batch_pos:
+      tok_type = batch[i]
+      end_pos = batch[i + 1]
+      self.batch_i = i + 2
+      self.batch_pos = end_pos
+      return tok_type, end_pos
+
+    if n == 0:
+      # The same mode twice in a row
+      if self.batch_size == 1 and lex_mode == self.batch_mode:
+        self.batch_size = 2
+    elif i < n:  # lexed too far
+      self.batch_size = self.batch_size // 2
+    elif self.batch_size < _MAX_BATCH:  # used them all
+      self.batch_size = self.batch_size * 2
+
+    self.batch_mode = lex_mode
+    if self.batch_size <= 1:
+      del batch[:]
+      self.batch_i = 0
+      return match.OneToken(lex_mode, line_str, line_pos)
+
+    match.OshTokens(lex_mode, line_str, line_pos, self.batch_size, batch)
+    end_pos = batch[1]
+    self.batch_i = 2
+    self.batch_pos = end_pos
+    return batch[0], end_pos
+
   def Read(self, lex_mode):
     # type: (lex_mode_t) -> Token
     # Inner loop optimization
@@ -212,39 +276,25 @@ class LineLexer(object):
       line_str = ''
     line_pos = self.line_pos
 
-    tok_type, end_pos = match.OneToken(lex_mode, line_str, line_pos)
+    tok_type, end_pos = self._NextToken(lex_mode, line_str, line_pos)
     if tok_type == Id.Eol_Tok:  # Do NOT add a span for this sentinel!
       return _EOL_TOK
 
-    # Save on allocations!  We often don't look at the token value.
-    # TODO: can inline this function with formula on 16-bit Id.
-    kind = consts.GetKind(tok_type)
-
-    # Whitelist doesn't work well?  Use blacklist for now.
-    # - Kind.KW is sometimes a literal in a word
-    # - Kind.Right is for " in here docs.  Lexer isn't involved.
-    # - Got an error with Kind.Left too that I don't understand
-    # - Kind.ControlFlow doesn't work because we word_.StaticEval()
-    # if kind in (Kind.Lit, Kind.VSub, Kind.Redir, Kind.Char, Kind.Backtick, Kind.KW, Kind.Right):
-
-    if kind in (Kind.Arith, Kind.Op,
-        Kind.VTest, Kind.VOp0, Kind.VOp2, Kind.VOp3,
-        Kind.WS, Kind.Ignored, Kind.Eof):
-      tok_val = None  # type: Optional[str]
-    else:
-      tok_val = line_str[line_pos:end_pos]
+    # Save on allocations!  We often don't look at the token value, so it's
+    # materialized by TokenVal().
+
     # NOTE: We're putting the arena hook in LineLexer and not Lexer because we
     # want it to be "low level".  The only thing fabricated here is a newline
     # added at the last line, so we don't end with \0.
 
     if self.replace_last_token:  # make another token from the last span
-      self.arena.tokens.pop()
+      self.arena.PopToken()
       self.replace_last_token = False
 
     #log('LineLexer.Read() span ID %d for %s', span_id, tok_type)
 
     tok_len = end_pos - line_pos
-    t = self.arena.NewToken(tok_type, line_pos, tok_len, self.src_line, tok_val)
+    t = self.arena.NewToken(tok_type, line_pos, tok_len, self.src_line, None)
 
     self.line_pos = end_pos
     return t
@@ -273,6 +323,11 @@ class Lexer(object):
     # type: () -> None
     self.line_lexer.Reset(None, 0)
 
+  def AtLineEnd(self):
+    # type: () -> bool
+    """Whether a new parser could start at the next line."""
+    return self.line_lexer.AtEnd()
+
   def MaybeUnreadOne(self):
     # type: () -> bool
     return self.line_lexer.MaybeUnreadOne()
@@ -51,26 +51,26 @@ class LexerTest(unittest.TestCase):
     self.assertTokensEqual(Tok(Id.Lit_Chars, 'ls'), t)
     t = lexer.Read(lex_mode_e.ShCommand)
 
-    self.assertTokensEqual(Tok(Id.WS_Space, None), t)
+    self.assertTokensEqual(Tok(Id.WS_Space, ' '), t)
 
     t = lexer.Read(lex_mode_e.ShCommand)
     self.assertTokensEqual(Tok(Id.Lit_Chars, '/'), t)
 
     t = lexer.Read(lex_mode_e.ShCommand)
-    self.assertTokensEqual(Tok(Id.Op_Newline, None), t)
+    self.assertTokensEqual(Tok(Id.Op_Newline, '\n'), t)
 
     # Line two
     t = lexer.Read(lex_mode_e.ShCommand)
     self.assertTokensEqual(Tok(Id.Lit_Chars, 'ls'), t)
 
     t = lexer.Read(lex_mode_e.ShCommand)
-    self.assertTokensEqual(Tok(Id.WS_Space, None), t)
+    self.assertTokensEqual(Tok(Id.WS_Space, ' '), t)
 
     t = lexer.Read(lex_mode_e.ShCommand)
     self.assertTokensEqual(Tok(Id.Lit_Chars, '/home/'), t)
 
     t = lexer.Read(lex_mode_e.ShCommand)
-    self.assertTokensEqual(Tok(Id.Op_Newline, None), t)
+    self.assertTokensEqual(Tok(Id.Op_Newline, '\n'), t)
 
     t = lexer.Read(lex_mode_e.ShCommand)
     self.assertTokensEqual(Tok(Id.Eof_Real, ''), t)
@@ -97,13 +97,13 @@ class LexerTest(unittest.TestCase):
     self.assertTokensEqual(Tok(Id.Lit_Chars, 'foo'), t)
 
     t = lexer.Read(lex_mode_e.ExtGlob)
-    self.assertTokensEqual(Tok(Id.Op_Pipe, None), t)
+    self.assertTokensEqual(Tok(Id.Op_Pipe, '|'), t)
 
     t = lexer.Read(lex_mode_e.ExtGlob)
     self.assertTokensEqual(Tok(Id.Lit_Chars, 'bar'), t)
 
     t = lexer.Read(lex_mode_e.ExtGlob)
-    self.assertTokensEqual(Tok(Id.Op_RParen, None), t)
+    self.assertTokensEqual(Tok(Id.Op_RParen, ')'), t)
 
     # Individual cases
 
@@ -237,7 +237,7 @@ class LexerTest(unittest.TestCase):
     self.assertTokensEqual(Tok(Id.Lit_Chars, 'fun'), t)
 
     t = lexer.Read(lex_mode_e.ShCommand)
-    self.assertTokensEqual(Tok(Id.Op_LParen, None), t)
+    self.assertTokensEqual(Tok(Id.Op_LParen, '('), t)
 
     self.assertEqual(Id.Op_RParen, lexer.LookPastSpace(lex_mode_e.ShCommand))
 
@@ -247,7 +247,7 @@ class LexerTest(unittest.TestCase):
     self.assertTokensEqual(Tok(Id.Lit_Chars, 'fun'), t)
 
     t = lexer.Read(lex_mode_e.ShCommand)
-    self.assertTokensEqual(Tok(Id.WS_Space, None), t)
+    self.assertTokensEqual(Tok(Id.WS_Space, ' '), t)
 
     self.assertEqual(Id.Op_LParen, lexer.LookPastSpace(lex_mode_e.ShCommand))
 
@@ -260,7 +260,7 @@ class LexerTest(unittest.TestCase):
     self.assertTokensEqual(Tok(Id.ExtGlob_At, '@('), t)
 
     t = lexer.Read(lex_mode_e.ShCommand)
-    self.assertTokensEqual(Tok(Id.Right_ExtGlob, None), t)
+    self.assertTokensEqual(Tok(Id.Right_ExtGlob, ')'), t)
 
     t = lexer.Read(lex_mode_e.ShCommand)
     self.assertTokensEqual(Tok(Id.Eof_Real, ''), t)
@@ -273,7 +273,7 @@ class LexerTest(unittest.TestCase):
     self.assertTokensEqual(Tok(Id.Lit_Chars, 'echo'), t)
 
     t = lexer.Read(lex_mode_e.ShCommand)
-    self.assertTokensEqual(Tok(Id.WS_Space, None), t)
+    self.assertTokensEqual(Tok(Id.WS_Space, ' '), t)
 
     # Right before EOF
     t = lexer.Read(lex_mode_e.ShCommand)
@@ -293,12 +293,12 @@ class LineLexerTest(unittest.TestCase):
     #log('RIGHT %s', right)
     # self.assertTrue(test_lib.TokensEqual(left, right))
     self.assertEqual(left.id, right.id, '%s != %s' % (Id_str(left.id), Id_str(right.id)))
-    self.assertEqual(left.tval, right.tval)
+    self.assertEqual(lexer.TokenVal(left), lexer.TokenVal(right))
 
   def testReadOuter(self):
     l = test_lib.InitLineLexer('\n', self.arena)
     self.assertTokensEqual(
-        Tok(Id.Op_Newline, None), l.Read(lex_mode_e.ShCommand))
+        Tok(Id.Op_Newline, '\n'), l.Read(lex_mode_e.ShCommand))
 
   def testRead_VSub_ArgUnquoted(self):
     l = test_lib.InitLineLexer("'hi'", self.arena)
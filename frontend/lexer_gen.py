@@ -303,6 +303,78 @@ static inline void %s(const unsigned char* s, int len, int* id) {
   # TODO: Check that we're at the END OF THE STRING
 
 
+def _NegatedRun(pat):
+  """If pat is like [^abc]+ or [^abc]*, return the excluded bytes.
+
+  Otherwise return None.
+  """
+  re_tree = sre_parse.parse(pat)
+  if len(re_tree) != 1:
+    return None
+  name, arg = re_tree[0]
+  if name != 'max_repeat':
+    return None
+  _, max_, children = arg
+  if max_ != sre_constants.MAXREPEAT or len(children) != 1:
+    return None
+
+  name, arg = children[0]
+  if name != 'in' or arg[0][0] != 'negate':
+    return None
+  stops = []
+  for name, a in arg[1:]:
+    if name != 'literal':  # ranges aren't supported
+      return None
+    stops.append(chr(a))
+  return ''.join(stops)
+
+
+def _FirstByte(is_regex, pat):
+  """The byte every match of pat starts with, or None if it can vary."""
+  if not is_regex:
+    return pat[0]
+  re_tree = sre_parse.parse(pat)
+  name, arg = re_tree[0]
+  if name == 'literal':
+    return chr(arg)
+  return None
+
+
+def FastRunRule(pat_list):
+  """Find a rule whose tokens can be found by scanning for a set of bytes.
+
+  That's true of a rule like [^$`"\0\\]+ if every other rule in the lexer
+  mode starts with one of those bytes.  Then any token that starts with
+  another byte is a maximal run of bytes outside the set.
+
+  Returns:
+    (stop bytes, Id) or None
+  """
+  result = None
+  for is_regex, pat, id_ in pat_list:
+    stops = _NegatedRun(pat) if is_regex else None
+    if stops is not None and '\0' in stops:
+      if result is not None:
+        return None  # ambiguous
+      result = (stops, id_)
+
+  if result is None:
+    return None
+
+  stops, run_id = result
+  for is_regex, pat, id_ in pat_list:
+    if id_ == run_id and is_regex and _NegatedRun(pat) == stops:
+      continue
+    first = _FirstByte(is_regex, pat)
+    if first is None or first not in stops:
+      return None
+  return result
+
+
+def _CByteString(s):
+  return '"%s"' % ''.join('\\x%02x' % ord(c) for c in s)
+
+
 def TranslateOshLexer(lexer_def):
   # https://stackoverflow.com/questions/12836171/difference-between-an-inline-function-and-static-inline-function
   # Has to be 'static inline' rather than 'inline', otherwise the
@@ -319,6 +391,58 @@ def TranslateOshLexer(lexer_def):
   re2c:yyfill:enable = 0;  // generated code doesn't ask for more input
 */
 
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+/* Return the first position in [p, end) holding one of the n bytes in stops,
+   or end.  Used to skip runs of bytes that can't start another token, e.g. in
+   comments and quoted strings. */
+static inline const unsigned char* FindAnyByte(const unsigned char* p,
+    const unsigned char* end, const unsigned char* stops, int n) {
+  int i;
+#if defined(__AVX2__)
+  while (end - p >= 32) {
+    __m256i chunk = _mm256_loadu_si256((const __m256i*)p);
+    __m256i hits = _mm256_setzero_si256();
+    int mask;
+    for (i = 0; i < n; ++i) {
+      hits = _mm256_or_si256(
+          hits, _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8((char)stops[i])));
+    }
+    mask = _mm256_movemask_epi8(hits);
+    if (mask) {
+      return p + __builtin_ctz(mask);
+    }
+    p += 32;
+  }
+#endif
+#if defined(__SSE2__)
+  while (end - p >= 16) {
+    __m128i chunk = _mm_loadu_si128((const __m128i*)p);
+    __m128i hits = _mm_setzero_si128();
+    int mask;
+    for (i = 0; i < n; ++i) {
+      hits = _mm_or_si128(
+          hits, _mm_cmpeq_epi8(chunk, _mm_set1_epi8((char)stops[i])));
+    }
+    mask = _mm_movemask_epi8(hits);
+    if (mask) {
+      return p + __builtin_ctz(mask);
+    }
+    p += 16;
+  }
+#endif
+  for (; p < end; ++p) {
+    for (i = 0; i < n; ++i) {
+      if (*p == stops[i]) {
+        return p;
+      }
+    }
+  }
+  return end;
+}
+
 static inline void MatchOshToken(int lex_mode, const unsigned char* line, int line_len,
                               int start_pos, int* id, int* end_pos) {
   assert(start_pos <= line_len);  /* caller should have checked */
@@ -335,6 +459,21 @@ static inline void MatchOshToken(int lex_mode, const unsigned char* line, int li
   for state, pat_list in lexer_def.iteritems():
     # e.g. lex_mode.DQ => lex_mode__DQ
     print('  case %s:' % lex_mode_str(state).replace('.', '__'))
+
+    fast = FastRunRule(pat_list)
+    if fast:
+      stops, run_id = fast
+      print('    {')
+      print('      /* Fast path: a run of bytes that can\'t start another token */')
+      print('      const unsigned char* q = FindAnyByte(p, line + line_len,')
+      print('          (const unsigned char*)%s, %d);' % (_CByteString(stops), len(stops)))
+      print('      if (q != p) {')
+      print('        *id = id__%s;' % Id_str(run_id).split('.')[-1])
+      print('        *end_pos = q - line;')
+      print('        return;')
+      print('      }')
+      print('    }')
+
     print('    for (;;) {')
     print('      /*!re2c')
 
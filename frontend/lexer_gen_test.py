@@ -6,6 +6,9 @@ from __future__ import print_function
 
 import unittest
 
+from _devbuild.gen.id_kind_asdl import Id
+from _devbuild.gen.types_asdl import lex_mode_e
+from frontend import lexer_def
 from frontend import lexer_gen  # module under test
 from core import test_lib
 
@@ -46,6 +49,27 @@ class LexerGenTest(unittest.TestCase):
       print()
       print()
 
+  def testFastRunRule(self):
+    r = lexer_gen.FastRunRule(lexer_def.LEXER_DEF[lex_mode_e.DQ])
+    self.assertEqual(('$`"\0\\', Id.Lit_Chars), r)
+
+    r = lexer_gen.FastRunRule(lexer_def.LEXER_DEF[lex_mode_e.Comment])
+    self.assertEqual(('\n\0', Id.Ignored_Comment), r)
+
+    # Lit_Chars is a whitelist, and Lit_Other matches any byte
+    r = lexer_gen.FastRunRule(lexer_def.LEXER_DEF[lex_mode_e.ShCommand])
+    self.assertEqual(None, r)
+
+    # Another rule can start with a byte in the run
+    pat_list = [
+        (True, r'[^$\0]+', Id.Lit_Chars),
+        (False, '$', Id.Lit_Dollar),
+        (False, 'a=', Id.Lit_VarLike),
+    ]
+    self.assertEqual(None, lexer_gen.FastRunRule(pat_list))
+    pat_list.pop()
+    self.assertEqual(('$\0', Id.Lit_Chars), lexer_gen.FastRunRule(pat_list))
+
 
 if __name__ == '__main__':
   unittest.main()
@@ -11,6 +11,7 @@ from core import test_lib
 from core.test_lib import Tok
 from core.pyerror import log
 from frontend.lexer_def import LEXER_DEF
+from frontend import match
 from frontend import parse_lib
 from frontend import reader
 
@@ -80,6 +81,27 @@ class TokenTest(unittest.TestCase):
     print(t)
     self.assertEqual(Id.Right_CasePat, t.id)
 
+  def testLexAhead(self):
+    # Reading in one mode lexes ahead; switching modes falls back.
+    line = 'echo "$x" ${y:-z} $((1+2)) done\n'
+    arena = test_lib.MakeArena('<lexer_test.py>')
+    _, lx = test_lib.InitLexer(line, arena)
+
+    modes = [lex_mode_e.ShCommand] * 3 + [lex_mode_e.DQ] * 3 + \
+        [lex_mode_e.ShCommand] * 20
+    pos = 0
+    for lex_mode in modes:
+      t = lx.Read(lex_mode)
+      if t.id == Id.Eof_Real:
+        break
+      # Same as lexing one token at a time
+      expected_id, end_pos = match.OneToken(lex_mode, line, pos)
+      self.assertEqual(expected_id, t.id)
+      self.assertEqual(pos, t.col)
+      self.assertEqual(end_pos - pos, t.length)
+      pos = end_pos
+    self.assertEqual(len(line), pos)
+
   def testPrintf(self):
     # Demonstrate input handling quirk
 
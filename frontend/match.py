@@ -86,6 +86,25 @@ def _MatchOshToken_Fast(lex_mode, line, start_pos):
   return tok_type, end_pos
 
 
+def _MatchOshTokens_Fast(lex_mode, line, start_pos, max_tokens, buf):
+  # type: (lex_mode_t, str, int, int, List[int]) -> None
+  """Fills buf with (id, end_pos) pairs, stopping after Eol_Tok."""
+  fastlex.MatchOshTokens(lex_mode, line, start_pos, max_tokens, buf)
+
+
+def _MatchOshTokens_Slow(lex_mode, line, start_pos, max_tokens, buf):
+  # type: (lex_mode_t, str, int, int, List[int]) -> None
+  del buf[:]
+  pos = start_pos
+  for _ in xrange(max_tokens):
+    tok_type, end_pos = OneToken(lex_mode, line, pos)
+    buf.append(tok_type)
+    buf.append(end_pos)
+    if tok_type == Id.Eol_Tok:
+      break
+    pos = end_pos
+
+
 class _MatchTokenSlow(object):
   def __init__(self, pat_list):
     # type: (List[Tuple[bool, str, Id_t]]) -> None
@@ -135,6 +154,7 @@ def _MatchBraceRangeToken_Fast(line, start_pos):
 
 if fastlex:
   OneToken = _MatchOshToken_Fast
+  OshTokens = _MatchOshTokens_Fast
   ECHO_MATCHER = _MatchEchoToken_Fast
   GLOB_MATCHER = _MatchGlobToken_Fast
   PS1_MATCHER = _MatchPS1Token_Fast
@@ -147,6 +167,7 @@ if fastlex:
   LooksLikeFloat = fastlex.LooksLikeFloat
 else:
   OneToken = _MatchOshToken_Slow(lexer_def.LEXER_DEF)
+  OshTokens = _MatchOshTokens_Slow
   ECHO_MATCHER = _MatchTokenSlow(lexer_def.ECHO_E_DEF)
   GLOB_MATCHER = _MatchTokenSlow(lexer_def.GLOB_DEF)
   PS1_MATCHER = _MatchTokenSlow(lexer_def.PS1_DEF)
@@ -7,6 +7,7 @@ from __future__ import print_function
 import unittest
 
 from _devbuild.gen.id_kind_asdl import Id, Id_str
+from _devbuild.gen.types_asdl import lex_mode_e
 from core.pyerror import log
 from frontend  import match  # module under test
 
@@ -43,6 +44,41 @@ class MatchTest(unittest.TestCase):
     self.assertEqual(
         False, match.ShouldHijack('#!/usr/bin/env \0 sh\n'))
 
+  def testOshTokens(self):
+    line = 'echo hi\n'
+    buf = [42]
+    match.OshTokens(lex_mode_e.ShCommand, line, 0, 10, buf)
+    self.assertEqual(
+        [Id.Lit_Chars, 4, Id.WS_Space, 5, Id.Lit_Chars, 7, Id.Op_Newline, 8,
+         Id.Eol_Tok, 8], buf)
+
+    match.OshTokens(lex_mode_e.ShCommand, line, 5, 1, buf)
+    self.assertEqual([Id.Lit_Chars, 7], buf)
+
+  def testLongRuns(self):
+    # The native lexer skips these runs with FindAnyByte().  Long enough to
+    # cover the vectorized loops.
+    run = 'x y' * 30
+    CASES = [
+        (lex_mode_e.Comment, '#' + run + '\n', 1, Id.Ignored_Comment, 91),
+        (lex_mode_e.Comment, '\n', 0, Id.Ignored_Comment, 0),
+        (lex_mode_e.SQ_Raw, run + "'", 0, Id.Lit_Chars, 90),
+        (lex_mode_e.SQ_Raw, "'", 0, Id.Right_SingleQuote, 1),
+        (lex_mode_e.DQ, run + '$x"', 0, Id.Lit_Chars, 90),
+        (lex_mode_e.DQ, run + '\\n', 5, Id.Lit_Chars, 90),
+        (lex_mode_e.DQ, run + '\\n', 90, Id.Lit_BadBackslash, 91),
+        (lex_mode_e.SQ_C, run + '\\n', 0, Id.Char_Literals, 90),
+        (lex_mode_e.VSub_ArgDQ, run + '}', 0, Id.Lit_Chars, 90),
+        (lex_mode_e.PrintfOuter, run + '%s', 0, Id.Char_Literals, 90),
+        # Up to the NUL terminator
+        (lex_mode_e.DQ, run, 0, Id.Lit_Chars, 90),
+        (lex_mode_e.DQ, run, 90, Id.Eol_Tok, 90),
+    ]
+    for lex_mode, line, start_pos, expected_id, expected_end in CASES:
+      id_, end_pos = match.OneToken(lex_mode, line, start_pos)
+      self.assertEqual(expected_id, id_, '%r: %s' % (line, Id_str(id_)))
+      self.assertEqual(expected_end, end_pos)
+
   def testBraceRangeLexer(self):
     lex = match.BraceRangeLexer('1..3')
     while True:
@@ -247,6 +247,13 @@ class ParseContext(object):
     # Completion state lives here since it may span multiple parsers.
     self.trail = _BaseTrail()  # no-op by default
 
+    self.e_parser = None  # type: Optional[expr_parse.ExprParser]
+
+    # If not None, the parser appends each name it looks up in the alias
+    # table.  The parse cache uses it to tell whether a cached parse is still
+    # valid.
+    self.alias_lookups = None  # type: Optional[List[str]]
+
   def Init_Trail(self, trail):
     # type: (_BaseTrail) -> None
     self.trail = trail
@@ -320,8 +327,12 @@ class ParseContext(object):
     # type: (Lexer, int) -> Tuple[PNode, Token]
     """Helper for Oil expression parsing."""
 
-    # TODO: maybe pool these ExprParser instances to reduce allocations?
-    e_parser = expr_parse.ExprParser(self, self.oil_grammar, False)
+    # Reuse the last ExprParser, unless we're nested inside it, e.g. for
+    # var x = $(var y = 1), or an error aborted it.
+    e_parser = self.e_parser
+    if e_parser is None or e_parser.busy:
+      e_parser = expr_parse.ExprParser(self, self.oil_grammar, False)
+      self.e_parser = e_parser
     return e_parser.Parse(lexer, start_symbol)
 
   def _ParseTea(self, lexer, start_symbol):
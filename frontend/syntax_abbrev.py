@@ -9,13 +9,21 @@ from _devbuild.gen.hnode_asdl import hnode_t
 from asdl import runtime
 
 
+def _TokenVal(tok):
+  # type: (Token) -> str
+  """Like lexer.TokenVal(), which can't be imported here."""
+  if tok.tval is None:
+    tok.tval = tok.line.content[tok.col : tok.col + tok.length]
+  return tok.tval
+
+
 def _AbbreviateToken(tok, out):
   # type: (Token, List[hnode_t]) -> None
   if tok.id != Id.Lit_Chars:
     n1 = runtime.NewLeaf(Id_str(tok.id), color_e.OtherConst)
     out.append(n1)
 
-  n2 = runtime.NewLeaf(tok.tval, color_e.StringConst)
+  n2 = runtime.NewLeaf(_TokenVal(tok), color_e.StringConst)
   out.append(n2)
 
 
@@ -119,7 +127,7 @@ def _expr__Var(obj):
   p_node.abbrev = True
 
   assert obj.name.id == Id.Expr_Name, obj.name
-  n1 = runtime.NewLeaf(obj.name.tval, color_e.StringConst)
+  n1 = runtime.NewLeaf(_TokenVal(obj.name), color_e.StringConst)
   p_node.unnamed_fields.append(n1)
   return p_node
 
@@ -135,6 +143,6 @@ def _expr__Const(obj):
   n1 = runtime.NewLeaf(Id_str(tok.id), color_e.OtherConst)
   out.append(n1)
 
-  n2 = runtime.NewLeaf(tok.tval, color_e.StringConst)
+  n2 = runtime.NewLeaf(_TokenVal(tok), color_e.StringConst)
   out.append(n2)
   return p_node
@@ -16,6 +16,9 @@ Str* readline(Str*);
 
 // Translation of Python's print().
 void print(Str* s) {
+  if (mylib::gStdout) {
+    mylib::gStdout->flush();  // it may have batched writes
+  }
   fputs(s->data_, stdout);  // print until first NUL
   fputc('\n', stdout);
 }
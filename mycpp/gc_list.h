@@ -316,8 +316,8 @@ T List<T>::pop(int i) {
   T result = index_(i);
   len_--;
 
-  // Shift everything by one
-  memmove(slab_->items_ + i, slab_->items_ + (i + 1), len_ * sizeof(T));
+  // Shift everything after i by one
+  memmove(slab_->items_ + i, slab_->items_ + (i + 1), (len_ - i) * sizeof(T));
 
   /*
   for (int j = 0; j < len_; j++) {
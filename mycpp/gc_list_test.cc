@@ -335,6 +335,12 @@ TEST list_methods_test() {
   ASSERT_EQ(-2, ints->index_(4));
   ASSERT_EQ(-1, ints->index_(3));
 
+  ints->pop(3);  // [9, 6, 7, -2]
+  ASSERT_EQ(4, len(ints));
+  ASSERT_EQ(7, ints->index_(2));
+  ASSERT_EQ(-2, ints->index_(3));
+  ASSERT_EQ(0, ints->slab_->items_[4]);  // zero'd for the GC
+
   ints->clear();
   ASSERT_EQ(0, len(ints));
   ASSERT_EQ(0, ints->slab_->items_[0]);  // make sure it's zero'd
@@ -2,12 +2,13 @@
 
 #include <errno.h>
 #include <stdio.h>
-#include <unistd.h>  // isatty
+#include <sys/uio.h>  // writev
+#include <unistd.h>   // isatty
 
 namespace mylib {
 
 void InitCppOnly() {
-  // We don't seem need this now that we have ctx_FlushStdout().
+  // Not needed, since the shell flushes Stdout() before forking.
   // setvbuf(stdout, 0, _IONBF, 0);
 
   // Arbitrary threshold of 50K objects based on eyeballing
@@ -15,7 +16,21 @@ void InitCppOnly() {
   gHeap.Init(50000);
 }
 
+// Messages on stderr, like xtrace, must come after the output that Stdout()
+// has batched, in case they go to the same file (2>&1).  Errors are reported
+// when the shell flushes stdout.
+static void FlushBatchedStdout() {
+  if (gStdout == nullptr) {
+    return;
+  }
+  try {
+    gStdout->flush();
+  } catch (IOError_OSError* e) {
+  }
+}
+
 void print_stderr(Str* s) {
+  FlushBatchedStdout();
   fputs(s->data_, stderr);  // prints until first NUL
   fputc('\n', stderr);
 }
@@ -156,13 +171,75 @@ Writer* gStderr;
 // CFileWriter
 //
 
+// Write all of iov[0, n), retrying on partial writes and EINTR.
+static void WriteAll(int fd, struct iovec* iov, int n) {
+  while (n > 0) {
+    ssize_t num_written = ::writev(fd, iov, n);
+    if (num_written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      throw Alloc<IOError>(errno);
+    }
+    // Skip buffers that were completely written
+    while (n > 0 && static_cast<size_t>(num_written) >= iov->iov_len) {
+      num_written -= iov->iov_len;
+      iov++;
+      n--;
+    }
+    if (n > 0) {  // partially written
+      iov->iov_base = static_cast<char*>(iov->iov_base) + num_written;
+      iov->iov_len -= num_written;
+    }
+  }
+}
+
 void CFileWriter::write(Str* s) {
-  // note: throwing away the return value
-  fwrite(s->data_, sizeof(char), len(s), f_);
+  int n = len(s);
+  if (!batch_) {
+    if (f_ == stderr) {
+      FlushBatchedStdout();
+    }
+    if (::fwrite(s->data_, sizeof(char), n, f_) != static_cast<size_t>(n)) {
+      throw Alloc<IOError>(errno);
+    }
+    return;
+  }
+
+  if (len_ == 0) {
+    // Keep stdio output, e.g. from print(), ahead of this batch
+    if (::fflush(f_) != 0) {
+      throw Alloc<IOError>(errno);
+    }
+  }
+
+  if (len_ + n <= kBufSize) {
+    memcpy(buf_ + len_, s->data_, n);
+    len_ += n;
+    return;
+  }
+
+  // Send buffered bytes and s together
+  struct iovec iov[2];
+  iov[0].iov_base = buf_;
+  iov[0].iov_len = len_;
+  iov[1].iov_base = s->data_;
+  iov[1].iov_len = n;
+  len_ = 0;  // don't write it again if there's an error
+  WriteAll(::fileno(f_), iov, 2);
 }
 
 void CFileWriter::flush() {
-  ::fflush(f_);
+  if (len_) {
+    struct iovec iov;
+    iov.iov_base = buf_;
+    iov.iov_len = len_;
+    len_ = 0;
+    WriteAll(::fileno(f_), &iov, 1);
+  }
+  if (::fflush(f_) != 0) {
+    throw Alloc<IOError>(errno);
+  }
 }
 
 bool CFileWriter::isatty() {
@@ -187,12 +264,10 @@ int BufWriter::capacity() {
   return str_ ? len(str_) : 0;
 }
 
-void BufWriter::Extend(Str* s) {
-  const int n = len(s);
-
+void BufWriter::Extend(const char* s, int n) {
   assert(capacity() >= len_ + n);
 
-  memcpy(end(), s->data_, n);
+  memcpy(end(), s, n);
   len_ += n;
   data()[len_] = '\0';
 }
@@ -210,9 +285,11 @@ void BufWriter::EnsureCapacity(int cap) {
 }
 
 void BufWriter::write(Str* s) {
-  assert(is_valid_);  // Can't write() after getvalue()
+  WriteRaw(s->data_, len(s));
+}
 
-  int n = len(s);
+void BufWriter::WriteRaw(const char* s, int n) {
+  assert(is_valid_);  // Can't write() after getvalue()
 
   // write('') is a no-op, so don't create Buf if we don't need to
   if (n == 0) {
@@ -228,7 +305,25 @@ void BufWriter::write(Str* s) {
   }
 
   // Append the contents to the buffer
-  Extend(s);
+  Extend(s, n);
+}
+
+void BufWriter::WriteRepeated(char c, int n) {
+  assert(is_valid_);
+
+  if (n <= 0) {
+    return;
+  }
+
+  if (str_ == nullptr) {
+    str_ = NewMutableStr(n);
+  } else {
+    EnsureCapacity(len_ + n);
+  }
+
+  memset(end(), c, n);
+  len_ += n;
+  data()[len_] = '\0';
 }
 
 Str* BufWriter::getvalue() {
@@ -4,6 +4,7 @@
 #define MYCPP_GC_MYLIB_H
 
 #include <limits.h>  // CHAR_BIT
+#include <unistd.h>  // isatty
 
 #include "mycpp/gc_alloc.h"  // gHeap
 #include "mycpp/gc_dict.h"   // kDeletedEntry
@@ -57,6 +58,12 @@ void dict_erase(Dict<K, V>* haystack, K needle) {
   haystack->len_--;
 }
 
+// Like ord(s[i]), without allocating s[i]
+inline int ByteAt(Str* s, int i) {
+  DCHECK(0 <= i && i < len(s));
+  return static_cast<uint8_t>(s->data_[i]);
+}
+
 // NOTE: Can use OverAllocatedStr for all of these, rather than copying
 
 inline Str* hex_lower(int i) {
@@ -168,10 +175,14 @@ class BufWriter : public Writer {
   // For cStringIO API
   Str* getvalue();
 
+  // For native code that formats into the buffer, like printf
+  void WriteRaw(const char* s, int n);
+  void WriteRepeated(char c, int n);
+
  private:
   void EnsureCapacity(int n);
 
-  void Extend(Str* s);
+  void Extend(const char* s, int n);
   char* data();
   char* end();
   int capacity();
@@ -186,10 +197,17 @@ class BufWriter : public Writer {
   }
 };
 
-// Wrap a FILE*
+// Wrap a FILE*.  write() and flush() raise IOError, like Python's file
+// objects.
+//
+// With batch=true, small writes are copied into buf_, and sent with a single
+// writev() when it fills up or on flush().  A write that doesn't fit is sent
+// along with buf_, without copying it.  Code that writes to the same FILE*
+// with stdio must call flush() first.
 class CFileWriter : public Writer {
  public:
-  explicit CFileWriter(FILE* f) : Writer(), f_(f) {
+  explicit CFileWriter(FILE* f, bool batch = false)
+      : Writer(), f_(f), batch_(batch), len_(0) {
     // not mutating field_mask because FILE* is not a managed pointer
   }
   void write(Str* s) override;
@@ -197,7 +215,12 @@ class CFileWriter : public Writer {
   bool isatty() override;
 
  private:
+  static constexpr int kBufSize = 8192;
+
   FILE* f_;
+  bool batch_;
+  int len_;  // number of bytes in buf_
+  char buf_[kBufSize];
 
   DISALLOW_COPY_AND_ASSIGN(CFileWriter)
 };
@@ -206,7 +229,9 @@ extern Writer* gStdout;
 
 inline Writer* Stdout() {
   if (gStdout == nullptr) {
-    gStdout = Alloc<CFileWriter>(stdout);
+    // Batch writes from builtins like echo, unless a user is watching.  The
+    // shell flushes before another process can write to the same file.
+    gStdout = Alloc<CFileWriter>(stdout, !::isatty(STDOUT_FILENO));
     gHeap.RootGlobalVar(gStdout);
   }
   return gStdout;
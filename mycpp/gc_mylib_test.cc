@@ -1,5 +1,10 @@
 #include "mycpp/gc_mylib.h"
 
+#include <errno.h>
+#include <fcntl.h>   // fcntl()
+#include <signal.h>  // signal()
+#include <unistd.h>  // pipe()
+
 #include "mycpp/gc_alloc.h"  // gHeap
 #include "mycpp/gc_str.h"
 #include "vendor/greatest.h"
@@ -146,6 +151,16 @@ TEST BufWriter_test() {
   ASSERT(str_equals0("foobar", s));
   log("result = %s", s->data());
 
+  // Native writes, e.g. from printf
+  writer = Alloc<mylib::BufWriter>();
+  writer->WriteRepeated(' ', 2);
+  writer->WriteRaw("foobar", 3);
+  writer->WriteRepeated('0', 0);
+  writer->write(bar);
+  writer->WriteRepeated('0', 3);
+  s = writer->getvalue();
+  ASSERT(str_equals0("  foobar000", s));
+
   PASS();
 }
 
@@ -258,6 +273,104 @@ TEST files_test() {
   PASS();
 }
 
+TEST CFileWriter_error_test() {
+  int fds[2];
+  ASSERT_EQ(0, pipe(fds));
+  FILE* f = fdopen(fds[1], "w");
+  ASSERT(f != nullptr);
+
+  mylib::CFileWriter* w = nullptr;
+  StackRoots _roots({&w});
+
+  w = Alloc<mylib::CFileWriter>(f);
+
+  // Writing to a closed pipe is reported on flush()
+  close(fds[0]);
+  signal(SIGPIPE, SIG_IGN);
+  w->write(StrFromC("closed"));
+  int err_num = 0;
+  try {
+    w->flush();
+  } catch (IOError_OSError* e) {
+    err_num = e->errno_;
+  }
+  ASSERT_EQ(EPIPE, err_num);
+  signal(SIGPIPE, SIG_DFL);
+
+  fclose(f);
+  PASS();
+}
+
+// Read everything available on a non-blocking fd
+static int ReadAvailable(int fd, char* buf, int n) {
+  int total = 0;
+  while (total < n) {
+    ssize_t r = read(fd, buf + total, n - total);
+    if (r <= 0) {
+      break;
+    }
+    total += r;
+  }
+  return total;
+}
+
+TEST CFileWriter_batch_test() {
+  int fds[2];
+  ASSERT_EQ(0, pipe(fds));
+  ASSERT(fcntl(fds[0], F_SETFL, O_NONBLOCK) != -1);
+  FILE* f = fdopen(fds[1], "w");
+  ASSERT(f != nullptr);
+
+  mylib::CFileWriter* w = nullptr;
+  Str* big = nullptr;
+  StackRoots _roots({&w, &big});
+
+  w = Alloc<mylib::CFileWriter>(f, true);
+
+  char buf[20000];
+
+  // Small writes are batched until flush()
+  w->write(StrFromC("foo "));
+  w->write(StrFromC("bar\n"));
+  ASSERT_EQ(0, ReadAvailable(fds[0], buf, sizeof(buf)));
+
+  w->flush();
+  ASSERT_EQ(8, ReadAvailable(fds[0], buf, sizeof(buf)));
+  ASSERT_EQ(0, memcmp(buf, "foo bar\n", 8));
+
+  // stdio output written before the batch stays ahead of it
+  fputs("stdio ", f);
+  w->write(StrFromC("batch"));
+  w->flush();
+  ASSERT_EQ(11, ReadAvailable(fds[0], buf, sizeof(buf)));
+  ASSERT_EQ(0, memcmp(buf, "stdio batch", 11));
+
+  // A write that doesn't fit goes out immediately, after the batch
+  big = NewStr(10000);
+  memset(big->data_, 'x', 10000);
+  w->write(StrFromC("a"));
+  w->write(big);
+  ASSERT_EQ(10001, ReadAvailable(fds[0], buf, sizeof(buf)));
+  ASSERT_EQ('a', buf[0]);
+  ASSERT_EQ('x', buf[10000]);
+
+  // Errors are reported
+  close(fds[0]);
+  signal(SIGPIPE, SIG_IGN);
+  w->write(StrFromC("closed"));
+  int err_num = 0;
+  try {
+    w->flush();
+  } catch (IOError_OSError* e) {
+    err_num = e->errno_;
+  }
+  ASSERT_EQ(EPIPE, err_num);
+  signal(SIGPIPE, SIG_DFL);
+
+  fclose(f);
+  PASS();
+}
+
 TEST for_test_coverage() {
   mylib::MaybeCollect();  // trivial wrapper for translation
   mylib::StrFromC("x");   // trivial wrapper for translation
@@ -291,6 +404,8 @@ int main(int argc, char** argv) {
   RUN_TEST(BufWriter_test);
   RUN_TEST(BufLineReader_test);
   RUN_TEST(files_test);
+  RUN_TEST(CFileWriter_error_test);
+  RUN_TEST(CFileWriter_batch_test);
   RUN_TEST(for_test_coverage);
 
   gHeap.CleanProcessExit();
@@ -51,9 +51,38 @@ def print_stderr(s):
   ui.ErrorFormatter does.  We use it to print fatal I/O errors that were only
   caught at the top level.
   """
+    _FlushStdout()
     print(s, file=sys.stderr)
 
 
+def _FlushStdout():
+    """Messages on stderr, like xtrace, must come after the output that the
+  shell batched for stdout, in case they go to the same file (2>&1).  Errors
+  are reported when the shell flushes stdout.
+  """
+    try:
+        sys.stdout.flush()
+    except IOError:
+        pass
+
+
+class _StderrWriter(object):
+    """Like sys.stderr, but flushes sys.stdout first."""
+
+    def write(self, s):
+        _FlushStdout()
+        sys.stderr.write(s)
+
+    def flush(self):
+        sys.stderr.flush()
+
+    def isatty(self):
+        return sys.stderr.isatty()
+
+
+_stderr = _StderrWriter()
+
+
 BufWriter = cStringIO.StringIO
 
 BufLineReader = cStringIO.StringIO
@@ -64,7 +93,7 @@ def Stdout():
 
 
 def Stderr():
-    return sys.stderr
+    return _stderr
 
 
 def Stdin():
@@ -132,6 +161,12 @@ def split_once(s, delim):
         return parts[0], parts[1]
 
 
+def ByteAt(s, i):
+    # type: (str, int) -> int
+    """Like ord(s[i]), but doesn't allocate a string in C++."""
+    return ord(s[i])
+
+
 def hex_lower(i):
     # type: (int) -> str
     return '%x' % i
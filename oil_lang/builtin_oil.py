@@ -27,6 +27,7 @@ from frontend import args
 from frontend import match
 from frontend import typed_args
 from mycpp.mylib import tagswitch
+from osh import sh_array
 from qsn_ import qsn
 
 import yajl
@@ -153,7 +154,7 @@ class Append(_Builtin):
     ok = False
     with tagswitch(val) as case:
       if case(value_e.MaybeStrArray):
-        val.strs.extend(arg_r.Rest())
+        sh_array.Append(val, arg_r.Rest())
         ok = True
       if case(value_e.Obj):
         if isinstance(val.obj, list):
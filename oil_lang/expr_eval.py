@@ -42,6 +42,7 @@ from core import state
 from core.pyerror import e_die, e_die_status, log
 from frontend import consts
 from frontend import match
+from frontend import lexer
 from frontend import location
 from oil_lang import objects
 from osh import braces
@@ -174,7 +175,7 @@ class OilEvaluator(object):
     with tagswitch(node) as case:
       if case(expr_e.Var):
         node = cast(expr__Var, UP_node)
-        return location.LName(node.name.tval)
+        return location.LName(lexer.TokenVal(node.name))
       else:
         # TODO:
         # subscripts, tuple unpacking, starred expressions, etc.
@@ -226,7 +227,7 @@ class OilEvaluator(object):
     kwargs = {}
     for named in args.named:
       if named.name:
-        kwargs[named.name.tval] = self.EvalExpr(named.value)
+        kwargs[lexer.TokenVal(named.name)] = self.EvalExpr(named.value)
       else:
         # ...named
         kwargs.update(self.EvalExpr(named.value))
@@ -248,7 +249,7 @@ class OilEvaluator(object):
       if case(place_expr_e.Var):
         place = cast(place_expr__Var, UP_place)
 
-        return location.LName(place.name.tval)
+        return location.LName(lexer.TokenVal(place.name))
 
       elif case(place_expr_e.Subscript):
         place = cast(subscript, UP_place)
@@ -262,10 +263,10 @@ class OilEvaluator(object):
 
         obj = self.EvalExpr(place.obj)
         if place.op.id == Id.Expr_RArrow:
-          index = place.attr.tval
+          index = lexer.TokenVal(place.attr)
           return lvalue.ObjIndex(obj, index)
         else:
-          return lvalue.ObjAttr(obj, place.attr.tval)
+          return lvalue.ObjAttr(obj, lexer.TokenVal(place.attr))
 
       else:
         raise NotImplementedError(place)
@@ -278,7 +279,7 @@ class OilEvaluator(object):
 
   def EvalInlineFunc(self, part):
     # type: (word_part__FuncCall) -> part_value_t
-    func_name = part.name.tval[1:]
+    func_name = lexer.TokenVal(part.name)[1:]
 
     fn_val = self.mem.GetValue(func_name)  # type: value_t
     if fn_val.tag_() != value_e.Obj:
@@ -409,7 +410,7 @@ class OilEvaluator(object):
 
         # Remove underscores from 1_000_000.  The lexer is responsible for
         # validation.
-        c = node.c.tval.replace('_', '')
+        c = lexer.TokenVal(node.c).replace('_', '')
 
         id_ = node.c.id
         if id_ == Id.Expr_DecInt:
@@ -434,17 +435,17 @@ class OilEvaluator(object):
         if id_ == Id.Expr_Name:
           # for {name: 'bob'}
           # Maybe also :Symbol?
-          return node.c.tval
+          return lexer.TokenVal(node.c)
 
         # These two could be done at COMPILE TIME
         if id_ == Id.Char_OneChar:
-          return consts.LookupCharInt(node.c.tval[1])  # It's an integer
+          return consts.LookupCharInt(lexer.TokenVal(node.c)[1])  # It's an integer
         if id_ == Id.Char_UBraced:
-          s = node.c.tval[3:-1]  # \u{123}
+          s = lexer.TokenVal(node.c)[3:-1]  # \u{123}
           return int(s, 16)
         if id_ == Id.Char_Pound:
           # TODO: accept UTF-8 code point instead of single byte
-          byte = node.c.tval[2]  # the a in #'a'
+          byte = lexer.TokenVal(node.c)[2]  # the a in #'a'
           return ord(byte)  # It's an integer
 
         # NOTE: We could allow Ellipsis for a[:, ...] here, but we're not using
@@ -454,7 +455,7 @@ class OilEvaluator(object):
       elif case(expr_e.Var):
         node = cast(expr__Var, UP_node)
 
-        return self.LookupVar(node.name.tval, span_id=node.name.span_id)
+        return self.LookupVar(lexer.TokenVal(node.name), span_id=node.name.span_id)
 
       elif case(expr_e.CommandSub):
         node = cast(command_sub, UP_node)
@@ -733,7 +734,7 @@ class OilEvaluator(object):
         obj = self._EvalExpr(comp.iter)
 
         # TODO: Handle x,y etc.
-        iter_name = comp.lhs[0].name.tval
+        iter_name = lexer.TokenVal(comp.lhs[0].name)
 
         if isinstance(obj, str):
           e_die("Strings aren't iterable")
@@ -800,11 +801,11 @@ class OilEvaluator(object):
         id_ = node.op.id
         if id_ == Id.Expr_Dot:
           # Used for .startswith()
-          name = node.attr.tval
+          name = lexer.TokenVal(node.attr)
           return getattr(o, name)
 
         if id_ == Id.Expr_RArrow:  # d->key is like d['key']
-          name = node.attr.tval
+          name = lexer.TokenVal(node.attr)
           try:
             result = o[name]
           except KeyError:
@@ -953,7 +954,7 @@ class OilEvaluator(object):
         node = cast(Token, UP_node)
 
         id_ = node.id
-        val = node.tval
+        val = lexer.TokenVal(node)
 
         if id_ == Id.Expr_Dot:
           return re.Primitive(Id.Re_Dot)
@@ -1009,7 +1010,7 @@ class OilEvaluator(object):
       elif case(re_e.Splice):
         node = cast(re__Splice, UP_node)
 
-        obj = self.LookupVar(node.name.tval, span_id=node.name.span_id)
+        obj = self.LookupVar(lexer.TokenVal(node.name), span_id=node.name.span_id)
         if not isinstance(obj, objects.Regex):
           e_die("Can't splice object of type %r into regex" % obj.__class__,
                 node.name)
@@ -13,6 +13,7 @@ from _devbuild.gen.types_asdl import lex_mode_e
 from core import ui
 from core.pyerror import log, p_die
 from frontend import consts
+from frontend import lexer
 from frontend import reader
 from mycpp import mylib
 from mycpp.mylib import tagswitch
@@ -47,7 +48,7 @@ if mylib.PYTHON:
       #   rid of.
       if pnode.tok:
         if isinstance(pnode.tok, Token):
-          v = pnode.tok.tval
+          v = lexer.TokenVal(pnode.tok)
         else:
           # e.g. command_sub for x = $(echo hi)
           v = repr(pnode.tok)
@@ -73,13 +74,14 @@ def _Classify(gr, tok, tea_keywords):
   # Special case for top-level Tea keywords like data/enum/class, etc.
   # TODO: Do this more elegantly at grammar build time.
   if tea_keywords and tok.id == Id.Expr_Name:
-    if tok.tval in gr.keywords:
-      #log('NEW %r', gr.keywords[tok.val])
-      return gr.keywords[tok.tval]
+    ilabel = gr.KeywordLabel(lexer.TokenVal(tok))
+    if ilabel != -1:
+      return ilabel
 
   # This handles 'x'.
-  if tok.id in gr.tokens:
-    return gr.tokens[tok.id]
+  ilabel = gr.TokenLabel(tok.id)
+  if ilabel != -1:
+    return ilabel
 
   if tok.id == Id.Unknown_DEqual:
     p_die('Use === to be exact, or ~== to convert types', tok)
@@ -203,7 +205,7 @@ def _PushOilTokens(parse_ctx, gr, p, lex, tea_keywords):
 
       lit_part = sh_array_literal(left_tok, words3)
       opaque = cast(Token, lit_part)  # HACK for expr_to_ast
-      done = p.addtoken(typ, opaque, gr.tokens[typ])
+      done = p.addtoken(typ, opaque, gr.TokenLabel(typ))
       assert not done  # can't end the expression
 
       # Now push the closing )
@@ -223,6 +225,8 @@ def _PushOilTokens(parse_ctx, gr, p, lex, tea_keywords):
       c_parser = parse_ctx.MakeParserForCommandSub(line_reader, lex,
                                                    Id.Eof_RParen)
       node = c_parser.ParseCommandSub()
+      if tok.id == Id.Left_CaretParen:
+        parse_ctx.arena.PinSegment()  # a block literal can be run later
       # A little gross: Copied from osh/word_parse.py
       right_token = c_parser.w_parser.cur_token
 
@@ -230,7 +234,7 @@ def _PushOilTokens(parse_ctx, gr, p, lex, tea_keywords):
 
       typ = Id.Expr_CastedDummy
       opaque = cast(Token, cs_part)  # HACK for expr_to_ast
-      done = p.addtoken(typ, opaque, gr.tokens[typ])
+      done = p.addtoken(typ, opaque, gr.TokenLabel(typ))
       assert not done  # can't end the expression
 
       # Now push the closing )
@@ -252,7 +256,7 @@ def _PushOilTokens(parse_ctx, gr, p, lex, tea_keywords):
 
       typ = Id.Expr_CastedDummy
       opaque = cast(Token, expr_dq_part)  # HACK for expr_to_ast
-      done = p.addtoken(typ, opaque, gr.tokens[typ])
+      done = p.addtoken(typ, opaque, gr.TokenLabel(typ))
       assert not done  # can't end the expression
 
       continue
@@ -268,7 +272,7 @@ def _PushOilTokens(parse_ctx, gr, p, lex, tea_keywords):
       # It's casted word_part__BracedVarSub -> dummy -> expr__BracedVarSub!
       typ = Id.Expr_CastedDummy
       opaque = cast(Token, part)  # HACK for expr_to_ast
-      done = p.addtoken(typ, opaque, gr.tokens[typ])
+      done = p.addtoken(typ, opaque, gr.TokenLabel(typ))
       assert not done  # can't end the expression
 
       continue
@@ -295,7 +299,7 @@ def _PushOilTokens(parse_ctx, gr, p, lex, tea_keywords):
 
       typ = Id.Expr_CastedDummy
       opaque = cast(Token, sq_part)  # HACK for expr_to_ast
-      done = p.addtoken(typ, opaque, gr.tokens[typ])
+      done = p.addtoken(typ, opaque, gr.TokenLabel(typ))
       assert not done  # can't end the expression
       continue
 
@@ -315,10 +319,14 @@ class ExprParser(object):
     # Reused multiple times.
     self.push_parser = parse.Parser(gr)
 
+    # True while parsing.  It stays True if parsing is aborted by an error.
+    self.busy = False
+
   def Parse(self, lexer, start_symbol):
     # type: (Lexer, int) -> Tuple[PNode, Token]
 
     # Reuse the parser
+    self.busy = True
     self.push_parser.setup(start_symbol)
     try:
       last_token = _PushOilTokens(self.parse_ctx, self.gr, self.push_parser,
@@ -336,4 +344,5 @@ class ExprParser(object):
       p_die('Syntax error in expression (near %s)' % ui.PrettyId(e.tok.id),
             e.tok)
 
+    self.busy = False
     return self.push_parser.rootnode, last_token
@@ -84,7 +84,7 @@ class Transformer(object):
   """
   def __init__(self, gr):
     # type: (Grammar) -> None
-    self.number2symbol = gr.number2symbol
+    self.gr = gr
 
   def _AssocBinary(self, children):
     # type: (List[PNode]) -> expr_t
@@ -604,7 +604,7 @@ class Transformer(object):
         tok = children[0].tok
 
         if tok.id == Id.VSub_DollarName:  # $foo is disallowed
-          bare = tok.tval[1:]
+          bare = lexer.TokenVal(tok)[1:]
           p_die('In expressions, remove $ and use `%s`, or sometimes "$%s"' %
                 (bare, bare), tok)
 
@@ -612,7 +612,7 @@ class Transformer(object):
         return simple_var_sub(tok, lexer.TokenSliceLeft(tok, 1))
 
       else:
-        nt_name = self.number2symbol[typ]
+        nt_name = self.gr.SymbolName(typ)
         raise AssertionError(
             "PNode type %d (%s) wasn't handled" % (typ, nt_name))
 
@@ -713,7 +713,7 @@ class Transformer(object):
       iterable = self.Expr(children[3])
       return lhs, iterable
 
-    nt_name = self.number2symbol[typ]
+    nt_name = self.gr.SymbolName(typ)
     raise AssertionError(
         "PNode type %d (%s) wasn't handled" % (typ, nt_name))
 
@@ -868,7 +868,7 @@ class Transformer(object):
       elif typ is None:
         untyped.append(UntypedParam(prefix, name, default_val))
       else:
-        if typ.tval not in ('Expr', 'Block'):
+        if lexer.TokenVal(typ) not in ('Expr', 'Block'):
           p_die('proc param types should be Expr or Block', typ)
         typed.append(TypedParam(name, typ, default_val))
 
@@ -1194,7 +1194,7 @@ class Transformer(object):
         tokens = sq_part.tokens
         if len(tokens) > 1:  # Can happen with multiline single-quoted strings
           p_die(RANGE_POINT_TOO_LONG, loc.WordPart(sq_part))
-        if len(tokens[0].tval) > 1:
+        if len(lexer.TokenVal(tokens[0])) > 1:
           p_die(RANGE_POINT_TOO_LONG, loc.WordPart(sq_part))
         return tokens[0]
 
@@ -1208,7 +1208,7 @@ class Transformer(object):
       tok = p_node.tok
       if tok.id in (Id.Expr_Name, Id.Expr_DecInt):
         # For the a in a-z, 0 in 0-9
-        if len(tok.tval) != 1:
+        if len(lexer.TokenVal(tok)) != 1:
           p_die(RANGE_POINT_TOO_LONG, tok)
         return tok
 
@@ -1291,7 +1291,7 @@ class Transformer(object):
 
       raise AssertionError(children[0].tok.id)
 
-    nt_name = self.number2symbol[typ]
+    nt_name = self.gr.SymbolName(typ)
     raise NotImplementedError(nt_name)
 
   def _ClassLiteral(self, p_node):
@@ -1306,7 +1306,7 @@ class Transformer(object):
 
   def _NameInRegex(self, negated_tok, tok):
     # type: (Token, Token) -> re_t
-    tok_str = tok.tval
+    tok_str = lexer.TokenVal(tok)
     if tok_str == 'dot':
       if negated_tok:
         p_die("Can't negate this symbol", tok)
@@ -1330,7 +1330,7 @@ class Transformer(object):
     Like the above, but 'dot' doesn't mean anything.  And `d` is a literal 'd',
     not `digit`.
     """
-    tok_str = tok.tval
+    tok_str = lexer.TokenVal(tok)
 
     # A bare, unquoted character literal.  In the grammar, this is expressed as
     # range_char without an ending.
@@ -1401,9 +1401,9 @@ class Transformer(object):
 
       if tok.id == Id.Expr_Symbol:
         # Validate symbols here, like we validate PerlClass, etc.
-        if tok.tval in ('%start', '%end', 'dot'):
+        if lexer.TokenVal(tok) in ('%start', '%end', 'dot'):
           return tok
-        p_die("Unexpected token %r in regex" % tok.tval, tok)
+        p_die("Unexpected token %r in regex" % lexer.TokenVal(tok), tok)
 
       if tok.id == Id.Expr_At:
         # | '@' Expr_Name
@@ -1537,6 +1537,6 @@ class Transformer(object):
       else:
         return re.Seq(seq)
 
-    nt_name = self.number2symbol[typ]
+    nt_name = self.gr.SymbolName(typ)
     raise NotImplementedError(nt_name)
 
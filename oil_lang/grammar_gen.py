@@ -170,8 +170,12 @@ def main(argv):
     with open(nonterm_h, 'w') as out_f:
       gr.dump_nonterminals_cpp(out_f)
 
+    tables_h = os.path.join(out_dir, basename + '_tables.h')
+    with open(tables_h, 'w') as out_f:
+      gr.dump_tables_cpp(out_f)
+
     if 0:
-      log('%s -> (oil_lang/grammar_gen) -> %s/%s._nt.h',
+      log('%s -> (oil_lang/grammar_gen) -> %s/%s{_nt,_tables}.h',
           grammar_path, out_dir, basename)
 
   elif action == 'parse':  # generate the grammar and parse it
@@ -168,8 +168,8 @@ class _RangeParser(object):
 def _RangePartDetect(tok):
   # type: (Token) -> Optional[word_part_t]
   """Parse the token and return a new word_part if it looks like a range."""
-  lexer = match.BraceRangeLexer(tok.tval)
-  p = _RangeParser(lexer, tok)
+  range_lexer = match.BraceRangeLexer(lexer.TokenVal(tok))
+  p = _RangeParser(range_lexer, tok)
   try:
     part = p.Parse()
   except _NotARange as e:
@@ -337,39 +337,53 @@ def _IntToString(i, width):
     return s
 
 
-def _RangeStrings(part):
-  # type: (word_part__BracedRange) -> List[str]
-
-  if part.kind == Id.Range_Int:
-    nums = []  # type: List[str]
+class IntRange(object):
+  """The strings in {1..N}, generated one at a time."""
 
+  def __init__(self, part):
+    # type: (word_part__BracedRange) -> None
     z1 = _LeadingZeros(part.start)
     z2 = _LeadingZeros(part.end)
 
     if z1 == 0 and z2 == 0:
-      width = 0
+      self.width = 0
     else:
       if z1 < z2:
-        width = len(part.end)
+        self.width = len(part.end)
       else:
-        width = len(part.start)
+        self.width = len(part.start)
 
-    n = int(part.start)
-    end = int(part.end)
-    step = part.step
-    if step > 0:
-      while True:
-        nums.append(_IntToString(n, width))
-        n += step
-        if n > end:
-          break
+    self.n = int(part.start)
+    self.end = int(part.end)
+    self.step = part.step
+    self.done = False
+
+  def Done(self):
+    # type: () -> bool
+    return self.done
+
+  def Value(self):
+    # type: () -> str
+    return _IntToString(self.n, self.width)
+
+  def Next(self):
+    # type: () -> None
+    self.n += self.step
+    if self.step > 0:
+      self.done = self.n > self.end
     else:
-      while True:
-        nums.append(_IntToString(n, width))
-        n += step
-        if n < end:
-          break
+      self.done = self.n < self.end
+
 
+def _RangeStrings(part):
+  # type: (word_part__BracedRange) -> List[str]
+
+  if part.kind == Id.Range_Int:
+    nums = []  # type: List[str]
+    it = IntRange(part)
+    while not it.Done():
+      nums.append(it.Value())
+      it.Next()
     return nums
 
   else:  # Id.Range_Char
@@ -394,101 +408,117 @@ def _RangeStrings(part):
     return chars
 
 
-def _ExpandPart(parts,  # type: List[word_part_t]
-                first_alt_index,  # type: int
-                suffixes,  # type: List[List[word_part_t]]
-                ):
-  # type: (...) -> List[List[word_part_t]]
-  """Mutually recursive with _BraceExpand.
+def _Alternatives(part):
+  # type: (word_part_t) -> List[List[word_part_t]]
+  """Return the list of parts that each alternative in {} expands to.
 
-  Args:
-    parts: input parts
-    first_alt_index: index of the first BracedTuple
-    suffixes: List of suffixes to append.
+  Mutually recursive with _BraceExpand.
   """
-  out = []  # type: List[List[word_part_t]]
+  alts = []  # type: List[List[word_part_t]]
 
-  prefix = parts[ : first_alt_index]
-  expand_part = parts[first_alt_index]
-
-  UP_part = expand_part
-  with tagswitch(expand_part) as case:
+  UP_part = part
+  with tagswitch(part) as case:
     if case(word_part_e.BracedTuple):
-      expand_part = cast(word_part__BracedTuple, UP_part)
+      part = cast(word_part__BracedTuple, UP_part)
       # Call _BraceExpand on each of the inner words too!
-      expanded_alts = []  # type: List[List[word_part_t]]
-      for w in expand_part.words:
-        expanded_alts.extend(_BraceExpand(w.parts))
-
-      for alt_parts in expanded_alts:
-        for suffix in suffixes:
-          out_parts = []  # type: List[word_part_t]
-          out_parts.extend(prefix)
-          out_parts.extend(alt_parts)
-          out_parts.extend(suffix)
-          out.append(out_parts)
+      for w in part.words:
+        alts.extend(_BraceExpand(w.parts))
 
     elif case(word_part_e.BracedRange):
-      expand_part = cast(word_part__BracedRange, UP_part)
-      # Not mutually recursive with _BraceExpand
-      strs = _RangeStrings(expand_part)
-
-      # Often prefix and suffixes are empty, but there's not that much to
-      # optimize
-      # log('prefix %s, suffixes %s, strs %s', prefix, suffixes, strs)
-
-      for s in strs:
-        for suffix in suffixes:
-          out_parts_ = []  # type: List[word_part_t]
-          out_parts_.extend(prefix)
-
-          # TODO: Does it help to preserve location info?
-          # t = Token(Id.Lit_Chars, expand_part.spids[0], s)
-          t = lexer.DummyToken(Id.Lit_Chars, s)
-
-          out_parts_.append(t)
-          out_parts_.extend(suffix)
-          out.append(out_parts_)
+      part = cast(word_part__BracedRange, UP_part)
+      # TODO: Does it help to preserve location info?
+      # t = Token(Id.Lit_Chars, part.spids[0], s)
+      for s in _RangeStrings(part):
+        alts.append([lexer.DummyToken(Id.Lit_Chars, s)])
 
     else:
       raise AssertionError()
 
-  return out
+  return alts
 
 
 def _BraceExpand(parts):
   # type: (List[word_part_t]) -> List[List[word_part_t]]
-  """Mutually recursive with _ExpandPart."""
+  """Expand the {} in a word, returning the parts of each resulting word.
 
+  Each {} is expanded once, and the results are shared by all the words.  We
+  know how many words there are up front, and count through the choices like
+  an odometer, so {a,b}{1..1000} doesn't build lists for partial results.
+  """
   # manual GC point, because brace expansion is a separate stage that does a
   # bunch of computation outside the interpreter
   mylib.MaybeCollect()
 
-  num_alts = 0
-  first_alt_index = -1
-  for i, part in enumerate(parts):
+  # Each segment is a list of choices.  A run of parts outside {} is a
+  # segment with one choice.
+  segments = []  # type: List[List[List[word_part_t]]]
+  fixed = []  # type: List[word_part_t]
+  for part in parts:
     tag = part.tag_()
     if tag in (word_part_e.BracedTuple, word_part_e.BracedRange):
-      num_alts += 1
-      if num_alts == 1:
-        first_alt_index = i
-      elif num_alts == 2:
-        break  # don't need to count anymore
+      if len(fixed):
+        segments.append([fixed])
+        fixed = []
+      segments.append(_Alternatives(part))
+    else:
+      fixed.append(part)
 
-  # NOTE: There are TWO recursive calls here, not just one -- one for
-  # nested {}, and one for adjacent {}.  This is hard to do iteratively.
-  if num_alts == 0:
-    return [parts]
+  if len(segments) == 0:
+    return [parts]  # no {}
+  if len(fixed):
+    segments.append([fixed])
 
-  elif num_alts == 1:
-    suffix = parts[first_alt_index+1 : ]
-    return _ExpandPart(parts, first_alt_index, [suffix])
+  num_words = 1
+  for seg in segments:
+    num_words *= len(seg)
 
-  else:
-    # Now call it on the tail
-    tail_parts = parts[first_alt_index+1 : ]
-    suffixes = _BraceExpand(tail_parts)  # recursive call
-    return _ExpandPart(parts, first_alt_index, suffixes)
+  out = []  # type: List[List[word_part_t]]
+  n = len(segments)
+  choices = [0] * n
+  for _ in xrange(num_words):
+    out_parts = []  # type: List[word_part_t]
+    for i in xrange(n):
+      out_parts.extend(segments[i][choices[i]])
+    out.append(out_parts)
+
+    # The last {} varies fastest, like bash
+    i = n - 1
+    while i >= 0:
+      choices[i] += 1
+      if choices[i] < len(segments[i]):
+        break
+      choices[i] = 0
+      i -= 1
+
+  return out
+
+
+def LazyIntRange(words):
+  # type: (List[word_t]) -> Optional[IntRange]
+  """If the words are just {1..N}, return an IntRange.
+
+  Then 'for i in {1..1000000}' doesn't make a million strings before it
+  starts.  The numbers don't need word evaluation, since they can't be split
+  or globbed.
+  """
+  if len(words) != 1:
+    return None
+
+  UP_w = words[0]
+  if UP_w.tag_() != word_e.BracedTree:
+    return None
+  w = cast(word__BracedTree, UP_w)
+  if len(w.parts) != 1:
+    return None
+
+  UP_part = w.parts[0]
+  if UP_part.tag_() != word_part_e.BracedRange:
+    return None
+  part = cast(word_part__BracedRange, UP_part)
+  if part.kind != Id.Range_Int:
+    return None
+
+  return IntRange(part)
 
 
 def BraceExpandWords(words):
@@ -11,6 +11,7 @@ from _devbuild.gen.syntax_asdl import word_part_e, compound_word
 from asdl import format as fmt
 from core.pyerror import log
 from core.test_lib import Tok
+from frontend import lexer
 from osh import braces  # module under test
 from osh import word_parse_test
 
@@ -182,6 +183,30 @@ class BracesTest(unittest.TestCase):
       _PrettyPrint(compound_word(parts))
       print('')
 
+    # The last {} varies fastest
+    w = _assertReadWord(self, '{a,b}{1..3}-{x,y{1,2}}')
+    tree = braces._BraceDetect(w)
+    results = braces._BraceExpand(tree.parts)
+    strs = [''.join(lexer.TokenVal(t) for t in parts) for parts in results]
+    self.assertEqual(18, len(strs))
+    self.assertEqual(['a1-x', 'a1-y1', 'a1-y2', 'a2-x'], strs[:4])
+    self.assertEqual('b3-y2', strs[-1])
+
+  def testLazyIntRange(self):
+    w = _assertReadWord(self, '{08..12..2}')
+    words = braces.BraceDetectAll([w])
+    it = braces.LazyIntRange(words)
+    strs = []
+    while not it.Done():
+      strs.append(it.Value())
+      it.Next()
+    self.assertEqual(['08', '10', '12'], strs)
+
+    for s in ['{a..c}', '{1..3}x', '{1,2}']:
+      w = _assertReadWord(self, s)
+      words = braces.BraceDetectAll([w])
+      self.assertEqual(None, braces.LazyIntRange(words))
+
 
 if __name__ == '__main__':
   unittest.main()
@@ -20,6 +20,7 @@ from frontend import flag_spec
 from frontend import location
 from frontend import args
 from mycpp import mylib
+from osh import sh_array
 from osh import sh_expr_eval
 from osh import cmd_eval
 from qsn_ import qsn
@@ -144,28 +145,23 @@ def _PrintVariables(mem, cmd_val, attrs, print_flags, builtin=_OTHER):
     elif val.tag_() == value_e.MaybeStrArray:
       array_val = cast(value__MaybeStrArray, val)
 
-      # mycpp rewrite: None in array_val.strs
-      has_holes = False
-      for s in array_val.strs:
-        if s is None:
-          has_holes = True
-          break
+      indices = sh_array.Indices(array_val)
+      items = sh_array.Items(array_val)
+      # The last index is past the end if there are holes
+      has_holes = len(indices) != 0 and indices[-1] != len(indices) - 1
 
       if has_holes:
         # Note: Arrays with unset elements are printed in the form:
         #   declare -p arr=(); arr[3]='' arr[4]='foo' ...
-        decl.append("=()")
-        first = True
-        for i, element in enumerate(array_val.strs):
-          if element is not None:
-            if first:
-              decl.append(";")
-              first = False
-            decl.extend([" ", name, "[", str(i), "]=",
-                         qsn.maybe_shell_encode(element)])
+        decl.append("=(); ")
+        for k, i in enumerate(indices):
+          if k != 0:
+            decl.append(" ")
+          decl.extend([name, "[", str(i), "]=",
+                       qsn.maybe_shell_encode(items[k])])
       else:
         body = []  # type: List[str]
-        for element in array_val.strs:
+        for element in items:
           if len(body) > 0: body.append(" ")
           body.append(qsn.maybe_shell_encode(element))
         decl.extend(["=(", ''.join(body), ")"])
@@ -300,7 +296,7 @@ class Readonly(vm._AssignBuiltin):
     for pair in cmd_val.pairs:
       if pair.rval is None:
         if arg.a:
-          rval = value.MaybeStrArray([])  # type: value_t
+          rval = value.MaybeStrArray([], None)  # type: value_t
         elif arg.A:
           rval = value.AssocArray({})
         else:
@@ -410,7 +406,7 @@ class NewVar(vm._AssignBuiltin):
         old_val = self.mem.GetValue(pair.var_name)
         if arg.a:
           if old_val.tag_() != value_e.MaybeStrArray:
-            rval = value.MaybeStrArray([])
+            rval = value.MaybeStrArray([], None)
         elif arg.A:
           if old_val.tag_() != value_e.AssocArray:
             rval = value.AssocArray({})
@@ -6,7 +6,7 @@ from __future__ import print_function
 
 from _devbuild.gen import arg_types
 from _devbuild.gen.runtime_asdl import cmd_value, CommandStatus
-from _devbuild.gen.syntax_asdl import source, loc
+from _devbuild.gen.syntax_asdl import source, source_t, loc
 from asdl import runtime
 from core import alloc
 from core import dev
@@ -20,6 +20,7 @@ from frontend import flag_spec
 from frontend import consts
 from frontend import reader
 from frontend import typed_args
+from mycpp import mylib
 from osh import cmd_eval
 
 _ = log
@@ -29,6 +30,7 @@ if TYPE_CHECKING:
   from _devbuild.gen.runtime_asdl import cmd_value__Argv, Proc
   from frontend.parse_lib import ParseContext
   from core import optview
+  from core.parse_cache import ParseCache, CodeCache, Recorder
   from core import process
   from core import state
   from core import ui
@@ -37,14 +39,57 @@ if TYPE_CHECKING:
 
 class Eval(vm._Builtin):
 
-  def __init__(self, parse_ctx, exec_opts, cmd_ev, tracer, errfmt):
-    # type: (ParseContext, optview.Exec, CommandEvaluator, dev.Tracer, ui.ErrorFormatter) -> None
+  def __init__(self, parse_ctx, exec_opts, cmd_ev, tracer, errfmt, code_cache):
+    # type: (ParseContext, optview.Exec, CommandEvaluator, dev.Tracer, ui.ErrorFormatter, CodeCache) -> None
     self.parse_ctx = parse_ctx
     self.arena = parse_ctx.arena
     self.exec_opts = exec_opts
     self.cmd_ev = cmd_ev
     self.tracer = tracer
     self.errfmt = errfmt
+    self.code_cache = code_cache
+
+  def _Batch(self, code_str, eval_spid):
+    # type: (str, int) -> int
+    """Parse and run code, reusing the nodes from an earlier eval if we can."""
+    # The location of the code includes the call site, so that's part of the
+    # key.  It's the same for each iteration of a loop.
+    key = '%d %s' % (eval_spid, code_str)
+
+    f = mylib.BufLineReader(code_str)
+    line_num = 1
+    cached = self.code_cache.Get(key)
+    if cached:
+      status, done = main_loop.BatchCached(
+          self.cmd_ev, cached, cmd_flags=cmd_eval.RaiseControlFlow)
+      if done:
+        return status
+
+      # Parse the rest, skipping what was already run
+      line_num = cached.ResumeLine()
+      for _ in xrange(line_num - 1):
+        f.readline()
+
+    line_reader = reader.FileLineReader(f, self.arena)
+    line_reader.SetLineOffset(line_num)
+    c_parser = self.parse_ctx.MakeOshParser(line_reader)
+
+    recorder = None  # type: Optional[Recorder]
+    if line_num == 1:
+      recorder = self.code_cache.StartRecording(c_parser, len(code_str))
+    if recorder is None:
+      return main_loop.Batch(self.cmd_ev, c_parser, self.errfmt,
+                             cmd_flags=cmd_eval.RaiseControlFlow)
+
+    try:
+      status = main_loop.Batch(self.cmd_ev, c_parser, self.errfmt,
+                               cmd_flags=cmd_eval.RaiseControlFlow,
+                               recorder=recorder)
+    except vm.ControlFlow as e:
+      self.code_cache.Save(key, recorder)  # releases it without saving
+      raise
+    self.code_cache.Save(key, recorder)
+    return status
 
   def Run(self, cmd_val):
     # type: (cmd_value__Argv) -> int
@@ -61,20 +106,17 @@ class Eval(vm._Builtin):
       # code_str could be EMPTY, so just use the first one
       eval_spid = cmd_val.arg_spids[0]
 
-    line_reader = reader.StringLineReader(code_str, self.arena)
-    c_parser = self.parse_ctx.MakeOshParser(line_reader)
-
     src = source.ArgvWord('eval', eval_spid)
     with dev.ctx_Tracer(self.tracer, 'eval', None):
       with alloc.ctx_Location(self.arena, src):
-        return main_loop.Batch(self.cmd_ev, c_parser, self.errfmt,
-                               cmd_flags=cmd_eval.RaiseControlFlow)
+        return self._Batch(code_str, eval_spid)
 
 
 class Source(vm._Builtin):
 
-  def __init__(self, parse_ctx, search_path, cmd_ev, fd_state, tracer, errfmt):
-    # type: (ParseContext, state.SearchPath, CommandEvaluator, process.FdState, dev.Tracer, ui.ErrorFormatter) -> None
+  def __init__(self, parse_ctx, search_path, cmd_ev, fd_state, tracer, errfmt,
+               parse_cache):
+    # type: (ParseContext, state.SearchPath, CommandEvaluator, process.FdState, dev.Tracer, ui.ErrorFormatter, Optional[ParseCache]) -> None
     self.parse_ctx = parse_ctx
     self.arena = parse_ctx.arena
     self.search_path = search_path
@@ -82,9 +124,48 @@ class Source(vm._Builtin):
     self.fd_state = fd_state
     self.tracer = tracer
     self.errfmt = errfmt
+    self.parse_cache = parse_cache
 
     self.mem = cmd_ev.mem
 
+  def _Batch(self, f, path, src):
+    # type: (mylib.LineReader, str, source_t) -> int
+    """Parse and run a file, using the parse cache if it's enabled."""
+    line_num = 1
+    if self.parse_cache:
+      cached = self.parse_cache.Load(path, src)
+      if cached:
+        status, done = main_loop.BatchCached(
+            self.cmd_ev, cached, cmd_flags=cmd_eval.RaiseControlFlow)
+        if done:
+          return status
+
+        # Parse the rest of the file, skipping what was already run
+        line_num = cached.ResumeLine()
+        for _ in xrange(line_num - 1):
+          f.readline()
+
+    line_reader = reader.FileLineReader(f, self.arena)
+    line_reader.SetLineOffset(line_num)
+    c_parser = self.parse_ctx.MakeOshParser(line_reader)
+
+    recorder = None  # type: Optional[Recorder]
+    if self.parse_cache and line_num == 1:
+      recorder = self.parse_cache.StartRecording(path, c_parser, src)
+    if recorder is None:
+      return main_loop.Batch(self.cmd_ev, c_parser, self.errfmt,
+                             cmd_flags=cmd_eval.RaiseControlFlow)
+
+    try:
+      status = main_loop.Batch(self.cmd_ev, c_parser, self.errfmt,
+                               cmd_flags=cmd_eval.RaiseControlFlow,
+                               recorder=recorder)
+    except vm.ControlFlow as e:
+      self.parse_cache.Save(recorder)  # releases it without saving
+      raise
+    self.parse_cache.Save(recorder)
+    return status
+
   def Run(self, cmd_val):
     # type: (cmd_value__Argv) -> int
     call_spid = cmd_val.arg_spids[0]
@@ -106,9 +187,6 @@ class Source(vm._Builtin):
                          span_id=cmd_val.arg_spids[1])
       return 1
 
-    line_reader = reader.FileLineReader(f, self.arena)
-    c_parser = self.parse_ctx.MakeOshParser(line_reader)
-
     # A sourced module CAN have a new arguments array, but it always shares
     # the same variable scope as the caller.  The caller could be at either a
     # global or a local scope.
@@ -119,8 +197,7 @@ class Source(vm._Builtin):
           src = source.SourcedFile(path, call_spid)
           with alloc.ctx_Location(self.arena, src):
             try:
-              status = main_loop.Batch(self.cmd_ev, c_parser, self.errfmt,
-                                       cmd_flags=cmd_eval.RaiseControlFlow)
+              status = self._Batch(f, resolved, src)
             except vm.ControlFlow as e:
               if e.IsReturn():
                 status = e.StatusCode()
@@ -329,6 +329,11 @@ class Read(vm._Builtin):
 
   def Run(self, cmd_val):
     # type: (cmd_value__Argv) -> int
+
+    # Another process may be waiting for our output before it writes our
+    # input, e.g. after echo -n 'Name? '
+    pyos.FlushStdout()
+
     try:
       status = self._Run(cmd_val)
     except pyos.ReadError as e:  # different paths for read -d, etc.
@@ -509,6 +514,8 @@ class MapFile(vm._Builtin):
      if var_name.startswith(':'):
        var_name = var_name[1:]
 
+    pyos.FlushStdout()  # like 'read'
+
     lines = []  # type: List[str]
     while True:
       # bash uses this slow algorithm; Oil could provide read --all-lines
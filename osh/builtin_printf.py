@@ -22,6 +22,7 @@ from core import alloc
 from core import error
 from core.pyerror import e_die, p_die, log
 from core import state
+from core import util
 from core import vm
 from frontend import flag_spec
 from frontend import consts
@@ -29,13 +30,14 @@ from frontend import lexer
 from frontend import match
 from frontend import reader
 from mycpp import mylib
+from osh import printf_format
 from osh import sh_expr_eval
 from osh import word_compile
 from qsn_ import qsn
 
 import posix_ as posix
 
-from typing import Dict, List, TYPE_CHECKING, cast
+from typing import Dict, List, Optional, TYPE_CHECKING, cast
 
 if TYPE_CHECKING:
   from core import ui
@@ -149,6 +151,52 @@ class _FormatStringParser(object):
     return parts
 
 
+# Formats are usually literals, so this only has to cover the printf calls in
+# one loop body.  A format built from data, like printf "$line", is evicted
+# without pushing those out.
+_MAX_FORMATS = 32
+
+
+class _Directive(object):
+  """Literal text, followed by an optional conversion like %-5s.
+
+  A format string is compiled to a list of these once, so formatting args
+  doesn't look at tokens or evaluate backslash escapes again.
+  """
+
+  def __init__(self, literal):
+    # type: (str) -> None
+    self.literal = literal  # written before the conversion
+
+    # One of s q b d i u o x X, or T for %(...)T.  Empty if there's no
+    # conversion.
+    self.typ = ''
+    self.time_fmt = ''  # for %(...)T
+
+    self.left = False  # - flag
+    self.zero = False  # 0 flag
+
+    # -1 if there's no width or precision
+    self.width = -1
+    self.width_star = False
+    self.precision = -1
+    self.precision_star = False
+
+    # For error messages
+    self.width_spid = runtime.NO_SPID
+    self.precision_spid = runtime.NO_SPID
+    self.type_spid = runtime.NO_SPID
+
+
+class _CompiledFormat(util.CacheEntry):
+
+  def __init__(self, directives, first_span_id):
+    # type: (List[_Directive], int) -> None
+    util.CacheEntry.__init__(self)
+    self.directives = directives
+    self.first_span_id = first_span_id  # of the tokens the spids refer to
+
+
 class Printf(vm._Builtin):
 
   def __init__(self, mem, parse_ctx, unsafe_arith, errfmt):
@@ -157,12 +205,14 @@ class Printf(vm._Builtin):
     self.parse_ctx = parse_ctx
     self.unsafe_arith = unsafe_arith
     self.errfmt = errfmt
-    self.parse_cache = {}  # type: Dict[str, List[printf_part_t]]
+
+    # Compiled format strings, e.g. for printf in a loop
+    self.formats = util.LruCache(_MAX_FORMATS)
 
     self.shell_start_time = time_.time()  # this object initialized in main()
 
-  def _Format(self, parts, varargs, spids, out):
-    # type: (List[printf_part_t], List[str], List[int], List[str]) -> int
+  def _Format(self, directives, varargs, spids, buf):
+    # type: (List[_Directive], List[str], List[int], mylib.BufWriter) -> int
     """Hairy printf formatting logic."""
 
     arg_index = 0
@@ -170,249 +220,168 @@ class Printf(vm._Builtin):
     backslash_c = False
 
     while True:  # loop over arguments
-      for part in parts:  # loop over parsed format string
-        UP_part = part
-        if part.tag_() == printf_part_e.Literal:
-          part = cast(printf_part__Literal, UP_part)
-          token = part.token
-          if token.id == Id.Format_EscapedPercent:
-            s = '%'
-          else:
-            s = word_compile.EvalCStringToken(token)
-          out.append(s)
-
-        elif part.tag_() == printf_part_e.Percent:
-          # Note: This case is very long, but hard to refactor because of the
-          # error cases and "recycling" of args!  (arg_index, return 1, etc.)
-          part = cast(printf_part__Percent, UP_part)
-
-          # TODO: These calculations are independent of the data, so could be
-          # cached
-          flags = []  # type: List[str]
-          if len(part.flags) > 0:
-            for flag_token in part.flags:
-              flags.append(lexer.TokenVal(flag_token))
-
-          width = -1  # nonexistent
-          if part.width:
-            if part.width.id in (Id.Format_Num, Id.Format_Zero):
-              width_str = lexer.TokenVal(part.width)
-              width_spid = part.width.span_id
-            elif part.width.id == Id.Format_Star:
-              if arg_index < num_args:
-                width_str = varargs[arg_index]
-                width_spid = spids[arg_index]
-                arg_index += 1
-              else:
-                width_str = ''  # invalid
-                width_spid = runtime.NO_SPID
-            else:
-              raise AssertionError()
+      for d in directives:  # loop over compiled format string
+        buf.write(d.literal)
+        typ = d.typ
+        if len(typ) == 0:  # no conversion
+          continue
 
-            try:
-              width = int(width_str)
-            except ValueError:
-              if width_spid == runtime.NO_SPID:
-                width_spid = part.width.span_id
-              self.errfmt.Print_("printf got invalid width %r" % width_str,
-                                 span_id=width_spid)
-              return 1
-
-          precision = -1  # nonexistent
-          if part.precision:
-            if part.precision.id == Id.Format_Dot:
-              precision_str = '0'
-              precision_spid = part.precision.span_id
-            elif part.precision.id in (Id.Format_Num, Id.Format_Zero):
-              precision_str = lexer.TokenVal(part.precision)
-              precision_spid = part.precision.span_id
-            elif part.precision.id == Id.Format_Star:
-              if arg_index < num_args:
-                precision_str = varargs[arg_index]
-                precision_spid = spids[arg_index]
-                arg_index += 1
-              else:
-                precision_str = ''
-                precision_spid = runtime.NO_SPID
-            else:
-              raise AssertionError()
-
-            try:
-              precision = int(precision_str)
-            except ValueError:
-              if precision_spid == runtime.NO_SPID:
-                precision_spid = part.precision.span_id
-              self.errfmt.Print_(
-                  'printf got invalid precision %r' % precision_str,
-                  span_id=precision_spid)
-              return 1
+        # Note: This case is very long, but hard to refactor because of the
+        # error cases and "recycling" of args!  (arg_index, return 1, etc.)
 
+        width = d.width
+        if d.width_star:
+          if arg_index < num_args:
+            width_str = varargs[arg_index]
+            width_spid = spids[arg_index]
+            arg_index += 1
+          else:
+            width_str = ''  # invalid
+            width_spid = runtime.NO_SPID
+
+          try:
+            width = int(width_str)
+          except ValueError:
+            if width_spid == runtime.NO_SPID:
+              width_spid = d.width_spid
+            self.errfmt.Print_("printf got invalid width %r" % width_str,
+                               span_id=width_spid)
+            return 1
+
+        precision = d.precision
+        if d.precision_star:
           if arg_index < num_args:
-            s = varargs[arg_index]
-            word_spid = spids[arg_index]
+            precision_str = varargs[arg_index]
+            precision_spid = spids[arg_index]
             arg_index += 1
-            has_arg = True
           else:
-            s = ''
-            word_spid = runtime.NO_SPID
-            has_arg = False
-
-          # Note: %s could be lexed into Id.Percent_S.  Although small string
-          # optimization would remove the allocation as well.
-          typ = lexer.TokenVal(part.type)
-          if typ == 's':
-            if precision >= 0:
-              s = s[:precision]  # truncate
-
-          elif typ == 'q':
-            # TODO: most shells give \' for single quote, while OSH gives $'\''
-            # this could matter when SSH'ing
-            s = qsn.maybe_shell_encode(s)
-
-          elif typ == 'b':
-            # Process just like echo -e, except \c handling is simpler.
-
-            c_parts = []  # type: List[str]
-            lex = match.EchoLexer(s)
-            while True:
-              id_, tok_val = lex.Next()
-              if id_ == Id.Eol_Tok:  # Note: This is really a NUL terminator
-                break
-
-              # Note: DummyToken is OK because EvalCStringToken() doesn't have
-              # any syntax errors.
-              tok = lexer.DummyToken(id_, tok_val)
-              p = word_compile.EvalCStringToken(tok)
-
-              # Unusual behavior: '\c' aborts processing!
-              if p is None:
-                backslash_c = True
-                break
-
-              c_parts.append(p)
-            s = ''.join(c_parts)
-
-          elif part.type.id == Id.Format_Time or typ in 'diouxX':
-            # %(...)T and %d share this complex integer conversion logic
+            precision_str = ''
+            precision_spid = runtime.NO_SPID
+
+          try:
+            precision = int(precision_str)
+          except ValueError:
+            if precision_spid == runtime.NO_SPID:
+              precision_spid = d.precision_spid
+            self.errfmt.Print_(
+                'printf got invalid precision %r' % precision_str,
+                span_id=precision_spid)
+            return 1
+
+        if arg_index < num_args:
+          s = varargs[arg_index]
+          word_spid = spids[arg_index]
+          arg_index += 1
+          has_arg = True
+        else:
+          s = ''
+          word_spid = runtime.NO_SPID
+          has_arg = False
+
+        if typ == 's':
+          printf_format.WriteStr(buf, s, width, precision, d.left)
+
+        elif typ == 'q':
+          # TODO: most shells give \' for single quote, while OSH gives $'\''
+          # this could matter when SSH'ing
+          s = qsn.maybe_shell_encode(s)
+          printf_format.WriteStr(buf, s, width, -1, d.left)
+
+        elif typ == 'b':
+          # Process just like echo -e, except \c handling is simpler.
+
+          c_parts = []  # type: List[str]
+          lex = match.EchoLexer(s)
+          while True:
+            id_, tok_val = lex.Next()
+            if id_ == Id.Eol_Tok:  # Note: This is really a NUL terminator
+              break
+
+            # Note: DummyToken is OK because EvalCStringToken() doesn't have
+            # any syntax errors.
+            tok = lexer.DummyToken(id_, tok_val)
+            p = word_compile.EvalCStringToken(tok)
+
+            # Unusual behavior: '\c' aborts processing!
+            if p is None:
+              backslash_c = True
+              break
+
+            c_parts.append(p)
+          s = ''.join(c_parts)
+          printf_format.WriteStr(buf, s, width, -1, d.left)
 
-            try:
-              d = int(s)  # note: spaces like ' -42 ' accepted and normalized
+        else:
+          # %(...)T and %d share this complex integer conversion logic
 
-            except ValueError:
-              # 'a is interpreted as the ASCII value of 'a'
-              if len(s) >= 1 and s[0] in '\'"':
-                # TODO: utf-8 decode s[1:] to be more correct.  Probably
-                # depends on issue #366, a utf-8 library.
-                # Note: len(s) == 1 means there is a NUL (0) after the quote..
-                d = ord(s[1]) if len(s) >= 2 else 0
-
-              # No argument means -1 for %(...)T as in Bash Reference Manual
-              # 4.2 "If no argument is specified, conversion behaves as if -1
-              # had been given."
-              elif not has_arg and part.type.id == Id.Format_Time:
-                d = -1
-
-              else:
-                blame_spid = word_spid if has_arg else part.type.span_id
-                self.errfmt.Print_('printf expected an integer, got %r' % s,
-                                   span_id=blame_spid)
-                return 1
-
-            if part.type.id == Id.Format_Time:
-              # Initialize timezone:
-              #   `localtime' uses the current timezone information initialized
-              #   by `tzset'.  The function `tzset' refers to the environment
-              #   variable `TZ'.  When the exported variable `TZ' is present,
-              #   its value should be reflected in the real environment
-              #   variable `TZ' before call of `tzset'.
-              #
-              # Note: unlike LANG, TZ doesn't seem to change behavior if it's
-              # not exported.
-              #
-              # TODO: In Oil, provide an API that doesn't rely on libc's
-              # global state.
-
-              tzcell = self.mem.GetCell('TZ')
-              if tzcell and tzcell.exported and tzcell.val.tag_() == value_e.Str:
-                tzval = cast(value__Str, tzcell.val)
-                posix.putenv('TZ', tzval.s)
-
-              time_.tzset()
-
-              # Handle special values:
-              #   User can specify two special values -1 and -2 as in Bash
-              #   Reference Manual 4.2: "Two special argument values may be
-              #   used: -1 represents the current time, and -2 represents the
-              #   time the shell was invoked." from
-              #   https://www.gnu.org/software/bash/manual/html_node/Bash-Builtins.html#index-printf
-              if d == -1: # the current time
-                ts = time_.time()
-              elif d == -2: # the shell start time
-                ts = self.shell_start_time
-              else:
-                ts = d
-
-              s = time_.strftime(typ[1:-2], time_.localtime(ts))
-              if precision >= 0:
-                s = s[:precision]  # truncate
-
-            else:  # typ in 'diouxX'
-              # Disallowed because it depends on 32- or 64- bit
-              if d < 0 and typ in 'ouxX':
-                e_die("Can't format negative number %d with %%%s" % (d, typ), 
-                      loc.Span(part.type.span_id))
-
-              if typ == 'o':
-                s = mylib.octal(d)
-              elif typ == 'x':
-                s = mylib.hex_lower(d)
-              elif typ == 'X':
-                s = mylib.hex_upper(d)
-              else:  # diu
-                s = str(d)  # without spaces like ' -42 '
-
-              # There are TWO different ways to ZERO PAD, and they differ on
-              # the negative sign!  See spec/builtin-printf
-
-              zero_pad = 0  # no zero padding
-              if width >= 0 and '0' in flags:
-                zero_pad = 1  # style 1
-              elif precision > 0 and len(s) < precision:
-                zero_pad = 2  # style 2
-
-              if zero_pad:
-                negative = (s[0] == '-')
-                if negative:
-                  digits = s[1:]
-                  sign = '-'
-                  if zero_pad == 1:
-                    # [%06d] -42 becomes [-00042] (6 TOTAL)
-                    n = width - 1
-                  else:
-                    # [%6.6d] -42 becomes [-000042] (1 for '-' + 6)
-                    n = precision
-                else:
-                  digits = s
-                  sign = ''
-                  if zero_pad == 1:
-                    n = width
-                  else:
-                    n = precision
-                s = sign + digits.rjust(n, '0')
+          try:
+            num = int(s)  # note: spaces like ' -42 ' accepted and normalized
 
-          else:
-            raise AssertionError()
+          except ValueError:
+            # 'a is interpreted as the ASCII value of 'a'
+            if len(s) >= 1 and s[0] in '\'"':
+              # TODO: utf-8 decode s[1:] to be more correct.  Probably
+              # depends on issue #366, a utf-8 library.
+              # Note: len(s) == 1 means there is a NUL (0) after the quote..
+              num = ord(s[1]) if len(s) >= 2 else 0
+
+            # No argument means -1 for %(...)T as in Bash Reference Manual
+            # 4.2 "If no argument is specified, conversion behaves as if -1
+            # had been given."
+            elif not has_arg and typ == 'T':
+              num = -1
 
-          if width >= 0:
-            if '-' in flags:
-              s = s.ljust(width, ' ')
             else:
-              s = s.rjust(width, ' ')
+              blame_spid = word_spid if has_arg else d.type_spid
+              self.errfmt.Print_('printf expected an integer, got %r' % s,
+                                 span_id=blame_spid)
+              return 1
 
-          out.append(s)
+          if typ == 'T':
+            # Initialize timezone:
+            #   `localtime' uses the current timezone information initialized
+            #   by `tzset'.  The function `tzset' refers to the environment
+            #   variable `TZ'.  When the exported variable `TZ' is present,
+            #   its value should be reflected in the real environment
+            #   variable `TZ' before call of `tzset'.
+            #
+            # Note: unlike LANG, TZ doesn't seem to change behavior if it's
+            # not exported.
+            #
+            # TODO: In Oil, provide an API that doesn't rely on libc's
+            # global state.
+
+            tzcell = self.mem.GetCell('TZ')
+            if tzcell and tzcell.exported and tzcell.val.tag_() == value_e.Str:
+              tzval = cast(value__Str, tzcell.val)
+              posix.putenv('TZ', tzval.s)
+
+            time_.tzset()
+
+            # Handle special values:
+            #   User can specify two special values -1 and -2 as in Bash
+            #   Reference Manual 4.2: "Two special argument values may be
+            #   used: -1 represents the current time, and -2 represents the
+            #   time the shell was invoked." from
+            #   https://www.gnu.org/software/bash/manual/html_node/Bash-Builtins.html#index-printf
+            if num == -1: # the current time
+              ts = time_.time()
+            elif num == -2: # the shell start time
+              ts = self.shell_start_time
+            else:
+              ts = num
 
-        else:
-          raise AssertionError()
+            s = time_.strftime(d.time_fmt, time_.localtime(ts))
+            printf_format.WriteStr(buf, s, width, precision, d.left)
+
+          else:  # typ in 'diouxX'
+            # Disallowed because it depends on 32- or 64- bit
+            if num < 0 and typ in 'ouxX':
+              e_die("Can't format negative number %d with %%%s" % (num, typ),
+                    loc.Span(d.type_spid))
+
+            printf_format.WriteInt(buf, num, typ, width, precision, d.zero,
+                                   d.left)
 
         if backslash_c:  # 'printf %b a\cb xx' - \c terminates processing!
           break
@@ -428,6 +397,123 @@ class Printf(vm._Builtin):
 
     return 0
 
+  def _Compile(self, parts):
+    # type: (List[printf_part_t]) -> Optional[List[_Directive]]
+    """Decode everything that doesn't depend on the args."""
+    directives = []  # type: List[_Directive]
+    literal = []  # type: List[str]
+
+    for part in parts:
+      UP_part = part
+      if part.tag_() == printf_part_e.Literal:
+        part = cast(printf_part__Literal, UP_part)
+        token = part.token
+        if token.id == Id.Format_EscapedPercent:
+          literal.append('%')
+        else:
+          literal.append(word_compile.EvalCStringToken(token))
+
+      elif part.tag_() == printf_part_e.Percent:
+        part = cast(printf_part__Percent, UP_part)
+        d = _Directive(''.join(literal))
+        literal = []
+
+        for flag_token in part.flags:
+          flag = lexer.TokenVal(flag_token)
+          if flag == '-':
+            d.left = True
+          elif flag == '0':
+            d.zero = True
+
+        if part.width:
+          d.width_spid = part.width.span_id
+          if part.width.id == Id.Format_Star:
+            d.width_star = True
+          else:
+            width_str = lexer.TokenVal(part.width)
+            try:
+              d.width = int(width_str)
+            except ValueError:
+              self.errfmt.Print_("printf got invalid width %r" % width_str,
+                                 span_id=d.width_spid)
+              return None
+
+        if part.precision:
+          d.precision_spid = part.precision.span_id
+          if part.precision.id == Id.Format_Dot:
+            d.precision = 0
+          elif part.precision.id == Id.Format_Star:
+            d.precision_star = True
+          else:
+            precision_str = lexer.TokenVal(part.precision)
+            try:
+              d.precision = int(precision_str)
+            except ValueError:
+              self.errfmt.Print_(
+                  'printf got invalid precision %r' % precision_str,
+                  span_id=d.precision_spid)
+              return None
+
+        d.type_spid = part.type.span_id
+        typ = lexer.TokenVal(part.type)
+        if part.type.id == Id.Format_Time:
+          d.typ = 'T'
+          d.time_fmt = typ[1:-2]
+        else:
+          d.typ = typ
+
+        directives.append(d)
+
+      else:
+        raise AssertionError()
+
+    if len(literal):
+      directives.append(_Directive(''.join(literal)))
+    return directives
+
+  def _GetFormat(self, fmt, fmt_spid):
+    # type: (str, int) -> Optional[List[_Directive]]
+    """Return the compiled format, parsing it if it's not in the cache.
+
+    Returns None if there was an error, after printing it.
+    """
+    arena = self.errfmt.arena
+
+    e = self.formats.Get(fmt)
+    if e is not None:
+      entry = cast(_CompiledFormat, e)
+      # The interactive shell releases the tokens of each command, and error
+      # messages refer to them.
+      if arena.HasToken(entry.first_span_id):
+        return entry.directives
+      self.formats.Remove(fmt)
+
+    first_span_id = arena.LastSpanId()
+    line_reader = reader.StringLineReader(fmt, arena)
+    # TODO: Make public
+    lexer = self.parse_ctx.MakeLexer(line_reader)
+    parser = _FormatStringParser(lexer)
+
+    with alloc.ctx_Location(arena, source.ArgvWord('printf', fmt_spid)):
+      try:
+        parts = parser.Parse()
+      except error.Parse as e:
+        self.errfmt.PrettyPrintError(e)
+        return None
+
+    if 0:
+      print()
+      for part in parts:
+        part.PrettyPrint()
+        print()
+
+    directives = self._Compile(parts)
+    if directives is None:
+      return None
+
+    self.formats.Put(fmt, _CompiledFormat(directives, first_span_id))
+    return directives
+
   def Run(self, cmd_val):
     # type: (cmd_value__Argv) -> int
     """
@@ -442,36 +528,16 @@ class Printf(vm._Builtin):
     #log('fmt %s', fmt)
     #log('vals %s', vals)
 
-    arena = self.errfmt.arena
-    if fmt in self.parse_cache:
-      parts = self.parse_cache[fmt]
-    else:
-      line_reader = reader.StringLineReader(fmt, arena)
-      # TODO: Make public
-      lexer = self.parse_ctx.MakeLexer(line_reader)
-      parser = _FormatStringParser(lexer)
-
-      with alloc.ctx_Location(arena, source.ArgvWord('printf', fmt_spid)):
-        try:
-          parts = parser.Parse()
-        except error.Parse as e:
-          self.errfmt.PrettyPrintError(e)
-          return 2  # parse error
-
-      self.parse_cache[fmt] = parts
-
-    if 0:
-      print()
-      for part in parts:
-        part.PrettyPrint()
-        print()
+    directives = self._GetFormat(fmt, fmt_spid)
+    if directives is None:
+      return 2  # parse error
 
-    out = []  # type: List[str]
-    status = self._Format(parts, varargs, spids, out)
+    buf = mylib.BufWriter()
+    status = self._Format(directives, varargs, spids, buf)
     if status != 0:
       return status  # failure
 
-    result = ''.join(out)
+    result = buf.getvalue()
     if arg.v is not None:
       # TODO: get the span_id for arg.v!
       v_spid = runtime.NO_SPID
@@ -30,6 +30,7 @@ from typing import Dict, List, Optional, TYPE_CHECKING
 if TYPE_CHECKING:
   from _devbuild.gen.syntax_asdl import command_t
   from core.comp_ui import _IDisplay
+  from core.parse_cache import CodeCache
   from core.ui import ErrorFormatter
   from frontend.parse_lib import ParseContext
 
@@ -166,13 +167,14 @@ _HOOK_NAMES = ['EXIT', 'ERR', 'RETURN', 'DEBUG']
 
 
 class Trap(vm._Builtin):
-  def __init__(self, trap_state, parse_ctx, tracer, errfmt):
-    # type: (TrapState, ParseContext, dev.Tracer, ErrorFormatter) -> None
+  def __init__(self, trap_state, parse_ctx, tracer, errfmt, code_cache):
+    # type: (TrapState, ParseContext, dev.Tracer, ErrorFormatter, CodeCache) -> None
     self.trap_state = trap_state
     self.parse_ctx = parse_ctx
     self.arena = parse_ctx.arena
     self.tracer = tracer
     self.errfmt = errfmt
+    self.code_cache = code_cache
 
   def _ParseTrapCode(self, code_str):
     # type: (str) -> command_t
@@ -180,18 +182,32 @@ class Trap(vm._Builtin):
     Returns:
       A node, or None if the code is invalid.
     """
+    # Scripts often reset the same handler, e.g. in a function
+    key = 'trap %s' % code_str
+    cached = self.code_cache.Get(key)
+    if cached:
+      node = cached.NextNode()  # None if an alias or parse option changed
+      if node:
+        return node
+
     line_reader = reader.StringLineReader(code_str, self.arena)
     c_parser = self.parse_ctx.MakeOshParser(line_reader)
+    recorder = self.code_cache.StartRecording(c_parser, len(code_str))
 
     # TODO: the SPID should be passed through argv.
     src = source.ArgvWord('trap', runtime.NO_SPID)
     with alloc.ctx_Location(self.arena, src):
       try:
-        node = main_loop.ParseWholeFile(c_parser)
+        node = main_loop.ParseWholeFile(c_parser, recorder=recorder)
       except error.Parse as e:
+        if recorder:
+          self.code_cache.Save(key, recorder)  # releases it without saving
         self.errfmt.PrettyPrintError(e)
         return None
 
+    if recorder:
+      self.code_cache.Save(key, recorder)
+    self.arena.PinSegment()  # the handler runs later
     return node
 
   def Run(self, cmd_val):
@@ -36,12 +36,12 @@ from _devbuild.gen.syntax_asdl import (
     expr_t,
     place_expr__Var,
     proc_sig_e, proc_sig__Closed,
-    redir_param_e, redir_param__HereDoc, proc_sig,
+    redir_param_e, redir_param__HereDoc, redir_loc_e, redir_loc__Fd, proc_sig,
     for_iter_e, for_iter__Words, for_iter__Oil,
     Token, loc,
 )
 from _devbuild.gen.runtime_asdl import (
-    lvalue_e, lvalue__ObjIndex, lvalue__ObjAttr,
+    lvalue_e, lvalue__Named, lvalue__ObjIndex, lvalue__ObjAttr,
     value, value_e, value_t, value__Str, value__MaybeStrArray,
     redirect, redirect_arg, scope_e,
     cmd_value_e, cmd_value__Argv, cmd_value__Assign,
@@ -59,9 +59,11 @@ from core import ui
 from core import util
 from core import vm
 from frontend import consts
+from frontend import lexer
 from frontend import location
 from oil_lang import objects
 from osh import braces
+from osh import sh_array
 from osh import sh_expr_eval
 from osh import word_
 from osh import word_eval
@@ -71,13 +73,13 @@ from mycpp.mylib import switch, tagswitch
 import posix_ as posix
 import libc  # for fnmatch
 
-from typing import List, Dict, Tuple, Any, cast, TYPE_CHECKING
+from typing import List, Dict, Tuple, Optional, Any, cast, TYPE_CHECKING
 
 if TYPE_CHECKING:
   from _devbuild.gen.id_kind_asdl import Id_t
   from _devbuild.gen.option_asdl import builtin_t
   from _devbuild.gen.runtime_asdl import (
-      cmd_value_t, cell, lvalue_t,
+      cmd_value_t, cell, lvalue_t, scope_t,
   )
   from _devbuild.gen.syntax_asdl import (
       redir, env_pair, proc_sig__Closed,
@@ -130,7 +132,7 @@ if mylib.PYTHON:
 
     elif isinstance(py_val, objects.StrArray):  # var a = %(a b)
       # It's safe to convert StrArray to MaybeStrArray.
-      val = value.MaybeStrArray(py_val)
+      val = value.MaybeStrArray(py_val, None)
 
     elif isinstance(py_val, dict):  # var d = {name: "bob"}
       # TODO: Is this necessary?  Shell assoc arrays aren't nested and don't have
@@ -185,6 +187,17 @@ def _HasManyStatuses(node):
   return True
 
 
+def _StdoutRedirect(redirects):
+  # type: (List[redirect]) -> Optional[redirect]
+  """Return the last redirect of descriptor 1, e.g. >out.txt, or None."""
+  result = None  # type: Optional[redirect]
+  for r in redirects:
+    UP_loc = r.loc
+    if r.loc.tag_() == redir_loc_e.Fd and cast(redir_loc__Fd, UP_loc).fd == 1:
+      result = r
+  return result
+
+
 def PlusEquals(old_val, val):
   # type: (value_t, value_t) -> value_t
   """Implement s+=val, typeset s+=val, etc."""
@@ -216,11 +229,18 @@ def PlusEquals(old_val, val):
     old_val = cast(value__MaybeStrArray, UP_old_val)
     to_append = cast(value__MaybeStrArray, UP_val)
 
-    # TODO: MUTATE the existing value for efficiency?
+    # a+=(x) in a loop mutates the cell with Mem.AppendArray().  This path is
+    # for a+=(x) that creates a new cell, e.g. a local copy of a global.
     strs = []  # type: List[str]
     strs.extend(old_val.strs)
-    strs.extend(to_append.strs)
-    val = value.MaybeStrArray(strs)
+    indices = None  # type: List[int]
+    if old_val.indices is not None:
+      indices = []
+      indices.extend(old_val.indices)
+
+    new_val = value.MaybeStrArray(strs, indices)
+    sh_array.Append(new_val, to_append.strs)
+    val = new_val
 
   return val
 
@@ -310,16 +330,20 @@ class CommandEvaluator(object):
       e_die("Assignment builtin %r not configured" % cmd_val.argv[0],
             loc.Span(cmd_val.arg_spids[0]))
 
-    with vm.ctx_FlushStdout():
-      with ui.ctx_Location(self.errfmt, cmd_val.arg_spids[0]):
-        try:
-          status = builtin_func.Run(cmd_val)
-        except error.Usage as e:  # Copied from RunBuiltin
-          arg0 = cmd_val.argv[0]
-          if e.span_id == runtime.NO_SPID:  # fill in default location.
-            e.span_id = self.errfmt.CurrentLocation()
-          self.errfmt.PrefixPrint(e.msg, '%r ' % arg0, loc.Span(e.span_id))
-          status = 2  # consistent error code for usage error
+    with ui.ctx_Location(self.errfmt, cmd_val.arg_spids[0]):
+      try:
+        status = builtin_func.Run(cmd_val)
+      except error.Usage as e:  # Copied from RunBuiltin
+        arg0 = cmd_val.argv[0]
+        if e.span_id == runtime.NO_SPID:  # fill in default location.
+          e.span_id = self.errfmt.CurrentLocation()
+        self.errfmt.PrefixPrint(e.msg, '%r ' % arg0, loc.Span(e.span_id))
+        status = 2  # consistent error code for usage error
+      except IOError as e:  # e.g. declare -p with a full batch
+        self.errfmt.PrefixPrint('write error: %s' % posix.strerror(e.errno),
+                                '%r ' % cmd_val.argv[0],
+                                loc.Span(cmd_val.arg_spids[0]))
+        status = 1
 
     return status
 
@@ -574,6 +598,28 @@ class CommandEvaluator(object):
       self.mem.SetValue(location.LName(e_pair.name), val, scope_e.LocalOnly,
                         flags=flags)
 
+  def _AppendInPlace(self, lval, rhs, which_scopes):
+    # type: (lvalue_t, value_t, scope_t) -> bool
+    """For s+=x and a+=(x), append to the existing cell rather than copying.
+
+    Returns whether it was done; otherwise fall back on PlusEquals().
+    """
+    if lval.tag_() != lvalue_e.Named:
+      return False  # a[i]+=x
+    name = cast(lvalue__Named, lval).name
+
+    UP_rhs = rhs
+    with tagswitch(rhs) as case:
+      if case(value_e.Str):
+        rhs = cast(value__Str, UP_rhs)
+        return self.mem.AppendString(name, rhs.s, which_scopes)
+
+      elif case(value_e.MaybeStrArray):
+        rhs = cast(value__MaybeStrArray, UP_rhs)
+        return self.mem.AppendArray(name, rhs.strs, which_scopes)
+
+    return False
+
   def _StrictErrExit(self, node):
     # type: (command_t) -> None
     if not (self.exec_opts.errexit() and self.exec_opts.strict_errexit()):
@@ -823,7 +869,7 @@ class CommandEvaluator(object):
             self.mem.SetCurrentSpanId(node.lhs[0].name.span_id)  # point to var name
 
             # Note: there's only one LHS
-            vd_lval = location.LName(node.lhs[0].name.tval)  # type: lvalue_t
+            vd_lval = location.LName(lexer.TokenVal(node.lhs[0].name))  # type: lvalue_t
             py_val = self.expr_ev.EvalExpr(node.rhs)
             val = _PyObjectToVal(py_val)  # type: value_t
 
@@ -837,7 +883,7 @@ class CommandEvaluator(object):
             vd_lvals = []  # type: List[lvalue_t]
             vals = []  # type: List[value_t]
             if len(node.lhs) == 1:  # TODO: optimize this common case (but measure)
-              vd_lval = location.LName(node.lhs[0].name.tval)
+              vd_lval = location.LName(lexer.TokenVal(node.lhs[0].name))
               val = _PyObjectToVal(py_val)
 
               vd_lvals.append(vd_lval)
@@ -845,7 +891,7 @@ class CommandEvaluator(object):
             else:
               it = py_val.__iter__()
               for vd_lhs in node.lhs:
-                vd_lval = location.LName(vd_lhs.name.tval)
+                vd_lval = location.LName(lexer.TokenVal(vd_lhs.name))
                 val = _PyObjectToVal(it.next())
 
                 vd_lvals.append(vd_lval)
@@ -920,7 +966,7 @@ class CommandEvaluator(object):
             # transformer and not the grammar.  We should do that too.
 
             place_expr = cast(place_expr__Var, node.lhs[0])
-            pe_lval = location.LName(place_expr.name.tval)
+            pe_lval = location.LName(lexer.TokenVal(place_expr.name))
             py_val = self.expr_ev.EvalExpr(node.rhs)
 
             new_py_val = self.expr_ev.EvalPlusEquals(pe_lval, py_val)
@@ -951,6 +997,11 @@ class CommandEvaluator(object):
             rhs = self.word_ev.EvalRhsWord(pair.rhs)
 
             lval = self.arith_ev.EvalShellLhs(pair.lhs, which_scopes)
+            if self._AppendInPlace(lval, rhs, which_scopes):
+              # Like bash, trace the RHS rather than the whole value
+              self.tracer.OnShAssignment(lval, pair.op, rhs, 0, which_scopes)
+              continue
+
             # do not respect set -u
             old_val = sh_expr_eval.OldValue(lval, self.mem, None)
 
@@ -1035,14 +1086,14 @@ class CommandEvaluator(object):
               arg = int(str_val.s)
             except ValueError:
               e_die('%r expected a number, got %r' %
-                    (node.token.tval, str_val.s), loc.Word(node.arg_word))
+                    (lexer.TokenVal(node.token), str_val.s), loc.Word(node.arg_word))
         else:
           if tok.id in (Id.ControlFlow_Exit, Id.ControlFlow_Return):
             arg = self.mem.LastStatus()
           else:
             arg = 1  # break or continue 1 level by default
 
-        self.tracer.OnControlFlow(tok.tval, arg)
+        self.tracer.OnControlFlow(lexer.TokenVal(tok), arg)
 
         # NOTE: A top-level 'return' is OK, unlike in bash.  If you can return
         # from a sourced script, it makes sense to return from a main script.
@@ -1152,6 +1203,7 @@ class CommandEvaluator(object):
 
         # for the 2 kinds of shell loop
         iter_list = None  # type: List[str]  
+        int_range = None  # type: braces.IntRange  # for x in {1..N}
 
         # for Oil loop
         iter_expr = None  # type: expr_t
@@ -1166,8 +1218,10 @@ class CommandEvaluator(object):
 
           elif case(for_iter_e.Words):
             iterable = cast(for_iter__Words, UP_iterable)
-            words = braces.BraceExpandWords(iterable.words)
-            iter_list = self.word_ev.EvalWordSequence(words)
+            int_range = braces.LazyIntRange(iterable.words)
+            if int_range is None:
+              words = braces.BraceExpandWords(iterable.words)
+              iter_list = self.word_ev.EvalWordSequence(words)
 
           elif case(for_iter_e.Oil):
             iterable = cast(for_iter__Oil, UP_iterable)
@@ -1176,7 +1230,7 @@ class CommandEvaluator(object):
 
         status = 0  # in case we don't loop
 
-        if iter_list is None:  # for_expr.Oil
+        if iter_list is None and int_range is None:  # for_expr.Oil
           if mylib.PYTHON:
             obj = self.expr_ev.EvalExpr(iter_expr)
 
@@ -1281,7 +1335,17 @@ class CommandEvaluator(object):
                            loc.Span(node.spids[0]))
 
             index = 0
-            for x in iter_list:
+            while True:
+              if int_range is not None:
+                if int_range.Done():
+                  break
+                x = int_range.Value()
+                int_range.Next()
+              else:
+                if index == len(iter_list):
+                  break
+                x = iter_list[index]
+
               #log('> ForEach setting %r', x)
               if mylib.PYTHON:
                 # value.Obj not available in C++
@@ -1350,8 +1414,8 @@ class CommandEvaluator(object):
       elif case(command_e.Proc):
         node = cast(command__Proc, UP_node)
 
-        if node.name.tval in self.procs and not self.exec_opts.redefine_proc():
-          e_die("Proc %s was already defined (redefine_proc)" % node.name.tval,
+        if lexer.TokenVal(node.name) in self.procs and not self.exec_opts.redefine_proc():
+          e_die("Proc %s was already defined (redefine_proc)" % lexer.TokenVal(node.name),
                 node.name)
 
         defaults = None  # type: List[value_t]
@@ -1365,8 +1429,8 @@ class CommandEvaluator(object):
                 py_val = self.expr_ev.EvalExpr(p.default_val)
                 defaults[i] = _PyObjectToVal(py_val)
      
-        self.procs[node.name.tval] = Proc(
-            node.name.tval, node.name.span_id, node.sig, node.body, defaults,
+        self.procs[lexer.TokenVal(node.name)] = Proc(
+            lexer.TokenVal(node.name), node.name.span_id, node.sig, node.body, defaults,
             False)  # no dynamic scope
 
         status = 0
@@ -1502,6 +1566,16 @@ class CommandEvaluator(object):
               status = 1
               check_errexit = True
 
+            # Builtins batch their output, so 'echo hi >/dev/full' only fails
+            # when it's flushed, before stdout is restored.
+            out_redir = _StdoutRedirect(redirects)
+            if out_redir is not None:
+              err_num = pyos.FlushStdout()
+              if err_num != 0:
+                self.errfmt.Print_('write error: %s' % posix.strerror(err_num),
+                                   span_id=out_redir.op_spid)
+                status = 1
+
           # Compute status from @PIPESTATUS
           codes = cmd_st.pipe_status
           if len(codes):  # Did we run a pipeline?
@@ -1736,17 +1810,18 @@ class CommandEvaluator(object):
     # type: (Proc, List[str], int) -> int
     """Run a shell "functions".
 
-    For SimpleCommand and registered completion hooks.
+    For SimpleCommand and registered completion hooks.  argv[0] is the name
+    of the proc.
     """
     sig = proc.sig
     if sig.tag_() == proc_sig_e.Closed:
       # We're binding named params.  User should use @rest.  No 'shift'.
-      proc_argv = []  # type: List[str]
+      proc_argv = [argv[0]]
     else:
-      proc_argv = argv
+      proc_argv = argv  # shared, not copied
 
     with state.ctx_Call(self.mem, self.mutable_opts, proc, proc_argv):
-      n_args = len(argv)
+      n_args = len(argv) - 1
       UP_sig = sig
 
       if UP_sig.tag_() == proc_sig_e.Closed:  # proc is-closed ()
@@ -1754,9 +1829,9 @@ class CommandEvaluator(object):
         for i, p in enumerate(sig.untyped):
           is_out_param = p.ref is not None
 
-          param_name = p.name.tval
+          param_name = lexer.TokenVal(p.name)
           if i < n_args:
-            arg_str = argv[i]
+            arg_str = argv[i + 1]
 
             # If we have myproc(p), and call it with myproc :arg, then bind
             # __p to 'arg'.  That is, the param has a prefix ADDED, and the arg
@@ -1775,7 +1850,7 @@ class CommandEvaluator(object):
           else:
             val = proc.defaults[i]
             if val is None:
-              e_die("No value provided for param %r" % p.name.tval)
+              e_die("No value provided for param %r" % lexer.TokenVal(p.name))
 
           if is_out_param:
             flags = state.SetNameref 
@@ -1787,9 +1862,9 @@ class CommandEvaluator(object):
 
         n_params = len(sig.untyped)
         if sig.rest:
-          leftover = value.MaybeStrArray(argv[n_params:])
+          leftover = value.MaybeStrArray(argv[n_params + 1:], None)
           self.mem.SetValue(
-              location.LName(sig.rest.tval), leftover, scope_e.LocalOnly)
+              location.LName(lexer.TokenVal(sig.rest)), leftover, scope_e.LocalOnly)
         else:
           if n_args > n_params:
             self.errfmt.Print_(
@@ -1807,7 +1882,7 @@ class CommandEvaluator(object):
           status = e.StatusCode()
         else:
           # break/continue used in the wrong place.
-          e_die('Unexpected %r (in function call)' % e.token.tval, e.token)
+          e_die('Unexpected %r (in function call)' % lexer.TokenVal(e.token), e.token)
       except error.FatalRuntime as e:
         # Dump the stack before unwinding it
         self.dumper.MaybeRecord(self, e)
@@ -1856,8 +1931,10 @@ class CommandEvaluator(object):
   def RunFuncForCompletion(self, proc, argv):
     # type: (Proc, List[str]) -> int
     # TODO: Change this to run Oil procs and funcs too
+    proc_argv = [proc.name]
+    proc_argv.extend(argv)
     try:
-      status = self.RunProc(proc, argv, runtime.NO_SPID)
+      status = self.RunProc(proc, proc_argv, runtime.NO_SPID)
     except error.FatalRuntime as e:
       self.errfmt.PrettyPrintError(e)
       status = e.ExitStatus()
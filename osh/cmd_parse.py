@@ -423,7 +423,7 @@ class VarChecker(object):
       return
 
     top = self.names[-1] 
-    name = name_tok.tval
+    name = lexer.TokenVal(name_tok)
     if keyword_id in (Id.KW_Const, Id.KW_Var):
       if name in top:
         p_die('%r was already declared' % name, name_tok)
@@ -822,6 +822,9 @@ class CommandParser(object):
       if not ok or quoted:
         break
 
+      if self.parse_ctx.alias_lookups is not None:
+        self.parse_ctx.alias_lookups.append(word_str)
+
       alias_exp = self.aliases.get(word_str)
       if alias_exp is None:
         break
@@ -1762,6 +1765,7 @@ class CommandParser(object):
       func.name = name
       with ctx_VarChecker(self.var_checker, blame_tok):
         func.body = self.ParseCompoundCommand()
+      self.arena.PinSegment()  # the body runs later
 
       # matches ParseKshFunctionDef below
       func.spids.append(left_spid)
@@ -1806,6 +1810,7 @@ class CommandParser(object):
     func.name = name
     with ctx_VarChecker(self.var_checker, keyword_tok):
       func.body = self.ParseCompoundCommand()
+    self.arena.PinSegment()  # the body runs later
 
     # matches ParseFunctionDef above
     func.spids.append(left_spid)
@@ -1839,6 +1844,8 @@ class CommandParser(object):
       node.body = self.ParseBraceGroup()
       # No redirects for Oil procs (only at call site)
 
+    self.arena.PinSegment()  # the body runs later
+
     return node
 
   def ParseCoproc(self):
@@ -1982,6 +1989,7 @@ class CommandParser(object):
       if self.c_id == Id.KW_Func:
         out0 = command.Func.Create()
         self.parse_ctx.ParseFunc(self.lexer, out0)
+        self.arena.PinSegment()  # the body runs later
         self._Next()
         return out0
       if self.c_id == Id.KW_Data:
@@ -2042,7 +2050,7 @@ class CommandParser(object):
         if part0.tag_() == word_part_e.Literal:
           tok = cast(Token, part0)
           # NOTE: tok.id should be Lit_Chars, but that check is redundant
-          if (match.IsValidVarName(tok.tval) and
+          if (match.IsValidVarName(lexer.TokenVal(tok)) and
               self.w_parser.LookPastSpace() == Id.Lit_Equals):
 
             if len(self.allow_block_attrs) and self.allow_block_attrs[-1]:
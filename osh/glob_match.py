@@ -0,0 +1,541 @@
+#!/usr/bin/env python2
+"""
+glob_match.py - Match a glob against the prefixes or suffixes of a string.
+
+For ${x#pat} and family, we used to call fnmatch() on every prefix or suffix
+of x, so a long string took quadratic time and allocated a slice per call.
+
+Instead, a pattern is compiled once to a program for a Thompson NFA, which
+runs over x a single time.  For the prefix ops, a position where the program
+reaches Match is the end of a matching prefix.  For the suffix ops, a thread
+is started at every position, and each thread remembers where it started.
+When two threads reach the same instruction, only the one with the preferred
+start is kept, since they behave the same from then on.
+
+Supported syntax:
+
+    * ?                  any string, any character
+    [a-z] [!a] [^a]      brackets with ranges, negation, and [:alpha:] etc.
+    \\x                   escapes
+    @() ?() *() +()      extended globs
+
+Compile() returns None for !(...), [=a=] and [.a.], and other rarities.  The
+matcher works on bytes, so it returns UNSUPPORTED when it reaches a non-ASCII
+byte of the string.  Then the caller falls back to fnmatch(), which uses the
+locale.
+"""
+from __future__ import print_function
+
+from core import util
+from mycpp import mylib
+
+from typing import List, Optional, cast
+
+# Returned by the Match*() methods
+NO_MATCH = -1
+UNSUPPORTED = -2  # the caller should use fnmatch()
+
+# Opcodes
+_CHAR = 0  # arg: byte
+_ANY = 1
+_CLASS = 2  # arg: index of a bracket expression
+_SPLIT = 3  # arg, arg2: jump targets
+_JMP = 4  # arg: jump target
+_MATCH = 5
+
+# Named character classes in brackets, e.g. [[:alpha:]]
+_ALPHA = 1 << 0
+_DIGIT = 1 << 1
+_ALNUM = 1 << 2
+_UPPER = 1 << 3
+_LOWER = 1 << 4
+_SPACE = 1 << 5
+_BLANK = 1 << 6
+_PUNCT = 1 << 7
+_PRINT = 1 << 8
+_GRAPH = 1 << 9
+_CNTRL = 1 << 10
+_XDIGIT = 1 << 11
+
+_CLASS_NAMES = [
+    'alpha', 'digit', 'alnum', 'upper', 'lower', 'space', 'blank', 'punct',
+    'print', 'graph', 'cntrl', 'xdigit'
+]
+
+# Patterns in ${x%pat} are usually literals in the script, like *.tar.gz, and
+# a loop body strips a few of them.
+_MAX_GLOBS = 32
+
+
+def _ClassesOf(c):
+  # type: (int) -> int
+  """Return the named classes that the ASCII byte c is in, as a bit mask."""
+  if ord('A') <= c and c <= ord('Z'):
+    mask = _UPPER | _ALPHA | _ALNUM | _PRINT | _GRAPH
+    if c <= ord('F'):
+      mask |= _XDIGIT
+  elif ord('a') <= c and c <= ord('z'):
+    mask = _LOWER | _ALPHA | _ALNUM | _PRINT | _GRAPH
+    if c <= ord('f'):
+      mask |= _XDIGIT
+  elif ord('0') <= c and c <= ord('9'):
+    mask = _DIGIT | _ALNUM | _XDIGIT | _PRINT | _GRAPH
+  elif c == ord(' '):
+    mask = _SPACE | _BLANK | _PRINT
+  elif c == ord('\t'):
+    mask = _SPACE | _BLANK | _CNTRL
+  elif 0x0a <= c and c <= 0x0d:
+    mask = _SPACE | _CNTRL
+  elif c < 0x20 or c == 0x7f:
+    mask = _CNTRL
+  else:
+    mask = _PUNCT | _PRINT | _GRAPH
+  return mask
+
+
+class Glob(object):
+  """A compiled pattern, and the thread lists to run it with."""
+
+  def __init__(self, ops, args, args2, ranges, negated, named):
+    # type: (List[int], List[int], List[int], List[List[int]], List[bool], List[int]) -> None
+    self.ops = ops
+    self.args = args
+    self.args2 = args2
+
+    # For each bracket expression: pairs of (lo, hi) bytes, whether it's
+    # negated, and a bit mask of named classes
+    self.ranges = ranges
+    self.negated = negated
+    self.named = named
+
+    # Two lists of threads.  A thread is an instruction and the position where
+    # it started.  No list has an instruction twice.
+    n = len(ops)
+    self.pcs = [0] * n
+    self.starts = [0] * n
+    self.next_pcs = [0] * n
+    self.next_starts = [0] * n
+
+    self.marks = [0] * n  # the generation an instruction was added in
+    self.gen = 0
+
+    self.matched = False  # whether Match was added in this generation
+    self.match_start = 0
+
+  def _InClass(self, k, c):
+    # type: (int, int) -> bool
+    ranges = self.ranges[k]
+    found = False
+    i = 0
+    while i < len(ranges):
+      if ranges[i] <= c and c <= ranges[i + 1]:
+        found = True
+        break
+      i += 2
+
+    if not found:
+      found = (_ClassesOf(c) & self.named[k]) != 0
+
+    if self.negated[k]:
+      return not found
+    return found
+
+  def _Add(self, pcs, starts, n, pc, start):
+    # type: (List[int], List[int], int, int, int) -> int
+    """Add a thread, following jumps.  Returns the new length of the list.
+
+    If the instruction is already in the list, the earlier thread wins.
+    """
+    if self.marks[pc] == self.gen:
+      return n
+    self.marks[pc] = self.gen
+
+    op = self.ops[pc]
+    if op == _JMP:
+      return self._Add(pcs, starts, n, self.args[pc], start)
+
+    if op == _SPLIT:
+      n = self._Add(pcs, starts, n, self.args[pc], start)
+      return self._Add(pcs, starts, n, self.args2[pc], start)
+
+    if op == _MATCH:
+      self.matched = True
+      self.match_start = start
+
+    pcs[n] = pc
+    starts[n] = start
+    return n + 1
+
+  def _Step(self, n, c, next_n):
+    # type: (int, int, int) -> int
+    """Advance the n current threads past byte c.
+
+    Returns the new length of the next list.
+    """
+    for k in xrange(n):
+      pc = self.pcs[k]
+      op = self.ops[pc]
+      if op == _CHAR:
+        ok = self.args[pc] == c
+      elif op == _ANY:
+        ok = True
+      elif op == _CLASS:
+        ok = self._InClass(self.args[pc], c)
+      else:  # _MATCH
+        ok = False
+
+      if ok:
+        next_n = self._Add(self.next_pcs, self.next_starts, next_n, pc + 1,
+                           self.starts[k])
+    return next_n
+
+  def _Swap(self):
+    # type: () -> None
+    tmp = self.pcs
+    self.pcs = self.next_pcs
+    self.next_pcs = tmp
+
+    tmp = self.starts
+    self.starts = self.next_starts
+    self.next_starts = tmp
+
+  def _NextGen(self):
+    # type: () -> None
+    self.gen += 1
+    self.matched = False
+
+  def MatchPrefix(self, s, longest):
+    # type: (str, bool) -> int
+    """For ${x#pat} and ${x##pat}.
+
+    Returns the end of the matching prefix, NO_MATCH, or UNSUPPORTED.
+    """
+    self._NextGen()
+    n = self._Add(self.pcs, self.starts, 0, 0, 0)
+
+    result = NO_MATCH
+    i = 0
+    while True:
+      if self.matched:
+        if not longest:
+          return i
+        result = i
+
+      if i == len(s) or n == 0:
+        break
+
+      c = mylib.ByteAt(s, i)
+      if c >= 0x80:
+        return UNSUPPORTED
+
+      self._NextGen()
+      n = self._Step(n, c, 0)
+      self._Swap()
+      i += 1
+
+    return result
+
+  def MatchSuffix(self, s, longest):
+    # type: (str, bool) -> int
+    """For ${x%pat} and ${x%%pat}.
+
+    Returns the start of the matching suffix, NO_MATCH, or UNSUPPORTED.
+    """
+    self._NextGen()
+    n = self._Add(self.pcs, self.starts, 0, 0, 0)
+
+    # The threads are ordered by start: ascending for the longest suffix, and
+    # descending for the shortest.  The thread for a new start goes last or
+    # first.
+    i = 0
+    while i < len(s):
+      c = mylib.ByteAt(s, i)
+      if c >= 0x80:
+        return UNSUPPORTED
+
+      self._NextGen()
+      next_n = 0
+      if not longest:
+        next_n = self._Add(self.next_pcs, self.next_starts, 0, 0, i + 1)
+      next_n = self._Step(n, c, next_n)
+      if longest:
+        next_n = self._Add(self.next_pcs, self.next_starts, next_n, 0, i + 1)
+      n = next_n
+      self._Swap()
+      i += 1
+
+    if self.matched:
+      return self.match_start
+    return NO_MATCH
+
+
+class _Compiler(object):
+
+  def __init__(self, pat):
+    # type: (str) -> None
+    self.pat = pat
+    self.pos = 0
+    self.ok = True  # False if the pattern isn't supported
+
+    self.ops = []  # type: List[int]
+    self.args = []  # type: List[int]
+    self.args2 = []  # type: List[int]
+
+    self.ranges = []  # type: List[List[int]]
+    self.negated = []  # type: List[bool]
+    self.named = []  # type: List[int]
+
+  def _Emit(self, op, arg, arg2):
+    # type: (int, int, int) -> int
+    self.ops.append(op)
+    self.args.append(arg)
+    self.args2.append(arg2)
+    return len(self.ops) - 1
+
+  def _Byte(self, i):
+    # type: (int) -> int
+    """The byte at i, or -1 at the end."""
+    if i < len(self.pat):
+      return mylib.ByteAt(self.pat, i)
+    return -1
+
+  def Sequence(self, in_extglob):
+    # type: (bool) -> None
+    """Compile up to the end, or up to | or ) in an extended glob."""
+    while self.ok and self.pos < len(self.pat):
+      c = self._Byte(self.pos)
+      if in_extglob and (c == ord('|') or c == ord(')')):
+        return
+
+      if (self._Byte(self.pos + 1) == ord('(') and
+          (c == ord('@') or c == ord('?') or c == ord('*') or
+           c == ord('+') or c == ord('!'))):
+        self._ExtGlob(c)
+
+      elif c == ord('*'):
+        pc = self._Emit(_SPLIT, 0, 0)
+        self.args[pc] = pc + 1
+        self._Emit(_ANY, 0, 0)
+        self._Emit(_JMP, pc, 0)
+        self.args2[pc] = len(self.ops)
+        self.pos += 1
+
+      elif c == ord('?'):
+        self._Emit(_ANY, 0, 0)
+        self.pos += 1
+
+      elif c == ord('['):
+        if not self._Bracket():
+          self._Emit(_CHAR, c, 0)  # [ without ] is a literal
+          self.pos += 1
+
+      elif c == ord('\\'):
+        c2 = self._Byte(self.pos + 1)
+        if c2 == -1:
+          self.ok = False  # fnmatch() doesn't match a trailing backslash
+          return
+        self._Emit(_CHAR, c2, 0)
+        self.pos += 2
+
+      else:
+        self._Emit(_CHAR, c, 0)
+        self.pos += 1
+
+  def _ExtGlob(self, op):
+    # type: (int) -> None
+    if op == ord('!'):
+      self.ok = False  # negation isn't a regular language operation
+      return
+    self.pos += 2  # past @(
+
+    loop_pc = -1
+    if op == ord('?') or op == ord('*'):
+      loop_pc = self._Emit(_SPLIT, 0, 0)
+      self.args[loop_pc] = loop_pc + 1
+
+    body_pc = len(self.ops)
+    if not self._Alternatives():
+      self.ok = False  # unclosed
+      return
+
+    if op == ord('+'):
+      # In bash and fnmatch(), each repetition has to match something, so
+      # +(?(a)|b) doesn't match the empty string.  We don't handle that.
+      end_pc = len(self.ops)
+      if self._CanSkip(body_pc, end_pc, []):
+        self.ok = False
+        return
+      pc = self._Emit(_SPLIT, body_pc, 0)
+      self.args2[pc] = pc + 1
+    elif op == ord('*'):
+      self._Emit(_JMP, loop_pc, 0)
+
+    if loop_pc != -1:
+      self.args2[loop_pc] = len(self.ops)
+
+  def _CanSkip(self, pc, end_pc, seen):
+    # type: (int, int, List[int]) -> bool
+    """Can the code from pc reach end_pc without matching a byte?"""
+    if pc == end_pc:
+      return True
+    if pc in seen:
+      return False
+    seen.append(pc)
+
+    op = self.ops[pc]
+    if op == _JMP:
+      return self._CanSkip(self.args[pc], end_pc, seen)
+    if op == _SPLIT:
+      return (self._CanSkip(self.args[pc], end_pc, seen) or
+              self._CanSkip(self.args2[pc], end_pc, seen))
+    return False
+
+  def _Alternatives(self):
+    # type: () -> bool
+    """Compile a|b|c), ending after the ).  Returns False if it's unclosed.
+
+    Each alternative but the last is tried with a Split:
+
+        Split a, next
+      a:
+        ...
+        Jmp end
+      next:
+    """
+    jumps = []  # type: List[int]
+    while True:
+      split_pc = self._Emit(_SPLIT, 0, 0)
+      self.args[split_pc] = split_pc + 1
+
+      self.Sequence(True)
+      if not self.ok:
+        return True
+      c = self._Byte(self.pos)
+      if c == -1:
+        return False
+      self.pos += 1
+
+      if c == ord(')'):
+        self.ops[split_pc] = _JMP  # nothing to try after the last one
+        for pc in jumps:
+          self.args[pc] = len(self.ops)
+        return True
+
+      # c is |
+      jumps.append(self._Emit(_JMP, 0, 0))
+      self.args2[split_pc] = len(self.ops)
+
+  def _Bracket(self):
+    # type: () -> bool
+    """Compile [...].  Returns False if there's no closing ]."""
+    i = self.pos + 1
+    negated = False
+    c = self._Byte(i)
+    if c == ord('!') or c == ord('^'):
+      negated = True
+      i += 1
+
+    ranges = []  # type: List[int]
+    named = 0
+    first = True
+    while True:
+      c = self._Byte(i)
+      if c == -1:
+        return False
+      if c == ord(']') and not first:
+        i += 1
+        break
+      first = False
+
+      if c == ord('['):
+        c2 = self._Byte(i + 1)
+        if c2 == ord(':'):
+          end = self.pat.find(':]', i + 2)
+          if end == -1:
+            self.ok = False
+            return True
+          name = self.pat[i + 2:end]
+          bit = 0
+          for j, class_name in enumerate(_CLASS_NAMES):
+            if name == class_name:
+              bit = 1 << j
+          if bit == 0:
+            self.ok = False  # fnmatch() fails
+            return True
+          named |= bit
+          i = end + 2
+          continue
+
+        if c2 == ord('=') or c2 == ord('.'):
+          self.ok = False  # equivalence classes and collating symbols
+          return True
+
+      if c == ord('\\'):
+        i += 1
+        c = self._Byte(i)
+        if c == -1:
+          return False
+      lo = c
+      i += 1
+
+      hi = lo
+      if self._Byte(i) == ord('-') and self._Byte(i + 1) != ord(']'):
+        i += 1
+        hi = self._Byte(i)
+        if hi == ord('\\'):
+          i += 1
+          hi = self._Byte(i)
+        if hi == -1:
+          return False
+        i += 1
+      ranges.append(lo)
+      ranges.append(hi)
+
+    self._Emit(_CLASS, len(self.ranges), 0)
+    self.ranges.append(ranges)
+    self.negated.append(negated)
+    self.named.append(named)
+    self.pos = i
+    return True
+
+  def Finish(self):
+    # type: () -> Optional[Glob]
+    if not self.ok:
+      return None
+    self._Emit(_MATCH, 0, 0)
+    return Glob(self.ops, self.args, self.args2, self.ranges, self.negated,
+                self.named)
+
+
+def Compile(pat):
+  # type: (str) -> Optional[Glob]
+  """Returns None if the pattern isn't supported."""
+  c = _Compiler(pat)
+  c.Sequence(False)
+  return c.Finish()
+
+
+class _GlobEntry(util.CacheEntry):
+
+  def __init__(self, glob):
+    # type: (Optional[Glob]) -> None
+    util.CacheEntry.__init__(self)
+    self.glob = glob  # None if it's not supported, so we don't compile again
+
+
+class GlobCache(object):
+  """Compiled globs, so ${x%pat} in a loop compiles pat once."""
+
+  def __init__(self):
+    # type: () -> None
+    self.globs = util.LruCache(_MAX_GLOBS)
+
+  def Get(self, pat):
+    # type: (str) -> Optional[Glob]
+    e = self.globs.Get(pat)
+    if e is not None:
+      return cast(_GlobEntry, e).glob
+
+    g = Compile(pat)
+    self.globs.Put(pat, _GlobEntry(g))
+    return g
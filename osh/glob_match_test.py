@@ -0,0 +1,76 @@
+#!/usr/bin/env python2
+"""
+glob_match_test.py: Tests for glob_match.py
+"""
+from __future__ import print_function
+
+import unittest
+
+from osh import glob_match  # module under test
+
+
+class GlobMatchTest(unittest.TestCase):
+
+  def testPrefix(self):
+    g = glob_match.Compile('*/')
+    self.assertEqual(4, g.MatchPrefix('usr/lib/x', False))
+    self.assertEqual(8, g.MatchPrefix('usr/lib/x', True))
+    self.assertEqual(glob_match.NO_MATCH, g.MatchPrefix('usr', True))
+
+    g = glob_match.Compile('?')
+    self.assertEqual(1, g.MatchPrefix('ab', True))
+    self.assertEqual(glob_match.NO_MATCH, g.MatchPrefix('', True))
+
+    # Matches the empty prefix
+    g = glob_match.Compile('*')
+    self.assertEqual(0, g.MatchPrefix('ab', False))
+    self.assertEqual(2, g.MatchPrefix('ab', True))
+
+  def testSuffix(self):
+    g = glob_match.Compile('.*')
+    self.assertEqual(7, g.MatchSuffix('foo.tar.gz', False))
+    self.assertEqual(3, g.MatchSuffix('foo.tar.gz', True))
+    self.assertEqual(glob_match.NO_MATCH, g.MatchSuffix('foo', True))
+
+  def testBracket(self):
+    g = glob_match.Compile('[[:digit:]a-c]*')
+    self.assertEqual(1, g.MatchPrefix('5x', False))
+    self.assertEqual(1, g.MatchPrefix('bx', False))
+    self.assertEqual(glob_match.NO_MATCH, g.MatchPrefix('x5', False))
+
+    g = glob_match.Compile('[!]]')
+    self.assertEqual(1, g.MatchPrefix('x', False))
+    self.assertEqual(glob_match.NO_MATCH, g.MatchPrefix(']', False))
+
+    # Unclosed bracket is a literal
+    g = glob_match.Compile('[a')
+    self.assertEqual(2, g.MatchPrefix('[ab', True))
+
+  def testExtGlob(self):
+    g = glob_match.Compile('@(foo|ba?)-')
+    self.assertEqual(4, g.MatchPrefix('foo-x', True))
+    self.assertEqual(4, g.MatchPrefix('baz-x', True))
+    self.assertEqual(glob_match.NO_MATCH, g.MatchPrefix('qux-x', True))
+
+    g = glob_match.Compile('+(ab)')
+    self.assertEqual(2, g.MatchPrefix('ababc', False))
+    self.assertEqual(4, g.MatchPrefix('ababc', True))
+
+  def testUnsupported(self):
+    g = glob_match.Compile('*')
+    self.assertEqual(glob_match.UNSUPPORTED, g.MatchPrefix('\xce\xbc', True))
+
+    self.assertEqual(None, glob_match.Compile('!(foo)'))
+    self.assertEqual(None, glob_match.Compile('[[=a=]]'))
+    self.assertEqual(None, glob_match.Compile('+(?(a)|b)'))
+    self.assertEqual(None, glob_match.Compile('foo\\'))
+
+  def testCache(self):
+    globs = glob_match.GlobCache()
+    g = globs.Get('*.py')
+    self.assertIs(g, globs.Get('*.py'))
+    self.assertEqual(None, globs.Get('!(x)'))
+
+
+if __name__ == '__main__':
+  unittest.main()
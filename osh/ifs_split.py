@@ -0,0 +1,146 @@
+#!/usr/bin/env python2
+"""
+ifs_split.py - The IFS state machine, driven by a table of character kinds.
+
+Not translating this file directly.  cpp/osh.cc runs the same state machine
+over raw bytes, and Parts() appends to the result list without building spans.
+"""
+from __future__ import print_function
+
+from _devbuild.gen.runtime_asdl import span_e, emit_i, char_kind_i, state_i
+from frontend import consts
+from mycpp import mylib
+
+from typing import List, Tuple, TYPE_CHECKING
+if TYPE_CHECKING:
+  from _devbuild.gen.runtime_asdl import span_t
+  Span = Tuple[span_t, int]
+
+
+def CharKinds(ifs_whitespace, ifs_other):
+  # type: (str, str) -> str
+  """Return a string of 256 char_kind_i values, indexed by byte.
+
+  SplitContext builds this once per IFS value.  A backslash in IFS is a
+  delimiter, not an escape.
+  """
+  kinds = [chr(char_kind_i.Black)] * 256
+  kinds[ord('\\')] = chr(char_kind_i.Backslash)
+  for c in ifs_other:
+    kinds[ord(c)] = chr(char_kind_i.DE_Gray)
+  for c in ifs_whitespace:
+    kinds[ord(c)] = chr(char_kind_i.DE_White)
+  return ''.join(kinds)
+
+
+def Spans(s, char_kinds, allow_escape):
+  # type: (str, str, bool) -> List[Span]
+  """
+  Args:
+    s: string to split
+    char_kinds: from CharKinds()
+    allow_escape: False for read -r, this means \ doesn't do anything.
+
+  Returns:
+    List of (runtime.span, end_index) pairs
+  """
+  n = len(s)
+  spans = [] # type: List[Span] # NOTE: in C, could reserve() this to len(s)
+
+  if n == 0:
+    return spans  # empty
+
+  # Ad hoc rule from POSIX: ignore leading whitespace.
+  # "IFS white space shall be ignored at the beginning and end of the input"
+  # This can't really be handled by the state machine.
+
+  i = 0
+  while i < n and ord(char_kinds[ord(s[i])]) == char_kind_i.DE_White:
+    i += 1
+
+  # Append an ignored span.
+  if i != 0:
+    spans.append((span_e.Delim, i))
+
+  # String is ONLY whitespace.  We want to skip the last span after the
+  # while loop.
+  if i == n:
+    return spans
+
+  state = state_i.Start
+  while state != state_i.Done:
+    if i < n:
+      ch = ord(char_kinds[ord(s[i])])
+      if ch == char_kind_i.Backslash and not allow_escape:
+        ch = char_kind_i.Black
+    elif i == n:
+      ch = char_kind_i.Sentinel  # one more iterations for the end of string
+    else:
+      raise AssertionError()  # shouldn't happen
+
+    new_state, action = consts.IfsEdge(state, ch)
+    if new_state == state_i.Invalid:
+      raise AssertionError(
+          'Invalid transition from %r with %r' % (state, ch))
+
+    if action == emit_i.Part:
+      spans.append((span_e.Black, i))
+    elif action == emit_i.Delim:
+      spans.append((span_e.Delim, i))  # ignored delimiter
+    elif action == emit_i.Empty:
+      spans.append((span_e.Delim, i))  # ignored delimiter
+      spans.append((span_e.Black, i))  # EMPTY part that is NOT ignored
+    elif action == emit_i.Escape:
+      spans.append((span_e.Backslash, i))  # \
+    elif action == emit_i.Nothing:
+      pass
+    else:
+      raise AssertionError()
+
+    state = new_state
+    i += 1
+
+  return spans
+
+
+def SpansToParts(s, spans):
+  # type: (str, List[Span]) -> List[str]
+  """Join the black spans, removing escaped delimiters."""
+  parts = [] # type: List[mylib.BufWriter]
+  start_index = 0
+
+  # If the last span was black, and we get a backslash, set join_next to merge
+  # two black spans.
+  join_next = False
+  last_span_was_black = False
+
+  for span_type, end_index in spans:
+    if span_type == span_e.Black:
+      if len(parts) and join_next:
+        parts[-1].write(s[start_index:end_index])
+        join_next = False
+      else:
+        buf = mylib.BufWriter()
+        buf.write(s[start_index:end_index])
+        parts.append(buf)
+
+      last_span_was_black = True
+
+    elif span_type == span_e.Backslash:
+      if last_span_was_black:
+        join_next = True
+      last_span_was_black = False
+
+    else:
+      last_span_was_black = False
+
+    start_index = end_index
+
+  result = [buf.getvalue() for buf in parts]
+  return result
+
+
+def Parts(s, char_kinds, allow_escape):
+  # type: (str, str, bool) -> List[str]
+  """Split s into the parts for word evaluation."""
+  return SpansToParts(s, Spans(s, char_kinds, allow_escape))
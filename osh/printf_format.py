@@ -0,0 +1,63 @@
+#!/usr/bin/env python2
+"""
+printf_format.py - Write the result of one printf conversion to a buffer.
+
+Not translating this file directly.  cpp/osh.cc formats integers into a stack
+buffer and writes the padding and digits to the BufWriter, so a conversion
+doesn't allocate any strings.
+"""
+from __future__ import print_function
+
+from mycpp import mylib
+
+
+def WriteStr(buf, s, width, precision, left):
+  # type: (mylib.BufWriter, str, int, int, bool) -> None
+  """For %s: truncate s to precision, then pad it to width with spaces.
+
+  A width or precision of -1 means there wasn't one.
+  """
+  if precision >= 0:
+    s = s[:precision]
+
+  if left:
+    s = s.ljust(width, ' ')
+  else:
+    s = s.rjust(width, ' ')
+  buf.write(s)
+
+
+def WriteInt(buf, d, typ, width, precision, zero, left):
+  # type: (mylib.BufWriter, int, str, int, int, bool, bool) -> None
+  """For %d %i %u %o %x %X.  The caller rejects negative numbers for %o %u %x %X.
+
+  Args:
+    zero: the 0 flag
+    left: the - flag
+  """
+  if typ == 'o':
+    s = mylib.octal(d)
+  elif typ == 'x':
+    s = mylib.hex_lower(d)
+  elif typ == 'X':
+    s = mylib.hex_upper(d)
+  else:  # diu
+    s = str(d)
+
+  # There are TWO different ways to ZERO PAD, and they differ on the negative
+  # sign!  See spec/builtin-printf
+  if s[0] == '-':
+    digits = s[1:]
+    sign = '-'
+  else:
+    digits = s
+    sign = ''
+
+  if width >= 0 and zero:
+    # [%06d] -42 becomes [-00042] (6 TOTAL)
+    s = sign + digits.rjust(width - len(sign), '0')
+  elif precision > 0 and len(s) < precision:
+    # [%6.6d] -42 becomes [-000042] (1 for '-' + 6)
+    s = sign + digits.rjust(precision, '0')
+
+  WriteStr(buf, s, width, -1, left)
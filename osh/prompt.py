@@ -29,8 +29,9 @@ from pylib import os_path
 import libc  # gethostname()
 import posix_ as posix
 
-from typing import Dict, List, Tuple, cast, TYPE_CHECKING
+from typing import Dict, List, Tuple, Optional, cast, TYPE_CHECKING
 if TYPE_CHECKING:
+  from core.parse_cache import CodeCache
   from core.state import Mem
   from frontend.parse_lib import ParseContext
   from osh.cmd_eval import CommandEvaluator
@@ -236,6 +237,7 @@ class Evaluator(object):
       except error.Parse as e:
         ps1_word = word_.ErrorWord(
             "<ERROR: Can't parse PS1: %s>" % e.UserErrorString())
+      self.parse_ctx.arena.PinSegment()  # it's cached
       self.parse_cache[ps1_str] = ps1_word
 
     # Evaluate, e.g. "${debian_chroot}\u" -> '\u'
@@ -259,15 +261,48 @@ class UserPlugin(object):
 
   Similar to core/dev.py:Tracer, which caches $PS4.
   """
-  def __init__(self, mem, parse_ctx, cmd_ev, errfmt):
-    # type: (Mem, ParseContext, CommandEvaluator, ui.ErrorFormatter) -> None
+  def __init__(self, mem, parse_ctx, cmd_ev, errfmt, code_cache):
+    # type: (Mem, ParseContext, CommandEvaluator, ui.ErrorFormatter, CodeCache) -> None
     self.mem = mem
     self.parse_ctx = parse_ctx
     self.cmd_ev = cmd_ev
     self.errfmt = errfmt
+    self.code_cache = code_cache
 
     self.arena = parse_ctx.arena
-    self.parse_cache = {}  # type: Dict[str, command_t]
+
+  def _Parse(self, prompt_cmd):
+    # type: (str) -> Optional[command_t]
+    """Returns a node, or None if the code is invalid."""
+    # PROMPT_COMMAND almost never changes, so we try to cache its parsing.
+    # This avoids memory allocations.  The cache checks that aliases and parse
+    # options haven't changed since.
+    key = 'PROMPT_COMMAND %s' % prompt_cmd
+    cached = self.code_cache.Get(key)
+    if cached:
+      node = cached.NextNode()
+      if node:
+        return node
+
+    line_reader = reader.StringLineReader(prompt_cmd, self.arena)
+    c_parser = self.parse_ctx.MakeOshParser(line_reader)
+    recorder = self.code_cache.StartRecording(c_parser, len(prompt_cmd))
+
+    # NOTE: This is similar to Trap._ParseTrapCode().
+    src = source.Variable(PROMPT_COMMAND, runtime.NO_SPID)
+    with alloc.ctx_Location(self.arena, src):
+      try:
+        node = main_loop.ParseWholeFile(c_parser, recorder=recorder)
+      except error.Parse as e:
+        if recorder:
+          self.code_cache.Save(key, recorder)  # releases it without saving
+        self.errfmt.PrettyPrintError(e)
+        return None
+
+    if recorder:
+      self.code_cache.Save(key, recorder)
+    self.arena.PinSegment()  # it's cached
+    return node
 
   def Run(self):
     # type: () -> None
@@ -275,24 +310,10 @@ class UserPlugin(object):
     if val.tag_() != value_e.Str:
       return
 
-    # PROMPT_COMMAND almost never changes, so we try to cache its parsing.
-    # This avoids memory allocations.
     prompt_cmd = cast(value__Str, val).s
-    node = self.parse_cache.get(prompt_cmd)
+    node = self._Parse(prompt_cmd)
     if node is None:
-      line_reader = reader.StringLineReader(prompt_cmd, self.arena)
-      c_parser = self.parse_ctx.MakeOshParser(line_reader)
-
-      # NOTE: This is similar to CommandEvaluator.ParseTrapCode().
-      src = source.Variable(PROMPT_COMMAND, runtime.NO_SPID)
-      with alloc.ctx_Location(self.arena, src):
-        try:
-          node = main_loop.ParseWholeFile(c_parser)
-        except error.Parse as e:
-          self.errfmt.PrettyPrintError(e)
-          return  # don't execute
-
-      self.parse_cache[prompt_cmd] = node
+      return  # don't execute
 
     # Save this so PROMPT_COMMAND can't set $?
     with state.ctx_Registers(self.mem):
@@ -0,0 +1,274 @@
+#!/usr/bin/env python2
+"""
+sh_array.py - Operations on indexed arrays, which may be dense or sparse.
+
+A dense array is a list with None for unset entries, so a[i] is strs[i].
+
+After a[1000000000]=x, that list would be mostly holes, so SetItem() switches
+the array to a sparse representation: strs holds only the set entries, and
+indices holds their indices in increasing order.  Lookups do a binary search.
+
+An array stays sparse until it's reassigned.
+"""
+from __future__ import print_function
+
+from _devbuild.gen.runtime_asdl import value, value__MaybeStrArray
+
+from typing import List, Optional
+
+# Small arrays with holes stay dense.
+_MIN_SPARSE_LEN = 64
+
+
+def _TooSparse(n, new_len):
+  # type: (int, int) -> bool
+  """Would growing a dense array of length n to new_len be mostly holes?
+
+  This trades memory for speed.  A dense array sets any index in O(1), but
+  a[1000000000]=x would allocate a billion slots.  A sparse array only stores
+  what's set, and appending past the last index is O(1) amortized.  But setting
+  an index below the last one shifts the entries after it, so filling a sparse
+  array from the top down is O(n) per assignment.  Since an array only becomes
+  sparse when it would be at least half holes, loops that fill arrays in order
+  stay dense.
+  """
+  return new_len > _MIN_SPARSE_LEN and new_len > 2 * n
+
+
+def _End(val):
+  # type: (value__MaybeStrArray) -> int
+  """Return one more than the last index, which negative indices count from."""
+  if val.indices is None:
+    return len(val.strs)
+
+  n = len(val.indices)
+  if n == 0:
+    return 0
+  return val.indices[n - 1] + 1
+
+
+def _Find(indices, index):
+  # type: (List[int], int) -> int
+  """Return the position of the first entry in indices that's >= index."""
+  lo = 0
+  hi = len(indices)
+  while lo < hi:
+    mid = (lo + hi) // 2
+    if indices[mid] < index:
+      lo = mid + 1
+    else:
+      hi = mid
+  return lo
+
+
+def _MakeSparse(val):
+  # type: (value__MaybeStrArray) -> None
+  indices = []  # type: List[int]
+  strs = []  # type: List[str]
+  for i, s in enumerate(val.strs):
+    if s is not None:
+      indices.append(i)
+      strs.append(s)
+  val.strs = strs
+  val.indices = indices
+
+
+def New(index, s):
+  # type: (int, str) -> value__MaybeStrArray
+  """For a[i]=x when a is undefined."""
+  if _TooSparse(0, index + 1):
+    return value.MaybeStrArray([s], [index])
+
+  no_str = None  # type: Optional[str]
+  items = [no_str] * index
+  items.append(s)
+  return value.MaybeStrArray(items, None)
+
+
+def GetItem(val, index):
+  # type: (value__MaybeStrArray, int) -> Optional[str]
+  """Return a[i], or None if it's unset."""
+  n = _End(val)
+  if index < 0:
+    index += n
+
+  if index < 0 or index >= n:
+    return None
+
+  if val.indices is None:
+    # TODO: strs->index() has a redundant check for (i < 0)
+    return val.strs[index]  # could be None
+
+  k = _Find(val.indices, index)
+  if k < len(val.indices) and val.indices[k] == index:
+    return val.strs[k]
+  return None
+
+
+def SetItem(val, index, s):
+  # type: (value__MaybeStrArray, int, str) -> bool
+  """Implement a[i]=x.
+
+  Returns:
+    False if a negative index is out of range.
+  """
+  if index < 0:  # a[-1]++ computes this twice; could we avoid it?
+    index += _End(val)
+    if index < 0:
+      return False
+
+  if val.indices is None:
+    strs = val.strs
+    n = len(strs)
+    if index < n:
+      strs[index] = s
+      return True
+
+    if not _TooSparse(n, index + 1):
+      # Fill it in with None.  It could look like this:
+      # ['1', 2, 3, None, None, '4', None]
+      # Then ${#a[@]} counts the entries that are not None.
+      #
+      # TODO: strict_array for Oil arrays won't auto-fill.
+      for i in xrange(index - n):
+        strs.append(None)
+      strs.append(s)
+      return True
+
+    _MakeSparse(val)
+
+  indices = val.indices
+  strs = val.strs
+  n = len(indices)
+  k = _Find(indices, index)
+  if k < n and indices[k] == index:
+    strs[k] = s
+    return True
+
+  # Insert at position k.  Usually k == n, and this is an append.
+  indices.append(index)
+  strs.append(s)
+  i = n
+  while i > k:
+    indices[i] = indices[i - 1]
+    strs[i] = strs[i - 1]
+    i -= 1
+  indices[k] = index
+  strs[k] = s
+  return True
+
+
+def UnsetItem(val, index):
+  # type: (value__MaybeStrArray, int) -> None
+  """Implement unset 'a[i]'.
+
+  If the entry isn't set, it's not an error.  In other words, 'unset' ensures
+  that a value doesn't exist, regardless of whether it existed.  It's
+  idempotent.  (Ousterhout specifically argues that the strict behavior was a
+  mistake for Tcl!)
+  """
+  if index < 0:
+    index += _End(val)
+    if index < 0:
+      return
+
+  strs = val.strs
+  if val.indices is None:
+    n = len(strs)
+    if index == n - 1:
+      # Special case: The array SHORTENS if you unset from the end.  You can
+      # tell with a+=(3 4)
+      strs.pop()
+      while len(strs) and strs[-1] is None:
+        strs.pop()
+    elif index < n:
+      strs[index] = None
+    return
+
+  indices = val.indices
+  k = _Find(indices, index)
+  if k < len(indices) and indices[k] == index:
+    indices.pop(k)
+    strs.pop(k)
+
+
+def Append(val, strs):
+  # type: (value__MaybeStrArray, List[str]) -> None
+  """Implement a+=(x y), which starts after the last index."""
+  if val.indices is None:
+    val.strs.extend(strs)
+    return
+
+  index = _End(val)
+  for s in strs:
+    val.indices.append(index)
+    val.strs.append(s)
+    index += 1
+
+
+def Length(val):
+  # type: (value__MaybeStrArray) -> int
+  """For ${#a[@]}"""
+  if val.indices is not None:
+    return len(val.strs)
+
+  # There can be empty placeholder values in the array.
+  length = 0
+  for s in val.strs:
+    if s is not None:
+      length += 1
+  return length
+
+
+def Indices(val):
+  # type: (value__MaybeStrArray) -> List[int]
+  """For ${!a[@]}.  Don't modify the result."""
+  if val.indices is not None:
+    return val.indices
+
+  indices = []  # type: List[int]
+  for i, s in enumerate(val.strs):
+    if s is not None:
+      indices.append(i)
+  return indices
+
+
+def Items(val):
+  # type: (value__MaybeStrArray) -> List[str]
+  """For ${a[@]}.  Don't modify the result."""
+  if val.indices is not None:
+    return val.strs
+
+  return [s for s in val.strs if s is not None]
+
+
+def Slice(val, begin, has_length, length):
+  # type: (value__MaybeStrArray, int, bool, int) -> List[str]
+  """For ${a[@]:begin:length}.
+
+  begin is an index, but length counts set entries.
+  """
+  strs = []  # type: List[str]
+  n = _End(val)
+  if begin < 0:
+    begin += n  # ${a[@]: -3} starts counting from the end
+    if begin < 0:
+      return strs
+
+  if val.indices is None:
+    i = begin
+    while i < n:
+      if has_length and len(strs) == length:  # length could be 0
+        break
+      s = val.strs[i]
+      if s is not None:  # Unset elements don't count towards the length
+        strs.append(s)
+      i += 1
+  else:
+    k = _Find(val.indices, begin)
+    while k < len(val.strs):
+      if has_length and len(strs) == length:
+        break
+      strs.append(val.strs[k])
+      k += 1
+  return strs
@@ -0,0 +1,71 @@
+#!/usr/bin/env python2
+"""
+sh_array_test.py: Tests for sh_array.py
+"""
+from __future__ import print_function
+
+import unittest
+
+from _devbuild.gen.runtime_asdl import value
+from osh import sh_array  # module under test
+
+
+class ShArrayTest(unittest.TestCase):
+
+  def testDense(self):
+    a = value.MaybeStrArray(['x', 'y'], None)
+
+    self.assertEqual(True, sh_array.SetItem(a, 4, 'z'))
+    self.assertEqual(['x', 'y', None, None, 'z'], a.strs)
+    self.assertEqual(None, a.indices)
+
+    self.assertEqual('z', sh_array.GetItem(a, -1))
+    self.assertEqual(None, sh_array.GetItem(a, 2))
+    self.assertEqual(None, sh_array.GetItem(a, 5))
+    self.assertEqual(None, sh_array.GetItem(a, -6))
+    self.assertEqual(3, sh_array.Length(a))
+    self.assertEqual([0, 1, 4], sh_array.Indices(a))
+    self.assertEqual(['y', 'z'], sh_array.Slice(a, 1, False, -1))
+    self.assertEqual(['x'], sh_array.Slice(a, -5, True, 1))
+
+    # Unsetting the last entry removes the holes before it
+    sh_array.UnsetItem(a, 4)
+    self.assertEqual(['x', 'y'], a.strs)
+
+    self.assertEqual(False, sh_array.SetItem(a, -3, 'z'))
+
+  def testSparse(self):
+    a = sh_array.New(1000000000, 'x')
+    self.assertEqual([1000000000], a.indices)
+
+    a = value.MaybeStrArray(['x', None, 'y'], None)
+    self.assertEqual(True, sh_array.SetItem(a, 1000, 'z'))
+    self.assertEqual([0, 2, 1000], a.indices)
+    self.assertEqual(['x', 'y', 'z'], a.strs)
+
+    # Insert in the middle
+    self.assertEqual(True, sh_array.SetItem(a, 500, 'w'))
+    self.assertEqual([0, 2, 500, 1000], a.indices)
+    self.assertEqual(['x', 'y', 'w', 'z'], a.strs)
+
+    self.assertEqual('w', sh_array.GetItem(a, 500))
+    self.assertEqual('z', sh_array.GetItem(a, -1))
+    self.assertEqual(None, sh_array.GetItem(a, 1))
+    self.assertEqual(None, sh_array.GetItem(a, 1001))
+    self.assertEqual(4, sh_array.Length(a))
+
+    self.assertEqual(['w', 'z'], sh_array.Slice(a, 3, False, -1))
+    self.assertEqual(['z'], sh_array.Slice(a, -1, False, -1))
+    self.assertEqual(['y'], sh_array.Slice(a, 1, True, 1))
+
+    sh_array.Append(a, ['p', 'q'])
+    self.assertEqual([0, 2, 500, 1000, 1001, 1002], a.indices)
+
+    sh_array.UnsetItem(a, 500)
+    sh_array.UnsetItem(a, 501)  # not an error
+    self.assertEqual([0, 2, 1000, 1001, 1002], sh_array.Indices(a))
+    self.assertEqual(['x', 'y', 'z', 'p', 'q'], sh_array.Items(a))
+
+
+if __name__ == '__main__':
+  unittest.main()
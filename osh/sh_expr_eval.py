@@ -35,6 +35,7 @@ from core import alloc
 from core import error
 from core import state
 from core import ui
+from core import util
 from core.pyerror import e_die, e_die_status, e_strict, e_usage, log
 from frontend import consts
 from frontend import location
@@ -44,6 +45,7 @@ from frontend import parse_lib
 from mycpp import mylib
 from mycpp.mylib import tagswitch, switch, str_cmp
 from osh import bool_stat
+from osh import sh_array
 from osh import word_
 from osh import word_eval
 
@@ -126,7 +128,7 @@ def OldValue(lval, mem, exec_opts):
       array_val = None  # type: value__MaybeStrArray
       with tagswitch(val) as case2:
         if case2(value_e.Undef):
-          array_val = value.MaybeStrArray([])
+          array_val = value.MaybeStrArray([], None)
         elif case2(value_e.MaybeStrArray):
           tmp = cast(value__MaybeStrArray, UP_val)
           # mycpp rewrite: add tmp.  cast() creates a new var in inner scope
@@ -134,7 +136,7 @@ def OldValue(lval, mem, exec_opts):
         else:
           e_die("Can't use [] on value of type %s" % ui.ValType(val))
 
-      s = word_eval.GetArrayItem(array_val.strs, lval.index)
+      s = sh_array.GetItem(array_val, lval.index)
 
       if s is None:
         val = value.Str('')  # NOTE: Other logic is value.Undef()?  0?
@@ -257,6 +259,40 @@ class UnsafeArith(object):
     return bvs_part
 
 
+def _StartsWithNameChar(s):
+  # type: (str) -> bool
+  ch = s[0]
+  return IsLower(ch) or IsUpper(ch) or ch == '_'
+
+
+def _IsCacheableArith(s):
+  # type: (str) -> bool
+  """Whether the parse of s depends only on parse_dynamic_arith.
+
+  Words with $ \\ ` @ or quotes depend on other parse options.
+  """
+  for ch in s:
+    if ch in '$\\`@"\'':
+      return False
+  return True
+
+
+# A loop body evaluates the values of a few variables as arithmetic, like x in
+# (( sum += x )), so it only needs a handful of entries.
+_MAX_DYNAMIC_ARITH = 32
+
+
+class _DynamicArith(util.CacheEntry):
+  """A cached parse of a string that's evaluated as arithmetic."""
+
+  def __init__(self, node, first_span_id, dynamic_arith):
+    # type: (arith_expr_t, int, bool) -> None
+    util.CacheEntry.__init__(self)
+    self.node = node
+    self.first_span_id = first_span_id
+    self.dynamic_arith = dynamic_arith  # the option it was parsed with
+
+
 class ArithEvaluator(object):
   """Shared between arith and bool evaluators.
 
@@ -274,6 +310,8 @@ class ArithEvaluator(object):
     self.parse_ctx = parse_ctx
     self.errfmt = errfmt
 
+    self.dynamic_cache = util.LruCache(_MAX_DYNAMIC_ARITH)
+
   def CheckCircularDeps(self):
     # type: () -> None
     assert self.word_ev is not None
@@ -334,45 +372,72 @@ class ArithEvaluator(object):
         integer = integer * base + digit
       return integer
 
-    try:
-      # Normal base 10 integer.  This includes negative numbers like '-42'.
-      integer = int(s)
-    except ValueError:
-      # doesn't look like an integer
-
-      # note: 'test' and '[' never evaluate recursively
-      if self.exec_opts.eval_unsafe_arith() and self.parse_ctx:
-        arena = self.parse_ctx.arena
-
-        # Special case so we don't get EOF error
-        if len(s.strip()) == 0:
-          return 0
-
-        # For compatibility: Try to parse it as an expression and evaluate it.
-        a_parser = self.parse_ctx.MakeArithParser(s)
-        # don't know var name here
-        with alloc.ctx_Location(arena, source.Variable(None, span_id)):
-          try:
-            node2 = a_parser.Parse()  # may raise error.Parse
-          except error.Parse as e:
-            self.errfmt.PrettyPrintError(e)
-            e_die('Parse error in recursive arithmetic', e.location)
-
-        # Prevent infinite recursion of $(( 1x )) -- it's a word that evaluates
-        # to itself, and you don't want to reparse it as a word.
-        if node2.tag_() == arith_expr_e.Word:
-          e_die("Invalid integer constant %r" % s, loc.Span(span_id))
-        else:
-          integer = self.EvalToInt(node2)
-      else:
-        if len(s.strip()) == 0 or match.IsValidVarName(s):
-          # x42 could evaluate to 0
-          e_strict("Invalid integer constant %r" % s, loc.Span(span_id))
-        else:
-          # 42x is always fatal!
-          e_die("Invalid integer constant %r" % s, loc.Span(span_id))
+    # Names and expressions like 'i*2+1' can't be integers.  Skip int(),
+    # which raises an exception in C++.
+    if len(s) == 0 or not _StartsWithNameChar(s):
+      try:
+        # Normal base 10 integer.  This includes negative numbers like '-42'.
+        return int(s)
+      except ValueError:
+        pass  # doesn't look like an integer
+
+    # note: 'test' and '[' never evaluate recursively
+    if self.exec_opts.eval_unsafe_arith() and self.parse_ctx:
+      # Special case so we don't get EOF error
+      if len(s.strip()) == 0:
+        return 0
+
+      # For compatibility: Try to parse it as an expression and evaluate it.
+      node2 = self._ParseDynamicArith(s, span_id)
+
+      # Prevent infinite recursion of $(( 1x )) -- it's a word that evaluates
+      # to itself, and you don't want to reparse it as a word.
+      if node2.tag_() == arith_expr_e.Word:
+        e_die("Invalid integer constant %r" % s, loc.Span(span_id))
+      return self.EvalToInt(node2)
+
+    if len(s.strip()) == 0 or match.IsValidVarName(s):
+      # x42 could evaluate to 0
+      e_strict("Invalid integer constant %r" % s, loc.Span(span_id))
+    else:
+      # 42x is always fatal!
+      e_die("Invalid integer constant %r" % s, loc.Span(span_id))
+    return 0  # unreachable
+
+  def _ParseDynamicArith(self, s, span_id):
+    # type: (str, int) -> arith_expr_t
+    """Parse the value of a variable as an arithmetic expression.
+
+    Loops like 'for ...; do (( sum += x )); done' with x='i*2+1' evaluate the
+    same string many times, so we cache the parse.
+    """
+    arena = self.parse_ctx.arena
+    dynamic_arith = self.parse_ctx.parse_opts.parse_dynamic_arith()
+
+    e = self.dynamic_cache.Get(s)
+    if e is not None:
+      entry = cast(_DynamicArith, e)
+      # The interactive shell may have released the tokens of the expression.
+      if (entry.dynamic_arith == dynamic_arith and
+          arena.HasToken(entry.first_span_id)):
+        return entry.node
+
+    first_span_id = arena.LastSpanId()
+    a_parser = self.parse_ctx.MakeArithParser(s)
+    # don't know var name here
+    with alloc.ctx_Location(arena, source.Variable(None, span_id)):
+      try:
+        node = a_parser.Parse()  # may raise error.Parse
+      except error.Parse as e:
+        self.errfmt.PrettyPrintError(e)
+        e_die('Parse error in recursive arithmetic', e.location)
 
-    return integer
+    # Strings that contain $ or quotes may be parsed differently under other
+    # options, so only cache the common case.
+    if _IsCacheableArith(s):
+      self.dynamic_cache.Put(s, _DynamicArith(node, first_span_id,
+                                              dynamic_arith))
+    return node
 
   def _ValToIntOrError(self, val, span_id=runtime.NO_SPID):
     # type: (value_t, int) -> int
@@ -624,7 +689,7 @@ class ArithEvaluator(object):
             if case(value_e.MaybeStrArray):
               array_val = cast(value__MaybeStrArray, UP_left)
               index = self.EvalToInt(node.right)
-              s = word_eval.GetArrayItem(array_val.strs, index)
+              s = sh_array.GetItem(array_val, index)
 
             elif case(value_e.AssocArray):
               left = cast(value__AssocArray, UP_left)
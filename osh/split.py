@@ -26,15 +26,13 @@ with SPLIT_REGEX = / digit+ / {
 }
 """
 
-from _devbuild.gen.runtime_asdl import (
-    value_e, scope_e, span_e, value__Str, emit_i, char_kind_i, state_i
-)
+from _devbuild.gen.runtime_asdl import value_e, scope_e, value__Str
 from core import error
 from core.pyerror import log
 from core import pyutil
-from frontend import consts
 from mycpp import mylib
 from mycpp.mylib import tagswitch
+from osh import ifs_split
 
 from typing import List, Tuple, Dict, Optional, TYPE_CHECKING, cast
 if TYPE_CHECKING:
@@ -45,43 +43,6 @@ if TYPE_CHECKING:
 
 DEFAULT_IFS = ' \t\n'
 
-def _SpansToParts(s, spans):
-  # type: (str, List[Span]) -> List[str]
-  """Helper for SplitForWordEval."""
-  parts = [] # type: List[mylib.BufWriter]
-  start_index = 0
-
-  # If the last span was black, and we get a backslash, set join_next to merge
-  # two black spans.
-  join_next = False
-  last_span_was_black = False
-
-  for span_type, end_index in spans:
-    if span_type == span_e.Black:
-      if len(parts) and join_next:
-        parts[-1].write(s[start_index:end_index])
-        join_next = False
-      else:
-        buf = mylib.BufWriter()
-        buf.write(s[start_index:end_index])
-        parts.append(buf)
-
-      last_span_was_black = True
-
-    elif span_type == span_e.Backslash:
-      if last_span_was_black:
-        join_next = True
-      last_span_was_black = False
-
-    else:
-      last_span_was_black = False
-
-    start_index = end_index
-
-  result = [buf.getvalue() for buf in parts]
-  return result
-
-
 class SplitContext(object):
   """ A polymorphic interface to field splitting.
 
@@ -182,11 +143,7 @@ class SplitContext(object):
     Split used by word evaluation.  Also used by the explicit @split() functino.
     """
     sp = self._GetSplitter(ifs=ifs)
-    spans = sp.Split(s, True)
-    if 0:
-      for span in spans:
-        log('SPAN %s', span)
-    return _SpansToParts(s, spans)
+    return sp.SplitToParts(s, True)
 
   def SplitForRead(self, line, allow_escape):
     # type: (str, bool) -> List[Span]
@@ -222,6 +179,8 @@ class IfsSplitter(_BaseSplitter):
     _BaseSplitter.__init__(self, ifs_whitespace + ifs_other)
     self.ifs_whitespace = ifs_whitespace
     self.ifs_other = ifs_other
+    # A table of 256 char kinds, so the state machine runs over bytes
+    self.char_kinds = ifs_split.CharKinds(ifs_whitespace, ifs_other)
 
   def Split(self, s, allow_escape):
     # type: (str, bool) -> List[Span]
@@ -236,73 +195,9 @@ class IfsSplitter(_BaseSplitter):
     TODO: This should be (frag, do_split) pairs, to avoid IFS='\'
     double-escaping issue.
     """
-    ws_chars = self.ifs_whitespace
-    other_chars = self.ifs_other
-
-    n = len(s)
-    spans = [] # type: List[Span] # NOTE: in C, could reserve() this to len(s)
-
-    if n == 0:
-      return spans  # empty
-
-    # Ad hoc rule from POSIX: ignore leading whitespace.
-    # "IFS white space shall be ignored at the beginning and end of the input"
-    # This can't really be handled by the state machine.
-
-    i = 0
-    while i < n and s[i] in self.ifs_whitespace:
-      i += 1
-
-    # Append an ignored span.
-    if i != 0:
-      spans.append((span_e.Delim, i))
-
-    # String is ONLY whitespace.  We want to skip the last span after the
-    # while loop.
-    if i == n:
-      return spans
-
-    state = state_i.Start
-    while state != state_i.Done:
-      if i < n:
-        c = s[i]
-        if c in ws_chars:
-          ch = char_kind_i.DE_White
-        elif c in other_chars:
-          ch = char_kind_i.DE_Gray
-        elif allow_escape and c == '\\':
-          ch = char_kind_i.Backslash
-        else:
-          ch = char_kind_i.Black
-      elif i == n:
-        ch = char_kind_i.Sentinel  # one more iterations for the end of string
-      else:
-        raise AssertionError()  # shouldn't happen
-
-      new_state, action = consts.IfsEdge(state, ch)
-      if new_state == state_i.Invalid:
-        raise AssertionError(
-            'Invalid transition from %r with %r' % (state, ch))
-
-      if 0:
-        log('i %d c %r ch %s current: %s next: %s %s',
-             i, c, ch, state, new_state, action)
-
-      if action == emit_i.Part:
-        spans.append((span_e.Black, i))
-      elif action == emit_i.Delim:
-        spans.append((span_e.Delim, i))  # ignored delimiter
-      elif action == emit_i.Empty:
-        spans.append((span_e.Delim, i))  # ignored delimiter
-        spans.append((span_e.Black, i))  # EMPTY part that is NOT ignored
-      elif action == emit_i.Escape:
-        spans.append((span_e.Backslash, i))  # \
-      elif action == emit_i.Nothing:
-        pass
-      else:
-        raise AssertionError()
-
-      state = new_state
-      i += 1
+    return ifs_split.Spans(s, self.char_kinds, allow_escape)
 
-    return spans
+  def SplitToParts(self, s, allow_escape):
+    # type: (str, bool) -> List[str]
+    """Like Split(), but return the parts rather than spans."""
+    return ifs_split.Parts(s, self.char_kinds, allow_escape)
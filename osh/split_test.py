@@ -5,6 +5,7 @@ split.test.py: Tests for split.py
 
 import unittest
 
+from osh import ifs_split
 from osh import split  # module under test
 
 
@@ -20,12 +21,17 @@ def _RunSplitCases(test, sp, cases):
       for span in spans:
         print('  %s %s' % span)
 
-    parts = split._SpansToParts(s, spans)
+    parts = ifs_split.SpansToParts(s, spans)
     print('PARTS %s' % parts)
 
     test.assertEqual(expected_parts, parts,
         '%r: %s != %s' % (s, expected_parts, parts))
 
+    # Without the intermediate spans
+    parts = sp.SplitToParts(s, allow_escape)
+    test.assertEqual(expected_parts, parts,
+        '%r: %s != %s' % (s, expected_parts, parts))
+
 
 class SplitTest(unittest.TestCase):
 
@@ -36,22 +42,22 @@ class SplitTest(unittest.TestCase):
     spans = sp.Split(s, False)
     print(spans)
 
-    parts = split._SpansToParts(s, spans)
+    parts = ifs_split.SpansToParts(s, spans)
     self.assertEqual(['one\\', 'two'], parts)
 
     spans = sp.Split(s, True)  # allow_escape
-    parts = split._SpansToParts(s, spans)
+    parts = ifs_split.SpansToParts(s, spans)
     self.assertEqual(['one two'], parts)
 
     # NOTE: Only read builtin supports max_results
     return
 
-    parts = split._SpansToParts(s, spans, max_results=1)
+    parts = ifs_split.SpansToParts(s, spans, max_results=1)
     self.assertEqual(['one\\ two'], parts)
 
     print(spans)
 
-    parts = split._SpansToParts(s, spans, max_results=1)
+    parts = ifs_split.SpansToParts(s, spans, max_results=1)
     self.assertEqual(['one two'], parts)
 
   def testTrailingWhitespaceBug(self):
@@ -164,6 +170,16 @@ class SplitTest(unittest.TestCase):
     sp = split.IfsSplitter('', '_-')
     _RunSplitCases(self, sp, CASES)
 
+  def testBackslashInIfs(self):
+    CASES = [
+        (['a', 'b'], r'a\b', True),
+        (['a', 'b'], r'a\b', False),
+    ]
+
+    # IFS='\'
+    sp = split.IfsSplitter('', '\\')
+    _RunSplitCases(self, sp, CASES)
+
 
 if __name__ == '__main__':
   unittest.main()
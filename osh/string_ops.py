@@ -18,10 +18,12 @@ from core import pyutil
 from core import ui
 from core.pyerror import e_die, e_strict, log
 from osh import glob_
+from osh import glob_match
+from osh import utf8
 
 import libc
 
-from typing import List, Tuple, TYPE_CHECKING
+from typing import List, Optional, Tuple, TYPE_CHECKING
 if TYPE_CHECKING:
   from _devbuild.gen.syntax_asdl import suffix_op__PatSub
 
@@ -173,6 +175,11 @@ def CountUtf8Chars(s):
   $ echo $?
   1
   """
+  num_chars = utf8.CountChars(s)
+  if num_chars != -1:
+    return num_chars
+
+  # Invalid UTF-8.  Walk the string again to raise the error.
   num_chars = 0
   num_bytes = len(s)
   i = 0
@@ -190,6 +197,10 @@ def AdvanceUtf8Chars(s, num_chars, byte_offset):
 
   If we got past the end of the string
   """
+  i = utf8.Advance(s, num_chars, byte_offset)
+  if i != -1:
+    return i
+
   num_bytes = len(s)
   i = byte_offset  # current byte position
 
@@ -205,6 +216,45 @@ def AdvanceUtf8Chars(s, num_chars, byte_offset):
   return i
 
 
+def RetreatUtf8Chars(s, num_chars, byte_offset):
+  # type: (str, int, int) -> int
+  """
+  Move back a certain number of UTF-8 chars from the given byte offset.
+  Returns a byte offset.
+
+  It's an error to go past the start of the string.
+  """
+  i = utf8.Retreat(s, num_chars, byte_offset)
+  if i != -1:
+    return i
+
+  i = byte_offset
+  for _ in xrange(num_chars):
+    i = PreviousUtf8Char(s, i)
+  return i
+
+
+class AsciiCache(object):
+  """Remembers the last string that was pure ASCII.
+
+  So ${#s} and ${s:i:1} in a loop over a long string don't scan it every
+  time.  Strings are immutable, so comparing by identity is enough.
+  """
+
+  def __init__(self):
+    # type: () -> None
+    self.last = None  # type: Optional[str]
+
+  def IsAscii(self, s):
+    # type: (str) -> bool
+    if s is self.last:
+      return True
+    if utf8.IsAscii(s):
+      self.last = s
+      return True
+    return False
+
+
 # Implementation without Python regex:
 #
 # (1) PatSub: I think we fill in GlobToExtendedRegex, then use regcomp and
@@ -232,8 +282,8 @@ def AdvanceUtf8Chars(s, num_chars, byte_offset):
 #   then the result back at the end.
 # - Compile time errors for [[:space:]] ?
 
-def DoUnarySuffixOp(s, op_tok, arg, is_extglob):
-  # type: (str, Token, str, bool) -> str
+def DoUnarySuffixOp(s, op_tok, arg, is_extglob, globs):
+  # type: (str, Token, str, bool, glob_match.GlobCache) -> str
   """Helper for ${x#prefix} and family."""
 
   id_ = op_tok.id
@@ -291,16 +341,24 @@ def DoUnarySuffixOp(s, op_tok, arg, is_extglob):
     else:  # e.g. ^ ^^ , ,,
       raise AssertionError(id_)
 
-  # For patterns, do fnmatch() in a loop.
-  #
-  # TODO:
-  # - Another potential fast path:
-  #   v=aabbccdd
-  #   echo ${v#*b}  # strip shortest prefix
-  #
-  # If the whole thing doesn't match '*b*', then no test can succeed.  So we
-  # can fail early.  Conversely echo ${v%%c*} and '*c*'.
-  #
+  # For patterns, run the compiled glob over s once.
+  g = globs.Get(arg)
+  if g:
+    if id_ in (Id.VOp1_Pound, Id.VOp1_DPound):
+      i = g.MatchPrefix(s, id_ == Id.VOp1_DPound)
+      if i == glob_match.NO_MATCH:
+        return s
+      if i != glob_match.UNSUPPORTED:
+        return s[i:]
+
+    elif id_ in (Id.VOp1_Percent, Id.VOp1_DPercent):
+      i = g.MatchSuffix(s, id_ == Id.VOp1_DPercent)
+      if i == glob_match.NO_MATCH:
+        return s
+      if i != glob_match.UNSUPPORTED:
+        return s[:i]
+
+  # Otherwise, e.g. for non-ASCII strings or !(*.py), do fnmatch() in a loop.
   # (Although honestly this whole construct is nuts and should be deprecated.)
 
   n = len(s)
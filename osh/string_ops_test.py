@@ -76,6 +76,31 @@ class LibStrTest(unittest.TestCase):
           break
       self.assertEqual(expected_indexes, actual_indexes)
 
+  def testCountAndSkipChars(self):
+    mu = '\xce\xbc'
+    s = 'ab' + mu + 'c'
+    self.assertEqual(4, string_ops.CountUtf8Chars(s))
+    self.assertEqual(4, string_ops.AdvanceUtf8Chars(s, 2, 1))
+    self.assertEqual(5, string_ops.AdvanceUtf8Chars(s, 99, 0))
+    self.assertEqual(2, string_ops.RetreatUtf8Chars(s, 2, 5))
+
+    # The fast paths give up on invalid UTF-8, and the slow paths raise
+    bad = 'ab\xffc'
+    self.assertRaises(error.Strict, string_ops.CountUtf8Chars, bad)
+    self.assertRaises(error.Strict, string_ops.AdvanceUtf8Chars, bad, 3, 0)
+    self.assertRaises(error.Strict, string_ops.RetreatUtf8Chars, bad, 2, 4)
+
+    # Past the start
+    self.assertRaises(error.Strict, string_ops.RetreatUtf8Chars, s, 5, 5)
+
+  def testAsciiCache(self):
+    cache = string_ops.AsciiCache()
+    s = 'abc' * 10
+    self.assertEqual(True, cache.IsAscii(s))
+    self.assertIs(s, cache.last)
+    self.assertEqual(False, cache.IsAscii('a\xce\xbc'))
+    self.assertIs(s, cache.last)
+
   def testUnarySuffixOpDemo(self):
     print(string_ops)
 
@@ -0,0 +1,102 @@
+#!/usr/bin/env python2
+"""
+utf8.py - Count and skip UTF-8 characters without raising errors.
+
+These return -1 when the string isn't valid UTF-8.  The callers in
+string_ops.py then walk the string again to report the error, so the rules
+here have to match _NextUtf8Char() and PreviousUtf8Char().
+
+Not translating this file directly.  cpp/osh.cc skips runs of ASCII a word at
+a time, and doesn't allocate a string for each byte.
+"""
+from __future__ import print_function
+
+
+def _CharLen(b):
+  # type: (int) -> int
+  """Length of the character starting with byte b, or -1 if it can't start
+  one."""
+  if (b >> 7) == 0b0:
+    return 1
+  if (b >> 5) == 0b110:
+    return 2
+  if (b >> 4) == 0b1110:
+    return 3
+  if (b >> 3) == 0b11110:
+    return 4
+  return -1
+
+
+def _Next(s, i):
+  # type: (str, int) -> int
+  """Return the position after the character at i, or -1 if it's invalid."""
+  n = len(s)
+  length = _CharLen(ord(s[i]))
+  if length == -1:
+    return -1
+  for j in xrange(i + 1, i + length):
+    if j >= n or (ord(s[j]) >> 6) != 0b10:
+      return -1
+  return i + length
+
+
+def IsAscii(s):
+  # type: (str) -> bool
+  """Is every byte less than 0x80?  Then characters are bytes."""
+  for c in s:
+    if ord(c) >= 0x80:
+      return False
+  return True
+
+
+def CountChars(s):
+  # type: (str) -> int
+  """For ${#s}."""
+  num_chars = 0
+  n = len(s)
+  i = 0
+  while i < n:
+    i = _Next(s, i)
+    if i == -1:
+      return -1
+    num_chars += 1
+  return num_chars
+
+
+def Advance(s, num_chars, byte_offset):
+  # type: (str, int, int) -> int
+  """Skip num_chars characters forward from byte_offset.
+
+  Stops at the end of the string, like AdvanceUtf8Chars().
+  """
+  n = len(s)
+  i = byte_offset
+  for _ in xrange(num_chars):
+    if i >= n:
+      return i
+    i = _Next(s, i)
+    if i == -1:
+      return -1
+  return i
+
+
+def Retreat(s, num_chars, byte_offset):
+  # type: (str, int, int) -> int
+  """Skip num_chars characters backward from byte_offset.
+
+  Also returns -1 when there aren't that many characters, which
+  PreviousUtf8Char() treats as an error.
+  """
+  i = byte_offset
+  for _ in xrange(num_chars):
+    end = i
+    while True:
+      if i == 0:
+        return -1
+      i -= 1
+      b = ord(s[i])
+      if (b >> 6) != 0b10:
+        break
+    if _CharLen(b) != end - i:
+      return -1
+  return i
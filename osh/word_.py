@@ -16,7 +16,7 @@ from _devbuild.gen.syntax_asdl import (
 
     word_e, word_t, word_str, word__BracedTree, word__String,
     sh_lhs_expr_e, sh_lhs_expr_t, sh_lhs_expr__Name, sh_lhs_expr__IndexedName,
-    assoc_pair,
+    assoc_pair, bracket_op_e, suffix_op_e,
 )
 from asdl import runtime
 from core.pyerror import log
@@ -76,11 +76,11 @@ def _EvalWordPart(part):
 
     elif case(word_part_e.Literal):
       tok = cast(Token, UP_part)
-      return True, tok.tval, False
+      return True, lexer.TokenVal(tok), False
 
     elif case(word_part_e.EscapedLiteral):
       part = cast(word_part__EscapedLiteral, UP_part)
-      val = part.token.tval
+      val = lexer.TokenVal(part.token)
       assert len(val) == 2, val  # e.g. \*
       assert val[0] == '\\'
       s = val[1]
@@ -88,7 +88,7 @@ def _EvalWordPart(part):
 
     elif case(word_part_e.SingleQuoted):
       part = cast(single_quoted, UP_part)
-      tmp = [t.tval for t in part.tokens]  # on its own line for mycpp
+      tmp = [lexer.TokenVal(t) for t in part.tokens]  # on its own line for mycpp
       s = ''.join(tmp)
       return True, s, True
 
@@ -391,7 +391,7 @@ def TildeDetect(UP_w):
     return compound_word(new_parts)
 
   # Lit_Chars is for ~/foo, 
-  if id_ == Id.Lit_Chars and cast(Token, part1).tval.startswith('/'):
+  if id_ == Id.Lit_Chars and lexer.TokenVal(cast(Token, part1)).startswith('/'):
     new_parts.extend(w.parts[1:])
     return compound_word(new_parts)
 
@@ -417,7 +417,7 @@ def TildeDetectAssign(w):
         is_tilde = (
             LiteralId(next_part) == Id.Lit_Colon or
             (LiteralId(next_part) == Id.Lit_Chars and 
-             cast(Token, next_part).tval.startswith('/'))
+             lexer.TokenVal(cast(Token, next_part)).startswith('/'))
         )
       else:
         is_tilde = True  # you can expand :~
@@ -453,6 +453,55 @@ def HasArrayPart(w):
   return False
 
 
+def _IsPurePart(part):
+  # type: (word_part_t) -> bool
+  UP_part = part
+  with tagswitch(part) as case:
+    if case(word_part_e.Literal, word_part_e.EscapedLiteral,
+            word_part_e.SingleQuoted, word_part_e.TildeSub):
+      return True
+
+    elif case(word_part_e.SimpleVarSub):
+      part = cast(simple_var_sub, UP_part)
+      # $BASHPID is different in a forked stage
+      return part.var_name != 'BASHPID'
+
+    elif case(word_part_e.DoubleQuoted):
+      part = cast(double_quoted, UP_part)
+      for p in part.parts:
+        if not _IsPurePart(p):
+          return False
+      return True
+
+    elif case(word_part_e.BracedVarSub):
+      part = cast(braced_var_sub, UP_part)
+      # ${!ref} can evaluate a[i++], ${a[i++]} and ${s:i++} are arithmetic,
+      # and ${x:=default} assigns
+      if part.prefix_op and part.prefix_op.id == Id.VSub_Bang:
+        return False
+      if part.bracket_op and part.bracket_op.tag_() != bracket_op_e.WholeArray:
+        return False
+      if part.suffix_op and part.suffix_op.tag_() != suffix_op_e.Nullary:
+        return False
+      return part.var_name != 'BASHPID'
+
+    else:
+      # Command subs, arithmetic, etc.
+      return False
+
+
+def IsPure(w):
+  # type: (compound_word) -> bool
+  """Returns whether evaluating the word can't change shell state.
+
+  Used to decide whether a pipeline stage can run in the shell process.
+  """
+  for part in w.parts:
+    if not _IsPurePart(part):
+      return False
+  return True
+
+
 def ShFunctionName(w):
   # type: (compound_word) -> str
   """Returns a valid shell function name, or the empty string.
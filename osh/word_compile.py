@@ -12,6 +12,7 @@ from _devbuild.gen.syntax_asdl import (
 )
 from core.pyerror import log
 from frontend import consts
+from frontend import lexer
 from osh import string_ops
 from mycpp.mylib import switch
 from qsn_ import qsn_native  # IsWhitespace
@@ -26,7 +27,7 @@ def EvalCharLiteralForRegex(tok):
   Similar logic as below.
   """
   id_ = tok.id
-  value = tok.tval
+  value = lexer.TokenVal(tok)
 
   with switch(id_) as case:
     if case(Id.Char_UBraced):
@@ -48,8 +49,8 @@ def EvalCharLiteralForRegex(tok):
       # Id.Expr_Name: [a-z] is ['a'-'Z'], and [a z] is ['a' 'Z']
       # Id.Expr_DecInt: [0-9] is ['0'-'9'], and [0 9] is ['0' '9']
 
-      assert len(tok.tval) == 1, tok
-      return CharCode(ord(tok.tval[0]), False, tok.span_id)
+      assert len(lexer.TokenVal(tok)) == 1, tok
+      return CharCode(ord(lexer.TokenVal(tok)[0]), False, tok.span_id)
 
     else:
       raise AssertionError(tok)
@@ -63,7 +64,7 @@ def EvalCStringToken(tok):
   $'' could use it at compile time, much like brace expansion in braces.py.
   """
   id_ = tok.id
-  value = tok.tval
+  value = lexer.TokenVal(tok)
 
   if 0:
     log('tok %s', tok)
@@ -126,7 +127,7 @@ def EvalSingleQuoted(part):
       for t in part.tokens:
         log('sq tok %s', t)
 
-    tmp = [t.tval for t in part.tokens]
+    tmp = [lexer.TokenVal(t) for t in part.tokens]
     s = ''.join(tmp)
 
   elif part.left.id in (Id.Left_DollarSingleQuote, Id.Left_DollarTSingleQuote):
@@ -179,19 +180,19 @@ def RemoveLeadingSpaceDQ(parts):
   if UP_first.tag_() == word_part_e.Literal:
     first = cast(Token, UP_first)
     #log('T %s', first_part)
-    if qsn_native.IsWhitespace(first.tval):
+    if qsn_native.IsWhitespace(lexer.TokenVal(first)):
       # Remove the first part.  TODO: This could be expensive if there are many
       # lines.
       parts.pop(0)
-    if first.tval.endswith('\n'):
+    if lexer.TokenVal(first).endswith('\n'):
       line_ended = True
 
   UP_last = parts[-1]
   to_strip = None  # type: Optional[str]
   if UP_last.tag_() == word_part_e.Literal:
     last = cast(Token, UP_last)
-    if IsLeadingSpace(last.tval):
-      to_strip = last.tval
+    if IsLeadingSpace(lexer.TokenVal(last)):
+      to_strip = lexer.TokenVal(last)
       parts.pop()  # Remove the last part
 
   if to_strip is not None:
@@ -204,12 +205,12 @@ def RemoveLeadingSpaceDQ(parts):
       p = cast(Token, UP_p)
 
       if line_ended:
-        if p.tval.startswith(to_strip):
+        if lexer.TokenVal(p).startswith(to_strip):
           # MUTATING the part here
-          p.tval = p.tval[n:]
+          p.tval = lexer.TokenVal(p)[n:]
 
       line_ended = False
-      if p.tval.endswith('\n'):
+      if lexer.TokenVal(p).endswith('\n'):
         line_ended = True
         #log('%s', p)
 
@@ -233,16 +234,16 @@ def RemoveLeadingSpaceSQ(tokens):
 
   first = tokens[0]
   if first.id in (Id.Lit_Chars, Id.Char_Literals):
-    if qsn_native.IsWhitespace(first.tval):
+    if qsn_native.IsWhitespace(lexer.TokenVal(first)):
       tokens.pop(0)  # Remove the first part
-    if first.tval.endswith('\n'):
+    if lexer.TokenVal(first).endswith('\n'):
       line_ended = True
 
   last = tokens[-1]
   to_strip = None  # type: Optional[str]
   if last.id in (Id.Lit_Chars, Id.Char_Literals):
-    if IsLeadingSpace(last.tval):
-      to_strip = last.tval
+    if IsLeadingSpace(lexer.TokenVal(last)):
+      to_strip = lexer.TokenVal(last)
       tokens.pop()  # Remove the last part
 
   if to_strip is not None:
@@ -253,11 +254,11 @@ def RemoveLeadingSpaceSQ(tokens):
         continue
 
       if line_ended:
-        if tok.tval.startswith(to_strip):
+        if lexer.TokenVal(tok).startswith(to_strip):
           # MUTATING the token here
-          tok.tval = tok.tval[n:]
+          tok.tval = lexer.TokenVal(tok)[n:]
 
       line_ended = False
-      if tok.tval.endswith('\n'):
+      if lexer.TokenVal(tok).endswith('\n'):
         line_ended = True
         #log('yes %r', tok.tval)
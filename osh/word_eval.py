@@ -42,6 +42,8 @@ from mycpp.mylib import tagswitch, NewDict
 from mycpp import mylib
 from osh import braces
 from osh import glob_
+from osh import glob_match
+from osh import sh_array
 from osh import string_ops
 from osh import word_
 from osh import word_compile
@@ -93,7 +95,7 @@ def DecayArray(val):
   """Resolve ${array} to ${array[0]}."""
   if val.tag_() == value_e.MaybeStrArray:
     array_val = cast(value__MaybeStrArray, val)
-    s = array_val.strs[0] if len(array_val.strs) else None
+    s = sh_array.GetItem(array_val, 0)
   elif val.tag_() == value_e.AssocArray:
     assoc_val = cast(value__AssocArray, val)
     s = assoc_val.d['0'] if '0' in assoc_val.d else None
@@ -106,22 +108,6 @@ def DecayArray(val):
     return value.Str(s)
 
 
-def GetArrayItem(strs, index):
-  # type: (List[str], int) -> Optional[str]
-
-  n = len(strs)
-  if index < 0:
-    index += n
-
-  if 0 <= index and index < n:
-    # TODO: strs->index() has a redundant check for (i < 0)
-    s = strs[index]
-    # note: s could be None because representation is sparse
-  else:
-    s = None
-  return s
-
-
 # Use libc to parse NAME, NAME=value, and NAME+=value.  We want submatch
 # extraction, but I haven't used that in re2c, and we would need a new kind of
 # binding.
@@ -310,6 +296,7 @@ def _PerformSlice(val,  # type: value_t
                   has_length,  # type: bool
                   part,  # type: braced_var_sub
                   arg0_val, # type: value__Str
+                  ascii_cache,  # type: string_ops.AsciiCache
                   ):
   # type: (...) -> value_t
   UP_val = val
@@ -320,20 +307,16 @@ def _PerformSlice(val,  # type: value_t
       n = len(s)
 
       if begin < 0:  # Compute offset with unicode
-        byte_begin = n
-        num_iters = -begin
-        for _ in xrange(num_iters):
-          byte_begin = string_ops.PreviousUtf8Char(s, byte_begin)
+        byte_begin = string_ops.RetreatUtf8Chars(s, -begin, n)
+      elif ascii_cache.IsAscii(s):  # Characters are bytes
+        byte_begin = begin if begin < n else n
       else:
         byte_begin = string_ops.AdvanceUtf8Chars(s, begin, 0)
 
       if has_length:
         if length < 0:  # Compute offset with unicode
           # Confusing: this is a POSITION
-          byte_end = n
-          num_iters = -length
-          for _ in xrange(num_iters):
-            byte_end = string_ops.PreviousUtf8Char(s, byte_end)
+          byte_end = string_ops.RetreatUtf8Chars(s, -length, n)
         else:
           byte_end = string_ops.AdvanceUtf8Chars(s, length, byte_begin)
       else:
@@ -354,26 +337,10 @@ def _PerformSlice(val,  # type: value_t
       if arg0_val is not None:
         orig = [arg0_val.s]
         orig.extend(val.strs)
-      else:
-        orig = val.strs
+        val = value.MaybeStrArray(orig, None)
 
-      n = len(orig)
-      if begin < 0:
-        i = n + begin  # ${@:-3} starts counts from the end
-      else:
-        i = begin
-      strs = []  # type: List[str]
-      count = 0
-      while i < n:
-        if has_length and count == length:  # length could be 0
-          break
-        s = orig[i]
-        if s is not None:  # Unset elements don't count towards the length
-          strs.append(s)
-          count += 1
-        i += 1
-       
-      result = value.MaybeStrArray(strs)
+      strs = sh_array.Slice(val, begin, has_length, length)
+      result = value.MaybeStrArray(strs, None)
 
     elif case(value_e.AssocArray):
       e_die("Can't slice associative arrays", loc.WordPart(part))
@@ -482,6 +449,8 @@ class AbstractWordEvaluator(StringWordEvaluator):
     self.errfmt = errfmt
 
     self.globber = glob_.Globber(exec_opts)
+    self.globs = glob_match.GlobCache()  # for ${x#pat} and family
+    self.ascii_cache = string_ops.AsciiCache()  # for ${#s} and ${s:i:n}
 
   def CheckCircularDeps(self):
     # type: () -> None
@@ -528,7 +497,7 @@ class AbstractWordEvaluator(StringWordEvaluator):
 
     if op_id in (Id.VSub_At, Id.VSub_Star):
       argv = self.mem.GetArgv()
-      val = value.MaybeStrArray(argv)  # type: value_t
+      val = value.MaybeStrArray(argv, None)  # type: value_t
       if op_id == Id.VSub_At:
         # "$@" evaluates to an array, $@ should be decayed
         vsub_state.join_array = not quoted
@@ -684,29 +653,28 @@ class AbstractWordEvaluator(StringWordEvaluator):
         # count-bytes?
 
         # https://stackoverflow.com/questions/17368067/length-of-string-in-bash
-        try:
-          length = string_ops.CountUtf8Chars(val.s)
-        except error.Strict as e:
-          # Add this here so we don't have to add it so far down the stack.
-          # TODO: It's better to show BOTH this CODE an the actual DATA
-          # somehow.
-          e.location = token
-
-          if self.exec_opts.strict_word_eval():
-            raise
-          else:
-            # NOTE: Doesn't make the command exit with 1; it just returns a
-            # length of -1.
-            self.errfmt.PrettyPrintError(e, prefix='warning: ')
-            return value.Str('-1')
+        if self.ascii_cache.IsAscii(val.s):
+          length = len(val.s)  # Characters are bytes
+        else:
+          try:
+            length = string_ops.CountUtf8Chars(val.s)
+          except error.Strict as e:
+            # Add this here so we don't have to add it so far down the stack.
+            # TODO: It's better to show BOTH this CODE an the actual DATA
+            # somehow.
+            e.location = token
+
+            if self.exec_opts.strict_word_eval():
+              raise
+            else:
+              # NOTE: Doesn't make the command exit with 1; it just returns a
+              # length of -1.
+              self.errfmt.PrettyPrintError(e, prefix='warning: ')
+              return value.Str('-1')
 
       elif case(value_e.MaybeStrArray):
         val = cast(value__MaybeStrArray, UP_val)
-        # There can be empty placeholder values in the array.
-        length = 0
-        for s in val.strs:
-          if s is not None:
-            length += 1
+        length = sh_array.Length(val)
 
       elif case(value_e.AssocArray):
         val = cast(value__AssocArray, UP_val)
@@ -725,20 +693,15 @@ class AbstractWordEvaluator(StringWordEvaluator):
     with tagswitch(val) as case:
       if case(value_e.MaybeStrArray):
         val = cast(value__MaybeStrArray, UP_val)
-        # translation issue: tuple indices not supported in list comprehensions
-        #indices = [str(i) for i, s in enumerate(val.strs) if s is not None]
-        indices = []  # type: List[str]
-        for i, s in enumerate(val.strs):
-          if s is not None:
-            indices.append(str(i))
-        return value.MaybeStrArray(indices)
+        indices = [str(i) for i in sh_array.Indices(val)]
+        return value.MaybeStrArray(indices, None)
 
       elif case(value_e.AssocArray):
         val = cast(value__AssocArray, UP_val)
         assert val.d is not None  # for MyPy, so it's not Optional[]
 
         # BUG: Keys aren't ordered according to insertion!
-        return value.MaybeStrArray(val.d.keys())
+        return value.MaybeStrArray(val.d.keys(), None)
 
       else:
         raise AssertionError()
@@ -788,7 +751,8 @@ class AbstractWordEvaluator(StringWordEvaluator):
       with tagswitch(val) as case:
         if case(value_e.Str):
           val = cast(value__Str, UP_val)
-          s = string_ops.DoUnarySuffixOp(val.s, op.op, arg_val.s, has_extglob)
+          s = string_ops.DoUnarySuffixOp(val.s, op.op, arg_val.s, has_extglob,
+                                          self.globs)
           #log('%r %r -> %r', val.s, arg_val.s, s)
           new_val = value.Str(s) # type: value_t
 
@@ -798,15 +762,17 @@ class AbstractWordEvaluator(StringWordEvaluator):
           strs = []  # type: List[str]
           for s in val.strs:
             if s is not None:
-              strs.append(string_ops.DoUnarySuffixOp(s, op.op, arg_val.s, has_extglob))
-          new_val = value.MaybeStrArray(strs)
+              strs.append(string_ops.DoUnarySuffixOp(s, op.op, arg_val.s,
+                                                     has_extglob, self.globs))
+          new_val = value.MaybeStrArray(strs, None)
 
         elif case(value_e.AssocArray):
           val = cast(value__AssocArray, UP_val)
           strs = []
           for s in val.d.values():
-            strs.append(string_ops.DoUnarySuffixOp(s, op.op, arg_val.s, has_extglob))
-          new_val = value.MaybeStrArray(strs)
+            strs.append(string_ops.DoUnarySuffixOp(s, op.op, arg_val.s,
+                                                     has_extglob, self.globs))
+          new_val = value.MaybeStrArray(strs, None)
 
         else:
           raise AssertionError(val.tag_())
@@ -856,14 +822,14 @@ class AbstractWordEvaluator(StringWordEvaluator):
         for s in array_val.strs:
           if s is not None:
             strs.append(replacer.Replace(s, op))
-        val = value.MaybeStrArray(strs)
+        val = value.MaybeStrArray(strs, None)
 
       elif case2(value_e.AssocArray):
         assoc_val = cast(value__AssocArray, val)
         strs = []
         for s in assoc_val.d.values():
           strs.append(replacer.Replace(s, op))
-        val = value.MaybeStrArray(strs)
+        val = value.MaybeStrArray(strs, None)
 
       else:
         raise AssertionError(val.tag_())
@@ -889,7 +855,8 @@ class AbstractWordEvaluator(StringWordEvaluator):
       arg0_val = None  # type: value__Str
       if var_name is None: # $* or $@
         arg0_val = self.mem.GetArg0()
-      val = _PerformSlice(val, begin, length, has_length, part, arg0_val)
+      val = _PerformSlice(val, begin, length, has_length, part, arg0_val,
+                        self.ascii_cache)
     except error.Strict as e:
       if self.exec_opts.strict_word_eval():
         raise
@@ -899,7 +866,7 @@ class AbstractWordEvaluator(StringWordEvaluator):
           if case2(value_e.Str):
             val = value.Str('')
           elif case2(value_e.MaybeStrArray):
-            val = value.MaybeStrArray([])
+            val = value.MaybeStrArray([], None)
           else:
             raise NotImplementedError()
     return val
@@ -979,7 +946,7 @@ class AbstractWordEvaluator(StringWordEvaluator):
         elif case2(value_e.MaybeStrArray):
           val = cast(value__MaybeStrArray, UP_val)
           # TODO: Is this a no-op?  Just leave 'val' alone.
-          val = value.MaybeStrArray(val.strs)
+          val = value.MaybeStrArray(val.strs, val.indices)
 
     elif op_id == Id.Arith_Star:
       vsub_state.join_array = True  # both ${a[*]} and "${a[*]}" decay
@@ -994,7 +961,7 @@ class AbstractWordEvaluator(StringWordEvaluator):
           val = cast(value__MaybeStrArray, UP_val)
           # TODO: Is this a no-op?  Just leave 'val' alone.
           # ${a[*]} or "${a[*]}" :  vsub_state.join_array is always true
-          val = value.MaybeStrArray(val.strs)
+          val = value.MaybeStrArray(val.strs, val.indices)
 
     else:
       raise AssertionError(op_id)  # unknown
@@ -1023,7 +990,7 @@ class AbstractWordEvaluator(StringWordEvaluator):
         index = self.arith_ev.EvalToInt(anode)
         vtest_place.index = a_index.Int(index)
 
-        s = GetArrayItem(array_val.strs, index)
+        s = sh_array.GetItem(array_val, index)
 
         if s is None:
           val = value.Undef()
@@ -1109,7 +1076,7 @@ class AbstractWordEvaluator(StringWordEvaluator):
     if self.exec_opts.nounset():
       e_die('Undefined array %r' % lexer.TokenVal(token), token)
     else:
-      return value.MaybeStrArray([])
+      return value.MaybeStrArray([], None)
 
   def _EvalBracketOp(self, val, part, quoted, vsub_state, vtest_place):
     # type: (value_t, braced_var_sub, bool, VarSubState, VTestPlace) -> value_t
@@ -1529,7 +1496,7 @@ class AbstractWordEvaluator(StringWordEvaluator):
         part = cast(Token, UP_part)
         # Split if it's in a substitution.
         # That is: echo is not split, but ${foo:-echo} is split
-        v = part_value.String(part.tval, quoted, is_subst)
+        v = part_value.String(lexer.TokenVal(part), quoted, is_subst)
         part_vals.append(v)
 
       elif case(word_part_e.EscapedLiteral):
@@ -1845,7 +1812,7 @@ class AbstractWordEvaluator(StringWordEvaluator):
         array_words = part0.words
         words = braces.BraceExpandWords(array_words)
         strs = self.EvalWordSequence(words)
-        return value.MaybeStrArray(strs)
+        return value.MaybeStrArray(strs, None)
 
       if tag == word_part_e.AssocArrayLiteral:
         part0 = cast(word_part__AssocArrayLiteral, UP_part0)
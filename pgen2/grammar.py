@@ -29,6 +29,20 @@ if TYPE_CHECKING:
   dfa_t = Tuple[states_t, first_t]
 
 
+if mylib.PYTHON:
+  def _BitSetInit(labels, num_bytes):
+    # type: (Dict[int, int], int) -> str
+    """C initializer for a bit set of labels."""
+    b = [0] * num_bytes
+    for label in labels:
+      b[label // 8] |= 1 << (label % 8)
+    return ', '.join('0x%02x' % x for x in b)
+
+  def _CBool(b):
+    # type: (bool) -> str
+    return 'true' if b else 'false'
+
+
 class Grammar(object):
     """Pgen parsing tables conversion class.
 
@@ -107,6 +121,23 @@ class Grammar(object):
         self.symbol2label = {}  # type: Dict[str, int]
         self.start = 256
 
+    # These accessors are used by oil_lang/expr_parse.py and expr_to_ast.py.
+    # In C++, they look up constant tables generated by dump_tables_cpp().
+
+    def TokenLabel(self, id_):
+        # type: (int) -> int
+        """Return the arc label for a token ID, or -1 if it's not in the grammar."""
+        return self.tokens.get(id_, -1)
+
+    def KeywordLabel(self, s):
+        # type: (str) -> int
+        """Return the arc label for a keyword like 'var', or -1."""
+        return self.keywords.get(s, -1)
+
+    def SymbolName(self, num):
+        # type: (int) -> str
+        return self.number2symbol[num]
+
     if mylib.PYTHON:
       def dump(self, f):
           # type: (IO[str]) -> None
@@ -173,6 +204,133 @@ namespace grammar_nt {
 }  // namespace grammar_nt
 """)
 
+      def dump_tables_cpp(self, f):
+          # type: (IO[str]) -> None
+          """Write the parsing tables as constant C++ arrays.
+
+          Read by cpp/pgen2.cc, which implements parse.py and the accessors
+          above without building any dicts at runtime.
+          """
+          num_labels = len(self.labels)
+          set_bytes = (num_labels + 7) // 8
+
+          f.write("""\
+// This code is generated by pgen2/grammar.py
+
+#include <stdint.h>
+
+namespace grammar_tables {
+
+const int kNumLabels = %d;
+const int kFirstSetBytes = %d;
+
+// ilabel -> token or symbol number
+constexpr int16_t kLabels[] = {
+""" % (num_labels, set_bytes))
+          for i, label in enumerate(self.labels):
+            f.write('  %d,  // %d\n' % (label, i))
+          f.write("""\
+};
+
+struct Arc {
+  int16_t label;
+  int16_t next_state;
+};
+
+struct State {
+  int16_t first_arc;
+  int16_t num_arcs;
+  bool is_final;     // has the arc (0, self)
+  bool accept_only;  // that's the only arc, so the DFA is done
+};
+
+struct Dfa {
+  int16_t first_state;
+  int16_t num_states;
+  uint8_t first_set[kFirstSetBytes];  // bit set of ilabels
+};
+
+""")
+          arcs = []  # type: List[str]
+          states = []  # type: List[str]
+          dfas = []  # type: List[str]
+          for i, dfa_states in enumerate(self.states):
+            num = 256 + i
+            _, first = self.dfas[num]
+            dfas.append('  {%d, %d, {%s}},  // %s' % (
+                len(states), len(dfa_states), _BitSetInit(first, set_bytes),
+                self.number2symbol[num]))
+
+            for state_num, state_arcs in enumerate(dfa_states):
+              is_final = (0, state_num) in state_arcs
+              accept_only = state_arcs == [(0, state_num)]
+              states.append('  {%d, %d, %s, %s},' % (
+                  len(arcs), len(state_arcs), _CBool(is_final),
+                  _CBool(accept_only)))
+              for label, next_state in state_arcs:
+                arcs.append('  {%d, %d},' % (label, next_state))
+
+          f.write('constexpr Arc kArcs[] = {\n%s\n};\n\n' % '\n'.join(arcs))
+          f.write('constexpr State kStates[] = {\n%s\n};\n\n' %
+                  '\n'.join(states))
+          f.write('// Indexed by symbol number - 256\n')
+          f.write('constexpr Dfa kDfas[] = {\n%s\n};\n\n' % '\n'.join(dfas))
+
+          names = [
+              '  "%s",' % self.number2symbol[256 + i]
+              for i in xrange(len(self.states))
+          ]
+          f.write('constexpr const char* kSymbolNames[] = {\n%s\n};\n\n' %
+                  '\n'.join(names))
+
+          # Only as big as the largest token ID in the grammar.  There are
+          # more than 256 IDs.
+          num_token_labels = max(self.tokens) + 1
+          token_labels = ['-1'] * num_token_labels
+          for id_, label in self.tokens.iteritems():
+            token_labels[id_] = str(label)
+          f.write('// Token ID -> ilabel, or -1\n')
+          f.write('const int kNumTokenLabels = %d;\n' % num_token_labels)
+          f.write('constexpr int16_t kTokenLabels[kNumTokenLabels] = {\n')
+          for i in xrange(0, num_token_labels, 16):
+            f.write('  %s,\n' % ', '.join(token_labels[i:i+16]))
+          f.write('};\n\n')
+
+          f.write("""\
+struct Keyword {
+  const char* name;
+  int len;
+  int16_t label;
+};
+
+""")
+          keywords = [
+              '  {"%s", %d, %d},' % (k, len(k), self.keywords[k])
+              for k in sorted(self.keywords)
+          ]
+          f.write('constexpr Keyword kKeywords[] = {\n%s\n};\n\n' %
+                  '\n'.join(keywords))
+          f.write('const int kNumKeywords = %d;\n\n' % len(keywords))
+
+          # The parser stack in cpp/pgen2.h stores DFA and state numbers in
+          # uint8_t, and the tables above use int16_t.  Fail to compile rather
+          # than truncate them if the grammar grows.
+          f.write("""\
+const int kNumDfas = %d;
+const int kMaxStatesPerDfa = %d;
+
+static_assert(kNumDfas <= 256, "parse::Parser::dfas_ is uint8_t");
+static_assert(kMaxStatesPerDfa <= 256, "parse::Parser::states_ is uint8_t");
+static_assert(kNumLabels <= INT16_MAX, "Arc::label is int16_t");
+static_assert(sizeof(kArcs) / sizeof(kArcs[0]) <= INT16_MAX,
+              "State::first_arc is int16_t");
+static_assert(sizeof(kStates) / sizeof(kStates[0]) <= INT16_MAX,
+              "Dfa::first_state is int16_t");
+
+""" % (len(self.states), max(len(dfa_states) for dfa_states in self.states)))
+
+          f.write('}  // namespace grammar_tables\n')
+
       MARSHAL_HEADER = 'PGEN2\n'  # arbitrary header
 
       def loads(self, s):
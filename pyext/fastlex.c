@@ -51,6 +51,60 @@ fastlex_MatchOshToken(PyObject *self, PyObject *args) {
   return Py_BuildValue("(ii)", id, end_pos);
 }
 
+// Lex up to max_tokens tokens in one mode, stopping after Eol_Tok.  The
+// (id, end_pos) pairs replace the contents of the list argument.
+static PyObject *
+fastlex_MatchOshTokens(PyObject *self, PyObject *args) {
+  int lex_mode;
+
+  unsigned char* line;
+  int line_len;
+
+  int start_pos;
+  int max_tokens;
+  PyObject* buf;
+  if (!PyArg_ParseTuple(args, "is#iiO!",
+                        &lex_mode, &line, &line_len, &start_pos, &max_tokens,
+                        &PyList_Type, &buf)) {
+    return NULL;
+  }
+
+  if (start_pos > line_len) {
+    PyErr_Format(PyExc_ValueError,
+                 "Invalid MatchOshTokens call (start_pos = %d, line_len = %d)",
+                 start_pos, line_len);
+    return NULL;
+  }
+
+  if (PyList_SetSlice(buf, 0, PyList_GET_SIZE(buf), NULL) < 0) {
+    return NULL;
+  }
+
+  int pos = start_pos;
+  for (int i = 0; i < max_tokens; ++i) {
+    int id;
+    int end_pos;
+    MatchOshToken(lex_mode, line, line_len, pos, &id, &end_pos);
+
+    PyObject* py_id = PyInt_FromLong(id);
+    PyObject* py_end_pos = PyInt_FromLong(end_pos);
+    int failed = (py_id == NULL || py_end_pos == NULL ||
+                  PyList_Append(buf, py_id) < 0 ||
+                  PyList_Append(buf, py_end_pos) < 0);
+    Py_XDECREF(py_id);
+    Py_XDECREF(py_end_pos);
+    if (failed) {
+      return NULL;
+    }
+
+    if (id == id__Eol_Tok) {
+      break;
+    }
+    pos = end_pos;
+  }
+  Py_RETURN_NONE;
+}
+
 static PyObject *
 fastlex_MatchEchoToken(PyObject *self, PyObject *args) {
   unsigned char* line;
@@ -221,6 +275,8 @@ fastlex_LooksLikeFloat(PyObject *self, PyObject *args) {
 static PyMethodDef methods[] = {
   {"MatchOshToken", fastlex_MatchOshToken, METH_VARARGS,
    "(lexer mode, line, start_pos) -> (id, end_pos)."},
+  {"MatchOshTokens", fastlex_MatchOshTokens, METH_VARARGS,
+   "(lexer mode, line, start_pos, max_tokens, list) -> None."},
   {"MatchEchoToken", fastlex_MatchEchoToken, METH_VARARGS,
    "(line, start_pos) -> (id, end_pos)."},
   {"MatchGlobToken", fastlex_MatchGlobToken, METH_VARARGS,
@@ -1,4 +1,4 @@
-from typing import Tuple
+from typing import List, Tuple
 
 def IsValidVarName(s: str) -> bool: ...
 def ShouldHijack(s: str) -> bool: ...
@@ -6,6 +6,7 @@ def LooksLikeInteger(s: str) -> bool: ...
 def LooksLikeFloat(s: str) -> bool: ...
 
 def MatchOshToken(lex_mode_enum_id: int, line: str, start_pos: int) -> Tuple[int, int]: ...
+def MatchOshTokens(lex_mode_enum_id: int, line: str, start_pos: int, max_tokens: int, buf: List[int]) -> None: ...
 def MatchPS1Token(line: str, start_pos: int) -> Tuple[int, int]: ...
 def MatchEchoToken(line: str, start_pos: int) -> Tuple[int, int]: ...
 def MatchHistoryToken(line: str, start_pos: int) -> Tuple[int, int]: ...
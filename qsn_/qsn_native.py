@@ -11,6 +11,7 @@ from _devbuild.gen.syntax_asdl import Token
 from _devbuild.gen.types_asdl import lex_mode_e, lex_mode_t
 from core.pyerror import log, p_die
 from frontend import consts
+from frontend import lexer
 
 from typing import Tuple, List, TYPE_CHECKING
 if TYPE_CHECKING:
@@ -31,20 +32,20 @@ def IsWhitespace(s):
   return True
 
 
-def Parse(lexer):
+def Parse(lx):
   # type: (Lexer) -> List[Token]
   """Given a QSN literal in a string, return the corresponding byte string.
 
   Grammar:
       qsn = SingleQuote Kind.Char* SingleQuote Whitespace? Eof_Real
   """
-  tok = lexer.Read(lex_mode_e.QSN)
+  tok = lx.Read(lex_mode_e.QSN)
   # Caller ensures this.  It's really a left single quote.
   assert tok.id == Id.Right_SingleQuote
 
   result = []  # type: List[Token]
   while True:
-    tok = lexer.Read(lex_mode_e.QSN)
+    tok = lx.Read(lex_mode_e.QSN)
     #log('tok = %s', tok)
 
     if tok.id == Id.Unknown_Tok:  # extra error
@@ -61,13 +62,13 @@ def Parse(lexer):
 
   # HACK: read in shell's SQ_C mode to get whitespace, which is disallowe
   # INSIDE QSN.  This gets Eof_Real too.
-  tok = lexer.Read(lex_mode_e.SQ_C)
+  tok = lx.Read(lex_mode_e.SQ_C)
 
   # Doesn't work because we want to allow literal newlines / tabs
   if tok.id == Id.Char_Literals:
-    if not IsWhitespace(tok.tval):
+    if not IsWhitespace(lexer.TokenVal(tok)):
       p_die("Unexpected data after closing quote", tok)
-    tok = lexer.Read(lex_mode_e.QSN)
+    tok = lx.Read(lex_mode_e.QSN)
 
   if tok.id != Id.Eof_Real:
     p_die('Unexpected token after QSN string', tok)
@@ -155,6 +155,87 @@ s1+='d'
 echo $s1 $s2
 ## stdout: abcd abc
 
+#### Append in a loop, reading the length in between
+s=''
+for i in 1 2 3 4 5; do
+  s+=x
+  echo ${#s}
+done
+echo $s
+## STDOUT:
+1
+2
+3
+4
+5
+xxxxx
+## END
+
+#### Append to two strings in a loop, and to a local
+f() {
+  local s=L
+  s+=1
+  a+=$s
+  s+=2
+  b+=$s
+}
+a=''
+b=''
+for i in 1 2; do
+  a+=A
+  b+=B
+  f
+done
+echo $a $b
+## stdout: AL1AL1 BL12BL12
+
+#### Append in a loop, then use the string as a nameref target and in unset
+s=a
+s+=b
+declare -n r=s
+s+=c
+echo $r
+r+=d
+echo $s
+s+=e
+unset -n r
+unset s
+s+=f
+echo $s
+## STDOUT:
+abc
+abcd
+f
+## END
+
+#### Append in a loop, reading and exporting in between
+s=''
+for i in 1 2 3; do
+  s+=$i
+  t=$s
+  s+='-'
+done
+echo $s $t
+export s
+s+=x
+printenv.py s
+## STDOUT:
+1-2-3- 1-2-3
+1-2-3-x
+## END
+
+#### Arrays have value semantics when appending in a loop
+a=()
+for i in 1 2 3; do
+  a+=($i)
+  b=("${a[@]}")
+done
+for x in "${a[@]}"; do
+  a+=(x$x)
+done
+echo "${a[@]}" / "${b[@]}"
+## stdout: 1 2 3 x1 x2 x3 / 1 2 3
+
 #### typeset s+= 
 
 typeset s+=foo
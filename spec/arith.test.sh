@@ -577,6 +577,25 @@ echo $(( a2 ))
 0
 ## END
  
+#### eval_unsafe_arith with the same string in a loop
+shopt -s eval_unsafe_arith
+e='i * 2 + 1'
+s=0
+for i in 1 2 3; do
+  (( s += e ))
+done
+echo $s
+a=(x y z w v u t s)
+echo ${a[e]}
+## STDOUT:
+15
+s
+## END
+## N-I dash status: 2
+## N-I dash STDOUT:
+0
+## END
+
 #### nested ternary (bug fix)
 echo $((1?2?3:4:5))
 ## STDOUT:
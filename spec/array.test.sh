@@ -538,6 +538,28 @@ argv.py "${a[99]}" "${a[100]}" "${a[101]}"
 ['1', '2', '3']
 ## END
 
+#### Very sparse array
+shopt -s eval_unsafe_arith
+a=(x)
+a[1000000000]=y
+a[500]=z
+a+=(w)
+echo len=${#a[@]}
+argv.py "${!a[@]}"
+argv.py "${a[@]}" "${a[-1]}" "${a[500]}" "${a[501]}"
+argv.py "${a[@]:1:2}"
+unset 'a[500]'
+argv.py "${!a[@]}"
+## STDOUT:
+len=4
+['0', '500', '1000000000', '1000000001']
+['x', 'z', 'y', 'w', 'w', 'z', '']
+['z', 'y']
+['0', '1000000000', '1000000001']
+## END
+## N-I mksh status: 1
+## N-I mksh stdout-json: ""
+
 #### Slice of sparse array with [@]
 # mksh doesn't support this syntax!  It's a bash extension.
 (( a[33]=1 ))
@@ -180,3 +180,15 @@ cat tmp.txt | wc -w  # each line is a single "word"
 2
 2
 ## END
+
+#### Many short-lived background jobs are all reaped
+i=0
+while test $i -lt 100; do
+  true &
+  i=$((i + 1))
+done
+wait
+echo status=$?
+## STDOUT:
+status=0
+## END
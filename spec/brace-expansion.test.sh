@@ -439,3 +439,26 @@ echo {z..3}
 BUG
 ## END
 
+
+#### for loop over a large range, with break and continue
+case $SH in dash|mksh) exit ;; esac
+
+for i in {1..100000}; do
+  if test $i -lt 3; then
+    continue
+  fi
+  echo $i
+  if test $i -eq 4; then
+    break
+  fi
+done
+for i in {003..1}; do
+  echo -n "$i "
+done
+echo
+## STDOUT:
+3
+4
+003 002 001 
+## END
+## N-I dash/mksh stdout-json: ""
@@ -121,6 +121,23 @@ echo status=$?
 ## OK mksh stdout-json: ""
 ## OK mksh status: 1
 
+#### Eval in a loop sees an alias defined after the first iteration
+shopt -s expand_aliases
+hi() { echo func; }
+for i in 1 2 3; do
+  eval 'hi
+echo $i'
+  alias hi='echo alias'
+done
+## STDOUT:
+func
+1
+alias
+2
+alias
+3
+## END
+
 #### Eval in does tilde expansion
 
 x="~"
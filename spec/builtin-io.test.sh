@@ -170,6 +170,41 @@ echo -e '\x' '\xg' | od -A n -c | sed 's/ \+/ /g'
 ## N-I dash stdout-json: " - e \\ x \\ x g \\n\n"
 ## BUG mksh/zsh stdout-json: " \\0 \\0 g \\n\n"
 
+#### echo and printf to /dev/full fail
+echo hi > /dev/full
+echo status=$?
+printf '%s\n' hi > /dev/full
+echo status=$?
+## STDOUT:
+status=1
+status=1
+## END
+
+#### Output of builtins stays in order with other processes and stderr
+{
+  echo 1
+  { sleep 0.01; echo 2; } &
+  wait
+  echo 3 >&2
+  echo 4
+  sh -c 'echo 5'
+  printf '%s\n' 6 7 > /dev/full 2>/dev/null
+  echo status=$?
+  for i in 9 10; do echo $i; done | cat
+  echo 11
+} 2>&1
+## STDOUT:
+1
+2
+3
+4
+5
+status=1
+9
+10
+11
+## END
+
 #### incomplete octal escape
 flags='-en'
 case $SH in dash) flags='-n' ;; esac
@@ -898,3 +898,16 @@ printf $'\U0z'
 ## stdout-json: "x"
 ## OK zsh stdout-repr: "x\0z\0z"
 ## N-I dash/ash stdout-json: ""
+
+#### printf reuses a format in a loop and for leftover args
+for i in 1 2; do
+  printf '[%-*s|%0*d]\n' 3 a$i 4 $i
+done
+printf '%s=%d\t' a 1 b -2; echo
+printf '%x %5.3d\n' 255 -7
+## STDOUT:
+[a1 |0001]
+[a2 |0002]
+a=1	b=-2	
+ff  -007
+## END
@@ -659,3 +659,20 @@ CODE
   ___
 ## END
 
+
+#### s+=x in a hay block
+shopt --set parse_brace
+
+hay define Package
+hay eval :result {
+  Package foo {
+    var s = 'a'
+    s+=b
+    s+=c
+  }
+}
+var attrs = result['children'][0]['attrs']
+write -- $[attrs['s']]
+## STDOUT:
+abc
+## END
@@ -368,3 +368,16 @@ EOF5
 5: fd5
 ## END
 
+#### Here doc larger than a pipe buffer
+big=$(printf '%070000d' 0)
+cat <<EOF | wc -c
+$big
+EOF
+read x <<EOF
+$big
+EOF
+echo ${#x}
+## STDOUT:
+70001
+70000
+## END
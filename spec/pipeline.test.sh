@@ -164,3 +164,64 @@ echo ${PIPESTATUS[@]}
 ## N-I zsh stdout:
 ## N-I dash status: 2
 ## N-I dash stdout-json: ""
+
+#### Builtin first stage: output, status, and function shadowing
+echo() { command echo "fn $@"; }
+echo hi | cat
+unset -f echo
+printf '%s\n' a b | wc -l
+false | true
+echo ${PIPESTATUS[@]}
+## STDOUT:
+fn hi
+2
+1 0
+## END
+## N-I dash STDOUT:
+fn hi
+2
+## END
+## N-I dash status: 2
+## N-I zsh STDOUT:
+fn hi
+2
+
+## END
+
+#### Builtin first stage gets SIGPIPE when its output doesn't fit in a pipe
+printf '%65538s\n' foo | head -c 1 > /dev/null
+echo ${PIPESTATUS[@]}
+printf '%s\n' small | head -c 1 > /dev/null
+echo ${PIPESTATUS[@]}
+printf '%65538s\n' foo | wc -c
+echo ${PIPESTATUS[@]}
+## STDOUT:
+141 0
+0 0
+65539
+0 0
+## END
+## BUG bash STDOUT:
+1 0
+0 0
+65539
+0 0
+## END
+## N-I dash status: 2
+## N-I dash stdout-json: ""
+## N-I zsh STDOUT:
+
+
+65539
+
+## END
+
+#### $BASHPID in the first stage is the stage's PID
+# OSH runs some first stages in the shell process
+parent=$BASHPID
+echo $BASHPID | { read x; test "$x" != "$parent" && echo different; }
+echo "${BASHPID}" | { read x; test "$x" != "$parent" && echo different; }
+## STDOUT:
+different
+different
+## END
@@ -313,3 +313,19 @@ argv.py ${array[@]::}
 ## N-I mksh/zsh status: 1
 ## N-I mksh/zsh status: 1
 ## N-I mksh/zsh stdout-json: ""
+
+#### Slice ASCII and UTF-8 strings one character at a time
+case $SH in (dash) exit ;; esac
+
+for s in 'hello' $'hμllo'; do
+  out=''
+  for ((i = 0; i < ${#s}; i++)); do
+    out="$out${s:i:1}-"
+  done
+  echo "${#s} $out ${s: -3:2}"
+done
+## STDOUT:
+5 h-e-l-l-o- ll
+5 h-μ-l-l-o- ll
+## END
+## N-I dash stdout-json: ""
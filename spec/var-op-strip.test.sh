@@ -355,3 +355,17 @@ echo 4 ${x##*(foo|bar)'()'}
 4
 ## END
 ## N-I dash/zsh/ash stdout-json: ""
+
+#### Strip the same patterns in a loop
+case $SH in (dash|ash) exit ;; esac
+
+shopt -s extglob
+for path in /usr/lib/libc.so.6 foo.tar.gz bar; do
+  echo "${path##*/} ${path#*.} ${path%.*} ${path%%@(.so|.tar)*}"
+done
+## STDOUT:
+libc.so.6 so.6 /usr/lib/libc.so /usr/lib/libc
+foo.tar.gz tar.gz foo.tar foo
+bar bar bar bar
+## END
+## N-I dash/ash stdout-json: ""
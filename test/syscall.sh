@@ -292,6 +292,38 @@ EOF
   summarize $suite 0 0
 }
 
+# Builtins like echo batch their output, and the shell flushes it before
+# another process can write to stdout.  So where bash makes one write() per
+# echo, osh should make one writev() per 8 KiB.
+echo-writes() {
+  local n=${1:-1000}
+
+  if ! strace true; then
+    echo "Aborting because we couldn't run strace"
+    return
+  fi
+
+  local code_str="for i in \$(seq $n); do echo \$i; done"
+
+  for sh in bash dash osh _bin/cxx-opt/osh; do
+    case $sh in
+      (osh)
+        sh="env PYTHONPATH=$REPO_ROOT:$REPO_ROOT/vendor $REPO_ROOT/bin/oil.py osh"
+        ;;
+      (_bin/*)
+        if ! test -f $sh; then
+          continue
+        fi
+        ;;
+    esac
+
+    echo "--- $sh"
+    # strace -c prints the table to stderr.  The shell's output goes to a file,
+    # not a terminal, like in a script.
+    strace -c -e trace=write,writev -- $sh -c "$code_str" > _tmp/echo-writes.txt
+  done
+}
+
 readonly MAX_CASES=100
 #readonly MAX_CASES=3
 
@@ -0,0 +1,15 @@
+#!/bin/sh
+#
+# Pipelines whose first stage is a builtin, as in 'echo $x | read y'.  OSH
+# runs such stages without forking, unless the output is more than a pipe
+# holds.  The last stage always runs in the shell.
+
+n=${1:-2000}
+
+i=0
+while test $i -lt $n; do
+  echo "$i" | read x
+  printf '%s\n' "$i" a b | wc -l > /dev/null
+  i=$((i + 1))
+done
+echo "$i iterations"
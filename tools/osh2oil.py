@@ -135,15 +135,17 @@ def PrintArena(arena):
 def PrintSpans(arena):
   # type: (alloc.Arena) -> None
   """Just to see spans."""
-  if len(arena.tokens) == 1:  # Special case for line_id == -1
+  num_tokens = arena.LastSpanId()
+  if num_tokens == 1:  # Special case for line_id == -1
     print('Empty file with EOF span on invalid line:')
-    print('%s' % arena.tokens[0])
+    print('%s' % arena.GetToken(0))
     return
 
-  for i, span in enumerate(arena.tokens):
+  for i in xrange(num_tokens):
+    span = arena.GetToken(i)
     piece = span.line.content[span.col : span.col + span.length]
     print('%5d %r' % (i, piece))
-  print_stderr('(%d tokens)' % len(arena.tokens))
+  print_stderr('(%d tokens)' % num_tokens)
 
 
 def PrintAsOil(arena, node):
@@ -966,7 +968,7 @@ class OilPrinter(object):
           # Hm is this necessary though?  I think the only motivation is changing
           # \{ and \( for macros.  And ' ' to be readable/visible.
           t = node.token
-          val = t.tval[1:]
+          val = lexer.TokenVal(t)[1:]
           assert len(val) == 1, val
           if val != '\n':
             self.cursor.PrintUntil(t.span_id)